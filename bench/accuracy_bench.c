@@ -0,0 +1,967 @@
+/*
+ * Measures the error and throughput of every function in vecmath.h, matmath.h and
+ * transforms.h, for whichever profile (and LAC_ISA level) this was built and run with.
+ *
+ * Each function is run over the same randomized inputs in every build, and each output
+ * is compared against a reference computed in double precision from the same float
+ * inputs. Errors are given in units in the last place (ULPs). A result which is a sum
+ * of products (a dot product, a matrix product, ...) can cancel to nearly 0, and then
+ * can't be expected to keep its relative precision, so for these a ULP is taken relative
+ * to the largest sum of the magnitudes of the terms. Otherwise, a ULP is taken relative to
+ * the largest component of the reference result, or for results marked per_component,
+ * to each component. Functions whose outputs have no closed-form reference, such as
+ * lac_decompose_mat4(), instead give an error function that measures how far their
+ * outputs are from satisfying what they promise, e.g. how far the decomposed parts are
+ * from composing back into the input. Functions over arrays are timed over all of the
+ * inputs in one call. Each function is run once to warm up, and then timed as the best
+ * of REPETITIONS runs. `make accuracy` builds and runs this for each profile in
+ * ACCURACY_PROFILES and each level in ACCURACY_ISAS.
+ *
+ * usage: accuracy_bench [count]
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+
+#include "lac_common.h"
+#include "vecmath.h"
+#include "matmath.h"
+#include "transforms.h"
+#include "dispatch.h"
+
+#define DEFAULT_COUNT (256 * 1024)
+#define MAX_IN 32
+#define MAX_OUT 32
+#define TAU 6.283185307179586
+#define REPETITIONS 5
+
+typedef struct {
+    const char *name;
+    size_t in_len;
+    size_t out_len;
+    /* Measure each output against its own magnitude, for results whose components are unrelated */
+    bool per_component;
+    /* Turns uniform values in [-1, 1] into valid inputs, in place; may be NULL */
+    void (*prepare)(float *in);
+    void (*run)(float *out, const float *in);
+    /* Returns the magnitude of the summed terms, or 0 if the result is not a sum of products */
+    double (*ref)(double *out, const float *in);
+    /* Used in place of run for array functions, over __count__ inputs of in_len and outputs of out_len */
+    void (*run_batch)(float *out, const float *in, const size_t count);
+    /* Used in place of ref; returns the error of one output in ULPs, or a negative value if it isn't finite */
+    double (*error)(const float *out, const float *in);
+} Case_t;
+
+static double get_time_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ts.tv_sec * 1000.0) + (ts.tv_nsec / 1000000.0);
+}
+
+/* Runs one function over all __count__ inputs; array functions take theirs back to back */
+static void run_case(const Case_t *kase, float *out, const float *in, const size_t count) {
+    size_t i;
+
+    if (kase->run_batch != NULL) {
+        kase->run_batch(out, in, count);
+        return;
+    }
+    for (i = 0; i < count; ++i) {
+        kase->run(&out[i * MAX_OUT], &in[i * MAX_IN]);
+    }
+}
+
+/* xorshift64*, so that every build sees the same inputs */
+static uint64_t rng_state = 0x9E3779B97F4A7C15u;
+
+static float random_unit(void) {
+    rng_state ^= rng_state >> 12;
+    rng_state ^= rng_state << 25;
+    rng_state ^= rng_state >> 27;
+    return (float)((double)((rng_state * 0x2545F4914F6CDD1Du) >> 11) / 4503599627370496.0) - 1.0f;
+}
+
+/* Gets the element in row r and column c of an n x n matrix, respecting LAC_IS_ROW_MAJOR */
+static double element(const float *m, const size_t n, const size_t r, const size_t c) {
+    return LAC_IS_ROW_MAJOR ? m[(r * n) + c] : m[(c * n) + r];
+}
+
+static void set_element(double *m, const size_t n, const size_t r, const size_t c, const double value) {
+    m[LAC_IS_ROW_MAJOR ? ((r * n) + c) : ((c * n) + r)] = value;
+}
+
+/**
+ * @brief Checks that __x__ is neither infinite nor NaN, in a way that survives -ffinite-math-only.
+ */
+static bool is_finite(const float x) {
+    uint32_t bits;
+
+    memcpy(&bits, &x, sizeof(bits));
+    return ((bits >> 23) & 0xFFu) != 0xFFu;
+}
+
+/**
+ * @brief Gets the size of a ULP of a float with the magnitude of __x__.
+ */
+static double get_ulp(const double x) {
+    int exponent;
+
+    if (x == 0.0) {
+        return ldexp(1.0, -149);
+    }
+    frexp(x, &exponent);
+    return ldexp(1.0, ((exponent - 1) < -126 ? -126 : (exponent - 1)) - 23);
+}
+
+/* Input preparation */
+
+static void prepare_scale(float *in, const size_t count, const float scale) {
+    size_t i;
+
+    for (i = 0; i < count; ++i) {
+        in[i] *= scale;
+    }
+}
+
+/* Vectors in [-100, 100], followed by a divisor or factor in [0.5, 100] */
+#define PREPARE_SCALAR(n) \
+    static void prepare_scalar_##n(float *in) { \
+        prepare_scale(in, n, 100.0f); \
+        in[n] = 0.5f + (99.5f * 0.5f * (in[n] + 1.0f)); \
+    }
+PREPARE_SCALAR(2)
+PREPARE_SCALAR(3)
+PREPARE_SCALAR(4)
+
+/* Two vectors in [-100, 100], followed by an interpolation factor in [0, 1] */
+#define PREPARE_LERP(n) \
+    static void prepare_lerp_##n(float *in) { \
+        prepare_scale(in, 2 * n, 100.0f); \
+        in[2 * n] = 0.5f * (in[2 * n] + 1.0f); \
+    }
+PREPARE_LERP(2)
+PREPARE_LERP(3)
+PREPARE_LERP(4)
+
+static void prepare_vectors(float *in) {
+    prepare_scale(in, MAX_IN, 100.0f);
+}
+
+static void prepare_angles(float *in) {
+    prepare_scale(in, MAX_IN, (float)TAU);
+}
+
+static void prepare_polar(float *in) {
+    in[0] = 50.0f * (in[0] + 1.0f);
+    in[1] *= (float)TAU;
+}
+
+static void prepare_projection(float *in) {
+    in[0] = 1.25f + (0.75f * in[0]);
+    in[1] = 1.4f + in[1];
+    in[2] = 0.5f + (0.49f * in[2]);
+    in[3] = 500.0f + (490.0f * in[3]);
+}
+
+/* A rotation about each axis followed by a translation, which is what lac_invert_mat4() accepts */
+static void prepare_rigid(float *in) {
+    mat4 m_rot;
+
+    lac_get_rotation_mat4(m_rot, in[0] * (float)TAU, in[1] * (float)TAU, in[2] * (float)TAU);
+    m_rot[3] = 100.0f * in[3];
+    m_rot[7] = 100.0f * in[4];
+    m_rot[11] = 100.0f * in[5];
+    memcpy(in, m_rot, sizeof(mat4));
+}
+
+/* translation * rotation * shear * scale, as taken apart by lac_decompose_mat4(), with the x axis sometimes reflected */
+static void prepare_affine(float *in) {
+    mat4 m_translation, m_rotation, m_shear, m_scale, m_tmp;
+    size_t i;
+
+    lac_get_translation_mat4(m_translation, 100.0f * in[0], 100.0f * in[1], 100.0f * in[2]);
+    lac_get_rotation_mat4(m_rotation, in[3] * (float)TAU, in[4] * (float)TAU, in[5] * (float)TAU);
+    memcpy(m_shear, lac_ident_mat4, sizeof(mat4));
+#if LAC_IS_ROW_MAJOR
+    m_shear[1] = 0.5f * in[6];
+    m_shear[2] = 0.5f * in[7];
+    m_shear[6] = 0.5f * in[8];
+#else
+    m_shear[4] = 0.5f * in[6];
+    m_shear[8] = 0.5f * in[7];
+    m_shear[9] = 0.5f * in[8];
+#endif
+    lac_get_scalar_mat4(m_scale, exp2f(2.0f * in[9]), exp2f(2.0f * in[10]), exp2f(2.0f * in[11]));
+    if (in[12] < 0.0f) {
+        m_scale[0] = -m_scale[0];
+    }
+
+    lac_multiply_mat4(m_tmp, m_shear, m_scale);
+    lac_multiply_mat4(m_shear, m_rotation, m_tmp);
+    lac_multiply_mat4(m_tmp, m_translation, m_shear);
+    for (i = 0; i < 16; ++i) {
+        in[i] = m_tmp[i];
+    }
+}
+
+/* A rotation whose axes have drifted by up to 1e-3, as after many small incremental updates */
+static void drift_rotation(mat4 m_out, const float *in) {
+    size_t r, c;
+
+    lac_get_rotation_mat4(m_out, in[0] * (float)TAU, in[1] * (float)TAU, in[2] * (float)TAU);
+    for (r = 0; r < 3; ++r) {
+        for (c = 0; c < 3; ++c) {
+            m_out[(r * 4) + c] += 1e-3f * in[3 + (r * 3) + c];
+        }
+    }
+}
+
+static void prepare_drifted_mat3(float *in) {
+    mat4 m_rot;
+    size_t r, c;
+
+    drift_rotation(m_rot, in);
+    for (r = 0; r < 3; ++r) {
+        for (c = 0; c < 3; ++c) {
+            in[(r * 3) + c] = m_rot[(r * 4) + c];
+        }
+    }
+}
+
+static void prepare_drifted_mat4(float *in) {
+    mat4 m_rot;
+
+    drift_rotation(m_rot, in);
+    m_rot[3] = 100.0f * in[12];
+    m_rot[7] = 100.0f * in[13];
+    m_rot[11] = 100.0f * in[14];
+    memcpy(in, m_rot, sizeof(mat4));
+}
+
+/* Vector references */
+
+static double ref_add(double *out, const float *in, const size_t n, const double sign) {
+    size_t i;
+
+    for (i = 0; i < n; ++i) {
+        out[i] = (double)in[i] + (sign * (double)in[n + i]);
+    }
+    return 0.0;
+}
+
+static double ref_scale(double *out, const float *in, const size_t n, const bool divide) {
+    size_t i;
+
+    for (i = 0; i < n; ++i) {
+        out[i] = divide ? ((double)in[i] / in[n]) : ((double)in[i] * in[n]);
+    }
+    return 0.0;
+}
+
+static double ref_lerp(double *out, const float *in, const size_t n) {
+    const double t = in[2 * n];
+    double terms = 0.0;
+    size_t i;
+
+    for (i = 0; i < n; ++i) {
+        out[i] = (double)in[i] + (t * ((double)in[n + i] - in[i]));
+        terms = fmax(terms, fabs((double)in[i]) + fabs((double)in[n + i]));
+    }
+    return terms;
+}
+
+static double ref_vec_mat(double *out, const float *in, const size_t n) {
+    double terms, scale = 0.0;
+    size_t r, c;
+
+    for (r = 0; r < n; ++r) {
+        out[r] = 0.0;
+        terms = 0.0;
+        for (c = 0; c < n; ++c) {
+            out[r] += element(&in[n], n, r, c) * in[c];
+            terms += fabs(element(&in[n], n, r, c) * in[c]);
+        }
+        scale = fmax(scale, terms);
+    }
+    return scale;
+}
+
+static double ref_dot_n(const float *a, const float *b, const size_t n) {
+    double sum = 0.0;
+    size_t i;
+
+    for (i = 0; i < n; ++i) {
+        sum += (double)a[i] * b[i];
+    }
+    return sum;
+}
+
+static double ref_dot_terms(double *out, const float *in, const size_t n) {
+    double terms = 0.0;
+    size_t i;
+
+    out[0] = ref_dot_n(in, &in[n], n);
+    for (i = 0; i < n; ++i) {
+        terms += fabs((double)in[i] * in[n + i]);
+    }
+    return terms;
+}
+
+static double ref_normalize(double *out, const float *in, const size_t n) {
+    const double magnitude = sqrt(ref_dot_n(in, in, n));
+    size_t i;
+
+    for (i = 0; i < n; ++i) {
+        out[i] = (double)in[i] / magnitude;
+    }
+    return 0.0;
+}
+
+#define VEC_CASES(n) \
+    static void run_add_vec##n(float *out, const float *in) { lac_add_vec##n(out, in, &in[n]); } \
+    static double ref_add_vec##n(double *out, const float *in) { return ref_add(out, in, n, 1.0); } \
+    static void run_subtract_vec##n(float *out, const float *in) { lac_subtract_vec##n(out, in, &in[n]); } \
+    static double ref_subtract_vec##n(double *out, const float *in) { return ref_add(out, in, n, -1.0); } \
+    static void run_multiply_vec##n(float *out, const float *in) { lac_multiply_vec##n(out, in, in[n]); } \
+    static double ref_multiply_vec##n(double *out, const float *in) { return ref_scale(out, in, n, false); } \
+    static void run_divide_vec##n(float *out, const float *in) { lac_divide_vec##n(out, in, in[n]); } \
+    static double ref_divide_vec##n(double *out, const float *in) { return ref_scale(out, in, n, true); } \
+    static void run_lerp_vec##n(float *out, const float *in) { lac_lerp_vec##n(out, in, &in[n], in[2 * n]); } \
+    static double ref_lerp_vec##n(double *out, const float *in) { return ref_lerp(out, in, n); } \
+    static void run_multiply_vec##n##_mat##n(float *out, const float *in) { lac_multiply_vec##n##_mat##n(out, in, &in[n]); } \
+    static double ref_multiply_vec##n##_mat##n(double *out, const float *in) { return ref_vec_mat(out, in, n); } \
+    static void run_calc_dot_prod_vec##n(float *out, const float *in) { lac_calc_dot_prod_vec##n(out, in, &in[n]); } \
+    static double ref_calc_dot_prod_vec##n(double *out, const float *in) { return ref_dot_terms(out, in, n); } \
+    static void run_calc_magnitude_vec##n(float *out, const float *in) { lac_calc_magnitude_vec##n(out, in); } \
+    static double ref_calc_magnitude_vec##n(double *out, const float *in) { out[0] = sqrt(ref_dot_n(in, in, n)); return 0.0; } \
+    static void run_normalize_vec##n(float *out, const float *in) { lac_normalize_vec##n(out, in); } \
+    static double ref_normalize_vec##n(double *out, const float *in) { return ref_normalize(out, in, n); }
+VEC_CASES(2)
+VEC_CASES(3)
+VEC_CASES(4)
+
+static void run_calc_cross_prod(float *out, const float *in) {
+    lac_calc_cross_prod(out, in, &in[3]);
+}
+
+static double ref_calc_cross_prod(double *out, const float *in) {
+    out[0] = ((double)in[1] * in[5]) - ((double)in[2] * in[4]);
+    out[1] = ((double)in[2] * in[3]) - ((double)in[0] * in[5]);
+    out[2] = ((double)in[0] * in[4]) - ((double)in[1] * in[3]);
+    return fmax(fmax(fabs((double)in[1] * in[5]), fabs((double)in[2] * in[4])),
+                fmax(fmax(fabs((double)in[2] * in[3]), fabs((double)in[0] * in[5])),
+                     fmax(fabs((double)in[0] * in[4]), fabs((double)in[1] * in[3]))));
+}
+
+static void run_polar_to_cartesian(float *out, const float *in) {
+    lac_polar_to_cartesian(out, in[0], in[1]);
+}
+
+static double ref_polar_to_cartesian(double *out, const float *in) {
+    out[0] = in[0] * cos((double)in[1]);
+    out[1] = in[0] * sin((double)in[1]);
+    return 0.0;
+}
+
+static void run_cartesian_to_polar(float *out, const float *in) {
+    lac_cartesian_to_polar(&out[0], &out[1], in);
+}
+
+static double ref_cartesian_to_polar(double *out, const float *in) {
+    out[0] = sqrt(ref_dot_n(in, in, 2));
+    out[1] = atan2((double)in[1], (double)in[0]);
+    return 0.0;
+}
+
+/* Matrix references */
+
+static double ref_mat_mul(double *out, const float *m_a, const float *m_b, const size_t n) {
+    double sum, terms, scale = 0.0;
+    size_t r, c, k;
+
+    for (r = 0; r < n; ++r) {
+        for (c = 0; c < n; ++c) {
+            sum = 0.0;
+            terms = 0.0;
+            for (k = 0; k < n; ++k) {
+                sum += element(m_a, n, r, k) * element(m_b, n, k, c);
+                terms += fabs(element(m_a, n, r, k) * element(m_b, n, k, c));
+            }
+            set_element(out, n, r, c, sum);
+            scale = fmax(scale, terms);
+        }
+    }
+    return scale;
+}
+
+static double ref_transpose(double *out, const float *in, const size_t n) {
+    size_t r, c;
+
+    for (r = 0; r < n; ++r) {
+        for (c = 0; c < n; ++c) {
+            out[(c * n) + r] = in[(r * n) + c];
+        }
+    }
+    return 0.0;
+}
+
+#define MAT_CASES(n) \
+    static void run_add_mat##n(float *out, const float *in) { lac_add_mat##n(out, in, &in[n * n]); } \
+    static double ref_add_mat##n(double *out, const float *in) { return ref_add(out, in, n * n, 1.0); } \
+    static void run_subtract_mat##n(float *out, const float *in) { lac_subtract_mat##n(out, in, &in[n * n]); } \
+    static double ref_subtract_mat##n(double *out, const float *in) { return ref_add(out, in, n * n, -1.0); } \
+    static void run_multiply_mat##n(float *out, const float *in) { lac_multiply_mat##n(out, in, &in[n * n]); } \
+    static double ref_multiply_mat##n(double *out, const float *in) { return ref_mat_mul(out, in, &in[n * n], n); } \
+    static void run_transpose_mat##n(float *out, const float *in) { lac_transpose_mat##n(out, in); } \
+    static double ref_transpose_mat##n(double *out, const float *in) { return ref_transpose(out, in, n); }
+MAT_CASES(2)
+MAT_CASES(3)
+MAT_CASES(4)
+
+/* Transform references, written out in the same (row-major) order as transforms.c */
+
+static void ref_diagonal(double *out, const size_t n, const double *diagonal) {
+    size_t i;
+
+    memset(out, 0, n * n * sizeof(double));
+    for (i = 0; i < n; ++i) {
+        out[(i * n) + i] = diagonal[i];
+    }
+}
+
+static void run_get_reflection_mat2(float *out, const float *in) {
+    lac_get_reflection_mat2(out, in[0] > 0.0f, in[1] > 0.0f);
+}
+
+static double ref_get_reflection_mat2(double *out, const float *in) {
+    const double diagonal[2] = { (in[0] > 0.0f) ? -1.0 : 1.0, (in[1] > 0.0f) ? -1.0 : 1.0 };
+    ref_diagonal(out, 2, diagonal);
+    return 0.0;
+}
+
+static void run_get_reflection_mat3(float *out, const float *in) {
+    lac_get_reflection_mat3(out, in[0] > 0.0f, in[1] > 0.0f, in[2] > 0.0f);
+}
+
+static double ref_get_reflection_mat3(double *out, const float *in) {
+    const double diagonal[3] = { (in[0] > 0.0f) ? -1.0 : 1.0, (in[1] > 0.0f) ? -1.0 : 1.0, (in[2] > 0.0f) ? -1.0 : 1.0 };
+    ref_diagonal(out, 3, diagonal);
+    return 0.0;
+}
+
+static void run_get_reflection_mat4(float *out, const float *in) {
+    lac_get_reflection_mat4(out, in[0] > 0.0f, in[1] > 0.0f, in[2] > 0.0f);
+}
+
+static double ref_get_reflection_mat4(double *out, const float *in) {
+    const double diagonal[4] = { (in[0] > 0.0f) ? -1.0 : 1.0, (in[1] > 0.0f) ? -1.0 : 1.0, (in[2] > 0.0f) ? -1.0 : 1.0, 1.0 };
+    ref_diagonal(out, 4, diagonal);
+    return 0.0;
+}
+
+static void run_get_translation_mat2(float *out, const float *in) {
+    lac_get_translation_mat2(out, in[0]);
+}
+
+static double ref_get_translation_mat2(double *out, const float *in) {
+    const double diagonal[2] = { 1.0, 1.0 };
+    ref_diagonal(out, 2, diagonal);
+    out[1] = in[0];
+    return 0.0;
+}
+
+static void run_get_translation_mat3(float *out, const float *in) {
+    lac_get_translation_mat3(out, in[0], in[1]);
+}
+
+static double ref_get_translation_mat3(double *out, const float *in) {
+    const double diagonal[3] = { 1.0, 1.0, 1.0 };
+    ref_diagonal(out, 3, diagonal);
+    out[2] = in[0];
+    out[5] = in[1];
+    return 0.0;
+}
+
+static void run_get_translation_mat4(float *out, const float *in) {
+    lac_get_translation_mat4(out, in[0], in[1], in[2]);
+}
+
+static double ref_get_translation_mat4(double *out, const float *in) {
+    const double diagonal[4] = { 1.0, 1.0, 1.0, 1.0 };
+    ref_diagonal(out, 4, diagonal);
+    out[3] = in[0];
+    out[7] = in[1];
+    out[11] = in[2];
+    return 0.0;
+}
+
+static void run_get_scalar_mat2(float *out, const float *in) {
+    lac_get_scalar_mat2(out, in[0], in[1]);
+}
+
+static double ref_get_scalar_mat2(double *out, const float *in) {
+    const double diagonal[2] = { in[0], in[1] };
+    ref_diagonal(out, 2, diagonal);
+    return 0.0;
+}
+
+static void run_get_scalar_mat3(float *out, const float *in) {
+    lac_get_scalar_mat3(out, in[0], in[1], in[2]);
+}
+
+static double ref_get_scalar_mat3(double *out, const float *in) {
+    const double diagonal[3] = { in[0], in[1], in[2] };
+    ref_diagonal(out, 3, diagonal);
+    return 0.0;
+}
+
+static void run_get_scalar_mat4(float *out, const float *in) {
+    lac_get_scalar_mat4(out, in[0], in[1], in[2]);
+}
+
+static double ref_get_scalar_mat4(double *out, const float *in) {
+    const double diagonal[4] = { in[0], in[1], in[2], 1.0 };
+    ref_diagonal(out, 4, diagonal);
+    return 0.0;
+}
+
+/* Rotation about axis 0 (roll, x), 1 (pitch, y) or 2 (yaw, z) */
+static void ref_axis_rotation(double *out, const size_t axis, const double angle) {
+    const double diagonal[4] = { 1.0, 1.0, 1.0, 1.0 };
+    const size_t a = (axis + 1) % 3, b = (axis + 2) % 3;
+
+    ref_diagonal(out, 4, diagonal);
+    out[(a * 4) + a] = cos(angle);
+    out[(b * 4) + b] = cos(angle);
+    out[(a * 4) + b] = -sin(angle);
+    out[(b * 4) + a] = sin(angle);
+}
+
+static void run_get_yaw_mat4(float *out, const float *in) {
+    lac_get_yaw_mat4(out, in[0]);
+}
+
+static double ref_get_yaw_mat4(double *out, const float *in) {
+    ref_axis_rotation(out, 2, in[0]);
+    return 0.0;
+}
+
+static void run_get_pitch_mat4(float *out, const float *in) {
+    lac_get_pitch_mat4(out, in[0]);
+}
+
+static double ref_get_pitch_mat4(double *out, const float *in) {
+    ref_axis_rotation(out, 1, in[0]);
+    return 0.0;
+}
+
+static void run_get_roll_mat4(float *out, const float *in) {
+    lac_get_roll_mat4(out, in[0]);
+}
+
+static double ref_get_roll_mat4(double *out, const float *in) {
+    ref_axis_rotation(out, 0, in[0]);
+    return 0.0;
+}
+
+static void run_get_rotation_mat4(float *out, const float *in) {
+    lac_get_rotation_mat4(out, in[0], in[1], in[2]);
+}
+
+static double ref_get_rotation_mat4(double *out, const float *in) {
+    double yaw[16], pitch[16], roll[16], tmp[16];
+    size_t r, c, k;
+
+    ref_axis_rotation(yaw, 2, in[2]);
+    ref_axis_rotation(pitch, 1, in[1]);
+    ref_axis_rotation(roll, 0, in[0]);
+    for (r = 0; r < 4; ++r) {
+        for (c = 0; c < 4; ++c) {
+            tmp[(r * 4) + c] = 0.0;
+            for (k = 0; k < 4; ++k) {
+                tmp[(r * 4) + c] += yaw[(r * 4) + k] * pitch[(k * 4) + c];
+            }
+        }
+    }
+    for (r = 0; r < 4; ++r) {
+        for (c = 0; c < 4; ++c) {
+            out[(r * 4) + c] = 0.0;
+            for (k = 0; k < 4; ++k) {
+                out[(r * 4) + c] += tmp[(r * 4) + k] * roll[(k * 4) + c];
+            }
+        }
+    }
+    return 0.0;
+}
+
+static void run_get_projection_mat4(float *out, const float *in) {
+    lac_get_projection_mat4(out, in[0], in[1], in[2], in[3]);
+}
+
+static double ref_get_projection_mat4(double *out, const float *in) {
+    const double f = 1.0 / tan((double)in[1] / 2.0);
+    const double znear = in[2], zfar = in[3];
+
+    memset(out, 0, 16 * sizeof(double));
+    out[0] = f / in[0];
+    out[5] = f;
+    out[10] = (zfar + znear) / (znear - zfar);
+    out[11] = -1.0;
+    out[14] = (2.0 * zfar * znear) / (znear - zfar);
+    return 0.0;
+}
+
+static void run_get_point_at_mat4(float *out, const float *in) {
+    lac_get_point_at_mat4(out, in, &in[3], &in[6]);
+}
+
+static double ref_get_point_at_mat4(double *out, const float *in) {
+    double forward[3], up[3], right[3], dot = 0.0, magnitude = 0.0;
+    size_t i;
+
+    for (i = 0; i < 3; ++i) {
+        forward[i] = (double)in[3 + i] - in[i];
+        magnitude += forward[i] * forward[i];
+    }
+    for (i = 0; i < 3; ++i) {
+        forward[i] /= sqrt(magnitude);
+        dot += in[6 + i] * forward[i];
+    }
+    magnitude = 0.0;
+    for (i = 0; i < 3; ++i) {
+        up[i] = in[6 + i] - (forward[i] * dot);
+        magnitude += up[i] * up[i];
+    }
+    for (i = 0; i < 3; ++i) {
+        up[i] /= sqrt(magnitude);
+    }
+    right[0] = (up[1] * forward[2]) - (up[2] * forward[1]);
+    right[1] = (up[2] * forward[0]) - (up[0] * forward[2]);
+    right[2] = (up[0] * forward[1]) - (up[1] * forward[0]);
+
+    memset(out, 0, 16 * sizeof(double));
+    for (i = 0; i < 3; ++i) {
+        out[(i * 4) + 0] = right[i];
+        out[(i * 4) + 1] = up[i];
+        out[(i * 4) + 2] = forward[i];
+        out[(i * 4) + 3] = in[i];
+    }
+    out[15] = 1.0;
+    return 0.0;
+}
+
+static void run_invert_mat4(float *out, const float *in) {
+    lac_invert_mat4(out, in);
+}
+
+static double ref_invert_mat4(double *out, const float *in) {
+    size_t r, c;
+
+    memset(out, 0, 16 * sizeof(double));
+    for (r = 0; r < 3; ++r) {
+        for (c = 0; c < 3; ++c) {
+            out[(r * 4) + c] = in[(c * 4) + r];
+        }
+        out[(r * 4) + 3] = -(((double)in[3] * in[r]) + ((double)in[7] * in[4 + r]) + ((double)in[11] * in[8 + r]));
+    }
+    out[15] = 1.0;
+    return 0.0;
+}
+
+/* Decompositions, measured by composing the parts back together */
+
+#define PARTS_LEN (sizeof(LacTransformParts_t) / sizeof(float))
+
+static void run_decompose_mat4(float *out, const float *in) {
+    LacTransformParts_t parts;
+
+    lac_decompose_mat4(&parts, in);
+    memcpy(out, &parts, sizeof(parts));
+}
+
+static void run_decompose_mat4_array(float *out, const float *in, const size_t count) {
+    lac_decompose_mat4_array((LacTransformParts_t *)out, (const mat4 *)in, count);
+}
+
+/*
+ * Builds translation * rotation * shear * scale from the parts in double precision, and
+ * compares it against the input. Each column is measured against its own largest element,
+ * so that the translation doesn't hide errors in the much smaller axes.
+ */
+static double error_decompose(const float *out, const float *in) {
+    LacTransformParts_t parts;
+    double q[4], rotation[3][3], error[4] = { 0.0 }, scale[4] = { 0.0 }, linear, worst = 0.0;
+    size_t r, c, k;
+
+    memcpy(&parts, out, sizeof(parts));
+    for (k = 0; k < 3; ++k) {
+        if (!is_finite(parts.translation[k]) || !is_finite(parts.scale[k]) || !is_finite(parts.shear[k])) {
+            return -1.0;
+        }
+    }
+    for (k = 0; k < 4; ++k) {
+        if (!is_finite(parts.rotation[k])) {
+            return -1.0;
+        }
+        q[k] = parts.rotation[k];
+    }
+
+    rotation[0][0] = 1.0 - (2.0 * ((q[1] * q[1]) + (q[2] * q[2])));
+    rotation[0][1] = 2.0 * ((q[0] * q[1]) - (q[2] * q[3]));
+    rotation[0][2] = 2.0 * ((q[0] * q[2]) + (q[1] * q[3]));
+    rotation[1][0] = 2.0 * ((q[0] * q[1]) + (q[2] * q[3]));
+    rotation[1][1] = 1.0 - (2.0 * ((q[0] * q[0]) + (q[2] * q[2])));
+    rotation[1][2] = 2.0 * ((q[1] * q[2]) - (q[0] * q[3]));
+    rotation[2][0] = 2.0 * ((q[0] * q[2]) - (q[1] * q[3]));
+    rotation[2][1] = 2.0 * ((q[1] * q[2]) + (q[0] * q[3]));
+    rotation[2][2] = 1.0 - (2.0 * ((q[0] * q[0]) + (q[1] * q[1])));
+
+    for (r = 0; r < 3; ++r) {
+        for (c = 0; c < 3; ++c) {
+            /* rotation * shear, where the shear has xy, xz and yz above a unit diagonal */
+            linear = rotation[r][c];
+            if (c >= 1) {
+                linear += rotation[r][0] * parts.shear[c - 1];
+            }
+            if (c == 2) {
+                linear += rotation[r][1] * parts.shear[2];
+            }
+            linear *= parts.scale[c];
+            error[c] = fmax(error[c], fabs(linear - element(in, 4, r, c)));
+            scale[c] = fmax(scale[c], fabs(element(in, 4, r, c)));
+        }
+        error[3] = fmax(error[3], fabs((double)parts.translation[r] - element(in, 4, r, 3)));
+        scale[3] = fmax(scale[3], fabs(element(in, 4, r, 3)));
+    }
+    for (c = 0; c < 4; ++c) {
+        worst = fmax(worst, error[c] / get_ulp(scale[c]));
+    }
+
+    return worst;
+}
+
+/* Orthonormalizations, measured by how far the transpose times the result is from the identity */
+
+static void run_orthonormalize_mat3_array_gram_schmidt(float *out, const float *in, const size_t count) {
+    lac_orthonormalize_mat3_array((mat3 *)out, (const mat3 *)in, count, LAC_ORTHONORMALIZE_GRAM_SCHMIDT);
+}
+
+static void run_orthonormalize_mat3_array_symmetric(float *out, const float *in, const size_t count) {
+    lac_orthonormalize_mat3_array((mat3 *)out, (const mat3 *)in, count, LAC_ORTHONORMALIZE_SYMMETRIC);
+}
+
+static void run_orthonormalize_mat4_array_gram_schmidt(float *out, const float *in, const size_t count) {
+    lac_orthonormalize_mat4_array((mat4 *)out, (const mat4 *)in, count, LAC_ORTHONORMALIZE_GRAM_SCHMIDT);
+}
+
+static void run_orthonormalize_mat4_array_symmetric(float *out, const float *in, const size_t count) {
+    lac_orthonormalize_mat4_array((mat4 *)out, (const mat4 *)in, count, LAC_ORTHONORMALIZE_SYMMETRIC);
+}
+
+/* Gets the largest element of |M^T M - I| for the upper 3x3 part of an n x n matrix, in ULPs of 1 */
+static double error_orthonormal(const float *out, const size_t n) {
+    double dot, error = 0.0;
+    size_t a, b, r;
+
+    for (r = 0; r < n * n; ++r) {
+        if (!is_finite(out[r])) {
+            return -1.0;
+        }
+    }
+    for (a = 0; a < 3; ++a) {
+        for (b = 0; b < 3; ++b) {
+            dot = (a == b) ? -1.0 : 0.0;
+            for (r = 0; r < 3; ++r) {
+                dot += element(out, n, r, a) * element(out, n, r, b);
+            }
+            error = fmax(error, fabs(dot));
+        }
+    }
+
+    return error / get_ulp(1.0);
+}
+
+static double error_orthonormal_mat3(const float *out, const float *in) {
+    (void)in;
+    return error_orthonormal(out, 3);
+}
+
+static double error_orthonormal_mat4(const float *out, const float *in) {
+    (void)in;
+    return error_orthonormal(out, 4);
+}
+
+#define CASE(fn, in_len, out_len, per_component, prepare) \
+    { #fn, in_len, out_len, per_component, prepare, run_##fn, ref_##fn, NULL, NULL }
+#define ERROR_CASE(fn, in_len, out_len, prepare, error) \
+    { #fn, in_len, out_len, false, prepare, run_##fn, NULL, NULL, error }
+#define BATCH_CASE(fn, in_len, out_len, prepare, error) \
+    { #fn, in_len, out_len, false, prepare, NULL, NULL, run_##fn, error }
+#define VEC_CASE_LIST(n) \
+    CASE(add_vec##n, 2 * n, n, false, prepare_vectors), \
+    CASE(subtract_vec##n, 2 * n, n, false, prepare_vectors), \
+    CASE(multiply_vec##n, n + 1, n, false, prepare_scalar_##n), \
+    CASE(divide_vec##n, n + 1, n, false, prepare_scalar_##n), \
+    CASE(lerp_vec##n, (2 * n) + 1, n, false, prepare_lerp_##n), \
+    CASE(multiply_vec##n##_mat##n, n + (n * n), n, false, NULL), \
+    CASE(calc_dot_prod_vec##n, 2 * n, 1, false, prepare_vectors), \
+    CASE(calc_magnitude_vec##n, n, 1, false, prepare_vectors), \
+    CASE(normalize_vec##n, n, n, false, prepare_vectors)
+#define MAT_CASE_LIST(n) \
+    CASE(add_mat##n, 2 * n * n, n * n, false, NULL), \
+    CASE(subtract_mat##n, 2 * n * n, n * n, false, NULL), \
+    CASE(multiply_mat##n, 2 * n * n, n * n, false, NULL), \
+    CASE(transpose_mat##n, n * n, n * n, false, NULL)
+
+static const Case_t cases[] = {
+    VEC_CASE_LIST(2),
+    VEC_CASE_LIST(3),
+    VEC_CASE_LIST(4),
+    CASE(calc_cross_prod, 6, 3, false, prepare_vectors),
+    CASE(polar_to_cartesian, 2, 2, false, prepare_polar),
+    CASE(cartesian_to_polar, 2, 2, true, prepare_vectors),
+    MAT_CASE_LIST(2),
+    MAT_CASE_LIST(3),
+    MAT_CASE_LIST(4),
+    CASE(get_reflection_mat2, 2, 4, true, NULL),
+    CASE(get_reflection_mat3, 3, 9, true, NULL),
+    CASE(get_reflection_mat4, 3, 16, true, NULL),
+    CASE(get_translation_mat2, 1, 4, true, prepare_vectors),
+    CASE(get_translation_mat3, 2, 9, true, prepare_vectors),
+    CASE(get_translation_mat4, 3, 16, true, prepare_vectors),
+    CASE(get_scalar_mat2, 2, 4, true, prepare_vectors),
+    CASE(get_scalar_mat3, 3, 9, true, prepare_vectors),
+    CASE(get_scalar_mat4, 3, 16, true, prepare_vectors),
+    CASE(get_yaw_mat4, 1, 16, false, prepare_angles),
+    CASE(get_pitch_mat4, 1, 16, false, prepare_angles),
+    CASE(get_roll_mat4, 1, 16, false, prepare_angles),
+    CASE(get_rotation_mat4, 3, 16, false, prepare_angles),
+    CASE(get_projection_mat4, 4, 16, true, prepare_projection),
+    CASE(get_point_at_mat4, 9, 16, false, prepare_vectors),
+    CASE(invert_mat4, 16, 16, false, prepare_rigid),
+    ERROR_CASE(decompose_mat4, 16, PARTS_LEN, prepare_affine, error_decompose),
+    BATCH_CASE(decompose_mat4_array, 16, PARTS_LEN, prepare_affine, error_decompose),
+    BATCH_CASE(orthonormalize_mat3_array_gram_schmidt, 9, 9, prepare_drifted_mat3, error_orthonormal_mat3),
+    BATCH_CASE(orthonormalize_mat3_array_symmetric, 9, 9, prepare_drifted_mat3, error_orthonormal_mat3),
+    BATCH_CASE(orthonormalize_mat4_array_gram_schmidt, 16, 16, prepare_drifted_mat4, error_orthonormal_mat4),
+    BATCH_CASE(orthonormalize_mat4_array_symmetric, 16, 16, prepare_drifted_mat4, error_orthonormal_mat4)
+};
+
+int main(int argc, char **argv) {
+    const size_t count = (argc > 1) ? (size_t)strtoull(argv[1], NULL, 10) : DEFAULT_COUNT;
+    double ref[MAX_OUT], scale, error, max_error, sum_error, start, elapsed = 0.0, sink = 0.0;
+    float *in, *out, *packed_in, *packed_out, *run_out, actual;
+    const float *run_in;
+    size_t c, r, i, j, measured, non_finite;
+
+    in = malloc(count * MAX_IN * sizeof(float));
+    out = malloc(count * MAX_OUT * sizeof(float));
+    packed_in = malloc(count * MAX_IN * sizeof(float));
+    packed_out = malloc(count * MAX_OUT * sizeof(float));
+    if (count == 0 || in == NULL || out == NULL || packed_in == NULL || packed_out == NULL) {
+        fprintf(stderr, "Failed to allocate %zu inputs\n", count);
+        return EXIT_FAILURE;
+    }
+
+    printf("%zu inputs per function, %s kernels, best of %d runs\n\n", count, lac_get_isa_name(lac_get_isa_level()), REPETITIONS);
+    printf("%-40s %14s %14s %12s %12s\n", "function", "max (ulp)", "mean (ulp)", "non-finite", "Mcalls/s");
+
+    for (c = 0; c < sizeof(cases) / sizeof(cases[0]); ++c) {
+        /* Every function gets its own reproducible inputs */
+        rng_state = 0x9E3779B97F4A7C15u + c;
+        for (i = 0; i < count; ++i) {
+            for (j = 0; j < MAX_IN; ++j) {
+                in[(i * MAX_IN) + j] = random_unit();
+            }
+            if (cases[c].prepare != NULL) {
+                cases[c].prepare(&in[i * MAX_IN]);
+            }
+        }
+
+        run_in = in;
+        run_out = out;
+        if (cases[c].run_batch != NULL) {
+            /* Array functions take their inputs and outputs back to back */
+            for (i = 0; i < count; ++i) {
+                memcpy(&packed_in[i * cases[c].in_len], &in[i * MAX_IN], cases[c].in_len * sizeof(float));
+            }
+            run_in = packed_in;
+            run_out = packed_out;
+        }
+
+        /* Warm up the caches and the lazily bound kernels before timing */
+        run_case(&cases[c], run_out, run_in, count);
+        for (r = 0; r < REPETITIONS; ++r) {
+            start = get_time_ms();
+            run_case(&cases[c], run_out, run_in, count);
+            start = get_time_ms() - start;
+            if (r == 0 || start < elapsed) {
+                elapsed = start;
+            }
+        }
+
+        if (cases[c].run_batch != NULL) {
+            for (i = 0; i < count; ++i) {
+                memcpy(&out[i * MAX_OUT], &packed_out[i * cases[c].out_len], cases[c].out_len * sizeof(float));
+            }
+        }
+
+        max_error = 0.0;
+        sum_error = 0.0;
+        measured = 0;
+        non_finite = 0;
+        for (i = 0; i < count; ++i) {
+            sink += out[i * MAX_OUT];
+            if (cases[c].error != NULL) {
+                error = cases[c].error(&out[i * MAX_OUT], &in[i * MAX_IN]);
+                if (error < 0.0) {
+                    non_finite++;
+                    continue;
+                }
+                max_error = (error > max_error) ? error : max_error;
+                sum_error += error;
+                measured++;
+                continue;
+            }
+
+            scale = cases[c].ref(ref, &in[i * MAX_IN]);
+            for (j = 0; j < cases[c].out_len; ++j) {
+                scale = (fabs(ref[j]) > scale) ? fabs(ref[j]) : scale;
+            }
+            for (j = 0; j < cases[c].out_len; ++j) {
+                actual = out[(i * MAX_OUT) + j];
+                if (!is_finite(actual)) {
+                    non_finite++;
+                    continue;
+                }
+                error = fabs((double)actual - ref[j]) / get_ulp(cases[c].per_component ? ref[j] : scale);
+                max_error = (error > max_error) ? error : max_error;
+                sum_error += error;
+                measured++;
+            }
+        }
+
+        printf("%-40s %14.3f %14.4f %12zu %12.1f\n",
+            cases[c].name,
+            max_error,
+            (measured > 0) ? (sum_error / (double)measured) : 0.0,
+            non_finite,
+            (double)count / (elapsed * 1000.0));
+    }
+
+    /* Keeps the calls from being optimized away */
+    if (sink == 0.123456789) {
+        printf("\n");
+    }
+
+    free(in);
+    free(out);
+    free(packed_in);
+    free(packed_out);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,186 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <float.h>
+#include <math.h>
+#include <time.h>
+
+#include "lac_common.h"
+#include "bvh.h"
+#include "scheduler.h"
+
+/* A rolling height field of GRID x GRID quads, i.e. 2 * GRID * GRID triangles */
+#define GRID 724
+#define RAY_COUNT (1024 * 1024)
+#define REPETITIONS 5
+
+typedef struct {
+    const LacBvh_t *bvh;
+    const LacRay_t *rays;
+    LacRayHit_t *hits;
+} Cast_t;
+
+static double get_time_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ts.tv_sec * 1000.0) + (ts.tv_nsec / 1000000.0);
+}
+
+static void make_terrain(vec3 *vertices, uint32_t *indices) {
+    size_t x, z, i = 0;
+    uint32_t v;
+
+    for (z = 0; z <= GRID; ++z) {
+        for (x = 0; x <= GRID; ++x) {
+            v = (uint32_t)((z * (GRID + 1)) + x);
+            vertices[v][0] = (float)x;
+            vertices[v][1] = 8.0f * sinf(0.05f * (float)x) * cosf(0.07f * (float)z);
+            vertices[v][2] = (float)z;
+        }
+    }
+
+    for (z = 0; z < GRID; ++z) {
+        for (x = 0; x < GRID; ++x) {
+            v = (uint32_t)((z * (GRID + 1)) + x);
+            indices[i++] = v;
+            indices[i++] = v + GRID + 1;
+            indices[i++] = v + 1;
+            indices[i++] = v + 1;
+            indices[i++] = v + GRID + 1;
+            indices[i++] = v + GRID + 2;
+        }
+    }
+}
+
+/* A camera above one corner of the terrain, looking across it */
+static void make_rays(LacRay_t *rays) {
+    vec3 v_origin = { -10.0f, 40.0f, -10.0f };
+    vec3 v_direction;
+    size_t i, w = 1024;
+
+    for (i = 0; i < RAY_COUNT; ++i) {
+        v_direction[0] = 0.3f + (0.7f * (float)(i % w) / (float)w);
+        v_direction[1] = -0.05f - (0.4f * (float)(i / w) / (float)(RAY_COUNT / w));
+        v_direction[2] = 1.0f - v_direction[0] + 0.3f;
+        lac_init_ray(&rays[i], v_origin, v_direction, 0.0f, FLT_MAX);
+    }
+}
+
+static void cast_rays(void *arg, size_t begin, size_t end) {
+    Cast_t *cast = arg;
+    size_t i;
+
+    for (i = begin; i < end; ++i) {
+        lac_init_ray_hit(&cast->hits[i], &cast->rays[i]);
+        lac_intersect_bvh_ray(cast->bvh, &cast->hits[i], &cast->rays[i]);
+    }
+}
+
+static double time_build(LacScheduler_t *scheduler, const vec3 *vertices, const uint32_t *indices, const size_t count) {
+    double start, elapsed = 0.0;
+    LacBvh_t *bvh;
+    size_t r;
+
+    for (r = 0; r < REPETITIONS; ++r) {
+        start = get_time_ms();
+        bvh = lac_create_bvh_triangles(scheduler, vertices, indices, count);
+        start = get_time_ms() - start;
+        if (bvh == NULL) {
+            return 0.0;
+        }
+        if (r == 0 || start < elapsed) {
+            elapsed = start;
+        }
+        lac_destroy_bvh(bvh);
+    }
+
+    return elapsed;
+}
+
+static double time_cast(LacScheduler_t *scheduler, Cast_t *cast) {
+    double start, elapsed = 0.0;
+    size_t r;
+
+    for (r = 0; r < REPETITIONS; ++r) {
+        start = get_time_ms();
+        if (scheduler != NULL) {
+            lac_parallel_for(scheduler, cast_rays, cast, RAY_COUNT, 1024);
+        } else {
+            cast_rays(cast, 0, RAY_COUNT);
+        }
+        start = get_time_ms() - start;
+        if (r == 0 || start < elapsed) {
+            elapsed = start;
+        }
+    }
+
+    return elapsed;
+}
+
+int main(void) {
+    const size_t threads[] = { 2, 4, 8, 16 };
+    const size_t count = 2 * GRID * GRID;
+    LacScheduler_t *scheduler;
+    Cast_t cast;
+    vec3 *vertices;
+    uint32_t *indices;
+    LacRay_t *rays;
+    LacRayHit_t *hits;
+    LacBvh_t *bvh;
+    double build, build_serial, trace, trace_serial;
+    size_t i, t, hit_count = 0;
+
+    vertices = malloc((GRID + 1) * (GRID + 1) * sizeof(vec3));
+    indices = malloc(3 * count * sizeof(uint32_t));
+    rays = malloc(RAY_COUNT * sizeof(LacRay_t));
+    hits = malloc(RAY_COUNT * sizeof(LacRayHit_t));
+    if (vertices == NULL || indices == NULL || rays == NULL || hits == NULL) {
+        fprintf(stderr, "Failed to allocate benchmark data\n");
+        return EXIT_FAILURE;
+    }
+
+    make_terrain(vertices, indices);
+    make_rays(rays);
+
+    bvh = lac_create_bvh_triangles(NULL, vertices, indices, count);
+    if (bvh == NULL) {
+        return EXIT_FAILURE;
+    }
+
+    cast.bvh = bvh;
+    cast.rays = rays;
+    cast.hits = hits;
+    build_serial = time_build(NULL, vertices, indices, count);
+    trace_serial = time_cast(NULL, &cast);
+    for (i = 0; i < RAY_COUNT; ++i) {
+        hit_count += (hits[i].prim != LAC_RAY_NO_HIT);
+    }
+
+    printf("%zu triangles, %zu nodes, %zu leaves\n", count, lac_get_bvh_node_count(bvh), lac_get_bvh_leaf_count(bvh));
+    printf("%d rays (%zu hit), best of %d runs\n\n", RAY_COUNT, hit_count, REPETITIONS);
+    printf("%8s %12s %10s %12s %10s\n", "threads", "build (ms)", "speedup", "Mrays/s", "speedup");
+    printf("%8s %12.3f %9.2fx %12.2f %9.2fx\n", "serial", build_serial, 1.0, RAY_COUNT / (trace_serial * 1000.0), 1.0);
+
+    for (t = 0; t < sizeof(threads) / sizeof(threads[0]); ++t) {
+        scheduler = lac_create_scheduler(threads[t]);
+        if (scheduler == NULL) {
+            return EXIT_FAILURE;
+        }
+
+        build = time_build(scheduler, vertices, indices, count);
+        trace = time_cast(scheduler, &cast);
+        printf("%8zu %12.3f %9.2fx %12.2f %9.2fx\n",
+            threads[t], build, build_serial / build, RAY_COUNT / (trace * 1000.0), trace_serial / trace);
+
+        lac_destroy_scheduler(scheduler);
+    }
+
+    lac_destroy_bvh(bvh);
+    free(vertices);
+    free(indices);
+    free(rays);
+    free(hits);
+
+    return EXIT_SUCCESS;
+}
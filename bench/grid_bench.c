@@ -0,0 +1,210 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+
+#include "lac_common.h"
+#include "grid.h"
+#include "scheduler.h"
+
+/* Particles in a box of SIDE x SIDE x SIDE, about 8 to each cell of width RADIUS */
+#define POINT_COUNT (1024 * 1024)
+#define SIDE 25.6f
+#define RADIUS 0.5f
+#define NEIGHBORS 16
+#define QUERY_COUNT (256 * 1024)
+#define BRUTE_QUERIES 256
+#define REPETITIONS 5
+
+typedef struct {
+    const LacGrid_t *grid;
+    const vec3 *points;
+    lac_atomic_size_t found;
+} Query_t;
+
+static uint32_t seed = 7;
+
+static float random_float(const float min, const float max) {
+    seed = (seed * 1664525u) + 1013904223u;
+    return min + ((max - min) * (float)(seed >> 8) / (float)(1u << 24));
+}
+
+static double get_time_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ts.tv_sec * 1000.0) + (ts.tv_nsec / 1000000.0);
+}
+
+/* Particles look for their neighbors, as in one step of a fluid simulation */
+static void query_points(void *arg, size_t begin, size_t end) {
+    Query_t *query = arg;
+    uint32_t indices[1024];
+    size_t i, found = 0;
+
+    for (i = begin; i < end; ++i) {
+        found += lac_query_grid_radius(query->grid, indices, 1024, query->points[i], RADIUS);
+    }
+    atomic_fetch_add_explicit(&query->found, found, memory_order_relaxed);
+}
+
+static void query_nearest(void *arg, size_t begin, size_t end) {
+    Query_t *query = arg;
+    uint32_t indices[NEIGHBORS];
+    float dist_sq[NEIGHBORS];
+    size_t i, found = 0;
+
+    for (i = begin; i < end; ++i) {
+        found += lac_query_grid_nearest(query->grid, indices, dist_sq, NEIGHBORS, query->points[i], RADIUS * 4.0f);
+    }
+    atomic_fetch_add_explicit(&query->found, found, memory_order_relaxed);
+}
+
+static double time_build(LacScheduler_t *scheduler, const vec3 *points) {
+    double start, elapsed = 0.0;
+    LacGrid_t *grid;
+    size_t r;
+
+    for (r = 0; r < REPETITIONS; ++r) {
+        start = get_time_ms();
+        grid = lac_create_grid(scheduler, points, POINT_COUNT, RADIUS);
+        start = get_time_ms() - start;
+        if (grid == NULL) {
+            return 0.0;
+        }
+        if (r == 0 || start < elapsed) {
+            elapsed = start;
+        }
+        lac_destroy_grid(grid);
+    }
+
+    return elapsed;
+}
+
+/* Updating with positions that moved a little, so that a few points change cells */
+static double time_update(LacScheduler_t *scheduler, LacGrid_t *grid, vec3 *points) {
+    double start, elapsed = 0.0;
+    size_t r, i;
+
+    for (r = 0; r < REPETITIONS; ++r) {
+        for (i = 0; i < POINT_COUNT; i += 97) {
+            points[i][0] += (r % 2 == 0) ? 0.05f : -0.05f;
+        }
+        start = get_time_ms();
+        lac_update_grid(grid, scheduler, points, POINT_COUNT);
+        start = get_time_ms() - start;
+        if (r == 0 || start < elapsed) {
+            elapsed = start;
+        }
+    }
+
+    return elapsed;
+}
+
+static double time_queries(LacScheduler_t *scheduler, Query_t *query, LacRangeFunc_t func) {
+    double start, elapsed = 0.0;
+    size_t r;
+
+    for (r = 0; r < REPETITIONS; ++r) {
+        atomic_store(&query->found, 0);
+        start = get_time_ms();
+        if (scheduler != NULL) {
+            lac_parallel_for(scheduler, func, query, QUERY_COUNT, 1024);
+        } else {
+            func(query, 0, QUERY_COUNT);
+        }
+        start = get_time_ms() - start;
+        if (r == 0 || start < elapsed) {
+            elapsed = start;
+        }
+    }
+
+    return elapsed;
+}
+
+/* Testing every point against a handful of queries, to compare against */
+static double time_brute_force(const vec3 *points, size_t *found) {
+    const float radius_sq = RADIUS * RADIUS;
+    double start;
+    float dx, dy, dz;
+    size_t q, i;
+
+    *found = 0;
+    start = get_time_ms();
+    for (q = 0; q < BRUTE_QUERIES; ++q) {
+        for (i = 0; i < POINT_COUNT; ++i) {
+            dx = points[i][0] - points[q][0];
+            dy = points[i][1] - points[q][1];
+            dz = points[i][2] - points[q][2];
+            *found += ((dx * dx) + (dy * dy) + (dz * dz) <= radius_sq);
+        }
+    }
+
+    return (get_time_ms() - start) * ((double)QUERY_COUNT / BRUTE_QUERIES);
+}
+
+int main(void) {
+    const size_t threads[] = { 2, 4, 8, 16 };
+    LacScheduler_t *scheduler;
+    Query_t query;
+    vec3 *points;
+    LacGrid_t *grid;
+    double build, build_serial, update, update_serial, radius, radius_serial, nearest, nearest_serial, brute;
+    size_t i, c, t, brute_found, radius_found, nearest_found;
+
+    points = malloc(POINT_COUNT * sizeof(vec3));
+    if (points == NULL) {
+        fprintf(stderr, "Failed to allocate benchmark data\n");
+        return EXIT_FAILURE;
+    }
+    for (i = 0; i < POINT_COUNT; ++i) {
+        for (c = 0; c < 3; ++c) {
+            points[i][c] = random_float(0.0f, SIDE);
+        }
+    }
+
+    grid = lac_create_grid(NULL, points, POINT_COUNT, RADIUS);
+    if (grid == NULL) {
+        return EXIT_FAILURE;
+    }
+
+    query.grid = grid;
+    query.points = points;
+    atomic_init(&query.found, 0);
+    build_serial = time_build(NULL, points);
+    update_serial = time_update(NULL, grid, points);
+    radius_serial = time_queries(NULL, &query, query_points);
+    radius_found = atomic_load(&query.found);
+    nearest_serial = time_queries(NULL, &query, query_nearest);
+    nearest_found = atomic_load(&query.found);
+    brute = time_brute_force(points, &brute_found);
+
+    printf("%d points, %zu cells, %d queries, best of %d runs\n",
+        POINT_COUNT, lac_get_grid_cell_count(grid), QUERY_COUNT, REPETITIONS);
+    printf("radius %.2f: %.2f neighbors per point (%.2f by brute force, which would take %.0f ms for every query)\n",
+        RADIUS, (double)radius_found / QUERY_COUNT, (double)brute_found / BRUTE_QUERIES, brute);
+    printf("nearest %d: %.2f found per point\n\n", NEIGHBORS, (double)nearest_found / QUERY_COUNT);
+    printf("%8s %12s %12s %14s %14s\n", "threads", "build (ms)", "update (ms)", "radius (ms)", "nearest (ms)");
+    printf("%8s %12.3f %12.3f %14.3f %14.3f\n", "serial", build_serial, update_serial, radius_serial, nearest_serial);
+
+    for (t = 0; t < sizeof(threads) / sizeof(threads[0]); ++t) {
+        scheduler = lac_create_scheduler(threads[t]);
+        if (scheduler == NULL) {
+            return EXIT_FAILURE;
+        }
+
+        build = time_build(scheduler, points);
+        update = time_update(scheduler, grid, points);
+        radius = time_queries(scheduler, &query, query_points);
+        nearest = time_queries(scheduler, &query, query_nearest);
+        printf("%8zu %12.3f %12.3f %14.3f %14.3f\n", threads[t], build, update, radius, nearest);
+
+        lac_destroy_scheduler(scheduler);
+    }
+
+    lac_destroy_grid(grid);
+    free(points);
+
+    return EXIT_SUCCESS;
+}
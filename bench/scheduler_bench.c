@@ -0,0 +1,131 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "lac_common.h"
+#include "matmath.h"
+#include "batch.h"
+#include "scheduler.h"
+
+#define VERTEX_COUNT (4 * 1024 * 1024)
+#define CHAIN_COUNT 512
+#define REPETITIONS 10
+
+static const mat4 m_identity = {
+    1.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 1.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 1.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 1.0f
+};
+
+typedef struct {
+    mat4 m_out;
+    size_t length;
+} Chain_t;
+
+static double get_time_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ts.tv_sec * 1000.0) + (ts.tv_nsec / 1000000.0);
+}
+
+/* Stands in for a skeleton chain; costs vary widely from one task to the next */
+static void run_chain(void *arg) {
+    Chain_t *chain = arg;
+    mat4 m_step = {
+        0.99f, 0.01f, 0.0f,  0.0f,
+        -0.01f, 0.99f, 0.0f, 0.0f,
+        0.0f,  0.0f,  1.0f,  0.0f,
+        0.1f,  0.0f,  0.0f,  1.0f
+    };
+    mat4 m_tmp;
+    size_t i;
+
+    memcpy(chain->m_out, m_identity, sizeof(mat4));
+    for (i = 0; i < chain->length; ++i) {
+        lac_multiply_mat4(m_tmp, chain->m_out, m_step);
+        memcpy(chain->m_out, m_tmp, sizeof(mat4));
+    }
+}
+
+/* One frame: a mix of small uneven tasks alongside a large split vertex transform */
+static void run_frame(LacScheduler_t *scheduler, Chain_t *chains, vec4 *v_out, const vec4 *v_in, const mat4 m_in) {
+    LacTaskGroup_t group;
+    size_t i;
+
+    lac_init_task_group(&group);
+    for (i = 0; i < CHAIN_COUNT; ++i) {
+        lac_submit_task(scheduler, &group, run_chain, &chains[i]);
+    }
+    lac_parallel_multiply_vec4_mat4_array(scheduler, v_out, v_in, m_in, VERTEX_COUNT);
+    lac_wait_task_group(scheduler, &group);
+}
+
+int main(void) {
+    const size_t threads[] = { 1, 2, 4, 8, 16, 32 };
+    LacScheduler_t *scheduler;
+    Chain_t *chains;
+    vec4 *v_in, *v_out;
+    mat4 m_in;
+    double start, elapsed, baseline = 0.0;
+    size_t i, t, r;
+
+    v_in = malloc(VERTEX_COUNT * sizeof(vec4));
+    v_out = malloc(VERTEX_COUNT * sizeof(vec4));
+    chains = malloc(CHAIN_COUNT * sizeof(Chain_t));
+    if (v_in == NULL || v_out == NULL || chains == NULL) {
+        fprintf(stderr, "Failed to allocate benchmark data\n");
+        return EXIT_FAILURE;
+    }
+
+    for (i = 0; i < VERTEX_COUNT; ++i) {
+        v_in[i][0] = (float)(i % 101);
+        v_in[i][1] = (float)(i % 37);
+        v_in[i][2] = (float)(i % 17);
+        v_in[i][3] = 1.0f;
+    }
+    for (i = 0; i < CHAIN_COUNT; ++i) {
+        chains[i].length = 1 + ((i * 7919) % 2000);
+    }
+    memcpy(m_in, m_identity, sizeof(mat4));
+    m_in[3] = 2.0f;
+
+    printf("%d vertices + %d chains per frame, best of %d frames\n\n", VERTEX_COUNT, CHAIN_COUNT, REPETITIONS);
+    printf("%8s %12s %10s %12s\n", "threads", "frame (ms)", "speedup", "efficiency");
+
+    for (t = 0; t < sizeof(threads) / sizeof(threads[0]); ++t) {
+        scheduler = lac_create_scheduler(threads[t]);
+        if (scheduler == NULL) {
+            return EXIT_FAILURE;
+        }
+
+        /* Warm up the workers and the caches */
+        run_frame(scheduler, chains, v_out, v_in, m_in);
+
+        elapsed = 0.0;
+        for (r = 0; r < REPETITIONS; ++r) {
+            start = get_time_ms();
+            run_frame(scheduler, chains, v_out, v_in, m_in);
+            start = get_time_ms() - start;
+            if (r == 0 || start < elapsed) {
+                elapsed = start;
+            }
+        }
+
+        if (t == 0) {
+            baseline = elapsed;
+        }
+        printf("%8zu %12.3f %9.2fx %11.0f%%\n",
+            threads[t], elapsed, baseline / elapsed, 100.0 * baseline / (elapsed * (double)threads[t]));
+
+        lac_destroy_scheduler(scheduler);
+    }
+
+    free(v_in);
+    free(v_out);
+    free(chains);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,301 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+
+#include "lac_common.h"
+#include "sparse.h"
+#include "scheduler.h"
+
+/* A 5-point Laplacian on a GRID_2D x GRID_2D grid, and a 27-point stencil on a GRID_3D^3 grid */
+#define GRID_2D 1024
+#define GRID_3D 64
+/* Cloth of CLOTH x CLOTH particles, each coupled to the 3x3 patch of particles around it */
+#define CLOTH 256
+/* Entries per row of a matrix with no structure at all */
+#define RANDOM_ROWS (256 * 1024)
+#define RANDOM_PER_ROW 16
+#define REPETITIONS 5
+/* The most triplets of any pattern, which is the 27-point stencil */
+#define MAX_TRIPLETS (GRID_3D * GRID_3D * GRID_3D * 27)
+
+#define PATTERNS 5
+
+typedef struct {
+    const char *name;
+    LacCsr_t csr;
+    LacBsr3_t bsr;
+    bool is_bsr;
+    double build;
+    double transpose;
+    double scalar;
+} Pattern_t;
+
+static uint32_t seed = 7;
+
+static float random_float(const float min, const float max) {
+    seed = (seed * 1664525u) + 1013904223u;
+    return min + ((max - min) * (float)(seed >> 8) / (float)(1u << 24));
+}
+
+static double get_time_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ts.tv_sec * 1000.0) + (ts.tv_nsec / 1000000.0);
+}
+
+/* Adds the entries coupling every point of a grid to its neighbors within __reach__ along each axis */
+static size_t stencil_triplets(LacTriplet_t *triplets, const size_t side, const size_t dims, const int reach, const bool star) {
+    const size_t count = (dims == 2) ? side * side : side * side * side;
+    long p[3], q[3];
+    size_t i, n = 0, a;
+    int d[3];
+
+    for (i = 0; i < count; ++i) {
+        p[0] = (long)(i % side);
+        p[1] = (long)((i / side) % side);
+        p[2] = (dims == 2) ? 0 : (long)(i / (side * side));
+        for (d[2] = (dims == 2) ? 0 : -reach; d[2] <= ((dims == 2) ? 0 : reach); ++d[2]) {
+            for (d[1] = -reach; d[1] <= reach; ++d[1]) {
+                for (d[0] = -reach; d[0] <= reach; ++d[0]) {
+                    /* A star stencil only couples neighbors along one axis */
+                    if (star && (d[0] != 0) + (d[1] != 0) + (d[2] != 0) > 1) {
+                        continue;
+                    }
+                    for (a = 0; a < 3; ++a) {
+                        q[a] = p[a] + d[a];
+                    }
+                    if (q[0] < 0 || q[1] < 0 || q[2] < 0 || q[0] >= (long)side || q[1] >= (long)side || q[2] >= (long)side) {
+                        continue;
+                    }
+                    triplets[n].row = (uint32_t)i;
+                    triplets[n].col = (uint32_t)(q[0] + (q[1] * (long)side) + (q[2] * (long)(side * side)));
+                    triplets[n].value = (d[0] == 0 && d[1] == 0 && d[2] == 0) ? 8.0f : random_float(-1.0f, 0.0f);
+                    ++n;
+                }
+            }
+        }
+    }
+    return n;
+}
+
+/* Expands each coupling of two particles into the 9 entries of their 3x3 block */
+static size_t cloth_triplets(LacTriplet_t *triplets, const LacTriplet_t *couplings, const size_t count) {
+    size_t i, r, c, n = 0;
+
+    for (i = 0; i < count; ++i) {
+        for (r = 0; r < 3; ++r) {
+            for (c = 0; c < 3; ++c) {
+                triplets[n].row = (couplings[i].row * 3) + (uint32_t)r;
+                triplets[n].col = (couplings[i].col * 3) + (uint32_t)c;
+                triplets[n].value = couplings[i].value * ((r == c) ? 1.0f : 0.25f);
+                ++n;
+            }
+        }
+    }
+    return n;
+}
+
+static size_t random_triplets(LacTriplet_t *triplets) {
+    size_t i, n = 0;
+
+    for (i = 0; i < RANDOM_ROWS * RANDOM_PER_ROW; ++i) {
+        seed = (seed * 1664525u) + 1013904223u;
+        triplets[n].row = (uint32_t)(i / RANDOM_PER_ROW);
+        triplets[n].col = (seed >> 8) % RANDOM_ROWS;
+        triplets[n].value = random_float(-1.0f, 1.0f);
+        ++n;
+    }
+    return n;
+}
+
+/* Builds a pattern from triplets, timing its assembly and transpose */
+static bool build_pattern(Pattern_t *pattern, const LacTriplet_t *triplets, const size_t count, const size_t rows) {
+    LacCsr_t csr_t;
+    LacBsr3_t bsr_t;
+    double start;
+    int result;
+
+    start = get_time_ms();
+    if (pattern->is_bsr) {
+        result = lac_init_bsr3(&pattern->bsr, rows / 3, rows / 3, triplets, count);
+    } else {
+        result = lac_init_csr(&pattern->csr, rows, rows, triplets, count);
+    }
+    pattern->build = get_time_ms() - start;
+    if (result != 0) {
+        return false;
+    }
+
+    start = get_time_ms();
+    if (pattern->is_bsr) {
+        result = lac_transpose_bsr3(&bsr_t, &pattern->bsr);
+        lac_free_bsr3(&bsr_t);
+    } else {
+        result = lac_transpose_csr(&csr_t, &pattern->csr);
+        lac_free_csr(&csr_t);
+    }
+    pattern->transpose = get_time_ms() - start;
+
+    return result == 0;
+}
+
+static size_t get_rows(const Pattern_t *pattern) {
+    return pattern->is_bsr ? pattern->bsr.block_rows * 3 : pattern->csr.rows;
+}
+
+static size_t get_nnz(const Pattern_t *pattern) {
+    return pattern->is_bsr ? pattern->bsr.block_count * 9 : pattern->csr.nnz;
+}
+
+static double time_product(LacScheduler_t *scheduler, const Pattern_t *pattern, float *y, const float *x) {
+    double start, elapsed = 0.0;
+    size_t r;
+
+    for (r = 0; r < REPETITIONS; ++r) {
+        start = get_time_ms();
+        if (pattern->is_bsr) {
+            lac_parallel_multiply_bsr3_vec(scheduler, (vec3*)y, &pattern->bsr, (const vec3*)x);
+        } else {
+            lac_parallel_multiply_csr_vec(scheduler, y, &pattern->csr, x);
+        }
+        start = get_time_ms() - start;
+        if (r == 0 || start < elapsed) {
+            elapsed = start;
+        }
+    }
+
+    return elapsed;
+}
+
+/* The textbook loop over a CSR matrix, one entry at a time, to compare against */
+static double time_scalar(const LacCsr_t *csr, float *y, const float *x) {
+    double start, elapsed = 0.0;
+    float sum;
+    size_t r, i, e;
+
+    for (r = 0; r < REPETITIONS; ++r) {
+        start = get_time_ms();
+        for (i = 0; i < csr->rows; ++i) {
+            sum = 0.0f;
+            for (e = csr->row_start[i]; e < csr->row_start[i + 1]; ++e) {
+                sum += csr->values[e] * x[csr->col_index[e]];
+            }
+            y[i] = sum;
+        }
+        start = get_time_ms() - start;
+        if (r == 0 || start < elapsed) {
+            elapsed = start;
+        }
+    }
+
+    return elapsed;
+}
+
+int main(void) {
+    const size_t threads[] = { 2, 4, 8, 16 };
+    Pattern_t patterns[PATTERNS] = {
+        { .name = "2D 5-point" },
+        { .name = "3D 27-point" },
+        { .name = "cloth CSR" },
+        { .name = "cloth BSR3", .is_bsr = true },
+        { .name = "random" }
+    };
+    LacTriplet_t *triplets, *couplings;
+    LacScheduler_t *scheduler;
+    float *x, *y;
+    double serial[PATTERNS], elapsed;
+    size_t i, p, t, count, rows;
+
+    triplets = malloc(MAX_TRIPLETS * sizeof(LacTriplet_t));
+    couplings = malloc((size_t)CLOTH * CLOTH * 9 * sizeof(LacTriplet_t));
+    x = malloc((size_t)GRID_2D * GRID_2D * sizeof(float));
+    y = malloc((size_t)GRID_2D * GRID_2D * sizeof(float));
+    if (triplets == NULL || couplings == NULL || x == NULL || y == NULL) {
+        fprintf(stderr, "Failed to allocate benchmark data\n");
+        return EXIT_FAILURE;
+    }
+    for (i = 0; i < (size_t)GRID_2D * GRID_2D; ++i) {
+        x[i] = random_float(-1.0f, 1.0f);
+    }
+
+    for (p = 0; p < PATTERNS; ++p) {
+        switch (p) {
+            case 0:
+                rows = (size_t)GRID_2D * GRID_2D;
+                count = stencil_triplets(triplets, GRID_2D, 2, 1, true);
+                break;
+            case 1:
+                rows = (size_t)GRID_3D * GRID_3D * GRID_3D;
+                count = stencil_triplets(triplets, GRID_3D, 3, 1, false);
+                break;
+            case 2:
+            case 3:
+                rows = (size_t)CLOTH * CLOTH * 3;
+                count = cloth_triplets(triplets, couplings, stencil_triplets(couplings, CLOTH, 2, 1, false));
+                break;
+            default:
+                rows = RANDOM_ROWS;
+                count = random_triplets(triplets);
+                break;
+        }
+        if (!build_pattern(&patterns[p], triplets, count, rows)) {
+            return EXIT_FAILURE;
+        }
+        patterns[p].scalar = patterns[p].is_bsr ? 0.0 : time_scalar(&patterns[p].csr, y, x);
+        serial[p] = time_product(NULL, &patterns[p], y, x);
+    }
+    free(triplets);
+    free(couplings);
+
+    printf("best of %d runs\n\n", REPETITIONS);
+    printf("%-12s %10s %10s %12s %15s %12s %12s %10s\n",
+        "pattern", "rows", "nnz", "build (ms)", "transpose (ms)", "scalar (ms)", "spmv (ms)", "GFLOP/s");
+    for (p = 0; p < PATTERNS; ++p) {
+        printf("%-12s %10zu %10zu %12.3f %15.3f ", patterns[p].name, get_rows(&patterns[p]), get_nnz(&patterns[p]),
+            patterns[p].build, patterns[p].transpose);
+        if (patterns[p].is_bsr) {
+            printf("%12s ", "-");
+        } else {
+            printf("%12.3f ", patterns[p].scalar);
+        }
+        printf("%12.3f %10.2f\n", serial[p], (2.0 * (double)get_nnz(&patterns[p])) / (serial[p] * 1e6));
+    }
+
+    printf("\nspmv (ms)\n%8s", "threads");
+    for (p = 0; p < PATTERNS; ++p) {
+        printf(" %12s", patterns[p].name);
+    }
+    printf("\n%8s", "serial");
+    for (p = 0; p < PATTERNS; ++p) {
+        printf(" %12.3f", serial[p]);
+    }
+    printf("\n");
+
+    for (t = 0; t < sizeof(threads) / sizeof(threads[0]); ++t) {
+        scheduler = lac_create_scheduler(threads[t]);
+        if (scheduler == NULL) {
+            return EXIT_FAILURE;
+        }
+
+        printf("%8zu", threads[t]);
+        for (p = 0; p < PATTERNS; ++p) {
+            elapsed = time_product(scheduler, &patterns[p], y, x);
+            printf(" %12.3f", elapsed);
+        }
+        printf("\n");
+
+        lac_destroy_scheduler(scheduler);
+    }
+
+    for (p = 0; p < PATTERNS; ++p) {
+        lac_free_csr(&patterns[p].csr);
+        lac_free_bsr3(&patterns[p].bsr);
+    }
+    free(x);
+    free(y);
+
+    return EXIT_SUCCESS;
+}
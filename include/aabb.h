@@ -0,0 +1,34 @@
+#ifndef AABB_H
+#define AABB_H
+
+#include "lac_common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* An axis-aligned bounding box; a box with any min component above its max component is empty */
+typedef struct {
+    vec3 min;
+    vec3 max;
+} LacAabb_t;
+
+/* Forward function declarations */
+
+void lac_init_aabb(LacAabb_t *box);
+void lac_init_aabb_from_points(LacAabb_t *box, const vec3 *points, const size_t count);
+void lac_expand_aabb(LacAabb_t *box, const vec3 v_point);
+void lac_merge_aabb(LacAabb_t *out, const LacAabb_t *a, const LacAabb_t *b);
+
+bool lac_test_aabb_overlap(const LacAabb_t *a, const LacAabb_t *b);
+void lac_calc_aabb_center(vec3 v_out, const LacAabb_t *box);
+void lac_calc_aabb_surface_area(float *area, const LacAabb_t *box);
+
+void lac_transform_aabb(LacAabb_t *out, const LacAabb_t *box, const mat4 m_in);
+void lac_transform_aabb_array(LacAabb_t *out, const LacAabb_t *in, const mat4 *m_in, const size_t count);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* AABB_H */
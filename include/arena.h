@@ -0,0 +1,45 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stdint.h>
+
+#include "lac_common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* Alignment used when 0 is passed to lac_alloc_arena() (one cache line) */
+#define LAC_ARENA_ALIGN 64
+/* Capacity of the arena returned by lac_get_thread_arena(), enough for the default stream buffers */
+#define LAC_THREAD_ARENA_SIZE (16 * 1024 * 1024)
+
+typedef struct {
+    uint8_t *base;
+    size_t capacity;
+    size_t offset;
+    size_t peak;
+    bool owns_memory;
+} LacArena_t;
+
+typedef size_t LacArenaMark_t;
+
+/* Forward function declarations */
+
+int lac_init_arena(LacArena_t *arena, const size_t capacity);
+void lac_init_arena_from_buffer(LacArena_t *arena, void *buffer, const size_t capacity);
+void lac_free_arena(LacArena_t *arena);
+
+void *lac_alloc_arena(LacArena_t *arena, const size_t size, const size_t alignment);
+
+LacArenaMark_t lac_get_arena_mark(const LacArena_t *arena);
+void lac_reset_arena_to_mark(LacArena_t *arena, const LacArenaMark_t mark);
+void lac_reset_arena(LacArena_t *arena);
+
+LacArena_t *lac_get_thread_arena(void);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* ARENA_H */
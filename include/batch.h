@@ -0,0 +1,81 @@
+#ifndef BATCH_H
+#define BATCH_H
+
+#include <stdint.h>
+
+#include "lac_common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* Number of vertices processed together by the blocked kernels */
+#define LAC_BATCH_BLOCK 8
+
+/* Per-vertex outcodes produced by lac_project_vec4_array() */
+typedef enum {
+    LAC_CLIP_LEFT   = 1 << 0,
+    LAC_CLIP_RIGHT  = 1 << 1,
+    LAC_CLIP_BOTTOM = 1 << 2,
+    LAC_CLIP_TOP    = 1 << 3,
+    LAC_CLIP_NEAR   = 1 << 4,
+    LAC_CLIP_FAR    = 1 << 5,
+    LAC_CLIP_W      = 1 << 6
+} LacClipCode_t;
+
+/* Separate arrays for each component of a set of 2D points, i.e. point i is (x[i], y[i]) */
+typedef struct {
+    float *x;
+    float *y;
+} LacSoaVec2_t;
+
+/* Separate arrays for each component of a set of 3D points, i.e. point i is (x[i], y[i], z[i]) */
+typedef struct {
+    float *x;
+    float *y;
+    float *z;
+} LacSoaVec3_t;
+
+typedef struct {
+    float x;
+    float y;
+    float width;
+    float height;
+    float min_depth;
+    float max_depth;
+} LacViewport_t;
+
+/* Forward function declarations */
+
+void lac_multiply_vec2_mat2_array(vec2 *v_out, const vec2 *v_in, const mat2 m_in, const size_t count);
+void lac_multiply_vec3_mat3_array(vec3 *v_out, const vec3 *v_in, const mat3 m_in, const size_t count);
+void lac_multiply_vec4_mat4_array(vec4 *v_out, const vec4 *v_in, const mat4 m_in, const size_t count);
+
+void lac_project_vec4_array(
+    vec3 *v_out,
+    uint8_t *clip_codes,
+    const vec4 *v_in,
+    const mat4 m_mvp,
+    const LacViewport_t *viewport,
+    const size_t count,
+    const bool remap_depth
+);
+
+void lac_lerp_vec2_array(vec2 *v_out, const vec2 *v_a, const vec2 *v_b, const float t, const size_t count);
+void lac_lerp_vec3_array(vec3 *v_out, const vec3 *v_a, const vec3 *v_b, const float t, const size_t count);
+void lac_lerp_vec4_array(vec4 *v_out, const vec4 *v_a, const vec4 *v_b, const float t, const size_t count);
+
+void lac_multiply_add_vec2_array(vec2 *v_out, const vec2 *v_a, const float scalar, const vec2 *v_b, const size_t count);
+void lac_multiply_add_vec3_array(vec3 *v_out, const vec3 *v_a, const float scalar, const vec3 *v_b, const size_t count);
+void lac_multiply_add_vec4_array(vec4 *v_out, const vec4 *v_a, const float scalar, const vec4 *v_b, const size_t count);
+
+void lac_blend_vec2_array(vec2 *v_out, const vec2 *const *v_in, const float *weights, const size_t inputs, const size_t count);
+void lac_blend_vec3_array(vec3 *v_out, const vec3 *const *v_in, const float *weights, const size_t inputs, const size_t count);
+void lac_blend_vec4_array(vec4 *v_out, const vec4 *const *v_in, const float *weights, const size_t inputs, const size_t count);
+void lac_blend_mat4_array(mat4 *m_out, const mat4 *const *m_in, const float *weights, const size_t inputs, const size_t count);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* BATCH_H */
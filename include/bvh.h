@@ -0,0 +1,49 @@
+#ifndef BVH_H
+#define BVH_H
+
+#include <stdint.h>
+
+#include "lac_common.h"
+#include "aabb.h"
+#include "ray.h"
+#include "scheduler.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* Number of children of each node, which are tested against a query together */
+#define LAC_BVH_WIDTH 4
+/* Number of bins per axis used to find the best split of a node */
+#define LAC_BVH_BINS 16
+/* Largest number of primitives in a leaf, except in leaves at LAC_BVH_MAX_DEPTH */
+#define LAC_BVH_MAX_LEAF LAC_RAY_PACKET
+/* Depth at which nodes are no longer split, which bounds the traversal stack */
+#define LAC_BVH_MAX_DEPTH 64
+
+/* Opaque; holds the nodes, leaves and primitive bounds */
+typedef struct LacBvh LacBvh_t;
+
+/* Forward function declarations */
+
+LacBvh_t *lac_create_bvh(LacScheduler_t *scheduler, const LacAabb_t *boxes, const size_t count);
+LacBvh_t *lac_create_bvh_triangles(
+    LacScheduler_t *scheduler,
+    const vec3 *vertices,
+    const uint32_t *indices,
+    const size_t count
+);
+void lac_destroy_bvh(LacBvh_t *bvh);
+
+size_t lac_get_bvh_node_count(const LacBvh_t *bvh);
+size_t lac_get_bvh_leaf_count(const LacBvh_t *bvh);
+void lac_get_bvh_bounds(LacAabb_t *box, const LacBvh_t *bvh);
+
+bool lac_intersect_bvh_ray(const LacBvh_t *bvh, LacRayHit_t *hit, const LacRay_t *ray);
+size_t lac_query_bvh_aabb(const LacBvh_t *bvh, uint32_t *prims, const size_t max_prims, const LacAabb_t *box);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* BVH_H */
@@ -0,0 +1,68 @@
+#ifndef CAMERA_H
+#define CAMERA_H
+
+#include <stdint.h>
+
+#include "lac_common.h"
+#include "matmath.h"
+#include "transforms.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+typedef struct {
+    /* Inputs; use the lac_set_camera_* functions to modify these */
+    vec3 eye;
+    vec3 target;
+    vec3 up;
+    float aspect;
+    float fov;
+    float znear;
+    float zfar;
+
+    /* Cached outputs; use the lac_get_camera_* functions to read these */
+    mat4 view;
+    mat4 inv_view;
+    mat4 proj;
+    mat4 inv_proj;
+    mat4 view_proj;
+    mat4 inv_view_proj;
+    uint32_t dirty;
+    uint64_t generation;
+} LacCamera_t;
+
+/* Forward function declarations */
+
+void lac_init_camera(
+    LacCamera_t *camera,
+    const vec3 v_eye,
+    const vec3 v_target,
+    const vec3 v_up,
+    const float aspect,
+    const float fov,
+    const float znear,
+    const float zfar
+);
+
+void lac_set_camera_eye(LacCamera_t *camera, const vec3 v_eye);
+void lac_set_camera_target(LacCamera_t *camera, const vec3 v_target);
+void lac_set_camera_up(LacCamera_t *camera, const vec3 v_up);
+void lac_set_camera_aspect(LacCamera_t *camera, const float aspect);
+void lac_set_camera_fov(LacCamera_t *camera, const float fov);
+void lac_set_camera_clip_planes(LacCamera_t *camera, const float znear, const float zfar);
+
+void lac_get_camera_view_mat4(mat4 m_out, LacCamera_t *camera);
+void lac_get_camera_inv_view_mat4(mat4 m_out, LacCamera_t *camera);
+void lac_get_camera_projection_mat4(mat4 m_out, LacCamera_t *camera);
+void lac_get_camera_inv_projection_mat4(mat4 m_out, LacCamera_t *camera);
+void lac_get_camera_view_projection_mat4(mat4 m_out, LacCamera_t *camera);
+void lac_get_camera_inv_view_projection_mat4(mat4 m_out, LacCamera_t *camera);
+
+uint64_t lac_get_camera_generation(const LacCamera_t *camera);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* CAMERA_H */
@@ -0,0 +1,78 @@
+#ifndef COORDS_H
+#define COORDS_H
+
+#include "lac_common.h"
+#include "batch.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* The accuracy of the sine, cosine and arctangent approximations used by the array conversions */
+typedef enum {
+    LAC_COORD_FAST,     /* Shorter polynomials, with an absolute error of at most about 2e-5 */
+    LAC_COORD_PRECISE   /* Longer polynomials, with an absolute error of at most about 3e-7 */
+} LacCoordAccuracy_t;
+
+/* Forward function declarations */
+
+void lac_polar_to_cartesian_array(vec2 *v_out, const vec2 *v_in, const size_t count, const LacCoordAccuracy_t accuracy);
+void lac_cartesian_to_polar_array(vec2 *v_out, const vec2 *v_in, const size_t count, const LacCoordAccuracy_t accuracy);
+void lac_polar_to_cartesian_soa(
+    LacSoaVec2_t *out,
+    const float *len,
+    const float *angle,
+    const size_t count,
+    const LacCoordAccuracy_t accuracy
+);
+void lac_cartesian_to_polar_soa(
+    float *len,
+    float *angle,
+    const LacSoaVec2_t *points,
+    const size_t count,
+    const LacCoordAccuracy_t accuracy
+);
+
+void lac_spherical_to_cartesian_array(vec3 *v_out, const vec3 *v_in, const size_t count, const LacCoordAccuracy_t accuracy);
+void lac_cartesian_to_spherical_array(vec3 *v_out, const vec3 *v_in, const size_t count, const LacCoordAccuracy_t accuracy);
+void lac_spherical_to_cartesian_soa(
+    LacSoaVec3_t *out,
+    const float *radius,
+    const float *azimuth,
+    const float *inclination,
+    const size_t count,
+    const LacCoordAccuracy_t accuracy
+);
+void lac_cartesian_to_spherical_soa(
+    float *radius,
+    float *azimuth,
+    float *inclination,
+    const LacSoaVec3_t *points,
+    const size_t count,
+    const LacCoordAccuracy_t accuracy
+);
+
+void lac_cylindrical_to_cartesian_array(vec3 *v_out, const vec3 *v_in, const size_t count, const LacCoordAccuracy_t accuracy);
+void lac_cartesian_to_cylindrical_array(vec3 *v_out, const vec3 *v_in, const size_t count, const LacCoordAccuracy_t accuracy);
+void lac_cylindrical_to_cartesian_soa(
+    LacSoaVec3_t *out,
+    const float *radius,
+    const float *azimuth,
+    const float *height,
+    const size_t count,
+    const LacCoordAccuracy_t accuracy
+);
+void lac_cartesian_to_cylindrical_soa(
+    float *radius,
+    float *azimuth,
+    float *height,
+    const LacSoaVec3_t *points,
+    const size_t count,
+    const LacCoordAccuracy_t accuracy
+);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* COORDS_H */
@@ -0,0 +1,29 @@
+#ifndef DISPATCH_H
+#define DISPATCH_H
+
+#include "lac_common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* Environment variable which caps the instruction set chosen at load time */
+#define LAC_ISA_ENV "LAC_ISA"
+
+/* Instruction set levels which the hot kernels are built for, from lowest to highest */
+typedef enum {
+    LAC_ISA_DEFAULT,
+    LAC_ISA_SSE42,
+    LAC_ISA_AVX2
+} LacIsaLevel_t;
+
+/* Forward function declarations */
+
+LacIsaLevel_t lac_get_isa_level(void);
+const char *lac_get_isa_name(const LacIsaLevel_t level);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* DISPATCH_H */
@@ -0,0 +1,48 @@
+#ifndef GRID_H
+#define GRID_H
+
+#include <stdint.h>
+
+#include "lac_common.h"
+#include "scheduler.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* Number of cells per axis on either side of the origin which points may lie within */
+#define LAC_GRID_MAX_CELLS (1 << 20)
+
+/* Opaque; holds the points sorted by cell, and a hash table of the occupied cells */
+typedef struct LacGrid LacGrid_t;
+
+/* Forward function declarations */
+
+LacGrid_t *lac_create_grid(LacScheduler_t *scheduler, const vec3 *points, const size_t count, const float cell_size);
+bool lac_update_grid(LacGrid_t *grid, LacScheduler_t *scheduler, const vec3 *points, const size_t count);
+void lac_destroy_grid(LacGrid_t *grid);
+
+size_t lac_get_grid_point_count(const LacGrid_t *grid);
+size_t lac_get_grid_cell_count(const LacGrid_t *grid);
+
+size_t lac_query_grid_radius(
+    const LacGrid_t *grid,
+    uint32_t *indices,
+    const size_t max_indices,
+    const vec3 center,
+    const float radius
+);
+size_t lac_query_grid_nearest(
+    const LacGrid_t *grid,
+    uint32_t *indices,
+    float *dist_sq,
+    const size_t k,
+    const vec3 center,
+    const float max_radius
+);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* GRID_H */
@@ -0,0 +1,38 @@
+#ifndef JOBQUEUE_H
+#define JOBQUEUE_H
+
+#include <stdint.h>
+
+#include "lac_common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+typedef struct {
+    vec4 *v_out;
+    const vec4 *v_in;
+    size_t count;
+    mat4 m_in;
+} LacTransformJob_t;
+
+/* Opaque; the queue's internals rely on C11 atomics */
+typedef struct LacJobQueue LacJobQueue_t;
+
+/* Forward function declarations */
+
+LacJobQueue_t *lac_create_job_queue(const size_t capacity);
+void lac_destroy_job_queue(LacJobQueue_t *queue);
+
+bool lac_push_job_queue(LacJobQueue_t *queue, const LacTransformJob_t *job);
+bool lac_pop_job_queue(LacTransformJob_t *job, LacJobQueue_t *queue);
+size_t lac_drain_job_queue(LacJobQueue_t *queue, const size_t max_jobs);
+
+size_t lac_get_job_queue_capacity(const LacJobQueue_t *queue);
+uint64_t lac_get_job_queue_completed(const LacJobQueue_t *queue);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* JOBQUEUE_H */
@@ -0,0 +1,283 @@
+/**
+ * @file lac.hpp
+ * @author Neil Kingdom
+ * @since 19-10-2026
+ * @version 1.0
+ * @brief C++ value types and expression templates on top of the liblac C API.
+ *
+ * @section exprtemplates Expression Templates
+ *
+ * Writing `P * V * M * v` with ordinary C++ operators evaluates one product
+ * at a time from left to right. Each of the two matrix-matrix products
+ * creates a temporary matrix (and each C call copies its result out of a
+ * temporary of its own), only for the final matrix to be applied to a
+ * single vector. Since matrix multiplication is associative, the same
+ * result can be computed as `P * (V * (M * v))`, which needs three cheap
+ * matrix-vector products instead of two matrix-matrix products and one
+ * matrix-vector product.
+ *
+ * The operators in this header therefore don't compute anything. Instead,
+ * they return small objects (expressions) which record the operands. Only
+ * when an expression is assigned to a Vec or Mat is it evaluated, and at
+ * that point the whole chain is visible at once:
+ *
+ * - A chain of matrices applied to a vector is evaluated right to left, as
+ *   a sequence of matrix-vector products, writing the last one straight into
+ *   the destination.
+ * - A chain of matrices assigned to a matrix is evaluated left to right with
+ *   lac_multiply_matN(), writing the last product straight into the
+ *   destination.
+ *
+ * Every product is computed by the same C kernels as the rest of the
+ * library, so results are identical to calling those kernels by hand in the
+ * same order. Assigning to one of the operands (e.g. `v = M * v`) is safe.
+ *
+ * Expressions hold references to the Vec and Mat values that they were
+ * built from, so they should be assigned to a Vec or Mat straight away rather
+ * than stored (e.g. with auto).
+ */
+
+#ifndef LAC_HPP
+#define LAC_HPP
+
+#include <cstddef>
+#include <type_traits>
+
+#include "lac_common.h"
+#include "vecmath.h"
+#include "matmath.h"
+#include "transforms.h"
+
+namespace lac {
+
+/* Value types */
+
+template <std::size_t N>
+struct Vec {
+    static_assert(N >= 2 && N <= 4, "liblac vectors have 2, 3 or 4 components");
+
+    using lac_vec_expr = void;
+    static constexpr std::size_t size = N;
+    static constexpr bool is_leaf = true;
+
+    float data[N];
+
+    constexpr float &operator[](const std::size_t i) { return data[i]; }
+    constexpr const float &operator[](const std::size_t i) const { return data[i]; }
+
+    template <class E, class = typename E::lac_vec_expr>
+    Vec &operator=(const E &expr) {
+        static_assert(E::size == N, "mismatched vector sizes");
+        expr.eval_into(*this);
+        return *this;
+    }
+};
+
+template <std::size_t N>
+struct Mat {
+    static_assert(N >= 2 && N <= 4, "liblac matrices are 2x2, 3x3 or 4x4");
+
+    using lac_mat_expr = void;
+    static constexpr std::size_t size = N;
+    static constexpr bool is_leaf = true;
+
+    /* Same element order as the C API, i.e. determined by LAC_IS_ROW_MAJOR */
+    float data[N * N];
+
+    constexpr float &operator[](const std::size_t i) { return data[i]; }
+    constexpr const float &operator[](const std::size_t i) const { return data[i]; }
+
+    template <class E, class = typename E::lac_mat_expr>
+    Mat &operator=(const E &expr) {
+        static_assert(E::size == N, "mismatched matrix sizes");
+        expr.eval_into(*this);
+        return *this;
+    }
+};
+
+using Vec2 = Vec<2>;
+using Vec3 = Vec<3>;
+using Vec4 = Vec<4>;
+using Mat2 = Mat<2>;
+using Mat3 = Mat<3>;
+using Mat4 = Mat<4>;
+
+static_assert(sizeof(Vec3) == sizeof(vec3) && std::is_standard_layout<Vec3>::value, "Vec must match the C layout");
+static_assert(sizeof(Mat4) == sizeof(mat4) && std::is_standard_layout<Mat4>::value, "Mat must match the C layout");
+
+namespace detail {
+
+template <class T, class = void>
+struct is_vec_expr : std::false_type {};
+template <class T>
+struct is_vec_expr<T, std::void_t<typename T::lac_vec_expr>> : std::true_type {};
+
+template <class T, class = void>
+struct is_mat_expr : std::false_type {};
+template <class T>
+struct is_mat_expr<T, std::void_t<typename T::lac_mat_expr>> : std::true_type {};
+
+/* Leaves are held by reference, and expressions (which are temporaries) by value */
+template <class T>
+using node_t = std::conditional_t<T::is_leaf, const T &, const T>;
+
+/* Bindings onto the C kernels */
+
+inline void multiply(Vec<2> &v_out, const Vec<2> &v_in, const Mat<2> &m_in) { lac_multiply_vec2_mat2(v_out.data, v_in.data, m_in.data); }
+inline void multiply(Vec<3> &v_out, const Vec<3> &v_in, const Mat<3> &m_in) { lac_multiply_vec3_mat3(v_out.data, v_in.data, m_in.data); }
+inline void multiply(Vec<4> &v_out, const Vec<4> &v_in, const Mat<4> &m_in) { lac_multiply_vec4_mat4(v_out.data, v_in.data, m_in.data); }
+
+inline void multiply(Mat<2> &m_out, const Mat<2> &m_a, const Mat<2> &m_b) { lac_multiply_mat2(m_out.data, m_a.data, m_b.data); }
+inline void multiply(Mat<3> &m_out, const Mat<3> &m_a, const Mat<3> &m_b) { lac_multiply_mat3(m_out.data, m_a.data, m_b.data); }
+inline void multiply(Mat<4> &m_out, const Mat<4> &m_a, const Mat<4> &m_b) { lac_multiply_mat4(m_out.data, m_a.data, m_b.data); }
+
+/**
+ * @brief Gets the value of a matrix or vector expression, without copying leaves.
+ * @param[in] node The expression
+ * @returns A reference to __node__ if it is a leaf, otherwise its evaluated value
+ */
+template <class T>
+decltype(auto) eval(const T &node) {
+    if constexpr (T::is_leaf) {
+        return (node);
+    } else if constexpr (is_mat_expr<T>::value) {
+        Mat<T::size> result;
+        node.eval_into(result);
+        return result;
+    } else {
+        Vec<T::size> result;
+        node.eval_into(result);
+        return result;
+    }
+}
+
+/**
+ * @brief Applies a matrix expression to a vector without evaluating the matrix.
+ * @param[out] v_out The product vector; may be the same as __v_in__
+ * @param[in] node The matrix expression
+ * @param[in] v_in The input vector
+ */
+template <class T>
+void apply(Vec<T::size> &v_out, const T &node, const Vec<T::size> &v_in) {
+    if constexpr (T::is_leaf) {
+        multiply(v_out, v_in, node);
+    } else {
+        node.apply(v_out, v_in);
+    }
+}
+
+} /* namespace detail */
+
+/* Expressions */
+
+template <class L, class R>
+struct MatProduct {
+    static_assert(L::size == R::size, "mismatched matrix sizes");
+
+    using lac_mat_expr = void;
+    static constexpr std::size_t size = L::size;
+    static constexpr bool is_leaf = false;
+
+    detail::node_t<L> lhs;
+    detail::node_t<R> rhs;
+
+    void eval_into(Mat<size> &m_out) const {
+        detail::multiply(m_out, detail::eval(lhs), detail::eval(rhs));
+    }
+
+    /* (lhs * rhs) * v is evaluated as lhs * (rhs * v) */
+    void apply(Vec<size> &v_out, const Vec<size> &v_in) const {
+        Vec<size> tmp;
+        detail::apply(tmp, rhs, v_in);
+        detail::apply(v_out, lhs, tmp);
+    }
+
+    operator Mat<size>() const {
+        Mat<size> result;
+        eval_into(result);
+        return result;
+    }
+};
+
+template <class M, class V>
+struct MatVecProduct {
+    static_assert(M::size == V::size, "mismatched matrix and vector sizes");
+
+    using lac_vec_expr = void;
+    static constexpr std::size_t size = M::size;
+    static constexpr bool is_leaf = false;
+
+    detail::node_t<M> mat;
+    detail::node_t<V> vec;
+
+    void eval_into(Vec<size> &v_out) const {
+        detail::apply(v_out, mat, detail::eval(vec));
+    }
+
+    operator Vec<size>() const {
+        Vec<size> result;
+        eval_into(result);
+        return result;
+    }
+};
+
+template <class L, class R,
+    std::enable_if_t<detail::is_mat_expr<L>::value && detail::is_mat_expr<R>::value, int> = 0>
+MatProduct<L, R> operator*(const L &lhs, const R &rhs) {
+    return { lhs, rhs };
+}
+
+template <class M, class V,
+    std::enable_if_t<detail::is_mat_expr<M>::value && detail::is_vec_expr<V>::value, int> = 0>
+MatVecProduct<M, V> operator*(const M &mat, const V &vec) {
+    return { mat, vec };
+}
+
+/* Eager operations */
+
+inline Vec<2> operator+(const Vec<2> &a, const Vec<2> &b) { Vec<2> r; lac_add_vec2(r.data, a.data, b.data); return r; }
+inline Vec<3> operator+(const Vec<3> &a, const Vec<3> &b) { Vec<3> r; lac_add_vec3(r.data, a.data, b.data); return r; }
+inline Vec<4> operator+(const Vec<4> &a, const Vec<4> &b) { Vec<4> r; lac_add_vec4(r.data, a.data, b.data); return r; }
+
+inline Vec<2> operator-(const Vec<2> &a, const Vec<2> &b) { Vec<2> r; lac_subtract_vec2(r.data, a.data, b.data); return r; }
+inline Vec<3> operator-(const Vec<3> &a, const Vec<3> &b) { Vec<3> r; lac_subtract_vec3(r.data, a.data, b.data); return r; }
+inline Vec<4> operator-(const Vec<4> &a, const Vec<4> &b) { Vec<4> r; lac_subtract_vec4(r.data, a.data, b.data); return r; }
+
+inline Vec<2> operator*(const Vec<2> &v, const float s) { Vec<2> r; lac_multiply_vec2(r.data, v.data, s); return r; }
+inline Vec<3> operator*(const Vec<3> &v, const float s) { Vec<3> r; lac_multiply_vec3(r.data, v.data, s); return r; }
+inline Vec<4> operator*(const Vec<4> &v, const float s) { Vec<4> r; lac_multiply_vec4(r.data, v.data, s); return r; }
+
+template <std::size_t N>
+Vec<N> operator*(const float s, const Vec<N> &v) { return v * s; }
+
+inline float dot(const Vec<2> &a, const Vec<2> &b) { float r; lac_calc_dot_prod_vec2(&r, a.data, b.data); return r; }
+inline float dot(const Vec<3> &a, const Vec<3> &b) { float r; lac_calc_dot_prod_vec3(&r, a.data, b.data); return r; }
+inline float dot(const Vec<4> &a, const Vec<4> &b) { float r; lac_calc_dot_prod_vec4(&r, a.data, b.data); return r; }
+
+inline Vec<3> cross(const Vec<3> &a, const Vec<3> &b) { Vec<3> r; lac_calc_cross_prod(r.data, a.data, b.data); return r; }
+
+inline Vec<2> normalize(const Vec<2> &v) { Vec<2> r; lac_normalize_vec2(r.data, v.data); return r; }
+inline Vec<3> normalize(const Vec<3> &v) { Vec<3> r; lac_normalize_vec3(r.data, v.data); return r; }
+inline Vec<4> normalize(const Vec<4> &v) { Vec<4> r; lac_normalize_vec4(r.data, v.data); return r; }
+
+inline Vec<2> lerp(const Vec<2> &a, const Vec<2> &b, const float t) { Vec<2> r; lac_lerp_vec2(r.data, a.data, b.data, t); return r; }
+inline Vec<3> lerp(const Vec<3> &a, const Vec<3> &b, const float t) { Vec<3> r; lac_lerp_vec3(r.data, a.data, b.data, t); return r; }
+inline Vec<4> lerp(const Vec<4> &a, const Vec<4> &b, const float t) { Vec<4> r; lac_lerp_vec4(r.data, a.data, b.data, t); return r; }
+
+inline Mat<2> operator+(const Mat<2> &a, const Mat<2> &b) { Mat<2> r; lac_add_mat2(r.data, a.data, b.data); return r; }
+inline Mat<3> operator+(const Mat<3> &a, const Mat<3> &b) { Mat<3> r; lac_add_mat3(r.data, a.data, b.data); return r; }
+inline Mat<4> operator+(const Mat<4> &a, const Mat<4> &b) { Mat<4> r; lac_add_mat4(r.data, a.data, b.data); return r; }
+
+inline Mat<2> operator-(const Mat<2> &a, const Mat<2> &b) { Mat<2> r; lac_subtract_mat2(r.data, a.data, b.data); return r; }
+inline Mat<3> operator-(const Mat<3> &a, const Mat<3> &b) { Mat<3> r; lac_subtract_mat3(r.data, a.data, b.data); return r; }
+inline Mat<4> operator-(const Mat<4> &a, const Mat<4> &b) { Mat<4> r; lac_subtract_mat4(r.data, a.data, b.data); return r; }
+
+inline Mat<2> transpose(const Mat<2> &m) { Mat<2> r; lac_transpose_mat2(r.data, m.data); return r; }
+inline Mat<3> transpose(const Mat<3> &m) { Mat<3> r; lac_transpose_mat3(r.data, m.data); return r; }
+inline Mat<4> transpose(const Mat<4> &m) { Mat<4> r; lac_transpose_mat4(r.data, m.data); return r; }
+
+inline Mat<4> invert(const Mat<4> &m) { Mat<4> r; lac_invert_mat4(r.data, m.data); return r; }
+
+} /* namespace lac */
+
+#endif /* LAC_HPP */
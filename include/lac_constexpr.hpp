@@ -0,0 +1,644 @@
+/**
+ * @file lac_constexpr.hpp
+ * @author Neil Kingdom
+ * @since 19-10-2026
+ * @version 1.0
+ * @brief constexpr equivalents of the transforms.c builders and the matmath.c operations.
+ *
+ * @section constexpr Compile-Time Matrices
+ *
+ * Many matrices never change once a program is written: a reflection that
+ * swaps handedness, a fixed rotation between two coordinate conventions, or
+ * a scale which converts between units. Building these with the C functions
+ * means paying for the calls at startup, and since the compiler can't see
+ * through them, it can't fold the results into the code that uses them.
+ *
+ * Every function in the lac::cx namespace is constexpr, so a matrix declared
+ * as `constexpr lac::Mat4 m = lac::cx::get_scalar_mat4(...)` is computed by the
+ * compiler and placed in read-only data (or folded away entirely). The same
+ * functions may also be called at run-time, where they behave like their C
+ * counterparts.
+ *
+ * Since the standard sinf(), cosf(), tanf() and sqrtf() aren't constexpr, this
+ * header provides its own. Each works in double precision and rounds its result
+ * to float, which makes it accurate to within 1 ULP of the C library. The matrix
+ * products sum their terms in the same order as matmath.c and vecmath.c, so
+ * with strict IEEE arithmetic they give bit-for-bit the same results as the C
+ * kernels. That only holds for the run-time calls while the compiler rounds
+ * every step as written, though: -ffast-math may reorder the sums, and FMA
+ * contraction (which GCC applies by default when the target has FMA, e.g. with
+ * -march=native) may fuse the multiplies and adds, differently in each copy.
+ * Either can move a result by an ULP or so. Values computed at compile-time
+ * are always rounded step by step.
+ */
+
+#ifndef LAC_CONSTEXPR_HPP
+#define LAC_CONSTEXPR_HPP
+
+#include <limits>
+
+#include "lac.hpp"
+
+namespace lac {
+namespace cx {
+
+/* Maths */
+
+namespace detail {
+
+/**
+ * @brief Evaluates sin(r) for |r| <= pi/4 with its Taylor series, which has converged to double precision by x^21.
+ * @param[in] r The angle (given in radians)
+ * @returns sin(r)
+ */
+constexpr double sin_kernel(const double r) {
+    const double r2 = r * r;
+    double term = r, sum = r;
+
+    for (int i = 2; i <= 20; i += 2) {
+        term *= -r2 / (double)(i * (i + 1));
+        sum += term;
+    }
+    return sum;
+}
+
+/**
+ * @brief Evaluates cos(r) for |r| <= pi/4 with its Taylor series.
+ * @param[in] r The angle (given in radians)
+ * @returns cos(r)
+ */
+constexpr double cos_kernel(const double r) {
+    const double r2 = r * r;
+    double term = 1.0, sum = 1.0;
+
+    for (int i = 1; i <= 19; i += 2) {
+        term *= -r2 / (double)(i * (i + 1));
+        sum += term;
+    }
+    return sum;
+}
+
+/**
+ * @brief Reduces __x__ to the range [-pi/4, pi/4] by subtracting a multiple of pi/2.
+ * @param[in] x The angle (given in radians)
+ * @param[out] quadrant The multiple of pi/2 which was subtracted, modulo 4
+ * @returns The reduced angle
+ */
+constexpr double reduce(const double x, int &quadrant) {
+    /* pi/2 split into a leading part with a short mantissa and the remainder, so k * pio2_hi is exact */
+    constexpr double pio2_hi = 1.57079632673412561417e+00;
+    constexpr double pio2_lo = 6.07710050650619224932e-11;
+    const double t = x * 6.36619772367581382433e-01;
+    const long long k = (long long)(t < 0.0 ? t - 0.5 : t + 0.5);
+
+    quadrant = (int)(k & 3);
+    return (x - ((double)k * pio2_hi)) - ((double)k * pio2_lo);
+}
+
+} /* namespace detail */
+
+/**
+ * @brief Calculates the sine of an angle.
+ * @since 19-10-2026
+ * @param[in] x The angle (given in radians)
+ * @returns sin(x)
+ */
+constexpr float sin(const float x) {
+    int quadrant = 0;
+    const double r = detail::reduce(x, quadrant);
+
+    switch (quadrant) {
+        case 0:  return (float)detail::sin_kernel(r);
+        case 1:  return (float)detail::cos_kernel(r);
+        case 2:  return (float)-detail::sin_kernel(r);
+        default: return (float)-detail::cos_kernel(r);
+    }
+}
+
+/**
+ * @brief Calculates the cosine of an angle.
+ * @since 19-10-2026
+ * @param[in] x The angle (given in radians)
+ * @returns cos(x)
+ */
+constexpr float cos(const float x) {
+    int quadrant = 0;
+    const double r = detail::reduce(x, quadrant);
+
+    switch (quadrant) {
+        case 0:  return (float)detail::cos_kernel(r);
+        case 1:  return (float)-detail::sin_kernel(r);
+        case 2:  return (float)-detail::cos_kernel(r);
+        default: return (float)detail::sin_kernel(r);
+    }
+}
+
+/**
+ * @brief Calculates the tangent of an angle.
+ * @since 19-10-2026
+ * @param[in] x The angle (given in radians)
+ * @returns tan(x)
+ */
+constexpr float tan(const float x) {
+    int quadrant = 0;
+    const double r = detail::reduce(x, quadrant);
+    const double s = detail::sin_kernel(r), c = detail::cos_kernel(r);
+
+    return (float)((quadrant & 1) ? -c / s : s / c);
+}
+
+/**
+ * @brief Calculates the square root of a number with Newton's method.
+ * @since 19-10-2026
+ * @param[in] x The number
+ * @returns sqrt(x), or NaN if __x__ is negative
+ */
+constexpr float sqrt(const float x) {
+    double guess = 1.0;
+
+    if (!(x >= 0.0f)) {
+        return std::numeric_limits<float>::quiet_NaN();
+    }
+    if (x == 0.0f || x == std::numeric_limits<float>::infinity()) {
+        return x;
+    }
+
+    /* Start from a power of 2 within a factor of 2 of the root, from which 6 iterations reach double precision */
+    for (double y = x; y >= 4.0; y *= 0.25) {
+        guess *= 2.0;
+    }
+    for (double y = x; y < 0.25; y *= 4.0) {
+        guess *= 0.5;
+    }
+    for (int i = 0; i < 6; ++i) {
+        guess = 0.5 * (guess + ((double)x / guess));
+    }
+    return (float)guess;
+}
+
+/* Matrix and vector operations */
+
+namespace detail {
+
+/**
+ * @brief Multiplies two matrices stored as rows, so that out[r] = sum of m_a[r][k] * m_b[k], like _lac_multiply_rows().
+ */
+template <std::size_t N>
+constexpr Mat<N> multiply_rows(const Mat<N> &m_a, const Mat<N> &m_b) {
+    Mat<N> m_out = {};
+
+    for (std::size_t r = 0; r < N; ++r) {
+        for (std::size_t c = 0; c < N; ++c) {
+            float sum = m_a[r * N] * m_b[c];
+            for (std::size_t k = 1; k < N; ++k) {
+                sum = (m_a[(r * N) + k] * m_b[(k * N) + c]) + sum;
+            }
+            m_out[(r * N) + c] = sum;
+        }
+    }
+    return m_out;
+}
+
+/**
+ * @brief Gets the element in row __r__ and column __c__ of a matrix, respecting LAC_IS_ROW_MAJOR.
+ */
+template <std::size_t N>
+constexpr float element(const Mat<N> &m_in, const std::size_t r, const std::size_t c) {
+#if LAC_IS_ROW_MAJOR
+    return m_in[(r * N) + c];
+#else
+    return m_in[(c * N) + r];
+#endif
+}
+
+} /* namespace detail */
+
+/**
+ * @brief Adds two matrices.
+ * @since 19-10-2026
+ * @param[in] m_a The augend matrix
+ * @param[in] m_b The addend matrix
+ * @returns The sum matrix
+ */
+template <std::size_t N>
+constexpr Mat<N> add(const Mat<N> &m_a, const Mat<N> &m_b) {
+    Mat<N> m_out = {};
+
+    for (std::size_t i = 0; i < N * N; ++i) {
+        m_out[i] = m_a[i] + m_b[i];
+    }
+    return m_out;
+}
+
+/**
+ * @brief Subtracts two matrices.
+ * @since 19-10-2026
+ * @param[in] m_a The minuend matrix
+ * @param[in] m_b The subtrahend matrix
+ * @returns The difference matrix
+ */
+template <std::size_t N>
+constexpr Mat<N> subtract(const Mat<N> &m_a, const Mat<N> &m_b) {
+    Mat<N> m_out = {};
+
+    for (std::size_t i = 0; i < N * N; ++i) {
+        m_out[i] = m_a[i] - m_b[i];
+    }
+    return m_out;
+}
+
+/**
+ * @brief Performs matrix multiplication on two matrices, giving the same result as lac_multiply_matN().
+ * @since 19-10-2026
+ * @param[in] m_a The multiplicand matrix
+ * @param[in] m_b The multiplier matrix
+ * @returns The product matrix
+ */
+template <std::size_t N>
+constexpr Mat<N> multiply(const Mat<N> &m_a, const Mat<N> &m_b) {
+#if LAC_IS_ROW_MAJOR
+    return detail::multiply_rows(m_a, m_b);
+#else
+    return detail::multiply_rows(m_b, m_a);
+#endif
+}
+
+/**
+ * @brief Multiplies a matrix by a vector, giving the same result as lac_multiply_vecN_matN().
+ * @since 19-10-2026
+ * @param[in] v_in The input vector
+ * @param[in] m_in The input matrix
+ * @returns The product vector
+ */
+template <std::size_t N>
+constexpr Vec<N> multiply(const Vec<N> &v_in, const Mat<N> &m_in) {
+    Vec<N> v_out = {};
+
+    /* Sum the columns of the matrix, each scaled by the matching component of the vector */
+    for (std::size_t r = 0; r < N; ++r) {
+        float sum = detail::element(m_in, r, 0) * v_in[0];
+        for (std::size_t c = 1; c < N; ++c) {
+            sum = (detail::element(m_in, r, c) * v_in[c]) + sum;
+        }
+        v_out[r] = sum;
+    }
+    return v_out;
+}
+
+/**
+ * @brief Transposes a matrix.
+ * @since 19-10-2026
+ * @param[in] m_in The matrix to be transposed
+ * @returns The transposed matrix
+ */
+template <std::size_t N>
+constexpr Mat<N> transpose(const Mat<N> &m_in) {
+    Mat<N> m_out = {};
+
+    for (std::size_t r = 0; r < N; ++r) {
+        for (std::size_t c = 0; c < N; ++c) {
+            m_out[(c * N) + r] = m_in[(r * N) + c];
+        }
+    }
+    return m_out;
+}
+
+/**
+ * @brief Calculates the dot product of two vectors.
+ * @since 19-10-2026
+ * @param[in] v_a The first vector
+ * @param[in] v_b The second vector
+ * @returns The dot product
+ */
+template <std::size_t N>
+constexpr float dot(const Vec<N> &v_a, const Vec<N> &v_b) {
+    float sum = v_a[0] * v_b[0];
+
+    for (std::size_t i = 1; i < N; ++i) {
+        sum += v_a[i] * v_b[i];
+    }
+    return sum;
+}
+
+/**
+ * @brief Calculates the cross product of two vectors of length 3.
+ * @since 19-10-2026
+ * @param[in] v_a The first vector
+ * @param[in] v_b The second vector
+ * @returns The cross product
+ */
+constexpr Vec<3> cross(const Vec<3> &v_a, const Vec<3> &v_b) {
+    return { {
+        (v_a[1] * v_b[2]) - (v_a[2] * v_b[1]),
+        (v_a[2] * v_b[0]) - (v_a[0] * v_b[2]),
+        (v_a[0] * v_b[1]) - (v_a[1] * v_b[0])
+    } };
+}
+
+/**
+ * @brief Normalizes a vector, returning the zero vector if its magnitude is 0.
+ * @since 19-10-2026
+ * @param[in] v_in The vector to be normalized
+ * @returns The unit vector
+ */
+template <std::size_t N>
+constexpr Vec<N> normalize(const Vec<N> &v_in) {
+    const float magnitude = cx::sqrt(cx::dot(v_in, v_in));
+    Vec<N> v_out = {};
+
+    if (magnitude != 0.0f) {
+        const float inv_magnitude = 1.0f / magnitude;
+        for (std::size_t i = 0; i < N; ++i) {
+            v_out[i] = v_in[i] * inv_magnitude;
+        }
+    }
+    return v_out;
+}
+
+/* Builders (see transforms.c) */
+
+/**
+ * @brief Gets an identity matrix.
+ * @since 19-10-2026
+ * @returns The NxN identity matrix
+ */
+template <std::size_t N>
+constexpr Mat<N> get_ident_mat() {
+    Mat<N> m_out = {};
+
+    for (std::size_t i = 0; i < N; ++i) {
+        m_out[(i * N) + i] = 1.0f;
+    }
+    return m_out;
+}
+
+/**
+ * @brief Gets a 2x2 reflection matrix, like lac_get_reflection_mat2().
+ * @since 19-10-2026
+ * @param[in] yz_plane If set to true, reflection is applied about the y-z plane
+ * @param[in] xz_plane If set to true, reflection is applied about the x-z plane
+ * @returns The reflection matrix
+ */
+constexpr Mat<2> get_reflection_mat2(const bool yz_plane, const bool xz_plane) {
+    return { {
+        yz_plane ? -1.0f : 1.0f, 0,
+        0,                       xz_plane ? -1.0f : 1.0f
+    } };
+}
+
+/**
+ * @brief Gets a 3x3 reflection matrix, like lac_get_reflection_mat3().
+ * @since 19-10-2026
+ * @param[in] yz_plane If set to true, reflection is applied about the y-z plane
+ * @param[in] xz_plane If set to true, reflection is applied about the x-z plane
+ * @param[in] xy_plane If set to true, reflection is applied about the x-y plane
+ * @returns The reflection matrix
+ */
+constexpr Mat<3> get_reflection_mat3(const bool yz_plane, const bool xz_plane, const bool xy_plane) {
+    return { {
+        yz_plane ? -1.0f : 1.0f, 0,                       0,
+        0,                       xz_plane ? -1.0f : 1.0f, 0,
+        0,                       0,                       xy_plane ? -1.0f : 1.0f
+    } };
+}
+
+/**
+ * @brief Gets a 4x4 reflection matrix, like lac_get_reflection_mat4().
+ * @since 19-10-2026
+ * @param[in] yz_plane If set to true, reflection is applied about the y-z plane
+ * @param[in] xz_plane If set to true, reflection is applied about the x-z plane
+ * @param[in] xy_plane If set to true, reflection is applied about the x-y plane
+ * @returns The reflection matrix
+ */
+constexpr Mat<4> get_reflection_mat4(const bool yz_plane, const bool xz_plane, const bool xy_plane) {
+    return { {
+        yz_plane ? -1.0f : 1.0f, 0,                       0,                       0,
+        0,                       xz_plane ? -1.0f : 1.0f, 0,                       0,
+        0,                       0,                       xy_plane ? -1.0f : 1.0f, 0,
+        0,                       0,                       0,                       1
+    } };
+}
+
+/**
+ * @brief Gets a 2x2 translation matrix, like lac_get_translation_mat2().
+ * @since 19-10-2026
+ * @param[in] tx Arbitrary unit for translation in the x-direction
+ * @returns The translation matrix
+ */
+constexpr Mat<2> get_translation_mat2(const float tx) {
+    return { {
+        1,    tx,
+        0,    1
+    } };
+}
+
+/**
+ * @brief Gets a 3x3 translation matrix, like lac_get_translation_mat3().
+ * @since 19-10-2026
+ * @param[in] tx Arbitrary unit for translation in the x-direction
+ * @param[in] ty Arbitrary unit for translation in the y-direction
+ * @returns The translation matrix
+ */
+constexpr Mat<3> get_translation_mat3(const float tx, const float ty) {
+    return { {
+        1,    0,    tx,
+        0,    1,    ty,
+        0,    0,    1
+    } };
+}
+
+/**
+ * @brief Gets a 4x4 translation matrix, like lac_get_translation_mat4().
+ * @since 19-10-2026
+ * @param[in] tx Arbitrary unit for translation in the x-direction
+ * @param[in] ty Arbitrary unit for translation in the y-direction
+ * @param[in] tz Arbitrary unit for translation in the z-direction
+ * @returns The translation matrix
+ */
+constexpr Mat<4> get_translation_mat4(const float tx, const float ty, const float tz) {
+    return { {
+        1,    0,    0,    tx,
+        0,    1,    0,    ty,
+        0,    0,    1,    tz,
+        0,    0,    0,    1
+    } };
+}
+
+/**
+ * @brief Gets a 2x2 scalar matrix, like lac_get_scalar_mat2().
+ * @since 19-10-2026
+ * @param[in] sx Arbitrary unit for scaling in the x-direction
+ * @param[in] sy Arbitrary unit for scaling in the y-direction
+ * @returns The scalar matrix
+ */
+constexpr Mat<2> get_scalar_mat2(const float sx, const float sy) {
+    return { {
+        sx,   0,
+        0,    sy
+    } };
+}
+
+/**
+ * @brief Gets a 3x3 scalar matrix, like lac_get_scalar_mat3().
+ * @since 19-10-2026
+ * @param[in] sx Arbitrary unit for scaling in the x-direction
+ * @param[in] sy Arbitrary unit for scaling in the y-direction
+ * @param[in] sz Arbitrary unit for scaling in the z-direction
+ * @returns The scalar matrix
+ */
+constexpr Mat<3> get_scalar_mat3(const float sx, const float sy, const float sz) {
+    return { {
+        sx,   0,    0,
+        0,    sy,   0,
+        0,    0,    sz
+    } };
+}
+
+/**
+ * @brief Gets a 4x4 scalar matrix, like lac_get_scalar_mat4().
+ * @since 19-10-2026
+ * @param[in] sx Arbitrary unit for scaling in the x-direction
+ * @param[in] sy Arbitrary unit for scaling in the y-direction
+ * @param[in] sz Arbitrary unit for scaling in the z-direction
+ * @returns The scalar matrix
+ */
+constexpr Mat<4> get_scalar_mat4(const float sx, const float sy, const float sz) {
+    return { {
+        sx,   0,    0,    0,
+        0,    sy,   0,    0,
+        0,    0,    sz,   0,
+        0,    0,    0,    1
+    } };
+}
+
+/**
+ * @brief Gets a rotation matrix according to the input angle of yaw, like lac_get_yaw_mat4().
+ * @since 19-10-2026
+ * @param[in] yaw Rotation angle about the yaw axis (given in radians)
+ * @returns The rotation matrix
+ */
+constexpr Mat<4> get_yaw_mat4(const float yaw) {
+    const float cos_yaw = cx::cos(yaw), sin_yaw = cx::sin(yaw);
+
+    return { {
+        cos_yaw, -sin_yaw,  0,        0,
+        sin_yaw,  cos_yaw,  0,        0,
+        0,        0,        1,        0,
+        0,        0,        0,        1
+    } };
+}
+
+/**
+ * @brief Gets a rotation matrix according to the input angle of pitch, like lac_get_pitch_mat4().
+ * @since 19-10-2026
+ * @param[in] pitch Rotation angle about the pitch axis (given in radians)
+ * @returns The rotation matrix
+ */
+constexpr Mat<4> get_pitch_mat4(const float pitch) {
+    const float cos_pitch = cx::cos(pitch), sin_pitch = cx::sin(pitch);
+
+    return { {
+        cos_pitch, 0,        sin_pitch, 0,
+        0,         1,        0,         0,
+       -sin_pitch, 0,        cos_pitch, 0,
+        0,         0,        0,         1
+    } };
+}
+
+/**
+ * @brief Gets a rotation matrix according to the input angle of roll, like lac_get_roll_mat4().
+ * @since 19-10-2026
+ * @param[in] roll Rotation angle about the roll axis (given in radians)
+ * @returns The rotation matrix
+ */
+constexpr Mat<4> get_roll_mat4(const float roll) {
+    const float cos_roll = cx::cos(roll), sin_roll = cx::sin(roll);
+
+    return { {
+        1,        0,          0,         0,
+        0,        cos_roll,  -sin_roll,  0,
+        0,        sin_roll,   cos_roll,  0,
+        0,        0,          0,         1
+    } };
+}
+
+/**
+ * @brief Gets a rotation matrix according to the input angles for each axis, like lac_get_rotation_mat4().
+ * @since 19-10-2026
+ * @param[in] rx Rotation angle in the x-axis (given in radians)
+ * @param[in] ry Rotation angle in the y-axis (given in radians)
+ * @param[in] rz Rotation angle in the z-axis (given in radians)
+ * @returns The rotation matrix (yaw * pitch * roll)
+ */
+constexpr Mat<4> get_rotation_mat4(const float rx, const float ry, const float rz) {
+    return cx::multiply(cx::multiply(cx::get_yaw_mat4(rz), cx::get_pitch_mat4(ry)), cx::get_roll_mat4(rx));
+}
+
+/**
+ * @brief Gets a normalized point-at matrix, like lac_get_point_at_mat4().
+ * @since 19-10-2026
+ * @param[in] v_eye A vector representing the origin of the camera
+ * @param[in] v_target A vector representing the target point in 3D space for the camera to point towards
+ * @param[in] v_up A vector representing the "up" direction (used for camera orientation)
+ * @returns The point-at matrix
+ */
+constexpr Mat<4> get_point_at_mat4(const Vec<3> &v_eye, const Vec<3> &v_target, const Vec<3> &v_up) {
+    const Vec<3> forward_unit = cx::normalize(Vec<3>{ { v_target[0] - v_eye[0], v_target[1] - v_eye[1], v_target[2] - v_eye[2] } });
+    const float dot_prod = cx::dot(v_up, forward_unit);
+    const Vec<3> up_unit = cx::normalize(Vec<3>{ {
+        v_up[0] - (forward_unit[0] * dot_prod),
+        v_up[1] - (forward_unit[1] * dot_prod),
+        v_up[2] - (forward_unit[2] * dot_prod)
+    } });
+    const Vec<3> right_unit = cx::cross(up_unit, forward_unit);
+
+    return { {
+        right_unit[0], up_unit[0], forward_unit[0], v_eye[0],
+        right_unit[1], up_unit[1], forward_unit[1], v_eye[1],
+        right_unit[2], up_unit[2], forward_unit[2], v_eye[2],
+        0,             0,          0,               1
+    } };
+}
+
+/**
+ * @brief Inverts a rotation and translation matrix, like lac_invert_mat4().
+ * @warning This is not a true matrix inversion function; it only works with rotation and translation matrices.
+ * @since 19-10-2026
+ * @param[in] m_in The matrix to be inverted
+ * @returns The inverted matrix
+ */
+constexpr Mat<4> invert(const Mat<4> &m_in) {
+    const Vec<3> v_trn = { { m_in[3], m_in[7], m_in[11] } };
+
+    return { {
+        m_in[0], m_in[4], m_in[8],  -cx::dot(v_trn, Vec<3>{ { m_in[0], m_in[4], m_in[8] } }),
+        m_in[1], m_in[5], m_in[9],  -cx::dot(v_trn, Vec<3>{ { m_in[1], m_in[5], m_in[9] } }),
+        m_in[2], m_in[6], m_in[10], -cx::dot(v_trn, Vec<3>{ { m_in[2], m_in[6], m_in[10] } }),
+        0,       0,       0,        1
+    } };
+}
+
+/**
+ * @brief Gets a frustum projection matrix, like lac_get_projection_mat4().
+ * @since 19-10-2026
+ * @param[in] aspect The aspect ratio of the screen (taken by height/width)
+ * @param[in] fov The field of view (given as an angle in radians)
+ * @param[in] znear The "near" clipping z-plane
+ * @param[in] zfar The "far" clipping z-plane
+ * @returns The projection matrix
+ */
+constexpr Mat<4> get_projection_mat4(const float aspect, const float fov, const float znear, const float zfar) {
+    const float f = 1.0f / cx::tan(fov / 2.0f);
+
+    return { {
+        f / aspect, 0, 0, 0,
+        0, f, 0, 0,
+        0, 0, (zfar + znear) / (znear - zfar), -1,
+        0, 0, (2.0f * zfar * znear) / (znear - zfar), 0
+    } };
+}
+
+} /* namespace cx */
+} /* namespace lac */
+
+#endif /* LAC_CONSTEXPR_HPP */
@@ -0,0 +1,312 @@
+/**
+ * @file lac_span.hpp
+ * @author Neil Kingdom
+ * @since 19-10-2026
+ * @version 1.0
+ * @brief C++20 adapters which pass spans and mdspans of vectors to the batch kernels.
+ *
+ * @section spans Spans
+ *
+ * C++ code rarely stores its vertices as C arrays of vec3. More often they
+ * live in a `std::vector<std::array<float, 3>>`, a `std::vector<lac::Vec3>`,
+ * or a `std::mdspan` with one row per vertex. All of these have the same
+ * layout as an array of vec3 (N floats per vertex, one vertex after the
+ * other), so they can be handed to the batch kernels in batch.h as they are,
+ * without copying them.
+ *
+ * The functions in this header accept any contiguous range whose elements are
+ * lac::Vec<N>, std::array<float, N> or float[N] (e.g. a std::span or a
+ * std::vector), as well as row-major mdspans with N columns where the
+ * standard library provides them. The input and output may be the same range.
+ *
+ * @section policies Execution Policies
+ *
+ * Each function also has an overload which takes a standard execution policy
+ * first. With std::execution::par or par_unseq, the range is cut into pieces of
+ * LAC_SCHEDULER_BATCH_GRAIN vectors which are handed to std::for_each(), so the
+ * standard library decides how to spread them across threads. Note that
+ * libstdc++ runs parallel algorithms on TBB, so programs which include this
+ * header with libstdc++ need to link with -ltbb. Programs which would rather use
+ * the liblac scheduler can pass a LacScheduler_t instead of a policy.
+ */
+
+#ifndef LAC_SPAN_HPP
+#define LAC_SPAN_HPP
+
+#if __cplusplus < 202002L
+#error "lac_span.hpp requires C++20"
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <execution>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <vector>
+#include <version>
+
+#if defined(__cpp_lib_mdspan)
+#include <mdspan>
+#endif
+
+#include "lac.hpp"
+#include "batch.h"
+#include "scheduler.h"
+
+namespace lac {
+
+namespace detail {
+
+/* Number of floats in a vector type which shares the layout of vecN, or 0 for any other type */
+template <class T>
+struct vec_size : std::integral_constant<std::size_t, 0> {};
+template <std::size_t N>
+struct vec_size<Vec<N>> : std::integral_constant<std::size_t, N> {};
+template <std::size_t N>
+struct vec_size<std::array<float, N>> : std::integral_constant<std::size_t, N> {};
+template <std::size_t N>
+struct vec_size<float[N]> : std::integral_constant<std::size_t, N> {};
+
+static_assert(sizeof(std::array<float, 3>) == sizeof(vec3), "std::array must match the C layout");
+
+/* A batch of __count__ vectors of N floats each, starting at __data__ */
+template <std::size_t N, class F>
+struct BatchView {
+    F *data;
+    std::size_t count;
+};
+
+/**
+ * @brief Describes the layout of a range or mdspan of vectors, for the batch kernels.
+ */
+template <class R, class = void>
+struct batch_traits {
+    static constexpr std::size_t size = 0;
+};
+
+template <class R>
+    requires std::ranges::contiguous_range<R> && std::ranges::sized_range<R>
+        && (vec_size<std::ranges::range_value_t<R>>::value != 0)
+struct batch_traits<R> {
+    static constexpr std::size_t size = vec_size<std::ranges::range_value_t<R>>::value;
+    static constexpr bool is_mutable = !std::is_const_v<std::remove_reference_t<std::ranges::range_reference_t<R>>>;
+
+    static auto view(R &r) {
+        using F = std::conditional_t<is_mutable, float, const float>;
+        return BatchView<size, F>{ reinterpret_cast<F*>(std::ranges::data(r)), std::ranges::size(r) };
+    }
+};
+
+#if defined(__cpp_lib_mdspan)
+template <class T, class I, std::size_t N, class A>
+    requires std::is_same_v<std::remove_const_t<T>, float> && (N >= 2 && N <= 4)
+struct batch_traits<std::mdspan<T, std::extents<I, std::dynamic_extent, N>, std::layout_right, A>> {
+    static constexpr std::size_t size = N;
+    static constexpr bool is_mutable = !std::is_const_v<T>;
+
+    static auto view(const std::mdspan<T, std::extents<I, std::dynamic_extent, N>, std::layout_right, A> &m) {
+        return BatchView<N, T>{ m.data_handle(), static_cast<std::size_t>(m.extent(0)) };
+    }
+};
+#endif
+
+template <class R>
+using batch_traits_t = batch_traits<std::remove_cvref_t<R>>;
+
+/**
+ * @brief Gets the batch view of a range or mdspan of vectors.
+ */
+template <class R>
+auto view(R &&r) {
+    return batch_traits_t<R>::view(r);
+}
+
+/* Bindings onto the C kernels */
+
+inline void multiply_array(BatchView<2, float> v_out, BatchView<2, const float> v_in, const Mat<2> &m_in, const std::size_t begin, const std::size_t end) {
+    lac_multiply_vec2_mat2_array(reinterpret_cast<vec2*>(v_out.data) + begin, reinterpret_cast<const vec2*>(v_in.data) + begin, m_in.data, end - begin);
+}
+inline void multiply_array(BatchView<3, float> v_out, BatchView<3, const float> v_in, const Mat<3> &m_in, const std::size_t begin, const std::size_t end) {
+    lac_multiply_vec3_mat3_array(reinterpret_cast<vec3*>(v_out.data) + begin, reinterpret_cast<const vec3*>(v_in.data) + begin, m_in.data, end - begin);
+}
+inline void multiply_array(BatchView<4, float> v_out, BatchView<4, const float> v_in, const Mat<4> &m_in, const std::size_t begin, const std::size_t end) {
+    lac_multiply_vec4_mat4_array(reinterpret_cast<vec4*>(v_out.data) + begin, reinterpret_cast<const vec4*>(v_in.data) + begin, m_in.data, end - begin);
+}
+
+inline void parallel_multiply_array(LacScheduler_t *scheduler, BatchView<2, float> v_out, BatchView<2, const float> v_in, const Mat<2> &m_in) {
+    lac_parallel_multiply_vec2_mat2_array(scheduler, reinterpret_cast<vec2*>(v_out.data), reinterpret_cast<const vec2*>(v_in.data), m_in.data, v_in.count);
+}
+inline void parallel_multiply_array(LacScheduler_t *scheduler, BatchView<3, float> v_out, BatchView<3, const float> v_in, const Mat<3> &m_in) {
+    lac_parallel_multiply_vec3_mat3_array(scheduler, reinterpret_cast<vec3*>(v_out.data), reinterpret_cast<const vec3*>(v_in.data), m_in.data, v_in.count);
+}
+inline void parallel_multiply_array(LacScheduler_t *scheduler, BatchView<4, float> v_out, BatchView<4, const float> v_in, const Mat<4> &m_in) {
+    lac_parallel_multiply_vec4_mat4_array(scheduler, reinterpret_cast<vec4*>(v_out.data), reinterpret_cast<const vec4*>(v_in.data), m_in.data, v_in.count);
+}
+
+/**
+ * @brief Calls func(begin, end) for consecutive pieces of [0, count), running the pieces according to __policy__.
+ * @param[in] policy The execution policy
+ * @param[in] count The number of vectors
+ * @param[in] func The function which processes a piece
+ */
+template <class P, class F>
+void for_each_piece(P &&policy, const std::size_t count, F &&func) {
+    constexpr std::size_t grain = LAC_SCHEDULER_BATCH_GRAIN;
+
+    if constexpr (std::is_same_v<std::remove_cvref_t<P>, std::execution::sequenced_policy>) {
+        func(std::size_t{ 0 }, count);
+    } else {
+        if (count <= grain) {
+            func(std::size_t{ 0 }, count);
+            return;
+        }
+
+        /* Only the offsets of the pieces are stored; the vectors are used in place */
+        std::vector<std::size_t> pieces((count + grain - 1) / grain);
+        std::iota(pieces.begin(), pieces.end(), std::size_t{ 0 });
+        std::for_each(std::forward<P>(policy), pieces.begin(), pieces.end(), [&](const std::size_t piece) {
+            func(piece * grain, std::min(count, (piece + 1) * grain));
+        });
+    }
+}
+
+} /* namespace detail */
+
+/**
+ * @brief A contiguous range (or mdspan) of vectors that can be passed to the batch kernels.
+ */
+template <class R>
+concept VecBatch = (detail::batch_traits_t<R>::size >= 2 && detail::batch_traits_t<R>::size <= 4);
+
+/**
+ * @brief A VecBatch that can be written to.
+ */
+template <class R>
+concept MutableVecBatch = VecBatch<R> && detail::batch_traits_t<R>::is_mutable;
+
+/**
+ * @brief Multiplies a range of vectors by a matrix, like lac_multiply_vecN_matN_array().
+ * @since 19-10-2026
+ * @param[out] v_out The output vectors; must hold at least as many vectors as __v_in__, and may be the same as __v_in__
+ * @param[in] v_in The input vectors
+ * @param[in] m_in The input matrix
+ */
+template <MutableVecBatch Out, VecBatch In, std::size_t N>
+    requires (detail::batch_traits_t<Out>::size == N && detail::batch_traits_t<In>::size == N)
+void multiply_array(Out &&v_out, In &&v_in, const Mat<N> &m_in) {
+    const detail::BatchView<N, float> out = detail::view(v_out);
+    const detail::BatchView<N, const float> in = { detail::view(v_in).data, detail::view(v_in).count };
+
+    assert(out.count >= in.count);
+    detail::multiply_array(out, in, m_in, 0, in.count);
+}
+
+/**
+ * @brief Multiplies a range of vectors by a matrix, spreading the work according to an execution policy.
+ * @since 19-10-2026
+ * @param[in] policy The execution policy, e.g. std::execution::par_unseq
+ * @param[out] v_out The output vectors; must hold at least as many vectors as __v_in__, and may be the same as __v_in__
+ * @param[in] v_in The input vectors
+ * @param[in] m_in The input matrix
+ */
+template <class P, MutableVecBatch Out, VecBatch In, std::size_t N>
+    requires std::is_execution_policy_v<std::remove_cvref_t<P>>
+        && (detail::batch_traits_t<Out>::size == N && detail::batch_traits_t<In>::size == N)
+void multiply_array(P &&policy, Out &&v_out, In &&v_in, const Mat<N> &m_in) {
+    const detail::BatchView<N, float> out = detail::view(v_out);
+    const detail::BatchView<N, const float> in = { detail::view(v_in).data, detail::view(v_in).count };
+
+    assert(out.count >= in.count);
+    detail::for_each_piece(std::forward<P>(policy), in.count, [&](const std::size_t begin, const std::size_t end) {
+        detail::multiply_array(out, in, m_in, begin, end);
+    });
+}
+
+/**
+ * @brief Multiplies a range of vectors by a matrix using every thread of a liblac scheduler.
+ * @since 19-10-2026
+ * @param[in] scheduler The scheduler
+ * @param[out] v_out The output vectors; must hold at least as many vectors as __v_in__, and may be the same as __v_in__
+ * @param[in] v_in The input vectors
+ * @param[in] m_in The input matrix
+ */
+template <MutableVecBatch Out, VecBatch In, std::size_t N>
+    requires (detail::batch_traits_t<Out>::size == N && detail::batch_traits_t<In>::size == N)
+void multiply_array(LacScheduler_t *scheduler, Out &&v_out, In &&v_in, const Mat<N> &m_in) {
+    const detail::BatchView<N, float> out = detail::view(v_out);
+    const detail::BatchView<N, const float> in = { detail::view(v_in).data, detail::view(v_in).count };
+
+    assert(out.count >= in.count);
+    detail::parallel_multiply_array(scheduler, out, in, m_in);
+}
+
+/**
+ * @brief Projects a range of clip-space vertices to the viewport, like lac_project_vec4_array().
+ * @since 19-10-2026
+ * @param[in] policy The execution policy, e.g. std::execution::par_unseq
+ * @param[out] v_out The window-space vertices; must hold at least as many vectors as __v_in__
+ * @param[out] clip_codes The outcodes (a mask of LacClipCode_t) of each vertex; must be as long as __v_in__
+ * @param[in] v_in The input vertices
+ * @param[in] m_mvp The model-view-projection matrix
+ * @param[in] viewport The viewport
+ * @param[in] remap_depth If set to true, NDC depth is mapped from [-1, 1] onto [min_depth, max_depth]
+ */
+template <class P, MutableVecBatch Out, VecBatch In>
+    requires std::is_execution_policy_v<std::remove_cvref_t<P>>
+        && (detail::batch_traits_t<Out>::size == 3 && detail::batch_traits_t<In>::size == 4)
+void project_array(
+    P &&policy,
+    Out &&v_out,
+    std::span<std::uint8_t> clip_codes,
+    In &&v_in,
+    const Mat<4> &m_mvp,
+    const LacViewport_t &viewport,
+    const bool remap_depth
+) {
+    const detail::BatchView<3, float> out = detail::view(v_out);
+    const detail::BatchView<4, const float> in = { detail::view(v_in).data, detail::view(v_in).count };
+
+    assert(out.count >= in.count && clip_codes.size() >= in.count);
+    detail::for_each_piece(std::forward<P>(policy), in.count, [&](const std::size_t begin, const std::size_t end) {
+        lac_project_vec4_array(
+            reinterpret_cast<vec3*>(out.data) + begin,
+            clip_codes.data() + begin,
+            reinterpret_cast<const vec4*>(in.data) + begin,
+            m_mvp.data,
+            &viewport,
+            end - begin,
+            remap_depth
+        );
+    });
+}
+
+/**
+ * @brief Projects a range of clip-space vertices to the viewport, like lac_project_vec4_array().
+ * @since 19-10-2026
+ * @param[out] v_out The window-space vertices; must hold at least as many vectors as __v_in__
+ * @param[out] clip_codes The outcodes (a mask of LacClipCode_t) of each vertex; must be as long as __v_in__
+ * @param[in] v_in The input vertices
+ * @param[in] m_mvp The model-view-projection matrix
+ * @param[in] viewport The viewport
+ * @param[in] remap_depth If set to true, NDC depth is mapped from [-1, 1] onto [min_depth, max_depth]
+ */
+template <MutableVecBatch Out, VecBatch In>
+    requires (detail::batch_traits_t<Out>::size == 3 && detail::batch_traits_t<In>::size == 4)
+void project_array(
+    Out &&v_out,
+    std::span<std::uint8_t> clip_codes,
+    In &&v_in,
+    const Mat<4> &m_mvp,
+    const LacViewport_t &viewport,
+    const bool remap_depth
+) {
+    project_array(std::execution::seq, std::forward<Out>(v_out), clip_codes, std::forward<In>(v_in), m_mvp, viewport, remap_depth);
+}
+
+} /* namespace lac */
+
+#endif /* LAC_SPAN_HPP */
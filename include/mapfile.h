@@ -0,0 +1,54 @@
+#ifndef MAPFILE_H
+#define MAPFILE_H
+
+#include <stdint.h>
+
+#include "lac_common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#define LAC_ARRAY_FILE_VERSION 1
+/* Alignment of the first element of the array within the file */
+#define LAC_ARRAY_FILE_ALIGN 64
+
+typedef enum {
+    LAC_ARRAY_VEC2 = 1,
+    LAC_ARRAY_VEC3,
+    LAC_ARRAY_VEC4,
+    LAC_ARRAY_MAT2,
+    LAC_ARRAY_MAT3,
+    LAC_ARRAY_MAT4
+} LacArrayType_t;
+
+typedef struct {
+    void *base;
+    size_t length;
+    void *data;
+    size_t count;
+    LacArrayType_t type;
+    bool writable;
+} LacMappedArray_t;
+
+/* Forward function declarations */
+
+int lac_write_array_file(const char *path, const void *data, const LacArrayType_t type, const size_t count);
+int lac_create_array_file(LacMappedArray_t *mapped, const char *path, const LacArrayType_t type, const size_t count);
+int lac_map_array_file(LacMappedArray_t *mapped, const char *path, const bool writable);
+void lac_unmap_array_file(LacMappedArray_t *mapped);
+
+size_t lac_get_array_type_size(const LacArrayType_t type);
+
+vec2 *lac_get_mapped_vec2_array(const LacMappedArray_t *mapped);
+vec3 *lac_get_mapped_vec3_array(const LacMappedArray_t *mapped);
+vec4 *lac_get_mapped_vec4_array(const LacMappedArray_t *mapped);
+mat2 *lac_get_mapped_mat2_array(const LacMappedArray_t *mapped);
+mat3 *lac_get_mapped_mat3_array(const LacMappedArray_t *mapped);
+mat4 *lac_get_mapped_mat4_array(const LacMappedArray_t *mapped);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* MAPFILE_H */
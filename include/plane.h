@@ -0,0 +1,50 @@
+#ifndef PLANE_H
+#define PLANE_H
+
+#include <stdint.h>
+
+#include "lac_common.h"
+#include "batch.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* Sides of a plane reported by lac_classify_plane_soa() */
+typedef enum {
+    LAC_PLANE_ON    = 1 << 0,
+    LAC_PLANE_FRONT = 1 << 1,
+    LAC_PLANE_BACK  = 1 << 2
+} LacPlaneSide_t;
+
+/* The plane of points p where dot(normal, p) + d = 0; the normal points towards the front */
+typedef struct {
+    vec3 normal;
+    float d;
+} LacPlane_t;
+
+/* Forward function declarations */
+
+bool lac_init_plane(LacPlane_t *plane, const vec3 v_point, const vec3 v_normal);
+bool lac_init_plane_from_points(LacPlane_t *plane, const vec3 v_a, const vec3 v_b, const vec3 v_c);
+bool lac_normalize_plane(LacPlane_t *out, const LacPlane_t *plane);
+void lac_transform_plane(LacPlane_t *out, const LacPlane_t *plane, const mat4 m_in);
+
+void lac_calc_plane_distance(float *distance, const LacPlane_t *plane, const vec3 v_point);
+void lac_calc_plane_distance_soa(float *distances, const LacSoaVec3_t *points, const LacPlane_t *plane, const size_t count);
+uint8_t lac_classify_plane_soa(
+    uint8_t *front,
+    uint8_t *back,
+    uint8_t *on,
+    const LacSoaVec3_t *points,
+    const LacPlane_t *plane,
+    const float epsilon,
+    const size_t count
+);
+void lac_project_plane_soa(LacSoaVec3_t *out, const LacSoaVec3_t *points, const LacPlane_t *plane, const size_t count);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* PLANE_H */
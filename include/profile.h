@@ -0,0 +1,37 @@
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include <stdint.h>
+
+#include "lac_common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* Number of log2 buckets in each histogram, i.e. calls of up to 2^32 ticks are told apart */
+#define LAC_PROFILE_BUCKETS 32
+/* Maximum number of distinct functions recorded by each thread */
+#define LAC_PROFILE_MAX_FUNCS 512
+
+/* Statistics for one function, summed across every thread */
+typedef struct {
+    const void *func;
+    const char *name;
+    uint64_t calls;
+    uint64_t ticks;
+    uint64_t histogram[LAC_PROFILE_BUCKETS];
+} LacProfileEntry_t;
+
+/* Forward function declarations */
+
+bool lac_is_profile_enabled(void);
+size_t lac_get_profile_snapshot(LacProfileEntry_t *entries, const size_t max_entries);
+void lac_reset_profile(void);
+int lac_dump_profile_json(FILE *stream);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* PROFILE_H */
@@ -0,0 +1,90 @@
+#ifndef RAY_H
+#define RAY_H
+
+#include <stdint.h>
+
+#include "lac_common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* Number of rays or triangles tested together by the packet kernels */
+#define LAC_RAY_PACKET 8
+/* Value of LacRayHit_t::prim for a ray which has not hit anything */
+#define LAC_RAY_NO_HIT UINT32_MAX
+
+typedef struct {
+    vec3 origin;
+    vec3 direction;
+    float tmin;
+    float tmax;
+} LacRay_t;
+
+/* The nearest hit found so far, where the hit point is v0 + u * (v1 - v0) + v * (v2 - v0) */
+typedef struct {
+    float t;
+    float u;
+    float v;
+    uint32_t prim;
+} LacRayHit_t;
+
+/* LAC_RAY_PACKET rays in SoA layout, i.e. origin[c][i] is component c of the origin of ray i */
+typedef struct {
+    float origin[3][LAC_RAY_PACKET];
+    float direction[3][LAC_RAY_PACKET];
+    float tmin[LAC_RAY_PACKET];
+} LacRayPacket_t;
+
+/* The nearest hit found so far by each ray in a LacRayPacket_t */
+typedef struct {
+    float t[LAC_RAY_PACKET];
+    float u[LAC_RAY_PACKET];
+    float v[LAC_RAY_PACKET];
+    uint32_t prim[LAC_RAY_PACKET];
+} LacRayHitPacket_t;
+
+/* LAC_RAY_PACKET triangles in SoA layout, each stored as its first vertex and two edges */
+typedef struct {
+    float v0[3][LAC_RAY_PACKET];
+    float e1[3][LAC_RAY_PACKET];
+    float e2[3][LAC_RAY_PACKET];
+    uint32_t prim[LAC_RAY_PACKET];
+} LacTrianglePacket_t;
+
+/* Forward function declarations */
+
+void lac_init_ray(LacRay_t *ray, const vec3 v_origin, const vec3 v_direction, const float tmin, const float tmax);
+void lac_init_ray_hit(LacRayHit_t *hit, const LacRay_t *ray);
+void lac_init_ray_packet(LacRayPacket_t *packet, LacRayHitPacket_t *hits, const LacRay_t *rays, const size_t count);
+void lac_init_triangle_packet(
+    LacTrianglePacket_t *packet,
+    const vec3 *vertices,
+    const uint32_t *indices,
+    const uint32_t *prims,
+    const size_t count
+);
+
+bool lac_intersect_ray_triangle(
+    LacRayHit_t *hit,
+    const LacRay_t *ray,
+    const vec3 v0,
+    const vec3 v1,
+    const vec3 v2,
+    const uint32_t prim
+);
+uint8_t lac_intersect_ray_packet_triangle(
+    LacRayHitPacket_t *hits,
+    const LacRayPacket_t *rays,
+    const vec3 v0,
+    const vec3 v1,
+    const vec3 v2,
+    const uint32_t prim
+);
+bool lac_intersect_ray_triangle_packet(LacRayHit_t *hit, const LacRay_t *ray, const LacTrianglePacket_t *triangles);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* RAY_H */
@@ -0,0 +1,71 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#ifdef __cplusplus
+#include <atomic>
+/* std::atomic<size_t> has the same size and representation as _Atomic size_t */
+typedef std::atomic<size_t> lac_atomic_size_t;
+#else
+#include <stdatomic.h>
+typedef atomic_size_t lac_atomic_size_t;
+#endif /* __cplusplus */
+
+#include "lac_common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* Upper bound on the number of threads (including the creating thread) */
+#define LAC_SCHEDULER_MAX_THREADS 64
+/* Number of elements below which the batch helpers stop splitting a range */
+#define LAC_SCHEDULER_BATCH_GRAIN 4096
+/* Smallest piece that a range is split into when no grain is given */
+#define LAC_SCHEDULER_MIN_GRAIN 256
+
+typedef void (*LacTaskFunc_t)(void *arg);
+typedef void (*LacRangeFunc_t)(void *arg, size_t begin, size_t end);
+
+/* Opaque; owns the worker threads and their deques */
+typedef struct LacScheduler LacScheduler_t;
+
+typedef struct {
+    lac_atomic_size_t pending;
+} LacTaskGroup_t;
+
+/* Forward function declarations */
+
+LacScheduler_t *lac_create_scheduler(const size_t num_threads);
+void lac_destroy_scheduler(LacScheduler_t *scheduler);
+size_t lac_get_scheduler_thread_count(const LacScheduler_t *scheduler);
+
+void lac_init_task_group(LacTaskGroup_t *group);
+bool lac_submit_task(LacScheduler_t *scheduler, LacTaskGroup_t *group, LacTaskFunc_t func, void *arg);
+bool lac_submit_range_task(
+    LacScheduler_t *scheduler,
+    LacTaskGroup_t *group,
+    LacRangeFunc_t func,
+    void *arg,
+    const size_t begin,
+    const size_t end,
+    const size_t grain
+);
+void lac_wait_task_group(LacScheduler_t *scheduler, LacTaskGroup_t *group);
+
+void lac_parallel_for(
+    LacScheduler_t *scheduler,
+    LacRangeFunc_t func,
+    void *arg,
+    const size_t count,
+    const size_t grain
+);
+
+void lac_parallel_multiply_vec2_mat2_array(LacScheduler_t *scheduler, vec2 *v_out, const vec2 *v_in, const mat2 m_in, const size_t count);
+void lac_parallel_multiply_vec3_mat3_array(LacScheduler_t *scheduler, vec3 *v_out, const vec3 *v_in, const mat3 m_in, const size_t count);
+void lac_parallel_multiply_vec4_mat4_array(LacScheduler_t *scheduler, vec4 *v_out, const vec4 *v_in, const mat4 m_in, const size_t count);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* SCHEDULER_H */
@@ -0,0 +1,74 @@
+#ifndef SPARSE_H
+#define SPARSE_H
+
+#include <stdint.h>
+
+#include "lac_common.h"
+#include "scheduler.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* Number of rows and columns in each block of a LacBsr3_t */
+#define LAC_BSR_BLOCK 3
+
+/* One entry of a matrix being assembled, at (row, col) */
+typedef struct {
+    uint32_t row;
+    uint32_t col;
+    float value;
+} LacTriplet_t;
+
+/*
+ * Compressed sparse row matrix. The entries of row r are [row_start[r], row_start[r + 1]),
+ * sorted by column, with their columns in col_index and their values in values.
+ */
+typedef struct {
+    size_t rows;
+    size_t cols;
+    size_t nnz;
+    uint32_t *row_start;
+    uint32_t *col_index;
+    float *values;
+} LacCsr_t;
+
+/*
+ * Block compressed sparse row matrix of 3x3 blocks. The blocks of block row r are
+ * [row_start[r], row_start[r + 1]), sorted by block column, with their block columns
+ * in col_index and their entries in blocks.
+ */
+typedef struct {
+    size_t block_rows;
+    size_t block_cols;
+    size_t block_count;
+    uint32_t *row_start;
+    uint32_t *col_index;
+    mat3 *blocks;
+} LacBsr3_t;
+
+/* Forward function declarations */
+
+int lac_init_csr(LacCsr_t *csr, const size_t rows, const size_t cols, const LacTriplet_t *triplets, const size_t count);
+void lac_free_csr(LacCsr_t *csr);
+int lac_transpose_csr(LacCsr_t *out, const LacCsr_t *csr);
+void lac_multiply_csr_vec(float *y, const LacCsr_t *csr, const float *x);
+void lac_parallel_multiply_csr_vec(LacScheduler_t *scheduler, float *y, const LacCsr_t *csr, const float *x);
+
+int lac_init_bsr3(
+    LacBsr3_t *bsr,
+    const size_t block_rows,
+    const size_t block_cols,
+    const LacTriplet_t *triplets,
+    const size_t count
+);
+void lac_free_bsr3(LacBsr3_t *bsr);
+int lac_transpose_bsr3(LacBsr3_t *out, const LacBsr3_t *bsr);
+void lac_multiply_bsr3_vec(vec3 *y, const LacBsr3_t *bsr, const vec3 *x);
+void lac_parallel_multiply_bsr3_vec(LacScheduler_t *scheduler, vec3 *y, const LacBsr3_t *bsr, const vec3 *x);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* SPARSE_H */
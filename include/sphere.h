@@ -0,0 +1,34 @@
+#ifndef SPHERE_H
+#define SPHERE_H
+
+#include "lac_common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* A bounding sphere; a sphere with a negative radius is empty */
+typedef struct {
+    vec3 center;
+    float radius;
+} LacSphere_t;
+
+/* Forward function declarations */
+
+void lac_init_sphere(LacSphere_t *sphere);
+void lac_init_sphere_from_points(LacSphere_t *sphere, const vec3 *points, const size_t count);
+
+void lac_merge_sphere(LacSphere_t *out, const LacSphere_t *a, const LacSphere_t *b);
+void lac_merge_sphere_array(LacSphere_t *out, const LacSphere_t *a, const LacSphere_t *b, const size_t count);
+
+void lac_transform_sphere(LacSphere_t *out, const LacSphere_t *sphere, const mat4 m_in);
+void lac_transform_sphere_array(LacSphere_t *out, const LacSphere_t *in, const mat4 *m_in, const size_t count);
+
+bool lac_test_sphere_overlap(const LacSphere_t *a, const LacSphere_t *b);
+size_t lac_test_sphere_overlap_array(bool *results, const LacSphere_t *spheres, const LacSphere_t *query, const size_t count);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* SPHERE_H */
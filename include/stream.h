@@ -0,0 +1,31 @@
+#ifndef STREAM_H
+#define STREAM_H
+
+#include "lac_common.h"
+#include "arena.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/* Number of buffers cycled between the read, compute and write stages */
+#define LAC_STREAM_BUFFERS 3
+/* Default size of each buffer; chunk sizes are rounded up to a multiple of LAC_STREAM_ALIGN */
+#define LAC_STREAM_CHUNK_SIZE (4 * 1024 * 1024)
+#define LAC_STREAM_ALIGN 4096
+
+/* Forward function declarations */
+
+int lac_stream_multiply_vec4_mat4(
+    const int fd_out,
+    const int fd_in,
+    const mat4 m_in,
+    const size_t chunk_size,
+    LacArena_t *scratch
+);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* STREAM_H */
@@ -14,6 +14,25 @@ extern mat3 lac_ident_mat3;
 extern mat4 lac_ident_mat4;
 extern mat4 lac_ortho_proj_mat4;
 
+/*
+ * The parts of an affine transform, as found by lac_decompose_mat4(), such that the
+ * transform is translation * rotation * shear * scale
+ */
+typedef struct {
+    vec3 translation;
+    vec4 rotation;      /* A unit quaternion (x, y, z, w), with w >= 0 */
+    vec3 euler;         /* The same rotation as (rx, ry, rz), as taken by lac_get_rotation_mat4() */
+    vec3 scale;         /* The x scale is negative if the transform is a reflection */
+    vec3 shear;         /* The xy, xz and yz shear factors */
+    bool reflected;
+} LacTransformParts_t;
+
+/* How lac_orthonormalize_mat3_array() and lac_orthonormalize_mat4_array() correct a matrix */
+typedef enum {
+    LAC_ORTHONORMALIZE_GRAM_SCHMIDT,    /* Keeps the x axis, then the xy plane, and corrects the others; the cheapest */
+    LAC_ORTHONORMALIZE_SYMMETRIC        /* Finds the nearest orthonormal matrix, which spreads the correction evenly */
+} LacOrthonormalizeMode_t;
+
 /* Forward function declarations */
 
 void lac_get_reflection_mat2(mat2 m_out, const bool yz_plane, const bool xz_plane);
@@ -37,6 +56,11 @@ void lac_invert_mat4(mat4 m_out, const mat4 m_in);
 void lac_get_point_at_mat4(mat4 m_out, const vec3 v_eye, const vec3 v_target, const vec3 v_up);
 void lac_get_projection_mat4(mat4 m_out, const float aspect, const float fov, const float znear, const float zfar);
 
+bool lac_decompose_mat4(LacTransformParts_t *parts, const mat4 m_in);
+size_t lac_decompose_mat4_array(LacTransformParts_t *parts, const mat4 *m_in, const size_t count);
+size_t lac_orthonormalize_mat3_array(mat3 *m_out, const mat3 *m_in, const size_t count, const LacOrthonormalizeMode_t mode);
+size_t lac_orthonormalize_mat4_array(mat4 *m_out, const mat4 *m_in, const size_t count, const LacOrthonormalizeMode_t mode);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
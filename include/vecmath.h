@@ -29,6 +29,10 @@ void lac_divide_vec2(vec2 v_out, const vec2 v_in, const float scalar);
 void lac_divide_vec3(vec3 v_out, const vec3 v_in, const float scalar);
 void lac_divide_vec4(vec4 v_out, const vec4 v_in, const float scalar);
 
+void lac_lerp_vec2(vec2 v_out, const vec2 v_a, const vec2 v_b, const float t);
+void lac_lerp_vec3(vec3 v_out, const vec3 v_a, const vec3 v_b, const float t);
+void lac_lerp_vec4(vec4 v_out, const vec4 v_a, const vec4 v_b, const float t);
+
 void lac_calc_dot_prod_vec2(float *dot_prod, const vec2 v_a, const vec2 v_b);
 void lac_calc_dot_prod_vec3(float *dot_prod, const vec3 v_a, const vec3 v_b);
 void lac_calc_dot_prod_vec4(float *dot_prod, const vec4 v_a, const vec4 v_b);
@@ -0,0 +1,271 @@
+/**
+ * @file aabb.c
+ * @author Neil Kingdom
+ * @since 19-10-2026
+ * @version 1.0
+ * @brief Contains functions for building and comparing axis-aligned bounding boxes.
+ *
+ * @section aabb Axis-Aligned Bounding Boxes
+ *
+ * An axis-aligned bounding box (AABB) is the smallest box with faces parallel
+ * to the x, y and z axes which contains a given set of points. It is stored
+ * as its minimum and maximum corners. Two AABBs overlap exactly when their
+ * ranges overlap on every one of the three axes, which makes AABBs one of
+ * the cheapest shapes to test against each other, and the usual choice for
+ * the bounds of the nodes in a BVH (see bvh.c).
+ *
+ * An empty box is represented with its minimum corner at FLT_MAX and its
+ * maximum corner at -FLT_MAX, so that expanding it by any point or merging
+ * it with any box gives back that point or box, and it overlaps nothing.
+ *
+ * @subsection aabb_related Related Functions
+ *
+ * - @ref lac_init_aabb_anchor "lac_init_aabb"
+ * - @ref lac_merge_aabb_anchor "lac_merge_aabb"
+ * - @ref lac_test_aabb_overlap_anchor "lac_test_aabb_overlap"
+ *
+ * @section aabbtransform Transforming Boxes
+ *
+ * When an object moves, the box around its model space geometry has to be
+ * carried into world space by its model matrix. Rotating a box tilts it off
+ * the axes, so the result is the axis-aligned box around the rotated one.
+ * The obvious way to find it is to transform all 8 corners and take their
+ * bounds, which costs 8 full matrix-vector products per box. The same box
+ * can be found far more cheaply by storing the box as its center c and
+ * half-extent e. The new center is simply M * c, while along each world
+ * axis r, the new half-extent is the sum of |M[r][k]| * e[k] over the three
+ * model axes k. That is the furthest that any corner can reach from the
+ * center, since each corner is c plus or minus e[k] along every axis k.
+ * This takes 9 multiply-adds for the center and 9 for the extent, rather
+ * than the 8 matrix-vector products for the corners. The array version is
+ * built for each ISA level (see dispatch.h), so that the multiply-adds are
+ * fused wherever the CPU supports it.
+ *
+ * @subsection aabbtransform_related Related Functions
+ *
+ * - @ref lac_transform_aabb_anchor "lac_transform_aabb"
+ * - @ref lac_transform_aabb_array_anchor "lac_transform_aabb_array"
+ */
+
+#include <float.h>
+#include <math.h>
+
+#include "aabb.h"
+#include "lac_dispatch.h"
+
+/**
+ * @brief Initializes an empty box.
+ * @anchor lac_init_aabb_anchor
+ * @since 19-10-2026
+ * @param[out] box The box to be initialized
+ */
+LAC_DECL void lac_init_aabb(LacAabb_t *box) {
+    size_t c;
+
+    for (c = 0; c < 3; ++c) {
+        box->min[c] = FLT_MAX;
+        box->max[c] = -FLT_MAX;
+    }
+}
+
+/**
+ * @brief Initializes the smallest box which contains every point in an array.
+ * @since 19-10-2026
+ * @param[out] box The box to be initialized; it is empty if __count__ is 0
+ * @param[in] points The points
+ * @param[in] count The number of points
+ */
+LAC_DECL void lac_init_aabb_from_points(LacAabb_t *box, const vec3 *points, const size_t count) {
+    size_t i;
+
+    lac_init_aabb(box);
+    for (i = 0; i < count; ++i) {
+        lac_expand_aabb(box, points[i]);
+    }
+}
+
+/**
+ * @brief Grows a box just enough to contain a point.
+ * @since 19-10-2026
+ * @param[in,out] box The box
+ * @param[in] v_point The point
+ */
+LAC_DECL void lac_expand_aabb(LacAabb_t *box, const vec3 v_point) {
+    size_t c;
+
+    for (c = 0; c < 3; ++c) {
+        box->min[c] = (v_point[c] < box->min[c]) ? v_point[c] : box->min[c];
+        box->max[c] = (v_point[c] > box->max[c]) ? v_point[c] : box->max[c];
+    }
+}
+
+/**
+ * @brief Gets the smallest box which contains two boxes.
+ * @anchor lac_merge_aabb_anchor
+ * @since 19-10-2026
+ * @param[out] out The merged box (may be the same as __a__ or __b__)
+ * @param[in] a The first box
+ * @param[in] b The second box
+ */
+LAC_DECL void lac_merge_aabb(LacAabb_t *out, const LacAabb_t *a, const LacAabb_t *b) {
+    size_t c;
+
+    for (c = 0; c < 3; ++c) {
+        out->min[c] = (a->min[c] < b->min[c]) ? a->min[c] : b->min[c];
+        out->max[c] = (a->max[c] > b->max[c]) ? a->max[c] : b->max[c];
+    }
+}
+
+/**
+ * @brief Checks whether two boxes overlap. Boxes which only touch count as overlapping.
+ * @anchor lac_test_aabb_overlap_anchor
+ * @since 19-10-2026
+ * @param[in] a The first box
+ * @param[in] b The second box
+ * @returns True if the boxes overlap, or false otherwise
+ */
+LAC_DECL bool lac_test_aabb_overlap(const LacAabb_t *a, const LacAabb_t *b) {
+    return a->min[0] <= b->max[0] && a->max[0] >= b->min[0] &&
+           a->min[1] <= b->max[1] && a->max[1] >= b->min[1] &&
+           a->min[2] <= b->max[2] && a->max[2] >= b->min[2];
+}
+
+/**
+ * @brief Gets the point at the center of a box.
+ * @since 19-10-2026
+ * @param[out] v_out The center
+ * @param[in] box The box, which must not be empty
+ */
+LAC_DECL void lac_calc_aabb_center(vec3 v_out, const LacAabb_t *box) {
+    size_t c;
+
+    for (c = 0; c < 3; ++c) {
+        v_out[c] = 0.5f * (box->min[c] + box->max[c]);
+    }
+}
+
+/**
+ * @brief Gets the total area of the 6 faces of a box.
+ * @since 19-10-2026
+ * @param[out] area The surface area, or 0 if the box is empty
+ * @param[in] box The box
+ */
+LAC_DECL void lac_calc_aabb_surface_area(float *area, const LacAabb_t *box) {
+    float dx, dy, dz;
+
+    /* Checked before subtracting, since the extent of an empty box overflows */
+    if (box->min[0] > box->max[0] || box->min[1] > box->max[1] || box->min[2] > box->max[2]) {
+        *area = 0.0f;
+        return;
+    }
+
+    dx = box->max[0] - box->min[0];
+    dy = box->max[1] - box->min[1];
+    dz = box->max[2] - box->min[2];
+    *area = 2.0f * ((dx * dy) + (dy * dz) + (dz * dx));
+}
+
+/**
+ * @brief Gets the element at row r, column c of a 4x4 matrix.
+ * @since 19-10-2026
+ * @param[in] m_in The matrix
+ * @param[in] r The row
+ * @param[in] c The column
+ * @returns The element
+ */
+static inline float _lac_get_mat4_element(const mat4 m_in, const size_t r, const size_t c) {
+#if LAC_IS_ROW_MAJOR
+    return m_in[(r * 4) + c];
+#else
+    return m_in[(c * 4) + r];
+#endif
+}
+
+/**
+ * @brief Transforms a box by the center and extent method, shared by the single box and array functions.
+ * @since 19-10-2026
+ * @param[out] out The transformed box (may be the same as __box__)
+ * @param[in] box The box to be transformed
+ * @param[in] m_in The transformation matrix
+ */
+static LAC_ALWAYS_INLINE void _lac_transform_aabb_box(LacAabb_t *out, const LacAabb_t *box, const float * restrict m_in) {
+    vec3 v_center, v_extent;
+    float m, center, extent;
+    size_t r, c;
+
+    if (box->min[0] > box->max[0] || box->min[1] > box->max[1] || box->min[2] > box->max[2]) {
+        lac_init_aabb(out);
+        return;
+    }
+
+    /* Halved before subtracting, so that boxes spanning most of the float range do not overflow */
+    for (c = 0; c < 3; ++c) {
+        v_center[c] = (0.5f * box->max[c]) + (0.5f * box->min[c]);
+        v_extent[c] = (0.5f * box->max[c]) - (0.5f * box->min[c]);
+    }
+
+    for (r = 0; r < 3; ++r) {
+        center = _lac_get_mat4_element(m_in, r, 3);
+        extent = 0.0f;
+        for (c = 0; c < 3; ++c) {
+            m = _lac_get_mat4_element(m_in, r, c);
+            center += m * v_center[c];
+            extent += fabsf(m) * v_extent[c];
+        }
+        out->min[r] = center - extent;
+        out->max[r] = center + extent;
+    }
+}
+
+/**
+ * @brief Gets the smallest box which contains a box after it has been transformed.
+ * @anchor lac_transform_aabb_anchor
+ * @since 19-10-2026
+ *
+ * The matrix is treated as an affine transform, i.e. its bottom row is assumed to be
+ * (0, 0, 0, 1), so projection matrices are not supported.
+ *
+ * @param[out] out The transformed box (may be the same as __box__); it is empty if __box__ is empty
+ * @param[in] box The box to be transformed
+ * @param[in] m_in The transformation matrix
+ */
+LAC_DECL void lac_transform_aabb(LacAabb_t *out, const LacAabb_t *box, const mat4 m_in) {
+    _lac_transform_aabb_box(out, box, m_in);
+}
+
+/**
+ * @brief Body of lac_transform_aabb_array(), instantiated for each ISA level by LAC_MULTIVERSION().
+ * @since 19-10-2026
+ */
+static LAC_ALWAYS_INLINE void _lac_transform_aabb_array(
+    LacAabb_t *out,
+    const LacAabb_t *in,
+    const mat4 * restrict m_in,
+    const size_t count
+) {
+    size_t i;
+
+    for (i = 0; i < count; ++i) {
+        _lac_transform_aabb_box(&out[i], &in[i], m_in[i]);
+    }
+}
+
+/**
+ * @brief Transforms each box in an array by its own matrix, e.g. an object's model space bounds by its model matrix.
+ * @anchor lac_transform_aabb_array_anchor
+ * @since 19-10-2026
+ *
+ * Gives the same boxes as calling lac_transform_aabb() on each element, to within
+ * rounding.
+ *
+ * @param[out] out The transformed boxes (may be the same array as __in__)
+ * @param[in] in The boxes to be transformed
+ * @param[in] m_in The affine transformation matrix of each box
+ * @param[in] count The number of boxes in __in__, __out__ and __m_in__
+ */
+LAC_MULTIVERSION(lac_transform_aabb_array, (
+    LacAabb_t *out,
+    const LacAabb_t *in,
+    const mat4 *m_in,
+    const size_t count
+), (out, in, m_in, count))
@@ -0,0 +1,225 @@
+/**
+ * @file arena.c
+ * @author Neil Kingdom
+ * @since 19-10-2026
+ * @version 1.0
+ * @brief Provides an arena (a.k.a. bump or frame) allocator for scratch memory.
+ *
+ * @section arena Arena Allocation
+ *
+ * A general purpose allocator such as malloc() has to cope with blocks
+ * being freed in any order, which means keeping track of every free block
+ * and searching for a suitable one on each allocation. Much of the memory
+ * used by a batch pipeline, however, has a very simple lifetime: it is
+ * needed while one batch (or one frame) is being processed and can all be
+ * thrown away at once afterwards.
+ *
+ * An arena takes advantage of this. It reserves one large block of memory
+ * up front and hands out pieces of it by simply advancing (bumping) an
+ * offset, rounding up to the requested alignment. Individual allocations
+ * are never freed. Instead, the current offset can be saved as a mark, and
+ * resetting the arena to that mark releases everything allocated since in
+ * a single assignment. Once an arena has grown large enough to hold a
+ * frame's worth of scratch data, a steady-state frame performs no heap
+ * allocations at all.
+ *
+ * An arena must not be shared between threads without external locking.
+ * lac_get_thread_arena() provides each thread with its own arena, which is
+ * created on first use and released automatically when the thread exits.
+ *
+ * Within liblac, the only scratch memory needed by a call is the set of
+ * buffers of the streaming driver, which takes an arena to allocate them
+ * from. The batch kernels work directly on the caller's arrays and never
+ * allocate. The thread arena is sized to hold the streaming buffers at
+ * their default size, so that it can be passed as is; the memory is only
+ * reserved, and pages are committed as they are first used.
+ *
+ * @subsection arena_related Related Functions
+ *
+ * - @ref lac_init_arena_anchor "lac_init_arena"
+ * - @ref lac_alloc_arena_anchor "lac_alloc_arena"
+ * - @ref lac_get_arena_mark_anchor "lac_get_arena_mark"
+ * - @ref lac_reset_arena_to_mark_anchor "lac_reset_arena_to_mark"
+ * - @ref lac_get_thread_arena_anchor "lac_get_thread_arena"
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <pthread.h>
+
+#include "arena.h"
+
+static pthread_once_t _lac_thread_arena_once = PTHREAD_ONCE_INIT;
+static pthread_key_t _lac_thread_arena_key;
+static _Thread_local LacArena_t *_lac_thread_arena = NULL;
+
+/**
+ * @brief Releases a thread's arena when the thread exits.
+ * @since 19-10-2026
+ * @param[in] arg The arena owned by the exiting thread
+ */
+static void _lac_destroy_thread_arena(void *arg) {
+    lac_free_arena(arg);
+    free(arg);
+}
+
+/**
+ * @brief Creates the key used to release per-thread arenas.
+ * @since 19-10-2026
+ */
+static void _lac_create_thread_arena_key(void) {
+    pthread_key_create(&_lac_thread_arena_key, _lac_destroy_thread_arena);
+}
+
+/**
+ * @brief Initializes an arena which owns a heap allocated block of __capacity__ bytes.
+ * @anchor lac_init_arena_anchor
+ * @since 19-10-2026
+ * @param[out] arena The arena to be initialized
+ * @param[in] capacity The number of bytes which can be allocated from the arena
+ * @returns 0 on success, otherwise -1 and errno is set
+ */
+LAC_DECL int lac_init_arena(LacArena_t *arena, const size_t capacity) {
+    void *base = NULL;
+
+    memset(arena, 0, sizeof(LacArena_t));
+
+    if (capacity > 0 && posix_memalign(&base, LAC_ARENA_ALIGN, capacity) != 0) {
+        LAC_LOG("Failed to allocate arena", LAC_ERROR);
+        errno = ENOMEM;
+        return -1;
+    }
+
+    arena->base = base;
+    arena->capacity = capacity;
+    arena->owns_memory = true;
+
+    return 0;
+}
+
+/**
+ * @brief Initializes an arena which allocates from a caller owned buffer (e.g. an array on the stack).
+ * @since 19-10-2026
+ * @param[out] arena The arena to be initialized
+ * @param[in] buffer The memory to allocate from; it must outlive the arena
+ * @param[in] capacity The size of __buffer__ in bytes
+ */
+LAC_DECL void lac_init_arena_from_buffer(LacArena_t *arena, void *buffer, const size_t capacity) {
+    memset(arena, 0, sizeof(LacArena_t));
+    arena->base = buffer;
+    arena->capacity = capacity;
+    arena->owns_memory = false;
+}
+
+/**
+ * @brief Releases the memory owned by an arena. All pointers allocated from it become invalid.
+ * @since 19-10-2026
+ * @param[out] arena The arena, which is reset to all zeroes
+ */
+LAC_DECL void lac_free_arena(LacArena_t *arena) {
+    if (arena->owns_memory) {
+        free(arena->base);
+    }
+    memset(arena, 0, sizeof(LacArena_t));
+}
+
+/**
+ * @brief Allocates __size__ bytes from an arena.
+ * @anchor lac_alloc_arena_anchor
+ * @since 19-10-2026
+ * @param[out] arena The arena to allocate from
+ * @param[in] size The number of bytes to allocate
+ * @param[in] alignment The alignment of the allocation; must be a power of 2, or 0 for LAC_ARENA_ALIGN
+ * @returns The allocated memory, or NULL if the arena is exhausted
+ */
+LAC_DECL void *lac_alloc_arena(LacArena_t *arena, const size_t size, const size_t alignment) {
+    const size_t align = (alignment == 0) ? LAC_ARENA_ALIGN : alignment;
+    uintptr_t start, aligned;
+    size_t offset;
+
+    /* Align the address rather than the offset, since buffers given by the caller may be unaligned */
+    start = (uintptr_t)arena->base + arena->offset;
+    aligned = (start + (align - 1)) & ~((uintptr_t)align - 1);
+    offset = arena->offset + (size_t)(aligned - start);
+
+    if (offset > arena->capacity || size > arena->capacity - offset) {
+        LAC_LOG("Arena is exhausted", LAC_WARNING);
+        return NULL;
+    }
+
+    arena->offset = offset + size;
+    if (arena->offset > arena->peak) {
+        arena->peak = arena->offset;
+    }
+
+    return arena->base + offset;
+}
+
+/**
+ * @brief Gets the current position of an arena so that subsequent allocations can be released together.
+ * @anchor lac_get_arena_mark_anchor
+ * @since 19-10-2026
+ * @param[in] arena The arena
+ * @returns A mark which can be passed to lac_reset_arena_to_mark()
+ */
+LAC_DECL LacArenaMark_t lac_get_arena_mark(const LacArena_t *arena) {
+    return arena->offset;
+}
+
+/**
+ * @brief Releases every allocation made from an arena since __mark__ was taken.
+ * @anchor lac_reset_arena_to_mark_anchor
+ * @since 19-10-2026
+ * @param[out] arena The arena
+ * @param[in] mark A mark previously returned by lac_get_arena_mark()
+ */
+LAC_DECL void lac_reset_arena_to_mark(LacArena_t *arena, const LacArenaMark_t mark) {
+    if (mark > arena->offset) {
+        LAC_LOG("Arena mark is ahead of the arena", LAC_WARNING);
+        return;
+    }
+    arena->offset = mark;
+}
+
+/**
+ * @brief Releases every allocation made from an arena.
+ * @since 19-10-2026
+ * @param[out] arena The arena
+ */
+LAC_DECL void lac_reset_arena(LacArena_t *arena) {
+    arena->offset = 0;
+}
+
+/**
+ * @brief Gets the calling thread's own arena of LAC_THREAD_ARENA_SIZE bytes.
+ * @anchor lac_get_thread_arena_anchor
+ * @since 19-10-2026
+ *
+ * The arena is created the first time that a thread calls this function and is freed
+ * when the thread exits. It can hold the buffers of lac_stream_multiply_vec4_mat4() at
+ * their default size. Callers should take a mark before allocating and reset to it
+ * afterwards, so that the arena can be shared by unrelated code on the same thread.
+ *
+ * @returns The arena, or NULL if it could not be allocated
+ */
+LAC_DECL LacArena_t *lac_get_thread_arena(void) {
+    LacArena_t *arena;
+
+    if (_lac_thread_arena != NULL) {
+        return _lac_thread_arena;
+    }
+
+    pthread_once(&_lac_thread_arena_once, _lac_create_thread_arena_key);
+
+    arena = malloc(sizeof(LacArena_t));
+    if (arena == NULL || lac_init_arena(arena, LAC_THREAD_ARENA_SIZE) < 0) {
+        LAC_LOG("Failed to create thread arena", LAC_ERROR);
+        free(arena);
+        return NULL;
+    }
+
+    pthread_setspecific(_lac_thread_arena_key, arena);
+    _lac_thread_arena = arena;
+
+    return arena;
+}
@@ -0,0 +1,851 @@
+/**
+ * @file batch.c
+ * @author Neil Kingdom
+ * @since 19-10-2026
+ * @version 1.0
+ * @brief Contains kernels which apply the vector maths over whole arrays.
+ *
+ * @section batch Batch Kernels
+ *
+ * The functions in vecmath.c operate on a single vector per call. This is
+ * easy to reason about, but when a renderer needs to transform hundreds of
+ * thousands of vertices, the cost of each call (and of the temporary that
+ * every call copies into its output) quickly outweighs the handful of
+ * multiplications actually being performed. The batch kernels instead take
+ * a pointer to the first element of an array along with an element count,
+ * and perform the same maths as their single vector counterparts for every
+ * element in one pass. Since the loop body is identical for every element,
+ * the kernels are written on top of the SIMD layer in lac_simd.h, which
+ * the compiler maps onto whichever vector instructions the build targets.
+ *
+ * @subsection batch_related Related Functions
+ *
+ * - @ref lac_multiply_vec2_mat2_array_anchor "lac_multiply_vec2_mat2_array"
+ * - @ref lac_multiply_vec3_mat3_array_anchor "lac_multiply_vec3_mat3_array"
+ * - @ref lac_multiply_vec4_mat4_array_anchor "lac_multiply_vec4_mat4_array"
+ *
+ * @section clipscreen Clip Space to Screen Space
+ *
+ * After a vertex has been multiplied by the model, view and projection
+ * matrices (often combined into a single MVP matrix), it is said to be in
+ * clip space. A vertex is visible if each of its x, y and z components
+ * lie between -w and w. Comparing each component against these bounds
+ * gives us 6 bits of information (commonly known as an outcode) which tell
+ * a clipper which planes of the view volume the vertex lies outside of.
+ * Dividing x, y and z by w (the perspective divide) then takes the vertex
+ * into normalized device coordinates (NDC), where the visible region is the
+ * cube from -1 to 1. Finally, the viewport transform maps this cube onto
+ * the pixels of the screen, and optionally maps the depth onto a custom
+ * range such as [0, 1].
+ *
+ * Performing each of these steps as a separate pass means reading and
+ * writing the whole vertex buffer once per step. lac_project_vec4_array()
+ * instead performs all of the steps on a small block of vertices at a time
+ * while they are still held in registers, so the input buffer is only read
+ * once. Within each block, the components are transposed so that all of the
+ * x values sit next to each other, all of the y values next to each other,
+ * and so on. This layout is known as a structure of arrays (SoA), and it is
+ * what allows the compiler to work on the whole block with SIMD instructions.
+ *
+ * @subsection clipscreen_related Related Functions
+ *
+ * - @ref lac_project_vec4_array_anchor "lac_project_vec4_array"
+ *
+ * @section blend Interpolation and Blending
+ *
+ * Animation blending mixes the joint transforms of two or more poses, and
+ * with the single vector functions, every lerp costs a subtraction, a
+ * multiplication and an addition, each as its own call with its own
+ * temporary. Element-wise operations like these do not care whether a float
+ * is the x or the y of a vector, so the kernels below treat an array of
+ * vectors as one long array of floats and work on LAC_BATCH_BLOCK floats at
+ * a time, with no transposing.
+ *
+ * lac_blend_vec3_array() and its siblings take any number of input arrays,
+ * such as the joint translations of every pose in a blend tree, along with
+ * a weight for each. Each block of the output is accumulated in a register
+ * across all of the inputs and written once, rather than once per input.
+ *
+ * @subsection blend_related Related Functions
+ *
+ * - @ref lac_lerp_vec3_array_anchor "lac_lerp_vec3_array"
+ * - @ref lac_multiply_add_vec3_array_anchor "lac_multiply_add_vec3_array"
+ * - @ref lac_blend_vec3_array_anchor "lac_blend_vec3_array"
+ * - @ref lac_blend_mat4_array_anchor "lac_blend_mat4_array"
+ */
+
+#include "batch.h"
+#include "lac_simd.h"
+#include "lac_dispatch.h"
+
+/**
+ * @brief Loads a 4x4 matrix such that rows[r][c] is the element at row r, column c.
+ * @since 19-10-2026
+ * @param[out] rows The matrix elements in row order
+ * @param[in] m_in The matrix to be loaded
+ */
+static inline void _lac_load_rows_mat4(float rows[4][4], const mat4 m_in) {
+    size_t r, c;
+
+    for (r = 0; r < 4; ++r) {
+        for (c = 0; c < 4; ++c) {
+#if LAC_IS_ROW_MAJOR
+            rows[r][c] = m_in[(r * 4) + c];
+#else
+            rows[r][c] = m_in[(c * 4) + r];
+#endif
+        }
+    }
+}
+
+/**
+ * @brief Runs the clip-to-screen pipeline on exactly LAC_BATCH_BLOCK vertices.
+ * @since 19-10-2026
+ * @param[out] v_out The screen space positions
+ * @param[out] clip_codes The outcode for each vertex
+ * @param[in] v_in The object space positions
+ * @param[in] rows The MVP matrix, as loaded by _lac_load_rows_mat4()
+ * @param[in] scale The viewport scale for the x, y and z components
+ * @param[in] bias The viewport offset for the x, y and z components
+ */
+static inline void _lac_project_block(
+    vec3 * restrict v_out,
+    uint8_t * restrict clip_codes,
+    const vec4 * restrict v_in,
+    float rows[4][4],
+    const float scale[3],
+    const float bias[3]
+) {
+    float soa[4][LAC_BATCH_BLOCK], clip[4][LAC_BATCH_BLOCK];
+    float *x = clip[0], *y = clip[1], *z = clip[2], *w = clip[3];
+    const lac_f32x8 zero = lac_simd_splat_f32x8(0.0f);
+    lac_f32x8 v[4], res, inv_w;
+    size_t i, r, c;
+
+    /* Transpose the block so that each component fills one 8-wide vector */
+    for (i = 0; i < LAC_BATCH_BLOCK; ++i) {
+        for (c = 0; c < 4; ++c) {
+            soa[c][i] = v_in[i][c];
+        }
+    }
+    for (c = 0; c < 4; ++c) {
+        v[c] = lac_simd_load_f32x8(soa[c]);
+    }
+
+    /* Transform into clip space */
+    for (r = 0; r < 4; ++r) {
+        res = lac_simd_mul_f32x8(lac_simd_splat_f32x8(rows[r][0]), v[0]);
+        for (c = 1; c < 4; ++c) {
+            res = lac_simd_madd_f32x8(lac_simd_splat_f32x8(rows[r][c]), v[c], res);
+        }
+        lac_simd_store_f32x8(clip[r], res);
+    }
+
+    /* Compare against the view volume -w <= x, y, z <= w */
+    for (i = 0; i < LAC_BATCH_BLOCK; ++i) {
+        clip_codes[i] = (uint8_t)(
+            ((x[i] < -w[i]) ? LAC_CLIP_LEFT   : 0) |
+            ((x[i] >  w[i]) ? LAC_CLIP_RIGHT  : 0) |
+            ((y[i] < -w[i]) ? LAC_CLIP_BOTTOM : 0) |
+            ((y[i] >  w[i]) ? LAC_CLIP_TOP    : 0) |
+            ((z[i] < -w[i]) ? LAC_CLIP_NEAR   : 0) |
+            ((z[i] >  w[i]) ? LAC_CLIP_FAR    : 0) |
+            ((w[i] <= 0.0f) ? LAC_CLIP_W      : 0)
+        );
+    }
+
+    /* Perspective divide followed by the viewport transform, leaving w = 0 at the origin */
+    v[3] = lac_simd_load_f32x8(w);
+    inv_w = lac_simd_select_f32x8(
+        lac_simd_or_i32x8(lac_simd_lt_f32x8(v[3], zero), lac_simd_lt_f32x8(zero, v[3])),
+        lac_simd_div_f32x8(lac_simd_splat_f32x8(1.0f), v[3]),
+        zero
+    );
+    for (c = 0; c < 3; ++c) {
+        res = lac_simd_mul_f32x8(lac_simd_load_f32x8(clip[c]), inv_w);
+        lac_simd_store_f32x8(soa[c], lac_simd_madd_f32x8(res, lac_simd_splat_f32x8(scale[c]), lac_simd_splat_f32x8(bias[c])));
+    }
+    for (i = 0; i < LAC_BATCH_BLOCK; ++i) {
+        for (c = 0; c < 3; ++c) {
+            v_out[i][c] = soa[c][i];
+        }
+    }
+}
+
+/**
+ * @brief Body of lac_multiply_vec2_mat2_array(), instantiated for each ISA level by LAC_MULTIVERSION().
+ * @since 19-10-2026
+ */
+static LAC_ALWAYS_INLINE void _lac_multiply_vec2_mat2_array(
+    vec2 *v_out,
+    const vec2 *v_in,
+    const mat2 m_in,
+    const size_t count
+) {
+    lac_f32x4 cols[2], v_res;
+    size_t i, c;
+
+    for (c = 0; c < 2; ++c) {
+        cols[c] = lac_simd_load_column_f32x4(m_in, 2, c);
+    }
+
+    for (i = 0; i < count; ++i) {
+        v_res = lac_simd_mul_f32x4(cols[0], lac_simd_splat_f32x4(v_in[i][0]));
+        for (c = 1; c < 2; ++c) {
+            v_res = lac_simd_madd_f32x4(cols[c], lac_simd_splat_f32x4(v_in[i][c]), v_res);
+        }
+        lac_simd_store_f32x4(v_out[i], v_res, 2);
+    }
+}
+
+/**
+ * @brief Multiplies a 2x2 matrix by each vector in an array of vectors of length 2.
+ * @anchor lac_multiply_vec2_mat2_array_anchor
+ * @since 19-10-2026
+ * @param[out] v_out The product vectors (may be the same array as __v_in__)
+ * @param[in] v_in The input vectors
+ * @param[in] m_in The input matrix
+ * @param[in] count The number of vectors in __v_in__ and __v_out__
+ */
+LAC_MULTIVERSION(lac_multiply_vec2_mat2_array, (
+    vec2 *v_out,
+    const vec2 *v_in,
+    const mat2 m_in,
+    const size_t count
+), (v_out, v_in, m_in, count))
+
+/**
+ * @brief Body of lac_multiply_vec3_mat3_array(), instantiated for each ISA level by LAC_MULTIVERSION().
+ * @since 19-10-2026
+ */
+static LAC_ALWAYS_INLINE void _lac_multiply_vec3_mat3_array(
+    vec3 *v_out,
+    const vec3 *v_in,
+    const mat3 m_in,
+    const size_t count
+) {
+    lac_f32x4 cols[3], v_res;
+    size_t i, c;
+
+    for (c = 0; c < 3; ++c) {
+        cols[c] = lac_simd_load_column_f32x4(m_in, 3, c);
+    }
+
+    for (i = 0; i < count; ++i) {
+        v_res = lac_simd_mul_f32x4(cols[0], lac_simd_splat_f32x4(v_in[i][0]));
+        for (c = 1; c < 3; ++c) {
+            v_res = lac_simd_madd_f32x4(cols[c], lac_simd_splat_f32x4(v_in[i][c]), v_res);
+        }
+        lac_simd_store_f32x4(v_out[i], v_res, 3);
+    }
+}
+
+/**
+ * @brief Multiplies a 3x3 matrix by each vector in an array of vectors of length 3.
+ * @anchor lac_multiply_vec3_mat3_array_anchor
+ * @since 19-10-2026
+ * @param[out] v_out The product vectors (may be the same array as __v_in__)
+ * @param[in] v_in The input vectors
+ * @param[in] m_in The input matrix
+ * @param[in] count The number of vectors in __v_in__ and __v_out__
+ */
+LAC_MULTIVERSION(lac_multiply_vec3_mat3_array, (
+    vec3 *v_out,
+    const vec3 *v_in,
+    const mat3 m_in,
+    const size_t count
+), (v_out, v_in, m_in, count))
+
+/**
+ * @brief Body of lac_multiply_vec4_mat4_array(), instantiated for each ISA level by LAC_MULTIVERSION().
+ * @since 19-10-2026
+ */
+static LAC_ALWAYS_INLINE void _lac_multiply_vec4_mat4_array(
+    vec4 *v_out,
+    const vec4 *v_in,
+    const mat4 m_in,
+    const size_t count
+) {
+    lac_f32x4 cols[4], v_res;
+    size_t i, c;
+
+    for (c = 0; c < 4; ++c) {
+        cols[c] = lac_simd_load_column_f32x4(m_in, 4, c);
+    }
+
+    for (i = 0; i < count; ++i) {
+        v_res = lac_simd_mul_f32x4(cols[0], lac_simd_splat_f32x4(v_in[i][0]));
+        for (c = 1; c < 4; ++c) {
+            v_res = lac_simd_madd_f32x4(cols[c], lac_simd_splat_f32x4(v_in[i][c]), v_res);
+        }
+        lac_simd_store_f32x4(v_out[i], v_res, 4);
+    }
+}
+
+/**
+ * @brief Multiplies a 4x4 matrix by each vector in an array of vectors of length 4.
+ * @anchor lac_multiply_vec4_mat4_array_anchor
+ * @since 19-10-2026
+ * @param[out] v_out The product vectors (may be the same array as __v_in__)
+ * @param[in] v_in The input vectors
+ * @param[in] m_in The input matrix
+ * @param[in] count The number of vectors in __v_in__ and __v_out__
+ */
+LAC_MULTIVERSION(lac_multiply_vec4_mat4_array, (
+    vec4 *v_out,
+    const vec4 *v_in,
+    const mat4 m_in,
+    const size_t count
+), (v_out, v_in, m_in, count))
+
+/**
+ * @brief Body of lac_project_vec4_array(), instantiated for each ISA level by LAC_MULTIVERSION().
+ * @since 19-10-2026
+ */
+static LAC_ALWAYS_INLINE void _lac_project_vec4_array(
+    vec3 *v_out,
+    uint8_t *clip_codes,
+    const vec4 *v_in,
+    const mat4 m_mvp,
+    const LacViewport_t *viewport,
+    const size_t count,
+    const bool remap_depth
+) {
+    float rows[4][4], scale[3], bias[3];
+    vec4 tail_in[LAC_BATCH_BLOCK] = { { 0 } };
+    vec3 tail_out[LAC_BATCH_BLOCK];
+    uint8_t tail_codes[LAC_BATCH_BLOCK];
+    size_t i, remaining;
+
+    _lac_load_rows_mat4(rows, m_mvp);
+
+    scale[0] = viewport->width * 0.5f;
+    scale[1] = viewport->height * 0.5f;
+    bias[0] = viewport->x + scale[0];
+    bias[1] = viewport->y + scale[1];
+
+    if (remap_depth) {
+        scale[2] = (viewport->max_depth - viewport->min_depth) * 0.5f;
+        bias[2] = viewport->min_depth + scale[2];
+    } else {
+        scale[2] = 1.0f;
+        bias[2] = 0.0f;
+    }
+
+    for (i = 0; i + LAC_BATCH_BLOCK <= count; i += LAC_BATCH_BLOCK) {
+        _lac_project_block(&v_out[i], &clip_codes[i], &v_in[i], rows, scale, bias);
+    }
+
+    /* Pad the final partial block so that it can share the same code path */
+    remaining = count - i;
+    if (remaining > 0) {
+        memcpy(tail_in, &v_in[i], remaining * sizeof(vec4));
+        _lac_project_block(tail_out, tail_codes, tail_in, rows, scale, bias);
+        memcpy(&v_out[i], tail_out, remaining * sizeof(vec3));
+        memcpy(&clip_codes[i], tail_codes, remaining * sizeof(uint8_t));
+    }
+}
+
+/**
+ * @brief Takes an array of vertices from object space to screen space in a single pass.
+ * @anchor lac_project_vec4_array_anchor
+ * @since 19-10-2026
+ *
+ * Each vertex is multiplied by __m_mvp__, tested against the clip space view volume,
+ * divided by w and finally mapped onto __viewport__. The viewport follows the same
+ * convention as glViewport(), where (x, y) is the bottom-left corner. For a top-left
+ * origin, set y to the bottom edge of the viewport and use a negative height. Vertices
+ * with w equal to 0 are written to the center of the viewport and are always flagged
+ * with LAC_CLIP_W, so callers should consult __clip_codes__ before using a vertex whose
+ * code is non-zero.
+ *
+ * @param[out] v_out The screen space positions. The z component holds the NDC depth, or the remapped depth if __remap_depth__ is set
+ * @param[out] clip_codes A bitwise OR of LacClipCode_t values for each vertex; 0 means the vertex is inside the view volume
+ * @param[in] v_in The object space positions
+ * @param[in] m_mvp The combined model, view and projection matrix
+ * @param[in] viewport The region of the screen that NDC coordinates are mapped onto
+ * @param[in] count The number of vertices in __v_in__, __v_out__ and __clip_codes__
+ * @param[in] remap_depth If set to true, NDC depth is mapped from [-1, 1] onto [min_depth, max_depth]
+ */
+LAC_MULTIVERSION(lac_project_vec4_array, (
+    vec3 *v_out,
+    uint8_t *clip_codes,
+    const vec4 *v_in,
+    const mat4 m_mvp,
+    const LacViewport_t *viewport,
+    const size_t count,
+    const bool remap_depth
+), (v_out, clip_codes, v_in, m_mvp, viewport, count, remap_depth))
+
+/**
+ * @brief Linearly interpolates exactly LAC_BATCH_BLOCK floats.
+ * @since 19-10-2026
+ * @param[out] out The interpolated floats
+ * @param[in] a The floats at t = 0
+ * @param[in] b The floats at t = 1
+ * @param[in] t The interpolation factor
+ */
+static LAC_VARIANT_INLINE void _lac_lerp_block(float *out, const float *a, const float *b, const float t) {
+    const lac_f32x8 va = lac_simd_load_f32x8(a);
+
+    lac_simd_store_f32x8(out, lac_simd_madd_f32x8(lac_simd_sub_f32x8(lac_simd_load_f32x8(b), va), lac_simd_splat_f32x8(t), va));
+}
+
+/**
+ * @brief Scales exactly LAC_BATCH_BLOCK floats and adds a second set of floats.
+ * @since 19-10-2026
+ * @param[out] out The results
+ * @param[in] a The floats to be scaled
+ * @param[in] scalar The multiplier
+ * @param[in] b The floats to be added
+ */
+static LAC_VARIANT_INLINE void _lac_multiply_add_block(float *out, const float *a, const float scalar, const float *b) {
+    lac_simd_store_f32x8(out, lac_simd_madd_f32x8(lac_simd_load_f32x8(a), lac_simd_splat_f32x8(scalar), lac_simd_load_f32x8(b)));
+}
+
+/**
+ * @brief Sums exactly LAC_BATCH_BLOCK floats from each input, scaled by the weight of that input.
+ * @since 19-10-2026
+ *
+ * The sum is held in a register until every input has been added, so each output is
+ * written once no matter how many inputs there are.
+ *
+ * @param[out] out The weighted sums
+ * @param[in] in The inputs
+ * @param[in] weights The weight of each input
+ * @param[in] inputs The number of inputs, which must be at least 1
+ * @param[in] offset The index of the first float to be read from each input
+ */
+static LAC_VARIANT_INLINE void _lac_blend_block(
+    float *out,
+    const float *const *in,
+    const float *weights,
+    const size_t inputs,
+    const size_t offset
+) {
+    lac_f32x8 sum = lac_simd_mul_f32x8(lac_simd_load_f32x8(&in[0][offset]), lac_simd_splat_f32x8(weights[0]));
+    size_t k;
+
+    for (k = 1; k < inputs; ++k) {
+        sum = lac_simd_madd_f32x8(lac_simd_load_f32x8(&in[k][offset]), lac_simd_splat_f32x8(weights[k]), sum);
+    }
+    lac_simd_store_f32x8(out, sum);
+}
+
+/**
+ * @brief Linearly interpolates two arrays of __n__ floats.
+ * @since 19-10-2026
+ * @param[out] out The interpolated floats (may be the same array as __a__ or __b__)
+ * @param[in] a The floats at t = 0
+ * @param[in] b The floats at t = 1
+ * @param[in] t The interpolation factor
+ * @param[in] n The number of floats
+ */
+static LAC_ALWAYS_INLINE void _lac_lerp_floats(float *out, const float *a, const float *b, const float t, const size_t n) {
+    float tail[3][LAC_BATCH_BLOCK] = { { 0 } };
+    size_t i, remaining;
+
+    for (i = 0; i + LAC_BATCH_BLOCK <= n; i += LAC_BATCH_BLOCK) {
+        _lac_lerp_block(&out[i], &a[i], &b[i], t);
+    }
+
+    /* Pad the final partial block so that it can share the same code path */
+    remaining = n - i;
+    if (remaining > 0) {
+        memcpy(tail[0], &a[i], remaining * sizeof(float));
+        memcpy(tail[1], &b[i], remaining * sizeof(float));
+        _lac_lerp_block(tail[2], tail[0], tail[1], t);
+        memcpy(&out[i], tail[2], remaining * sizeof(float));
+    }
+}
+
+/**
+ * @brief Scales an array of __n__ floats and adds a second array.
+ * @since 19-10-2026
+ * @param[out] out The results (may be the same array as __a__ or __b__)
+ * @param[in] a The floats to be scaled
+ * @param[in] scalar The multiplier
+ * @param[in] b The floats to be added
+ * @param[in] n The number of floats
+ */
+static LAC_ALWAYS_INLINE void _lac_multiply_add_floats(float *out, const float *a, const float scalar, const float *b, const size_t n) {
+    float tail[3][LAC_BATCH_BLOCK] = { { 0 } };
+    size_t i, remaining;
+
+    for (i = 0; i + LAC_BATCH_BLOCK <= n; i += LAC_BATCH_BLOCK) {
+        _lac_multiply_add_block(&out[i], &a[i], scalar, &b[i]);
+    }
+
+    /* Pad the final partial block so that it can share the same code path */
+    remaining = n - i;
+    if (remaining > 0) {
+        memcpy(tail[0], &a[i], remaining * sizeof(float));
+        memcpy(tail[1], &b[i], remaining * sizeof(float));
+        _lac_multiply_add_block(tail[2], tail[0], scalar, tail[1]);
+        memcpy(&out[i], tail[2], remaining * sizeof(float));
+    }
+}
+
+/**
+ * @brief Sums arrays of __n__ floats, each scaled by its own weight.
+ * @since 19-10-2026
+ * @param[out] out The weighted sums (may be the same array as any of the inputs)
+ * @param[in] in The inputs
+ * @param[in] weights The weight of each input
+ * @param[in] inputs The number of inputs
+ * @param[in] n The number of floats in each input
+ */
+static LAC_ALWAYS_INLINE void _lac_blend_floats(
+    float *out,
+    const float *const *in,
+    const float *weights,
+    const size_t inputs,
+    const size_t n
+) {
+    float sum;
+    size_t i, k;
+
+    if (inputs == 0) {
+        memset(out, 0, n * sizeof(float));
+        return;
+    }
+
+    for (i = 0; i + LAC_BATCH_BLOCK <= n; i += LAC_BATCH_BLOCK) {
+        _lac_blend_block(&out[i], in, weights, inputs, i);
+    }
+
+    /* Padding the final partial block would mean copying every input, so sum it directly instead */
+    for (; i < n; ++i) {
+        sum = in[0][i] * weights[0];
+        for (k = 1; k < inputs; ++k) {
+            sum = (in[k][i] * weights[k]) + sum;
+        }
+        out[i] = sum;
+    }
+}
+
+/**
+ * @brief Body of lac_lerp_vec2_array(), instantiated for each ISA level by LAC_MULTIVERSION().
+ * @since 19-10-2026
+ */
+static LAC_ALWAYS_INLINE void _lac_lerp_vec2_array(
+    vec2 *v_out,
+    const vec2 *v_a,
+    const vec2 *v_b,
+    const float t,
+    const size_t count
+) {
+    _lac_lerp_floats((float *)v_out, (const float *)v_a, (const float *)v_b, t, count * 2);
+}
+
+/**
+ * @brief Linearly interpolates between each pair of vectors in two arrays of vectors of length 2.
+ * @anchor lac_lerp_vec2_array_anchor
+ * @since 19-10-2026
+ * @param[out] v_out The interpolated vectors, i.e. __v_a__ + __t__ * (__v_b__ - __v_a__) (may be the same array as __v_a__ or __v_b__)
+ * @param[in] v_a The vectors at t = 0
+ * @param[in] v_b The vectors at t = 1
+ * @param[in] t The interpolation factor, which may lie outside [0, 1] to extrapolate
+ * @param[in] count The number of vectors in __v_a__, __v_b__ and __v_out__
+ */
+LAC_MULTIVERSION(lac_lerp_vec2_array, (
+    vec2 *v_out,
+    const vec2 *v_a,
+    const vec2 *v_b,
+    const float t,
+    const size_t count
+), (v_out, v_a, v_b, t, count))
+
+/**
+ * @brief Body of lac_lerp_vec3_array(), instantiated for each ISA level by LAC_MULTIVERSION().
+ * @since 19-10-2026
+ */
+static LAC_ALWAYS_INLINE void _lac_lerp_vec3_array(
+    vec3 *v_out,
+    const vec3 *v_a,
+    const vec3 *v_b,
+    const float t,
+    const size_t count
+) {
+    _lac_lerp_floats((float *)v_out, (const float *)v_a, (const float *)v_b, t, count * 3);
+}
+
+/**
+ * @brief Linearly interpolates between each pair of vectors in two arrays of vectors of length 3.
+ * @anchor lac_lerp_vec3_array_anchor
+ * @since 19-10-2026
+ * @param[out] v_out The interpolated vectors, i.e. __v_a__ + __t__ * (__v_b__ - __v_a__) (may be the same array as __v_a__ or __v_b__)
+ * @param[in] v_a The vectors at t = 0
+ * @param[in] v_b The vectors at t = 1
+ * @param[in] t The interpolation factor, which may lie outside [0, 1] to extrapolate
+ * @param[in] count The number of vectors in __v_a__, __v_b__ and __v_out__
+ */
+LAC_MULTIVERSION(lac_lerp_vec3_array, (
+    vec3 *v_out,
+    const vec3 *v_a,
+    const vec3 *v_b,
+    const float t,
+    const size_t count
+), (v_out, v_a, v_b, t, count))
+
+/**
+ * @brief Body of lac_lerp_vec4_array(), instantiated for each ISA level by LAC_MULTIVERSION().
+ * @since 19-10-2026
+ */
+static LAC_ALWAYS_INLINE void _lac_lerp_vec4_array(
+    vec4 *v_out,
+    const vec4 *v_a,
+    const vec4 *v_b,
+    const float t,
+    const size_t count
+) {
+    _lac_lerp_floats((float *)v_out, (const float *)v_a, (const float *)v_b, t, count * 4);
+}
+
+/**
+ * @brief Linearly interpolates between each pair of vectors in two arrays of vectors of length 4.
+ * @anchor lac_lerp_vec4_array_anchor
+ * @since 19-10-2026
+ * @param[out] v_out The interpolated vectors, i.e. __v_a__ + __t__ * (__v_b__ - __v_a__) (may be the same array as __v_a__ or __v_b__)
+ * @param[in] v_a The vectors at t = 0
+ * @param[in] v_b The vectors at t = 1
+ * @param[in] t The interpolation factor, which may lie outside [0, 1] to extrapolate
+ * @param[in] count The number of vectors in __v_a__, __v_b__ and __v_out__
+ */
+LAC_MULTIVERSION(lac_lerp_vec4_array, (
+    vec4 *v_out,
+    const vec4 *v_a,
+    const vec4 *v_b,
+    const float t,
+    const size_t count
+), (v_out, v_a, v_b, t, count))
+
+/**
+ * @brief Body of lac_multiply_add_vec2_array(), instantiated for each ISA level by LAC_MULTIVERSION().
+ * @since 19-10-2026
+ */
+static LAC_ALWAYS_INLINE void _lac_multiply_add_vec2_array(
+    vec2 *v_out,
+    const vec2 *v_a,
+    const float scalar,
+    const vec2 *v_b,
+    const size_t count
+) {
+    _lac_multiply_add_floats((float *)v_out, (const float *)v_a, scalar, (const float *)v_b, count * 2);
+}
+
+/**
+ * @brief Scales each vector in an array of vectors of length 2, and adds the matching vector of a second array.
+ * @anchor lac_multiply_add_vec2_array_anchor
+ * @since 19-10-2026
+ * @param[out] v_out The results, i.e. __v_a__ * __scalar__ + __v_b__ (may be the same array as __v_a__ or __v_b__)
+ * @param[in] v_a The vectors to be scaled
+ * @param[in] scalar A constant representing the multiplier
+ * @param[in] v_b The vectors to be added
+ * @param[in] count The number of vectors in __v_a__, __v_b__ and __v_out__
+ */
+LAC_MULTIVERSION(lac_multiply_add_vec2_array, (
+    vec2 *v_out,
+    const vec2 *v_a,
+    const float scalar,
+    const vec2 *v_b,
+    const size_t count
+), (v_out, v_a, scalar, v_b, count))
+
+/**
+ * @brief Body of lac_multiply_add_vec3_array(), instantiated for each ISA level by LAC_MULTIVERSION().
+ * @since 19-10-2026
+ */
+static LAC_ALWAYS_INLINE void _lac_multiply_add_vec3_array(
+    vec3 *v_out,
+    const vec3 *v_a,
+    const float scalar,
+    const vec3 *v_b,
+    const size_t count
+) {
+    _lac_multiply_add_floats((float *)v_out, (const float *)v_a, scalar, (const float *)v_b, count * 3);
+}
+
+/**
+ * @brief Scales each vector in an array of vectors of length 3, and adds the matching vector of a second array.
+ * @anchor lac_multiply_add_vec3_array_anchor
+ * @since 19-10-2026
+ * @param[out] v_out The results, i.e. __v_a__ * __scalar__ + __v_b__ (may be the same array as __v_a__ or __v_b__)
+ * @param[in] v_a The vectors to be scaled
+ * @param[in] scalar A constant representing the multiplier
+ * @param[in] v_b The vectors to be added
+ * @param[in] count The number of vectors in __v_a__, __v_b__ and __v_out__
+ */
+LAC_MULTIVERSION(lac_multiply_add_vec3_array, (
+    vec3 *v_out,
+    const vec3 *v_a,
+    const float scalar,
+    const vec3 *v_b,
+    const size_t count
+), (v_out, v_a, scalar, v_b, count))
+
+/**
+ * @brief Body of lac_multiply_add_vec4_array(), instantiated for each ISA level by LAC_MULTIVERSION().
+ * @since 19-10-2026
+ */
+static LAC_ALWAYS_INLINE void _lac_multiply_add_vec4_array(
+    vec4 *v_out,
+    const vec4 *v_a,
+    const float scalar,
+    const vec4 *v_b,
+    const size_t count
+) {
+    _lac_multiply_add_floats((float *)v_out, (const float *)v_a, scalar, (const float *)v_b, count * 4);
+}
+
+/**
+ * @brief Scales each vector in an array of vectors of length 4, and adds the matching vector of a second array.
+ * @anchor lac_multiply_add_vec4_array_anchor
+ * @since 19-10-2026
+ * @param[out] v_out The results, i.e. __v_a__ * __scalar__ + __v_b__ (may be the same array as __v_a__ or __v_b__)
+ * @param[in] v_a The vectors to be scaled
+ * @param[in] scalar A constant representing the multiplier
+ * @param[in] v_b The vectors to be added
+ * @param[in] count The number of vectors in __v_a__, __v_b__ and __v_out__
+ */
+LAC_MULTIVERSION(lac_multiply_add_vec4_array, (
+    vec4 *v_out,
+    const vec4 *v_a,
+    const float scalar,
+    const vec4 *v_b,
+    const size_t count
+), (v_out, v_a, scalar, v_b, count))
+
+/**
+ * @brief Body of lac_blend_vec2_array(), instantiated for each ISA level by LAC_MULTIVERSION().
+ * @since 19-10-2026
+ */
+static LAC_ALWAYS_INLINE void _lac_blend_vec2_array(
+    vec2 *v_out,
+    const vec2 *const *v_in,
+    const float *weights,
+    const size_t inputs,
+    const size_t count
+) {
+    _lac_blend_floats((float *)v_out, (const float *const *)v_in, weights, inputs, count * 2);
+}
+
+/**
+ * @brief Blends several arrays of vectors of length 2, e.g. the joint translations of several poses.
+ * @anchor lac_blend_vec2_array_anchor
+ * @since 19-10-2026
+ * @param[out] v_out The weighted sum of the matching vectors of every input (may be the same array as any input)
+ * @param[in] v_in The input arrays, each of __count__ vectors
+ * @param[in] weights The weight of each input array, which typically add up to 1
+ * @param[in] inputs The number of arrays in __v_in__ and weights in __weights__; if 0, __v_out__ is zeroed
+ * @param[in] count The number of vectors in each input array and __v_out__
+ */
+LAC_MULTIVERSION(lac_blend_vec2_array, (
+    vec2 *v_out,
+    const vec2 *const *v_in,
+    const float *weights,
+    const size_t inputs,
+    const size_t count
+), (v_out, v_in, weights, inputs, count))
+
+/**
+ * @brief Body of lac_blend_vec3_array(), instantiated for each ISA level by LAC_MULTIVERSION().
+ * @since 19-10-2026
+ */
+static LAC_ALWAYS_INLINE void _lac_blend_vec3_array(
+    vec3 *v_out,
+    const vec3 *const *v_in,
+    const float *weights,
+    const size_t inputs,
+    const size_t count
+) {
+    _lac_blend_floats((float *)v_out, (const float *const *)v_in, weights, inputs, count * 3);
+}
+
+/**
+ * @brief Blends several arrays of vectors of length 3, e.g. the joint translations of several poses.
+ * @anchor lac_blend_vec3_array_anchor
+ * @since 19-10-2026
+ * @param[out] v_out The weighted sum of the matching vectors of every input (may be the same array as any input)
+ * @param[in] v_in The input arrays, each of __count__ vectors
+ * @param[in] weights The weight of each input array, which typically add up to 1
+ * @param[in] inputs The number of arrays in __v_in__ and weights in __weights__; if 0, __v_out__ is zeroed
+ * @param[in] count The number of vectors in each input array and __v_out__
+ */
+LAC_MULTIVERSION(lac_blend_vec3_array, (
+    vec3 *v_out,
+    const vec3 *const *v_in,
+    const float *weights,
+    const size_t inputs,
+    const size_t count
+), (v_out, v_in, weights, inputs, count))
+
+/**
+ * @brief Body of lac_blend_vec4_array(), instantiated for each ISA level by LAC_MULTIVERSION().
+ * @since 19-10-2026
+ */
+static LAC_ALWAYS_INLINE void _lac_blend_vec4_array(
+    vec4 *v_out,
+    const vec4 *const *v_in,
+    const float *weights,
+    const size_t inputs,
+    const size_t count
+) {
+    _lac_blend_floats((float *)v_out, (const float *const *)v_in, weights, inputs, count * 4);
+}
+
+/**
+ * @brief Blends several arrays of vectors of length 4, e.g. the joint translations of several poses.
+ * @anchor lac_blend_vec4_array_anchor
+ * @since 19-10-2026
+ * @param[out] v_out The weighted sum of the matching vectors of every input (may be the same array as any input)
+ * @param[in] v_in The input arrays, each of __count__ vectors
+ * @param[in] weights The weight of each input array, which typically add up to 1
+ * @param[in] inputs The number of arrays in __v_in__ and weights in __weights__; if 0, __v_out__ is zeroed
+ * @param[in] count The number of vectors in each input array and __v_out__
+ */
+LAC_MULTIVERSION(lac_blend_vec4_array, (
+    vec4 *v_out,
+    const vec4 *const *v_in,
+    const float *weights,
+    const size_t inputs,
+    const size_t count
+), (v_out, v_in, weights, inputs, count))
+
+/**
+ * @brief Body of lac_blend_mat4_array(), instantiated for each ISA level by LAC_MULTIVERSION().
+ * @since 19-10-2026
+ */
+static LAC_ALWAYS_INLINE void _lac_blend_mat4_array(
+    mat4 *m_out,
+    const mat4 *const *m_in,
+    const float *weights,
+    const size_t inputs,
+    const size_t count
+) {
+    _lac_blend_floats((float *)m_out, (const float *const *)m_in, weights, inputs, count * 16);
+}
+
+/**
+ * @brief Blends several arrays of 4x4 matrices element by element, e.g. the joint matrices of several poses.
+ * @anchor lac_blend_mat4_array_anchor
+ * @since 19-10-2026
+ *
+ * Blending the elements of rotation matrices does not give a rotation, as the result
+ * is scaled and sheared between the inputs. This is accurate enough for the small
+ * differences between neighbouring animation frames, or for linear blend skinning, but
+ * larger differences should be blended as separate translations, rotations and scales.
+ *
+ * @param[out] m_out The weighted sum of the matching matrices of every input (may be the same array as any input)
+ * @param[in] m_in The input arrays, each of __count__ matrices
+ * @param[in] weights The weight of each input array, which typically add up to 1
+ * @param[in] inputs The number of arrays in __m_in__ and weights in __weights__; if 0, __m_out__ is zeroed
+ * @param[in] count The number of matrices in each input array and __m_out__
+ */
+LAC_MULTIVERSION(lac_blend_mat4_array, (
+    mat4 *m_out,
+    const mat4 *const *m_in,
+    const float *weights,
+    const size_t inputs,
+    const size_t count
+), (m_out, m_in, weights, inputs, count))
@@ -0,0 +1,977 @@
+/**
+ * @file bvh.c
+ * @author Neil Kingdom
+ * @since 19-10-2026
+ * @version 1.0
+ * @brief Provides a bounding volume hierarchy for ray casts and overlap queries.
+ *
+ * @section bvh Bounding Volume Hierarchies
+ *
+ * Finding which of n primitives a ray hits, or which of them overlap a box,
+ * takes n tests when every primitive has to be visited. A bounding volume
+ * hierarchy (BVH) instead groups nearby primitives together into a tree,
+ * where each node stores the bounding box (see aabb.c) of everything below
+ * it. A query which misses a node's box can skip its entire subtree, so a
+ * typical query only visits a handful of nodes on its way down to the few
+ * primitives that it actually touches, i.e. O(log n) of them.
+ *
+ * Each node here has up to LAC_BVH_WIDTH (4) children. The children's boxes
+ * are stored in SoA layout within their parent (see batch.c), so a query
+ * tests all 4 of them at once with SIMD instructions, and every node fills
+ * exactly two cache lines. The nodes live in one flat, cache-aligned array
+ * and refer to each other by index. A child is either another node, or a
+ * leaf holding up to LAC_BVH_MAX_LEAF primitives. For BVHs built from
+ * triangles, the triangles of each leaf are also stored as packets (see
+ * ray.c), so that a ray is tested against a whole leaf at once.
+ *
+ * @subsection bvh_related Related Functions
+ *
+ * - @ref lac_create_bvh_anchor "lac_create_bvh"
+ * - @ref lac_create_bvh_triangles_anchor "lac_create_bvh_triangles"
+ * - @ref lac_intersect_bvh_ray_anchor "lac_intersect_bvh_ray"
+ * - @ref lac_query_bvh_aabb_anchor "lac_query_bvh_aabb"
+ *
+ * @section bvhbuild Binned SAH Build
+ *
+ * How quickly a BVH can be queried depends on how its primitives are split
+ * between children. The surface area heuristic (SAH) estimates the cost of
+ * a split from the observation that the chance of a random ray hitting a
+ * box is proportional to the box's surface area. Splitting a node into left
+ * and right halves is then expected to cost A(L) * N(L) + A(R) * N(R), where
+ * A is the surface area of a half's bounds and N is the number of primitives
+ * in it. Rather than trying every possible split, the centers of the
+ * primitives are sorted into LAC_BVH_BINS bins along each axis, and only
+ * the boundaries between the bins are considered. Two sweeps over the bins
+ * (one from each end) give the cost of every boundary, so each split takes
+ * a single pass over the node's primitives. A 4-wide node is made by first
+ * splitting its primitives in two, and then repeatedly splitting whichever
+ * half has the largest surface area, until there are 4 children or all of
+ * them are small enough to be leaves.
+ *
+ * Given a scheduler (see scheduler.c), the build runs across threads. Once
+ * a node has been split, its children are independent of each other, so
+ * every child with enough primitives below it is built as a separate task.
+ * Near the root, where there are few nodes but many primitives each, the
+ * binning pass is instead split across threads.
+ *
+ * @subsection bvhbuild_related Related Functions
+ *
+ * - @ref lac_create_bvh_anchor "lac_create_bvh"
+ * - @ref lac_parallel_for_anchor "lac_parallel_for"
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdalign.h>
+#include <stdint.h>
+#include <float.h>
+#include <pthread.h>
+
+#include "bvh.h"
+#include "lac_simd.h"
+
+#define LAC_CACHE_LINE 64
+/* Bit of a child which marks it as a leaf rather than a node */
+#define LAC_BVH_LEAF_BIT 0x80000000u
+/* Child of a node which has fewer than LAC_BVH_WIDTH children */
+#define LAC_BVH_EMPTY UINT32_MAX
+/* Nodes with at least this many primitives below them are built as separate tasks */
+#define LAC_BVH_TASK_GRAIN 4096
+/* Nodes with at least this many primitives below them are binned across threads */
+#define LAC_BVH_PARALLEL_BINNING (64 * 1024)
+/* Smallest magnitude of a ray direction component, so that its reciprocal stays finite */
+#define LAC_BVH_MIN_DIRECTION 1e-20f
+/* Each node visited pushes at most LAC_BVH_WIDTH - 1 more entries than it pops */
+#define LAC_BVH_STACK_SIZE (((LAC_BVH_MAX_DEPTH + 1) * (LAC_BVH_WIDTH - 1)) + 1)
+
+/* The bounds of the children are stored in SoA layout, i.e. min[c][i] is component c of child i */
+typedef struct {
+    alignas(LAC_CACHE_LINE) float min[3][LAC_BVH_WIDTH];
+    float max[3][LAC_BVH_WIDTH];
+    uint32_t child[LAC_BVH_WIDTH];
+} LacBvhNode_t;
+
+typedef struct {
+    uint32_t first;
+    uint32_t count;
+    uint32_t packet;
+} LacBvhLeaf_t;
+
+struct LacBvh {
+    LacBvhNode_t *nodes;
+    LacBvhLeaf_t *leaves;
+    uint32_t *prims;
+    LacAabb_t *boxes;
+    LacTrianglePacket_t *packets;
+    size_t node_count;
+    size_t leaf_count;
+    size_t prim_count;
+    LacAabb_t bounds;
+};
+
+typedef struct {
+    LacAabb_t bounds;
+    LacAabb_t centers;
+    size_t count;
+} LacBvhBin_t;
+
+/* A run of primitives, with their bounds and the bounds of their centers */
+typedef struct {
+    LacAabb_t bounds;
+    LacAabb_t centers;
+    size_t begin;
+    size_t end;
+} LacBvhRange_t;
+
+typedef struct {
+    LacBvh_t *bvh;
+    LacScheduler_t *scheduler;
+    const LacAabb_t *boxes;
+    const vec3 *vertices;
+    const uint32_t *indices;
+    vec3 *centers;
+    lac_atomic_size_t node_count;
+    lac_atomic_size_t leaf_count;
+} LacBvhBuild_t;
+
+typedef struct {
+    LacBvhBuild_t *build;
+    LacBvhRange_t range;
+    uint32_t node;
+    size_t depth;
+} LacBvhTask_t;
+
+typedef struct {
+    const LacBvhBuild_t *build;
+    const LacBvhRange_t *range;
+    float scale[3];
+    pthread_mutex_t lock;
+    LacBvhBin_t bins[3][LAC_BVH_BINS];
+} LacBvhBinning_t;
+
+/**
+ * @brief Calls __func__ over [0, __count__), across threads if there is a scheduler.
+ * @since 19-10-2026
+ * @param[out] scheduler The scheduler, or NULL to run on the calling thread
+ * @param[in] func The function to be called for each piece of the range
+ * @param[in] arg The argument passed to __func__
+ * @param[in] count The number of elements
+ */
+static void _lac_run_bvh_range(LacScheduler_t *scheduler, LacRangeFunc_t func, void *arg, const size_t count) {
+    if (scheduler != NULL && count >= LAC_SCHEDULER_BATCH_GRAIN) {
+        lac_parallel_for(scheduler, func, arg, count, LAC_SCHEDULER_BATCH_GRAIN);
+    } else if (count > 0) {
+        func(arg, 0, count);
+    }
+}
+
+/**
+ * @brief Range task which computes the bounds of each triangle.
+ * @since 19-10-2026
+ * @param[in] arg The build, whose boxes are written to
+ * @param[in] begin The first triangle of the piece
+ * @param[in] end One past the last triangle of the piece
+ */
+static void _lac_bound_bvh_triangles(void *arg, size_t begin, size_t end) {
+    LacBvhBuild_t *build = arg;
+    LacAabb_t *boxes = (LacAabb_t *)build->boxes;
+    size_t i, k, v;
+
+    for (i = begin; i < end; ++i) {
+        lac_init_aabb(&boxes[i]);
+        for (k = 0; k < 3; ++k) {
+            v = (build->indices != NULL) ? build->indices[(i * 3) + k] : ((i * 3) + k);
+            lac_expand_aabb(&boxes[i], build->vertices[v]);
+        }
+    }
+}
+
+/**
+ * @brief Range task which computes the center of each primitive's bounds.
+ * @since 19-10-2026
+ * @param[in] arg The build
+ * @param[in] begin The first primitive of the piece
+ * @param[in] end One past the last primitive of the piece
+ */
+static void _lac_center_bvh_prims(void *arg, size_t begin, size_t end) {
+    LacBvhBuild_t *build = arg;
+    size_t i;
+
+    for (i = begin; i < end; ++i) {
+        lac_calc_aabb_center(build->centers[i], &build->boxes[i]);
+    }
+}
+
+/**
+ * @brief Computes the bounds of a range, and of the centers within it, from its primitives.
+ * @since 19-10-2026
+ * @param[in,out] range The range, whose bounds are written to
+ * @param[in] build The build
+ */
+static void _lac_bound_bvh_range(LacBvhRange_t *range, const LacBvhBuild_t *build) {
+    const uint32_t *prims = build->bvh->prims;
+    size_t i;
+
+    lac_init_aabb(&range->bounds);
+    lac_init_aabb(&range->centers);
+    for (i = range->begin; i < range->end; ++i) {
+        lac_merge_aabb(&range->bounds, &range->bounds, &build->boxes[prims[i]]);
+        lac_expand_aabb(&range->centers, build->centers[prims[i]]);
+    }
+}
+
+/**
+ * @brief Gets the bin of a primitive's center along one axis.
+ * @since 19-10-2026
+ * @param[in] center The component of the center along the axis
+ * @param[in] min The smallest center of the range along the axis
+ * @param[in] scale The number of bins per unit along the axis
+ * @returns The bin
+ */
+static inline size_t _lac_get_bvh_bin(const float center, const float min, const float scale) {
+    const float bin = (center - min) * scale;
+
+    if (bin <= 0.0f) {
+        return 0;
+    }
+    return (bin >= (float)(LAC_BVH_BINS - 1)) ? (LAC_BVH_BINS - 1) : (size_t)bin;
+}
+
+/**
+ * @brief Range task which sorts a piece of a range into bins, then adds them to the shared bins.
+ * @since 19-10-2026
+ * @param[in] arg The binning state
+ * @param[in] begin The first primitive of the piece, relative to the start of the range
+ * @param[in] end One past the last primitive of the piece, relative to the start of the range
+ */
+static void _lac_bin_bvh_prims(void *arg, size_t begin, size_t end) {
+    LacBvhBinning_t *binning = arg;
+    const LacBvhBuild_t *build = binning->build;
+    const LacBvhRange_t *range = binning->range;
+    const uint32_t *prims = build->bvh->prims;
+    LacBvhBin_t bins[3][LAC_BVH_BINS], *bin;
+    size_t i, c, b;
+
+    for (c = 0; c < 3; ++c) {
+        for (b = 0; b < LAC_BVH_BINS; ++b) {
+            lac_init_aabb(&bins[c][b].bounds);
+            lac_init_aabb(&bins[c][b].centers);
+            bins[c][b].count = 0;
+        }
+    }
+
+    for (i = range->begin + begin; i < range->begin + end; ++i) {
+        for (c = 0; c < 3; ++c) {
+            bin = &bins[c][_lac_get_bvh_bin(build->centers[prims[i]][c], range->centers.min[c], binning->scale[c])];
+            lac_merge_aabb(&bin->bounds, &bin->bounds, &build->boxes[prims[i]]);
+            lac_expand_aabb(&bin->centers, build->centers[prims[i]]);
+            bin->count++;
+        }
+    }
+
+    pthread_mutex_lock(&binning->lock);
+    for (c = 0; c < 3; ++c) {
+        for (b = 0; b < LAC_BVH_BINS; ++b) {
+            bin = &binning->bins[c][b];
+            lac_merge_aabb(&bin->bounds, &bin->bounds, &bins[c][b].bounds);
+            lac_merge_aabb(&bin->centers, &bin->centers, &bins[c][b].centers);
+            bin->count += bins[c][b].count;
+        }
+    }
+    pthread_mutex_unlock(&binning->lock);
+}
+
+/**
+ * @brief Splits a range in two at the boundary between bins with the lowest SAH cost.
+ * @since 19-10-2026
+ *
+ * If every center lies at the same point, no boundary separates the primitives, so the
+ * range is instead split at its middle.
+ *
+ * @param[out] left The lower half
+ * @param[out] right The upper half
+ * @param[in] build The build, whose primitives within __range__ are reordered
+ * @param[in] range The range to be split, which holds at least 2 primitives
+ */
+static void _lac_split_bvh_range(
+    LacBvhRange_t *left,
+    LacBvhRange_t *right,
+    LacBvhBuild_t *build,
+    const LacBvhRange_t *range
+) {
+    const size_t count = range->end - range->begin;
+    uint32_t *prims = build->bvh->prims, tmp;
+    LacBvhBinning_t binning;
+    LacAabb_t acc;
+    float extent, area, cost, best_cost = FLT_MAX, right_cost[LAC_BVH_BINS];
+    size_t right_count[LAC_BVH_BINS], acc_count;
+    size_t c, b, i, j, best_axis = 3, best_bin = 0, mid;
+
+    binning.build = build;
+    binning.range = range;
+    for (c = 0; c < 3; ++c) {
+        extent = range->centers.max[c] - range->centers.min[c];
+        binning.scale[c] = (extent > 0.0f) ? ((float)LAC_BVH_BINS / extent) : 0.0f;
+        for (b = 0; b < LAC_BVH_BINS; ++b) {
+            lac_init_aabb(&binning.bins[c][b].bounds);
+            lac_init_aabb(&binning.bins[c][b].centers);
+            binning.bins[c][b].count = 0;
+        }
+    }
+
+    pthread_mutex_init(&binning.lock, NULL);
+    if (count >= LAC_BVH_PARALLEL_BINNING) {
+        _lac_run_bvh_range(build->scheduler, _lac_bin_bvh_prims, &binning, count);
+    } else {
+        _lac_bin_bvh_prims(&binning, 0, count);
+    }
+    pthread_mutex_destroy(&binning.lock);
+
+    /* The cost to the right of each boundary comes from sweeping down, and to the left from sweeping up */
+    for (c = 0; c < 3; ++c) {
+        if (binning.scale[c] == 0.0f) {
+            continue;
+        }
+
+        lac_init_aabb(&acc);
+        acc_count = 0;
+        for (b = LAC_BVH_BINS - 1; b > 0; --b) {
+            lac_merge_aabb(&acc, &acc, &binning.bins[c][b].bounds);
+            acc_count += binning.bins[c][b].count;
+            lac_calc_aabb_surface_area(&area, &acc);
+            right_cost[b] = area * (float)acc_count;
+            right_count[b] = acc_count;
+        }
+
+        lac_init_aabb(&acc);
+        acc_count = 0;
+        for (b = 0; b < LAC_BVH_BINS - 1; ++b) {
+            lac_merge_aabb(&acc, &acc, &binning.bins[c][b].bounds);
+            acc_count += binning.bins[c][b].count;
+            if (acc_count == 0 || right_count[b + 1] == 0) {
+                continue;
+            }
+
+            lac_calc_aabb_surface_area(&area, &acc);
+            cost = (area * (float)acc_count) + right_cost[b + 1];
+            if (cost < best_cost) {
+                best_cost = cost;
+                best_axis = c;
+                best_bin = b;
+            }
+        }
+    }
+
+    if (best_axis == 3) {
+        mid = range->begin + (count / 2);
+    } else {
+        /* Everything in bins up to best_bin goes to the left */
+        i = range->begin;
+        j = range->end;
+        while (i < j) {
+            if (_lac_get_bvh_bin(build->centers[prims[i]][best_axis], range->centers.min[best_axis], binning.scale[best_axis]) <= best_bin) {
+                ++i;
+            } else {
+                --j;
+                tmp = prims[i];
+                prims[i] = prims[j];
+                prims[j] = tmp;
+            }
+        }
+        mid = i;
+    }
+
+    left->begin = range->begin;
+    left->end = mid;
+    right->begin = mid;
+    right->end = range->end;
+
+    if (best_axis == 3) {
+        _lac_bound_bvh_range(left, build);
+        _lac_bound_bvh_range(right, build);
+        return;
+    }
+
+    lac_init_aabb(&left->bounds);
+    lac_init_aabb(&left->centers);
+    lac_init_aabb(&right->bounds);
+    lac_init_aabb(&right->centers);
+    for (b = 0; b < LAC_BVH_BINS; ++b) {
+        if (b <= best_bin) {
+            lac_merge_aabb(&left->bounds, &left->bounds, &binning.bins[best_axis][b].bounds);
+            lac_merge_aabb(&left->centers, &left->centers, &binning.bins[best_axis][b].centers);
+        } else {
+            lac_merge_aabb(&right->bounds, &right->bounds, &binning.bins[best_axis][b].bounds);
+            lac_merge_aabb(&right->centers, &right->centers, &binning.bins[best_axis][b].centers);
+        }
+    }
+}
+
+static void _lac_build_bvh_node(LacBvhBuild_t *build, const uint32_t index, const LacBvhRange_t *range, const size_t depth);
+
+/**
+ * @brief Task which builds the subtree below one node.
+ * @since 19-10-2026
+ * @param[in] arg The LacBvhTask_t describing the node
+ */
+static void _lac_run_bvh_task(void *arg) {
+    LacBvhTask_t *task = arg;
+    _lac_build_bvh_node(task->build, task->node, &task->range, task->depth);
+}
+
+/**
+ * @brief Fills in a node from a range of primitives, then builds the nodes below it.
+ * @since 19-10-2026
+ * @param[out] build The build
+ * @param[in] index The index of the node, which has already been allocated
+ * @param[in] range The primitives below the node
+ * @param[in] depth The depth of the node, where the root is at depth 0
+ */
+static void _lac_build_bvh_node(LacBvhBuild_t *build, const uint32_t index, const LacBvhRange_t *range, const size_t depth) {
+    LacBvhNode_t *node = &build->bvh->nodes[index];
+    LacBvhRange_t children[LAC_BVH_WIDTH], parent;
+    LacBvhTask_t tasks[LAC_BVH_WIDTH];
+    LacTaskGroup_t group;
+    float area, largest_area;
+    size_t count = 1, num_tasks = 0, i, c, size, largest, leaf;
+    bool waiting = false;
+
+    /* Keep splitting the child with the largest surface area until the node is full */
+    children[0] = *range;
+    while (count < LAC_BVH_WIDTH && depth + 1 < LAC_BVH_MAX_DEPTH) {
+        largest = LAC_BVH_WIDTH;
+        largest_area = -1.0f;
+        for (i = 0; i < count; ++i) {
+            lac_calc_aabb_surface_area(&area, &children[i].bounds);
+            if ((children[i].end - children[i].begin) > LAC_BVH_MAX_LEAF && area > largest_area) {
+                largest = i;
+                largest_area = area;
+            }
+        }
+        if (largest == LAC_BVH_WIDTH) {
+            break;
+        }
+
+        parent = children[largest];
+        _lac_split_bvh_range(&children[largest], &children[count], build, &parent);
+        count++;
+    }
+
+    for (i = 0; i < LAC_BVH_WIDTH; ++i) {
+        if (i >= count) {
+            for (c = 0; c < 3; ++c) {
+                node->min[c][i] = FLT_MAX;
+                node->max[c][i] = -FLT_MAX;
+            }
+            node->child[i] = LAC_BVH_EMPTY;
+            continue;
+        }
+
+        for (c = 0; c < 3; ++c) {
+            node->min[c][i] = children[i].bounds.min[c];
+            node->max[c][i] = children[i].bounds.max[c];
+        }
+
+        size = children[i].end - children[i].begin;
+        if (size <= LAC_BVH_MAX_LEAF || depth + 1 >= LAC_BVH_MAX_DEPTH) {
+            leaf = atomic_fetch_add_explicit(&build->leaf_count, 1, memory_order_relaxed);
+            build->bvh->leaves[leaf].first = (uint32_t)children[i].begin;
+            build->bvh->leaves[leaf].count = (uint32_t)size;
+            node->child[i] = (uint32_t)leaf | LAC_BVH_LEAF_BIT;
+        } else {
+            node->child[i] = (uint32_t)atomic_fetch_add_explicit(&build->node_count, 1, memory_order_relaxed);
+            tasks[num_tasks].build = build;
+            tasks[num_tasks].range = children[i];
+            tasks[num_tasks].node = node->child[i];
+            tasks[num_tasks].depth = depth + 1;
+            num_tasks++;
+        }
+    }
+
+    /* Large subtrees are handed to the scheduler, and the rest are built right away */
+    lac_init_task_group(&group);
+    for (i = 0; i < num_tasks; ++i) {
+        size = tasks[i].range.end - tasks[i].range.begin;
+        if (build->scheduler != NULL && size >= LAC_BVH_TASK_GRAIN &&
+            lac_submit_task(build->scheduler, &group, _lac_run_bvh_task, &tasks[i])) {
+            waiting = true;
+        } else {
+            _lac_run_bvh_task(&tasks[i]);
+        }
+    }
+    if (waiting) {
+        lac_wait_task_group(build->scheduler, &group);
+    }
+}
+
+/**
+ * @brief Range task which copies the bounds of each primitive into leaf order.
+ * @since 19-10-2026
+ * @param[in] arg The build
+ * @param[in] begin The first primitive of the piece, in leaf order
+ * @param[in] end One past the last primitive of the piece, in leaf order
+ */
+static void _lac_order_bvh_boxes(void *arg, size_t begin, size_t end) {
+    LacBvhBuild_t *build = arg;
+    size_t i;
+
+    for (i = begin; i < end; ++i) {
+        build->bvh->boxes[i] = build->boxes[build->bvh->prims[i]];
+    }
+}
+
+/**
+ * @brief Range task which packs the triangles of each leaf.
+ * @since 19-10-2026
+ * @param[in] arg The build
+ * @param[in] begin The first leaf of the piece
+ * @param[in] end One past the last leaf of the piece
+ */
+static void _lac_pack_bvh_leaves(void *arg, size_t begin, size_t end) {
+    LacBvhBuild_t *build = arg;
+    const LacBvhLeaf_t *leaf;
+    size_t i, p, remaining;
+
+    for (i = begin; i < end; ++i) {
+        leaf = &build->bvh->leaves[i];
+        for (p = 0; p * LAC_RAY_PACKET < leaf->count; ++p) {
+            remaining = leaf->count - (p * LAC_RAY_PACKET);
+            lac_init_triangle_packet(
+                &build->bvh->packets[leaf->packet + p],
+                build->vertices,
+                build->indices,
+                &build->bvh->prims[leaf->first + (p * LAC_RAY_PACKET)],
+                (remaining < LAC_RAY_PACKET) ? remaining : LAC_RAY_PACKET
+            );
+        }
+    }
+}
+
+/**
+ * @brief Builds a BVH over primitives with the given bounds, packing triangles into the leaves if __vertices__ is set.
+ * @since 19-10-2026
+ * @param[out] scheduler The scheduler, or NULL to build on the calling thread
+ * @param[in] boxes The bounds of each primitive
+ * @param[in] count The number of primitives
+ * @param[in] vertices The vertices of the triangles, or NULL
+ * @param[in] indices The vertex indices of the triangles, or NULL
+ * @returns The BVH, or NULL if it could not be allocated
+ */
+static LacBvh_t *_lac_create_bvh(
+    LacScheduler_t *scheduler,
+    const LacAabb_t *boxes,
+    const size_t count,
+    const vec3 *vertices,
+    const uint32_t *indices
+) {
+    LacBvhBuild_t build;
+    LacBvhRange_t root;
+    LacBvh_t *bvh;
+    size_t capacity, size, packets, i;
+
+    if (count >= LAC_BVH_LEAF_BIT) {
+        LAC_LOG("Too many primitives for a BVH", LAC_ERROR);
+        return NULL;
+    }
+
+    bvh = calloc(1, sizeof(LacBvh_t));
+    if (bvh == NULL) {
+        LAC_LOG("Failed to allocate BVH", LAC_ERROR);
+        return NULL;
+    }
+    lac_init_aabb(&bvh->bounds);
+    if (count == 0) {
+        return bvh;
+    }
+
+    /* Every node but the root splits at least once, so there are never more nodes than leaves */
+    capacity = count;
+    size = (capacity * sizeof(LacBvhNode_t) + (LAC_CACHE_LINE - 1)) & ~((size_t)LAC_CACHE_LINE - 1);
+    bvh->nodes = aligned_alloc(LAC_CACHE_LINE, size);
+    bvh->leaves = malloc(capacity * sizeof(LacBvhLeaf_t));
+    bvh->prims = malloc(count * sizeof(uint32_t));
+    bvh->boxes = malloc(count * sizeof(LacAabb_t));
+    build.centers = malloc(count * sizeof(vec3));
+    if (bvh->nodes == NULL || bvh->leaves == NULL || bvh->prims == NULL || bvh->boxes == NULL || build.centers == NULL) {
+        LAC_LOG("Failed to allocate BVH", LAC_ERROR);
+        free(build.centers);
+        lac_destroy_bvh(bvh);
+        return NULL;
+    }
+
+    build.bvh = bvh;
+    build.scheduler = scheduler;
+    build.boxes = boxes;
+    build.vertices = vertices;
+    build.indices = indices;
+    atomic_init(&build.node_count, 1);
+    atomic_init(&build.leaf_count, 0);
+
+    for (i = 0; i < count; ++i) {
+        bvh->prims[i] = (uint32_t)i;
+    }
+    _lac_run_bvh_range(scheduler, _lac_center_bvh_prims, &build, count);
+
+    root.begin = 0;
+    root.end = count;
+    _lac_bound_bvh_range(&root, &build);
+    _lac_build_bvh_node(&build, 0, &root, 0);
+
+    bvh->bounds = root.bounds;
+    bvh->node_count = atomic_load(&build.node_count);
+    bvh->leaf_count = atomic_load(&build.leaf_count);
+    bvh->prim_count = count;
+    free(build.centers);
+
+    _lac_run_bvh_range(scheduler, _lac_order_bvh_boxes, &build, count);
+
+    if (vertices != NULL) {
+        packets = 0;
+        for (i = 0; i < bvh->leaf_count; ++i) {
+            bvh->leaves[i].packet = (uint32_t)packets;
+            packets += (bvh->leaves[i].count + (LAC_RAY_PACKET - 1)) / LAC_RAY_PACKET;
+        }
+
+        bvh->packets = malloc(packets * sizeof(LacTrianglePacket_t));
+        if (bvh->packets == NULL) {
+            LAC_LOG("Failed to allocate BVH", LAC_ERROR);
+            lac_destroy_bvh(bvh);
+            return NULL;
+        }
+        _lac_run_bvh_range(scheduler, _lac_pack_bvh_leaves, &build, bvh->leaf_count);
+    }
+
+    return bvh;
+}
+
+/**
+ * @brief Builds a BVH over primitives given by their bounding boxes.
+ * @anchor lac_create_bvh_anchor
+ * @since 19-10-2026
+ *
+ * Queries report primitives by their index in __boxes__. A ray cast against this
+ * BVH hits the boxes themselves, at the point where the ray enters them.
+ *
+ * @param[out] scheduler The scheduler to build with, or NULL to build on the calling thread
+ * @param[in] boxes The bounds of each primitive
+ * @param[in] count The number of primitives
+ * @returns The BVH, or NULL if it could not be allocated
+ */
+LAC_DECL LacBvh_t *lac_create_bvh(LacScheduler_t *scheduler, const LacAabb_t *boxes, const size_t count) {
+    return _lac_create_bvh(scheduler, boxes, count, NULL, NULL);
+}
+
+/**
+ * @brief Builds a BVH over the triangles of a mesh.
+ * @anchor lac_create_bvh_triangles_anchor
+ * @since 19-10-2026
+ *
+ * Queries report triangles by their index within the mesh. The BVH keeps its own copy
+ * of the triangles, so the mesh may be freed or modified afterwards (although the BVH
+ * then needs rebuilding to reflect the changes).
+ *
+ * @param[out] scheduler The scheduler to build with, or NULL to build on the calling thread
+ * @param[in] vertices The vertex positions of the mesh
+ * @param[in] indices The 3 vertex indices of each triangle, or NULL if triangle i is made up of vertices 3i, 3i + 1 and 3i + 2
+ * @param[in] count The number of triangles
+ * @returns The BVH, or NULL if it could not be allocated
+ */
+LAC_DECL LacBvh_t *lac_create_bvh_triangles(
+    LacScheduler_t *scheduler,
+    const vec3 *vertices,
+    const uint32_t *indices,
+    const size_t count
+) {
+    LacBvhBuild_t build;
+    LacAabb_t *boxes;
+    LacBvh_t *bvh;
+
+    boxes = malloc(((count > 0) ? count : 1) * sizeof(LacAabb_t));
+    if (boxes == NULL) {
+        LAC_LOG("Failed to allocate BVH", LAC_ERROR);
+        return NULL;
+    }
+
+    build.boxes = boxes;
+    build.vertices = vertices;
+    build.indices = indices;
+    _lac_run_bvh_range(scheduler, _lac_bound_bvh_triangles, &build, count);
+
+    bvh = _lac_create_bvh(scheduler, boxes, count, vertices, indices);
+    free(boxes);
+    return bvh;
+}
+
+/**
+ * @brief Destroys a BVH.
+ * @since 19-10-2026
+ * @param[in] bvh The BVH to be destroyed
+ */
+LAC_DECL void lac_destroy_bvh(LacBvh_t *bvh) {
+    if (bvh == NULL) {
+        return;
+    }
+
+    free(bvh->nodes);
+    free(bvh->leaves);
+    free(bvh->prims);
+    free(bvh->boxes);
+    free(bvh->packets);
+    free(bvh);
+}
+
+/**
+ * @brief Gets the number of nodes in a BVH.
+ * @since 19-10-2026
+ * @param[in] bvh The BVH
+ * @returns The number of nodes, which is 0 only for a BVH without primitives
+ */
+LAC_DECL size_t lac_get_bvh_node_count(const LacBvh_t *bvh) {
+    return bvh->node_count;
+}
+
+/**
+ * @brief Gets the number of leaves in a BVH.
+ * @since 19-10-2026
+ * @param[in] bvh The BVH
+ * @returns The number of leaves
+ */
+LAC_DECL size_t lac_get_bvh_leaf_count(const LacBvh_t *bvh) {
+    return bvh->leaf_count;
+}
+
+/**
+ * @brief Gets the bounds of every primitive in a BVH.
+ * @since 19-10-2026
+ * @param[out] box The bounds, which are empty for a BVH without primitives
+ * @param[in] bvh The BVH
+ */
+LAC_DECL void lac_get_bvh_bounds(LacAabb_t *box, const LacBvh_t *bvh) {
+    *box = bvh->bounds;
+}
+
+/**
+ * @brief Finds where a ray enters a box.
+ * @since 19-10-2026
+ * @param[out] t The distance at which the ray enters the box, or __tmin__ if it starts inside
+ * @param[in] box The box
+ * @param[in] origin The origin of the ray
+ * @param[in] inv_dir The reciprocal of each component of the ray's direction
+ * @param[in] tmin The distance that the hit must be beyond
+ * @param[in] tmax The distance that the hit must be within
+ * @returns True if the ray enters the box between __tmin__ and __tmax__, or false otherwise
+ */
+static bool _lac_intersect_bvh_box(
+    float *t,
+    const LacAabb_t *box,
+    const float origin[3],
+    const float inv_dir[3],
+    const float tmin,
+    const float tmax
+) {
+    float t_near = tmin, t_far = tmax, t1, t2;
+    size_t c;
+
+    for (c = 0; c < 3; ++c) {
+        t1 = (box->min[c] - origin[c]) * inv_dir[c];
+        t2 = (box->max[c] - origin[c]) * inv_dir[c];
+        t_near = fmaxf(t_near, fminf(t1, t2));
+        t_far = fminf(t_far, fmaxf(t1, t2));
+    }
+
+    *t = t_near;
+    return t_near <= t_far && t_near < tmax;
+}
+
+/**
+ * @brief Tests a ray against every primitive in a leaf.
+ * @since 19-10-2026
+ * @param[in,out] hit The nearest hit so far
+ * @param[in] bvh The BVH
+ * @param[in] leaf The leaf
+ * @param[in] ray The ray
+ * @param[in] inv_dir The reciprocal of each component of the ray's direction
+ * @returns True if __hit__ was replaced, or false otherwise
+ */
+static bool _lac_intersect_bvh_leaf(
+    LacRayHit_t *hit,
+    const LacBvh_t *bvh,
+    const LacBvhLeaf_t *leaf,
+    const LacRay_t *ray,
+    const float inv_dir[3]
+) {
+    bool replaced = false;
+    size_t p;
+    float t;
+
+    if (bvh->packets != NULL) {
+        for (p = 0; p * LAC_RAY_PACKET < leaf->count; ++p) {
+            replaced |= lac_intersect_ray_triangle_packet(hit, ray, &bvh->packets[leaf->packet + p]);
+        }
+        return replaced;
+    }
+
+    for (p = leaf->first; p < leaf->first + leaf->count; ++p) {
+        if (_lac_intersect_bvh_box(&t, &bvh->boxes[p], ray->origin, inv_dir, ray->tmin, hit->t)) {
+            hit->t = t;
+            hit->u = 0.0f;
+            hit->v = 0.0f;
+            hit->prim = bvh->prims[p];
+            replaced = true;
+        }
+    }
+    return replaced;
+}
+
+/**
+ * @brief Finds the nearest primitive in a BVH which a ray hits.
+ * @anchor lac_intersect_bvh_ray_anchor
+ * @since 19-10-2026
+ *
+ * The children of each node are visited from nearest to furthest. Each is pushed with the
+ * distance at which the ray enters it, and skipped when popped if a hit at least as near
+ * has been found in the meantime, so a ray typically stops after the first few leaves that
+ * it reaches. For a BVH built by lac_create_bvh(), the boxes are hit where the ray enters
+ * them and the barycentrics are set to 0.
+ *
+ * @param[in] bvh The BVH
+ * @param[in,out] hit The nearest hit so far, as initialized by lac_init_ray_hit(), which is replaced if any primitive is hit any nearer
+ * @param[in] ray The ray
+ * @returns True if __hit__ was replaced, or false otherwise
+ */
+LAC_DECL bool lac_intersect_bvh_ray(const LacBvh_t *bvh, LacRayHit_t *hit, const LacRay_t *ray) {
+    uint32_t stack[LAC_BVH_STACK_SIZE], order[LAC_BVH_WIDTH], entry;
+    float stack_near[LAC_BVH_STACK_SIZE], inv_dir[3], dir, t_near[LAC_BVH_WIDTH];
+    lac_f32x4 origin[3], inv[3], t1, t2, near, far;
+    const LacBvhNode_t *node;
+    size_t top = 0, hits, c, i, j;
+    unsigned bits;
+    bool replaced = false;
+
+    if (bvh->node_count == 0) {
+        return false;
+    }
+
+    for (c = 0; c < 3; ++c) {
+        dir = ray->direction[c];
+        if (dir < LAC_BVH_MIN_DIRECTION && dir > -LAC_BVH_MIN_DIRECTION) {
+            dir = (dir < 0.0f) ? -LAC_BVH_MIN_DIRECTION : LAC_BVH_MIN_DIRECTION;
+        }
+        inv_dir[c] = 1.0f / dir;
+        inv[c] = lac_simd_splat_f32x4(inv_dir[c]);
+        origin[c] = lac_simd_splat_f32x4(ray->origin[c]);
+    }
+
+    stack[top] = 0;
+    stack_near[top++] = ray->tmin;
+    while (top > 0) {
+        entry = stack[--top];
+
+        /* A nearer hit may have been found since the entry was pushed */
+        if (stack_near[top] >= hit->t) {
+            continue;
+        }
+        if (entry & LAC_BVH_LEAF_BIT) {
+            replaced |= _lac_intersect_bvh_leaf(hit, bvh, &bvh->leaves[entry & ~LAC_BVH_LEAF_BIT], ray, inv_dir);
+            continue;
+        }
+
+        /* Slab test against all 4 children at once */
+        node = &bvh->nodes[entry];
+        near = lac_simd_splat_f32x4(ray->tmin);
+        far = lac_simd_splat_f32x4(hit->t);
+        for (c = 0; c < 3; ++c) {
+            t1 = lac_simd_mul_f32x4(lac_simd_sub_f32x4(lac_simd_load_f32x4(node->min[c], 4), origin[c]), inv[c]);
+            t2 = lac_simd_mul_f32x4(lac_simd_sub_f32x4(lac_simd_load_f32x4(node->max[c], 4), origin[c]), inv[c]);
+            near = lac_simd_max_f32x4(near, lac_simd_min_f32x4(t1, t2));
+            far = lac_simd_min_f32x4(far, lac_simd_max_f32x4(t1, t2));
+        }
+        bits = lac_simd_bits_i32x4(lac_simd_le_f32x4(near, far));
+        lac_simd_store_f32x4(t_near, near, 4);
+
+        /* Sort the children that were hit from furthest to nearest, so that the nearest is popped first */
+        hits = 0;
+        for (i = 0; i < LAC_BVH_WIDTH; ++i) {
+            if (!(bits & (1u << i)) || node->child[i] == LAC_BVH_EMPTY) {
+                continue;
+            }
+            for (j = hits; j > 0 && t_near[order[j - 1]] < t_near[i]; --j) {
+                order[j] = order[j - 1];
+            }
+            order[j] = (uint32_t)i;
+            hits++;
+        }
+        for (i = 0; i < hits; ++i) {
+            stack[top] = node->child[order[i]];
+            stack_near[top++] = t_near[order[i]];
+        }
+    }
+
+    return replaced;
+}
+
+/**
+ * @brief Finds every primitive in a BVH whose bounds overlap a box.
+ * @anchor lac_query_bvh_aabb_anchor
+ * @since 19-10-2026
+ * @param[in] bvh The BVH
+ * @param[out] prims The overlapping primitives, in no particular order
+ * @param[in] max_prims The number of primitives which __prims__ can hold
+ * @param[in] box The box
+ * @returns The number of overlapping primitives, which may be more than __max_prims__
+ */
+LAC_DECL size_t lac_query_bvh_aabb(const LacBvh_t *bvh, uint32_t *prims, const size_t max_prims, const LacAabb_t *box) {
+    uint32_t stack[LAC_BVH_STACK_SIZE], entry;
+    lac_f32x4 box_min[3], box_max[3];
+    const LacBvhNode_t *node;
+    const LacBvhLeaf_t *leaf;
+    lac_i32x4 mask;
+    size_t top = 0, found = 0, c, i;
+    unsigned bits;
+
+    if (bvh->node_count == 0) {
+        return 0;
+    }
+
+    for (c = 0; c < 3; ++c) {
+        box_min[c] = lac_simd_splat_f32x4(box->min[c]);
+        box_max[c] = lac_simd_splat_f32x4(box->max[c]);
+    }
+
+    stack[top++] = 0;
+    while (top > 0) {
+        entry = stack[--top];
+        if (entry & LAC_BVH_LEAF_BIT) {
+            leaf = &bvh->leaves[entry & ~LAC_BVH_LEAF_BIT];
+            for (i = leaf->first; i < leaf->first + leaf->count; ++i) {
+                if (lac_test_aabb_overlap(&bvh->boxes[i], box)) {
+                    if (found < max_prims) {
+                        prims[found] = bvh->prims[i];
+                    }
+                    found++;
+                }
+            }
+            continue;
+        }
+
+        /* Overlap test against all 4 children at once */
+        node = &bvh->nodes[entry];
+        mask = lac_simd_and_i32x4(
+            lac_simd_le_f32x4(lac_simd_load_f32x4(node->min[0], 4), box_max[0]),
+            lac_simd_le_f32x4(box_min[0], lac_simd_load_f32x4(node->max[0], 4))
+        );
+        for (c = 1; c < 3; ++c) {
+            mask = lac_simd_and_i32x4(mask, lac_simd_le_f32x4(lac_simd_load_f32x4(node->min[c], 4), box_max[c]));
+            mask = lac_simd_and_i32x4(mask, lac_simd_le_f32x4(box_min[c], lac_simd_load_f32x4(node->max[c], 4)));
+        }
+        bits = lac_simd_bits_i32x4(mask);
+
+        for (i = 0; i < LAC_BVH_WIDTH; ++i) {
+            if ((bits & (1u << i)) && node->child[i] != LAC_BVH_EMPTY) {
+                stack[top++] = node->child[i];
+            }
+        }
+    }
+
+    return found;
+}
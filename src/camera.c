@@ -0,0 +1,321 @@
+/**
+ * @file camera.c
+ * @author Neil Kingdom
+ * @since 19-10-2026
+ * @version 1.0
+ * @brief Provides a camera which caches its view and projection matrices.
+ *
+ * @section camera Camera
+ *
+ * Rendering a scene requires two matrices from the camera. The view matrix
+ * takes vertices from world space into the camera's own coordinate space,
+ * and is obtained by inverting the point-at matrix (see transforms.c). The
+ * projection matrix then takes vertices from camera space into clip space.
+ * These are usually combined into a single view-projection matrix, and
+ * their inverses are needed for things like mouse picking, where a point
+ * on the screen must be taken back into world space.
+ *
+ * Building all six of these matrices every frame is wasteful, since the
+ * inputs that they depend on rarely all change at once. For example,
+ * resizing the window only changes the aspect ratio, which has no effect
+ * on the view matrix whatsoever. The camera therefore keeps track of which
+ * matrices are out of date, and only recomputes a matrix the next time it
+ * is requested. Each time an input actually changes value, the camera's
+ * generation counter is incremented. By remembering the generation at which
+ * they last uploaded a camera's matrices (e.g. to a uniform buffer), callers
+ * can skip the upload entirely when nothing has changed.
+ *
+ * @subsection camera_related Related Functions
+ *
+ * - @ref lac_init_camera_anchor "lac_init_camera"
+ * - @ref lac_get_camera_generation_anchor "lac_get_camera_generation"
+ * - @ref lac_get_point_at_mat4_anchor "lac_get_point_at_mat4"
+ * - @ref lac_invert_mat4_anchor "lac_invert_mat4"
+ */
+
+#include "camera.h"
+
+/* Bits of LacCamera_t::dirty; each bit marks a group of cached matrices as out of date */
+#define LAC_CAMERA_VIEW          (1u << 0)
+#define LAC_CAMERA_PROJ          (1u << 1)
+#define LAC_CAMERA_VIEW_PROJ     (1u << 2)
+#define LAC_CAMERA_INV_VIEW_PROJ (1u << 3)
+
+#define LAC_CAMERA_VIEW_DEPS (LAC_CAMERA_VIEW | LAC_CAMERA_VIEW_PROJ | LAC_CAMERA_INV_VIEW_PROJ)
+#define LAC_CAMERA_PROJ_DEPS (LAC_CAMERA_PROJ | LAC_CAMERA_VIEW_PROJ | LAC_CAMERA_INV_VIEW_PROJ)
+
+/**
+ * @brief Marks the matrices given by __deps__ as out of date and bumps the generation.
+ * @since 19-10-2026
+ * @param[out] camera The camera which has been modified
+ * @param[in] deps The dirty bits that depend on the modified input
+ */
+static inline void _lac_touch_camera(LacCamera_t *camera, const uint32_t deps) {
+    camera->dirty |= deps;
+    camera->generation++;
+}
+
+/**
+ * @brief Rebuilds the view matrix and its inverse if they are out of date.
+ * @since 19-10-2026
+ * @param[out] camera The camera to be updated
+ */
+static void _lac_update_camera_view(LacCamera_t *camera) {
+    if (!(camera->dirty & LAC_CAMERA_VIEW)) {
+        return;
+    }
+
+    /* The point-at matrix takes camera space to world space, so it is the inverse view matrix */
+    lac_get_point_at_mat4(camera->inv_view, camera->eye, camera->target, camera->up);
+    lac_invert_mat4(camera->view, camera->inv_view);
+
+    camera->dirty &= ~LAC_CAMERA_VIEW;
+}
+
+/**
+ * @brief Rebuilds the projection matrix and its inverse if they are out of date.
+ * @since 19-10-2026
+ * @param[out] camera The camera to be updated
+ */
+static void _lac_update_camera_proj(LacCamera_t *camera) {
+    float a, f, c, d;
+
+    if (!(camera->dirty & LAC_CAMERA_PROJ)) {
+        return;
+    }
+
+    lac_get_projection_mat4(camera->proj, camera->aspect, camera->fov, camera->znear, camera->zfar);
+
+    /*
+     * Rather than inverting the projection matrix through the general
+     * (and expensive) cofactor method, we take advantage of the fact that
+     * only 6 of its elements are non-zero. Solving for x, y, z and w gives:
+     *
+     * | 1/a  0    0    0   |
+     * | 0    1/f  0    0   |
+     * | 0    0    0    1/d |
+     * | 0    0   -1    c/d |
+     */
+    a = camera->proj[0];
+    f = camera->proj[5];
+    c = camera->proj[10];
+    d = camera->proj[14];
+
+    memset(camera->inv_proj, 0, sizeof(mat4));
+    if (a == 0.0f || f == 0.0f || d == 0.0f) {
+        LAC_LOG("Projection matrix is not invertible", LAC_WARNING);
+    } else {
+        camera->inv_proj[0]  = 1.0f / a;
+        camera->inv_proj[5]  = 1.0f / f;
+        camera->inv_proj[11] = 1.0f / d;
+        camera->inv_proj[14] = -1.0f;
+        camera->inv_proj[15] = c / d;
+    }
+
+    camera->dirty &= ~LAC_CAMERA_PROJ;
+}
+
+/**
+ * @brief Initializes a camera and marks all of its matrices as out of date.
+ * @anchor lac_init_camera_anchor
+ * @since 19-10-2026
+ * @param[out] camera The camera to be initialized
+ * @param[in] v_eye A vector representing the origin of the camera
+ * @param[in] v_target A vector representing the target point in 3D space for the camera to point towards
+ * @param[in] v_up A vector representing the "up" direction (used for camera orientation)
+ * @param[in] aspect The aspect ratio of the screen (see lac_get_projection_mat4())
+ * @param[in] fov The field of view (see lac_get_projection_mat4())
+ * @param[in] znear The "near" clipping z-plane
+ * @param[in] zfar The "far" clipping z-plane
+ */
+LAC_DECL void lac_init_camera(
+    LacCamera_t *camera,
+    const vec3 v_eye,
+    const vec3 v_target,
+    const vec3 v_up,
+    const float aspect,
+    const float fov,
+    const float znear,
+    const float zfar
+) {
+    memset(camera, 0, sizeof(LacCamera_t));
+
+    memcpy(camera->eye, v_eye, sizeof(vec3));
+    memcpy(camera->target, v_target, sizeof(vec3));
+    memcpy(camera->up, v_up, sizeof(vec3));
+    camera->aspect = aspect;
+    camera->fov = fov;
+    camera->znear = znear;
+    camera->zfar = zfar;
+
+    _lac_touch_camera(camera, LAC_CAMERA_VIEW_DEPS | LAC_CAMERA_PROJ_DEPS);
+}
+
+/**
+ * @brief Moves the origin of the camera.
+ * @since 19-10-2026
+ * @param[out] camera The camera to be modified
+ * @param[in] v_eye A vector representing the origin of the camera
+ */
+LAC_DECL void lac_set_camera_eye(LacCamera_t *camera, const vec3 v_eye) {
+    if (memcmp(camera->eye, v_eye, sizeof(vec3)) != 0) {
+        memcpy(camera->eye, v_eye, sizeof(vec3));
+        _lac_touch_camera(camera, LAC_CAMERA_VIEW_DEPS);
+    }
+}
+
+/**
+ * @brief Changes the point that the camera looks towards.
+ * @since 19-10-2026
+ * @param[out] camera The camera to be modified
+ * @param[in] v_target A vector representing the target point in 3D space for the camera to point towards
+ */
+LAC_DECL void lac_set_camera_target(LacCamera_t *camera, const vec3 v_target) {
+    if (memcmp(camera->target, v_target, sizeof(vec3)) != 0) {
+        memcpy(camera->target, v_target, sizeof(vec3));
+        _lac_touch_camera(camera, LAC_CAMERA_VIEW_DEPS);
+    }
+}
+
+/**
+ * @brief Changes the "up" direction of the camera.
+ * @since 19-10-2026
+ * @param[out] camera The camera to be modified
+ * @param[in] v_up A vector representing the "up" direction (used for camera orientation)
+ */
+LAC_DECL void lac_set_camera_up(LacCamera_t *camera, const vec3 v_up) {
+    if (memcmp(camera->up, v_up, sizeof(vec3)) != 0) {
+        memcpy(camera->up, v_up, sizeof(vec3));
+        _lac_touch_camera(camera, LAC_CAMERA_VIEW_DEPS);
+    }
+}
+
+/**
+ * @brief Changes the aspect ratio of the camera.
+ * @since 19-10-2026
+ * @param[out] camera The camera to be modified
+ * @param[in] aspect The aspect ratio of the screen (see lac_get_projection_mat4())
+ */
+LAC_DECL void lac_set_camera_aspect(LacCamera_t *camera, const float aspect) {
+    if (camera->aspect != aspect) {
+        camera->aspect = aspect;
+        _lac_touch_camera(camera, LAC_CAMERA_PROJ_DEPS);
+    }
+}
+
+/**
+ * @brief Changes the field of view of the camera.
+ * @since 19-10-2026
+ * @param[out] camera The camera to be modified
+ * @param[in] fov The field of view (see lac_get_projection_mat4())
+ */
+LAC_DECL void lac_set_camera_fov(LacCamera_t *camera, const float fov) {
+    if (camera->fov != fov) {
+        camera->fov = fov;
+        _lac_touch_camera(camera, LAC_CAMERA_PROJ_DEPS);
+    }
+}
+
+/**
+ * @brief Changes the near and far clipping planes of the camera.
+ * @since 19-10-2026
+ * @param[out] camera The camera to be modified
+ * @param[in] znear The "near" clipping z-plane
+ * @param[in] zfar The "far" clipping z-plane
+ */
+LAC_DECL void lac_set_camera_clip_planes(LacCamera_t *camera, const float znear, const float zfar) {
+    if (camera->znear != znear || camera->zfar != zfar) {
+        camera->znear = znear;
+        camera->zfar = zfar;
+        _lac_touch_camera(camera, LAC_CAMERA_PROJ_DEPS);
+    }
+}
+
+/**
+ * @brief Gets the view matrix of the camera, rebuilding it only if it is out of date.
+ * @since 19-10-2026
+ * @param[out] m_out The view matrix
+ * @param[in] camera The camera
+ */
+LAC_DECL void lac_get_camera_view_mat4(mat4 m_out, LacCamera_t *camera) {
+    _lac_update_camera_view(camera);
+    memcpy(m_out, camera->view, sizeof(mat4));
+}
+
+/**
+ * @brief Gets the inverse view matrix (i.e. the point-at matrix) of the camera.
+ * @since 19-10-2026
+ * @param[out] m_out The inverse view matrix
+ * @param[in] camera The camera
+ */
+LAC_DECL void lac_get_camera_inv_view_mat4(mat4 m_out, LacCamera_t *camera) {
+    _lac_update_camera_view(camera);
+    memcpy(m_out, camera->inv_view, sizeof(mat4));
+}
+
+/**
+ * @brief Gets the projection matrix of the camera, rebuilding it only if it is out of date.
+ * @since 19-10-2026
+ * @param[out] m_out The projection matrix
+ * @param[in] camera The camera
+ */
+LAC_DECL void lac_get_camera_projection_mat4(mat4 m_out, LacCamera_t *camera) {
+    _lac_update_camera_proj(camera);
+    memcpy(m_out, camera->proj, sizeof(mat4));
+}
+
+/**
+ * @brief Gets the inverse projection matrix of the camera.
+ * @since 19-10-2026
+ * @param[out] m_out The inverse projection matrix
+ * @param[in] camera The camera
+ */
+LAC_DECL void lac_get_camera_inv_projection_mat4(mat4 m_out, LacCamera_t *camera) {
+    _lac_update_camera_proj(camera);
+    memcpy(m_out, camera->inv_proj, sizeof(mat4));
+}
+
+/**
+ * @brief Gets the combined view-projection matrix of the camera.
+ * @since 19-10-2026
+ * @param[out] m_out The product of the projection and view matrices
+ * @param[in] camera The camera
+ */
+LAC_DECL void lac_get_camera_view_projection_mat4(mat4 m_out, LacCamera_t *camera) {
+    if (camera->dirty & LAC_CAMERA_VIEW_PROJ) {
+        _lac_update_camera_view(camera);
+        _lac_update_camera_proj(camera);
+        lac_multiply_mat4(camera->view_proj, camera->proj, camera->view);
+        camera->dirty &= ~LAC_CAMERA_VIEW_PROJ;
+    }
+
+    memcpy(m_out, camera->view_proj, sizeof(mat4));
+}
+
+/**
+ * @brief Gets the inverse of the combined view-projection matrix of the camera.
+ * @since 19-10-2026
+ * @param[out] m_out The product of the inverse view and inverse projection matrices
+ * @param[in] camera The camera
+ */
+LAC_DECL void lac_get_camera_inv_view_projection_mat4(mat4 m_out, LacCamera_t *camera) {
+    if (camera->dirty & LAC_CAMERA_INV_VIEW_PROJ) {
+        _lac_update_camera_view(camera);
+        _lac_update_camera_proj(camera);
+        lac_multiply_mat4(camera->inv_view_proj, camera->inv_view, camera->inv_proj);
+        camera->dirty &= ~LAC_CAMERA_INV_VIEW_PROJ;
+    }
+
+    memcpy(m_out, camera->inv_view_proj, sizeof(mat4));
+}
+
+/**
+ * @brief Gets the number of times that any of the camera's inputs have changed.
+ * @anchor lac_get_camera_generation_anchor
+ * @since 19-10-2026
+ * @param[in] camera The camera
+ * @returns A counter which differs from any previously returned value if any of the camera's matrices have changed since
+ */
+LAC_DECL uint64_t lac_get_camera_generation(const LacCamera_t *camera) {
+    return camera->generation;
+}
@@ -0,0 +1,713 @@
+/**
+ * @file coords.c
+ * @author Neil Kingdom
+ * @since 19-10-2026
+ * @version 1.0
+ * @brief Contains functions for converting arrays of points between coordinate systems.
+ *
+ * @section coordarrays Converting Arrays of Points
+ *
+ * lac_polar_to_cartesian() and lac_cartesian_to_polar() (see vecmath.c)
+ * convert one point at a time through the C library's cosf(), sinf() and
+ * atan2f(). These cannot be vectorized, and they handle every possible
+ * input, including angles of any size, to within half a ULP. A sensor
+ * pipeline which converts millions of returns per second rarely needs all
+ * of that, so the array conversions here compute the sines, cosines and
+ * arctangents of LAC_BATCH_BLOCK points at once with polynomials.
+ *
+ * To find the sine and cosine of an angle x, the angle is first reduced to
+ * r = x - k * pi/2, where k is x * 2/pi rounded to the nearest integer, so
+ * that r lies within [-pi/4, pi/4]. On that range, short polynomials in r
+ * are accurate, and the two lowest bits of k say which quadrant x lies in,
+ * i.e. whether the sine and cosine of r swap places or change sign. The
+ * constant pi/2 is split into three parts, and k times each part is taken
+ * away in turn, which keeps the reduction exact for angles of up to 8192
+ * radians in either direction. Larger angles, infinities and NaNs are
+ * passed to sinf() and cosf() instead, one at a time.
+ *
+ * The arctangent of y / x is found for t = min(|x|, |y|) / max(|x|, |y|),
+ * which lies within [0, 1], and then reflected into the right octant using
+ * the signs and relative sizes of x and y.
+ *
+ * Each conversion takes a LacCoordAccuracy_t. LAC_COORD_FAST uses shorter
+ * polynomials, with an absolute error of at most about 2e-5, which is far
+ * below the noise of most sensors. LAC_COORD_PRECISE uses longer ones,
+ * with an absolute error of at most about 1e-7 for sines and cosines, and
+ * 3e-7 for angles. For results near 1 in size, that is within 2 ULPs of the
+ * C library for sines and cosines and 4 ULPs for angles, but results close
+ * to zero, such as the sine of an angle near a multiple of pi, are only as
+ * accurate in absolute terms, so they can be many ULPs out.
+ *
+ * The points may be given either as arrays of vectors (e.g. vec2 holding a
+ * length and an angle), or in SoA layout, where each component lives in its
+ * own array. The SoA forms skip the transposing that the arrays of vectors
+ * need, so they are the faster of the two.
+ *
+ * @subsection coordarrays_related Related Functions
+ *
+ * - @ref lac_polar_to_cartesian_array_anchor "lac_polar_to_cartesian_array"
+ * - @ref lac_cartesian_to_polar_array_anchor "lac_cartesian_to_polar_array"
+ * - @ref lac_polar_to_cartesian_soa_anchor "lac_polar_to_cartesian_soa"
+ * - @ref lac_cartesian_to_polar_soa_anchor "lac_cartesian_to_polar_soa"
+ *
+ * @section coordsphere Spherical and Cylindrical Coordinates
+ *
+ * Spherical and cylindrical coordinates extend polar coordinates to 3D.
+ * Both keep the azimuth, which is the angle of the point around the z axis,
+ * measured anticlockwise from the x axis just like a polar angle.
+ *
+ * Cylindrical coordinates (radius, azimuth, height) are simply polar
+ * coordinates in the xy plane, with z carried over as the height.
+ *
+ * Spherical coordinates (radius, azimuth, inclination) give the distance of
+ * the point from the origin, and its inclination, which is the angle between
+ * the point and the z axis, from 0 (straight up the z axis) to pi (straight
+ * down). The point is then:
+ *
+ * - x = radius * sin(inclination) * cos(azimuth)
+ * - y = radius * sin(inclination) * sin(azimuth)
+ * - z = radius * cos(inclination)
+ *
+ * The inclination is recovered as atan2(sqrt(x^2 + y^2), z), rather than
+ * acos(z / radius), which loses precision near the poles.
+ *
+ * @subsection coordsphere_related Related Functions
+ *
+ * - @ref lac_spherical_to_cartesian_array_anchor "lac_spherical_to_cartesian_array"
+ * - @ref lac_cartesian_to_spherical_array_anchor "lac_cartesian_to_spherical_array"
+ * - @ref lac_cylindrical_to_cartesian_array_anchor "lac_cylindrical_to_cartesian_array"
+ * - @ref lac_cartesian_to_cylindrical_array_anchor "lac_cartesian_to_cylindrical_array"
+ */
+
+#include "coords.h"
+#include "lac_simd.h"
+#include "lac_dispatch.h"
+#include "lac_trig.h"
+
+/* The conversions performed by _lac_convert_block() */
+typedef enum {
+    LAC_CONVERT_POLAR_TO_CARTESIAN,
+    LAC_CONVERT_CARTESIAN_TO_POLAR,
+    LAC_CONVERT_SPHERICAL_TO_CARTESIAN,
+    LAC_CONVERT_CARTESIAN_TO_SPHERICAL,
+    LAC_CONVERT_CYLINDRICAL_TO_CARTESIAN,
+    LAC_CONVERT_CARTESIAN_TO_CYLINDRICAL
+} LacConversion_t;
+
+/**
+ * @brief Converts exactly LAC_BATCH_BLOCK points from polar to cartesian coordinates.
+ * @since 19-10-2026
+ * @param[out] x The x components of the points (may be the same array as __len__ or __angle__)
+ * @param[out] y The y components of the points (may be the same array as __len__ or __angle__)
+ * @param[in] len The radial coordinates
+ * @param[in] angle The angular coordinates in radians
+ * @param[in] accuracy The accuracy of the polynomials
+ */
+static LAC_VARIANT_INLINE void _lac_polar_to_cartesian_block(
+    float *x,
+    float *y,
+    const float *len,
+    const float *angle,
+    const LacCoordAccuracy_t accuracy
+) {
+    const lac_f32x8 r = lac_simd_load_f32x8(len);
+    float s[LAC_BATCH_BLOCK], c[LAC_BATCH_BLOCK];
+
+    _lac_sincos_block(s, c, angle, accuracy == LAC_COORD_PRECISE);
+    lac_simd_store_f32x8(x, lac_simd_mul_f32x8(r, lac_simd_load_f32x8(c)));
+    lac_simd_store_f32x8(y, lac_simd_mul_f32x8(r, lac_simd_load_f32x8(s)));
+}
+
+/**
+ * @brief Converts exactly LAC_BATCH_BLOCK points from cartesian to polar coordinates.
+ * @since 19-10-2026
+ * @param[out] len The radial coordinates (may be the same array as __x__ or __y__)
+ * @param[out] angle The angular coordinates in radians (may be the same array as __x__ or __y__)
+ * @param[in] x The x components of the points
+ * @param[in] y The y components of the points
+ * @param[in] accuracy The accuracy of the polynomial
+ */
+static LAC_VARIANT_INLINE void _lac_cartesian_to_polar_block(
+    float *len,
+    float *angle,
+    const float *x,
+    const float *y,
+    const LacCoordAccuracy_t accuracy
+) {
+    const lac_f32x8 vx = lac_simd_load_f32x8(x), vy = lac_simd_load_f32x8(y);
+    float a[LAC_BATCH_BLOCK];
+
+    _lac_atan2_block(a, y, x, accuracy == LAC_COORD_PRECISE);
+    lac_simd_store_f32x8(len, lac_simd_sqrt_f32x8(lac_simd_madd_f32x8(vx, vx, lac_simd_mul_f32x8(vy, vy))));
+    lac_simd_store_f32x8(angle, lac_simd_load_f32x8(a));
+}
+
+/**
+ * @brief Converts exactly LAC_BATCH_BLOCK points from spherical to cartesian coordinates.
+ * @since 19-10-2026
+ * @param[out] out The x, y and z components of the points (may be the same arrays as __in__)
+ * @param[in] in The radius, azimuth and inclination of the points
+ * @param[in] accuracy The accuracy of the polynomials
+ */
+static LAC_VARIANT_INLINE void _lac_spherical_to_cartesian_block(
+    float *const out[3],
+    const float *const in[3],
+    const LacCoordAccuracy_t accuracy
+) {
+    const lac_f32x8 r = lac_simd_load_f32x8(in[0]);
+    float sin_az[LAC_BATCH_BLOCK], cos_az[LAC_BATCH_BLOCK], sin_inc[LAC_BATCH_BLOCK], cos_inc[LAC_BATCH_BLOCK];
+    lac_f32x8 rho;
+
+    _lac_sincos_block(sin_az, cos_az, in[1], accuracy == LAC_COORD_PRECISE);
+    _lac_sincos_block(sin_inc, cos_inc, in[2], accuracy == LAC_COORD_PRECISE);
+    rho = lac_simd_mul_f32x8(r, lac_simd_load_f32x8(sin_inc));
+    lac_simd_store_f32x8(out[0], lac_simd_mul_f32x8(rho, lac_simd_load_f32x8(cos_az)));
+    lac_simd_store_f32x8(out[1], lac_simd_mul_f32x8(rho, lac_simd_load_f32x8(sin_az)));
+    lac_simd_store_f32x8(out[2], lac_simd_mul_f32x8(r, lac_simd_load_f32x8(cos_inc)));
+}
+
+/**
+ * @brief Converts exactly LAC_BATCH_BLOCK points from cartesian to spherical coordinates.
+ * @since 19-10-2026
+ * @param[out] out The radius, azimuth and inclination of the points (may be the same arrays as __in__)
+ * @param[in] in The x, y and z components of the points
+ * @param[in] accuracy The accuracy of the polynomial
+ */
+static LAC_VARIANT_INLINE void _lac_cartesian_to_spherical_block(
+    float *const out[3],
+    const float *const in[3],
+    const LacCoordAccuracy_t accuracy
+) {
+    const lac_f32x8 x = lac_simd_load_f32x8(in[0]), y = lac_simd_load_f32x8(in[1]), z = lac_simd_load_f32x8(in[2]);
+    const lac_f32x8 rho_sq = lac_simd_madd_f32x8(x, x, lac_simd_mul_f32x8(y, y));
+    float rho[LAC_BATCH_BLOCK], azimuth[LAC_BATCH_BLOCK], inclination[LAC_BATCH_BLOCK];
+
+    lac_simd_store_f32x8(rho, lac_simd_sqrt_f32x8(rho_sq));
+    _lac_atan2_block(azimuth, in[1], in[0], accuracy == LAC_COORD_PRECISE);
+    _lac_atan2_block(inclination, rho, in[2], accuracy == LAC_COORD_PRECISE);
+    lac_simd_store_f32x8(out[0], lac_simd_sqrt_f32x8(lac_simd_madd_f32x8(z, z, rho_sq)));
+    lac_simd_store_f32x8(out[1], lac_simd_load_f32x8(azimuth));
+    lac_simd_store_f32x8(out[2], lac_simd_load_f32x8(inclination));
+}
+
+/**
+ * @brief Performs one of the conversions on exactly LAC_BATCH_BLOCK points.
+ * @since 19-10-2026
+ * @param[out] out The components of the converted points (may be the same arrays as __in__)
+ * @param[in] in The components of the points, i.e. __in__[c][i] is component c of point i
+ * @param[in] conversion The conversion, which decides whether the points have 2 or 3 components
+ * @param[in] accuracy The accuracy of the polynomials
+ */
+static LAC_VARIANT_INLINE void _lac_convert_block(
+    float *const out[3],
+    const float *const in[3],
+    const LacConversion_t conversion,
+    const LacCoordAccuracy_t accuracy
+) {
+    lac_f32x8 height;
+
+    switch (conversion) {
+        case LAC_CONVERT_POLAR_TO_CARTESIAN:
+            _lac_polar_to_cartesian_block(out[0], out[1], in[0], in[1], accuracy);
+            break;
+        case LAC_CONVERT_CARTESIAN_TO_POLAR:
+            _lac_cartesian_to_polar_block(out[0], out[1], in[0], in[1], accuracy);
+            break;
+        case LAC_CONVERT_SPHERICAL_TO_CARTESIAN:
+            _lac_spherical_to_cartesian_block(out, in, accuracy);
+            break;
+        case LAC_CONVERT_CARTESIAN_TO_SPHERICAL:
+            _lac_cartesian_to_spherical_block(out, in, accuracy);
+            break;
+        case LAC_CONVERT_CYLINDRICAL_TO_CARTESIAN:
+            height = lac_simd_load_f32x8(in[2]);
+            _lac_polar_to_cartesian_block(out[0], out[1], in[0], in[1], accuracy);
+            lac_simd_store_f32x8(out[2], height);
+            break;
+        case LAC_CONVERT_CARTESIAN_TO_CYLINDRICAL:
+            height = lac_simd_load_f32x8(in[2]);
+            _lac_cartesian_to_polar_block(out[0], out[1], in[0], in[1], accuracy);
+            lac_simd_store_f32x8(out[2], height);
+            break;
+    }
+}
+
+/**
+ * @brief Performs one of the conversions on an array of vectors, transposing each block to SoA layout and back.
+ * @since 19-10-2026
+ * @param[out] v_out The converted vectors (may be the same array as __v_in__)
+ * @param[in] v_in The vectors, each of __n__ floats
+ * @param[in] n The number of components in each vector (2 or 3)
+ * @param[in] count The number of vectors in __v_in__ and __v_out__
+ * @param[in] conversion The conversion
+ * @param[in] accuracy The accuracy of the polynomials
+ */
+static LAC_ALWAYS_INLINE void _lac_convert_aos(
+    float *v_out,
+    const float *v_in,
+    const size_t n,
+    const size_t count,
+    const LacConversion_t conversion,
+    const LacCoordAccuracy_t accuracy
+) {
+    float in[3][LAC_BATCH_BLOCK] = { { 0 } }, out[3][LAC_BATCH_BLOCK];
+    float *const out_rows[3] = { out[0], out[1], out[2] };
+    const float *const in_rows[3] = { in[0], in[1], in[2] };
+    size_t i, j, c, block;
+
+    for (i = 0; i < count; i += LAC_BATCH_BLOCK) {
+        /* The lanes past the end of a final partial block keep the previous block's points, which are discarded */
+        block = ((count - i) < LAC_BATCH_BLOCK) ? (count - i) : LAC_BATCH_BLOCK;
+        for (j = 0; j < block; ++j) {
+            for (c = 0; c < n; ++c) {
+                in[c][j] = v_in[((i + j) * n) + c];
+            }
+        }
+
+        _lac_convert_block(out_rows, in_rows, conversion, accuracy);
+
+        for (j = 0; j < block; ++j) {
+            for (c = 0; c < n; ++c) {
+                v_out[((i + j) * n) + c] = out[c][j];
+            }
+        }
+    }
+}
+
+/**
+ * @brief Performs one of the conversions on points in SoA layout.
+ * @since 19-10-2026
+ * @param[out] out The arrays of the converted components (may be the same arrays as __in__)
+ * @param[in] in The arrays of each component of the points
+ * @param[in] n The number of components in each point (2 or 3)
+ * @param[in] count The number of points
+ * @param[in] conversion The conversion
+ * @param[in] accuracy The accuracy of the polynomials
+ */
+static LAC_ALWAYS_INLINE void _lac_convert_soa(
+    float *const out[3],
+    const float *const in[3],
+    const size_t n,
+    const size_t count,
+    const LacConversion_t conversion,
+    const LacCoordAccuracy_t accuracy
+) {
+    float tail_in[3][LAC_BATCH_BLOCK] = { { 0 } }, tail_out[3][LAC_BATCH_BLOCK];
+    float *out_rows[3] = { NULL, NULL, NULL };
+    const float *in_rows[3] = { NULL, NULL, NULL };
+    size_t i, c, remaining;
+
+    for (i = 0; i + LAC_BATCH_BLOCK <= count; i += LAC_BATCH_BLOCK) {
+        for (c = 0; c < n; ++c) {
+            out_rows[c] = &out[c][i];
+            in_rows[c] = &in[c][i];
+        }
+        _lac_convert_block(out_rows, in_rows, conversion, accuracy);
+    }
+
+    /* Pad the final partial block so that it can share the same code path */
+    remaining = count - i;
+    if (remaining > 0) {
+        for (c = 0; c < n; ++c) {
+            memcpy(tail_in[c], &in[c][i], remaining * sizeof(float));
+            out_rows[c] = tail_out[c];
+            in_rows[c] = tail_in[c];
+        }
+        _lac_convert_block(out_rows, in_rows, conversion, accuracy);
+        for (c = 0; c < n; ++c) {
+            memcpy(&out[c][i], tail_out[c], remaining * sizeof(float));
+        }
+    }
+}
+
+/**
+ * @brief Body of lac_polar_to_cartesian_array(), instantiated for each ISA level by LAC_MULTIVERSION().
+ * @since 19-10-2026
+ */
+static LAC_ALWAYS_INLINE void _lac_polar_to_cartesian_array(
+    vec2 *v_out,
+    const vec2 *v_in,
+    const size_t count,
+    const LacCoordAccuracy_t accuracy
+) {
+    _lac_convert_aos((float *)v_out, (const float *)v_in, 2, count, LAC_CONVERT_POLAR_TO_CARTESIAN, accuracy);
+}
+
+/**
+ * @brief Converts an array of points from polar to cartesian coordinates.
+ * @anchor lac_polar_to_cartesian_array_anchor
+ * @since 19-10-2026
+ * @param[out] v_out The cartesian coordinates (x, y) of each point (may be the same array as __v_in__)
+ * @param[in] v_in The polar coordinates (length, angle) of each point, with the angles in radians
+ * @param[in] count The number of points in __v_in__ and __v_out__
+ * @param[in] accuracy The accuracy of the sine and cosine approximations
+ */
+LAC_MULTIVERSION(lac_polar_to_cartesian_array, (
+    vec2 *v_out,
+    const vec2 *v_in,
+    const size_t count,
+    const LacCoordAccuracy_t accuracy
+), (v_out, v_in, count, accuracy))
+
+/**
+ * @brief Body of lac_cartesian_to_polar_array(), instantiated for each ISA level by LAC_MULTIVERSION().
+ * @since 19-10-2026
+ */
+static LAC_ALWAYS_INLINE void _lac_cartesian_to_polar_array(
+    vec2 *v_out,
+    const vec2 *v_in,
+    const size_t count,
+    const LacCoordAccuracy_t accuracy
+) {
+    _lac_convert_aos((float *)v_out, (const float *)v_in, 2, count, LAC_CONVERT_CARTESIAN_TO_POLAR, accuracy);
+}
+
+/**
+ * @brief Converts an array of points from cartesian to polar coordinates.
+ * @anchor lac_cartesian_to_polar_array_anchor
+ * @since 19-10-2026
+ * @param[out] v_out The polar coordinates (length, angle) of each point, with the angles in radians within [-pi, pi] (may be the same array as __v_in__)
+ * @param[in] v_in The cartesian coordinates (x, y) of each point
+ * @param[in] count The number of points in __v_in__ and __v_out__
+ * @param[in] accuracy The accuracy of the arctangent approximation
+ */
+LAC_MULTIVERSION(lac_cartesian_to_polar_array, (
+    vec2 *v_out,
+    const vec2 *v_in,
+    const size_t count,
+    const LacCoordAccuracy_t accuracy
+), (v_out, v_in, count, accuracy))
+
+/**
+ * @brief Body of lac_polar_to_cartesian_soa(), instantiated for each ISA level by LAC_MULTIVERSION().
+ * @since 19-10-2026
+ */
+static LAC_ALWAYS_INLINE void _lac_polar_to_cartesian_soa(
+    LacSoaVec2_t *out,
+    const float *len,
+    const float *angle,
+    const size_t count,
+    const LacCoordAccuracy_t accuracy
+) {
+    float *const out_rows[3] = { out->x, out->y, NULL };
+    const float *const in_rows[3] = { len, angle, NULL };
+
+    _lac_convert_soa(out_rows, in_rows, 2, count, LAC_CONVERT_POLAR_TO_CARTESIAN, accuracy);
+}
+
+/**
+ * @brief Converts points in SoA layout from polar to cartesian coordinates.
+ * @anchor lac_polar_to_cartesian_soa_anchor
+ * @since 19-10-2026
+ * @param[out] out The cartesian coordinates of the points (may share arrays with __len__ and __angle__)
+ * @param[in] len The radial coordinate of each point
+ * @param[in] angle The angular coordinate of each point in radians
+ * @param[in] count The number of points
+ * @param[in] accuracy The accuracy of the sine and cosine approximations
+ */
+LAC_MULTIVERSION(lac_polar_to_cartesian_soa, (
+    LacSoaVec2_t *out,
+    const float *len,
+    const float *angle,
+    const size_t count,
+    const LacCoordAccuracy_t accuracy
+), (out, len, angle, count, accuracy))
+
+/**
+ * @brief Body of lac_cartesian_to_polar_soa(), instantiated for each ISA level by LAC_MULTIVERSION().
+ * @since 19-10-2026
+ */
+static LAC_ALWAYS_INLINE void _lac_cartesian_to_polar_soa(
+    float *len,
+    float *angle,
+    const LacSoaVec2_t *points,
+    const size_t count,
+    const LacCoordAccuracy_t accuracy
+) {
+    float *const out_rows[3] = { len, angle, NULL };
+    const float *const in_rows[3] = { points->x, points->y, NULL };
+
+    _lac_convert_soa(out_rows, in_rows, 2, count, LAC_CONVERT_CARTESIAN_TO_POLAR, accuracy);
+}
+
+/**
+ * @brief Converts points in SoA layout from cartesian to polar coordinates.
+ * @anchor lac_cartesian_to_polar_soa_anchor
+ * @since 19-10-2026
+ * @param[out] len The radial coordinate of each point (may be the same array as __points__->x or __points__->y)
+ * @param[out] angle The angular coordinate of each point in radians, within [-pi, pi] (may be the same array as __points__->x or __points__->y)
+ * @param[in] points The cartesian coordinates of the points
+ * @param[in] count The number of points
+ * @param[in] accuracy The accuracy of the arctangent approximation
+ */
+LAC_MULTIVERSION(lac_cartesian_to_polar_soa, (
+    float *len,
+    float *angle,
+    const LacSoaVec2_t *points,
+    const size_t count,
+    const LacCoordAccuracy_t accuracy
+), (len, angle, points, count, accuracy))
+
+/**
+ * @brief Body of lac_spherical_to_cartesian_array(), instantiated for each ISA level by LAC_MULTIVERSION().
+ * @since 19-10-2026
+ */
+static LAC_ALWAYS_INLINE void _lac_spherical_to_cartesian_array(
+    vec3 *v_out,
+    const vec3 *v_in,
+    const size_t count,
+    const LacCoordAccuracy_t accuracy
+) {
+    _lac_convert_aos((float *)v_out, (const float *)v_in, 3, count, LAC_CONVERT_SPHERICAL_TO_CARTESIAN, accuracy);
+}
+
+/**
+ * @brief Converts an array of points from spherical to cartesian coordinates.
+ * @anchor lac_spherical_to_cartesian_array_anchor
+ * @since 19-10-2026
+ * @param[out] v_out The cartesian coordinates (x, y, z) of each point (may be the same array as __v_in__)
+ * @param[in] v_in The spherical coordinates (radius, azimuth, inclination) of each point, with the angles in radians
+ * @param[in] count The number of points in __v_in__ and __v_out__
+ * @param[in] accuracy The accuracy of the sine and cosine approximations
+ */
+LAC_MULTIVERSION(lac_spherical_to_cartesian_array, (
+    vec3 *v_out,
+    const vec3 *v_in,
+    const size_t count,
+    const LacCoordAccuracy_t accuracy
+), (v_out, v_in, count, accuracy))
+
+/**
+ * @brief Body of lac_cartesian_to_spherical_array(), instantiated for each ISA level by LAC_MULTIVERSION().
+ * @since 19-10-2026
+ */
+static LAC_ALWAYS_INLINE void _lac_cartesian_to_spherical_array(
+    vec3 *v_out,
+    const vec3 *v_in,
+    const size_t count,
+    const LacCoordAccuracy_t accuracy
+) {
+    _lac_convert_aos((float *)v_out, (const float *)v_in, 3, count, LAC_CONVERT_CARTESIAN_TO_SPHERICAL, accuracy);
+}
+
+/**
+ * @brief Converts an array of points from cartesian to spherical coordinates.
+ * @anchor lac_cartesian_to_spherical_array_anchor
+ * @since 19-10-2026
+ * @param[out] v_out The spherical coordinates (radius, azimuth, inclination) of each point, with the azimuth within [-pi, pi] and the inclination within [0, pi] (may be the same array as __v_in__)
+ * @param[in] v_in The cartesian coordinates (x, y, z) of each point
+ * @param[in] count The number of points in __v_in__ and __v_out__
+ * @param[in] accuracy The accuracy of the arctangent approximation
+ */
+LAC_MULTIVERSION(lac_cartesian_to_spherical_array, (
+    vec3 *v_out,
+    const vec3 *v_in,
+    const size_t count,
+    const LacCoordAccuracy_t accuracy
+), (v_out, v_in, count, accuracy))
+
+/**
+ * @brief Body of lac_spherical_to_cartesian_soa(), instantiated for each ISA level by LAC_MULTIVERSION().
+ * @since 19-10-2026
+ */
+static LAC_ALWAYS_INLINE void _lac_spherical_to_cartesian_soa(
+    LacSoaVec3_t *out,
+    const float *radius,
+    const float *azimuth,
+    const float *inclination,
+    const size_t count,
+    const LacCoordAccuracy_t accuracy
+) {
+    float *const out_rows[3] = { out->x, out->y, out->z };
+    const float *const in_rows[3] = { radius, azimuth, inclination };
+
+    _lac_convert_soa(out_rows, in_rows, 3, count, LAC_CONVERT_SPHERICAL_TO_CARTESIAN, accuracy);
+}
+
+/**
+ * @brief Converts points in SoA layout from spherical to cartesian coordinates.
+ * @since 19-10-2026
+ * @param[out] out The cartesian coordinates of the points (may share arrays with the spherical coordinates)
+ * @param[in] radius The distance of each point from the origin
+ * @param[in] azimuth The angle of each point around the z axis in radians
+ * @param[in] inclination The angle of each point from the z axis in radians
+ * @param[in] count The number of points
+ * @param[in] accuracy The accuracy of the sine and cosine approximations
+ */
+LAC_MULTIVERSION(lac_spherical_to_cartesian_soa, (
+    LacSoaVec3_t *out,
+    const float *radius,
+    const float *azimuth,
+    const float *inclination,
+    const size_t count,
+    const LacCoordAccuracy_t accuracy
+), (out, radius, azimuth, inclination, count, accuracy))
+
+/**
+ * @brief Body of lac_cartesian_to_spherical_soa(), instantiated for each ISA level by LAC_MULTIVERSION().
+ * @since 19-10-2026
+ */
+static LAC_ALWAYS_INLINE void _lac_cartesian_to_spherical_soa(
+    float *radius,
+    float *azimuth,
+    float *inclination,
+    const LacSoaVec3_t *points,
+    const size_t count,
+    const LacCoordAccuracy_t accuracy
+) {
+    float *const out_rows[3] = { radius, azimuth, inclination };
+    const float *const in_rows[3] = { points->x, points->y, points->z };
+
+    _lac_convert_soa(out_rows, in_rows, 3, count, LAC_CONVERT_CARTESIAN_TO_SPHERICAL, accuracy);
+}
+
+/**
+ * @brief Converts points in SoA layout from cartesian to spherical coordinates.
+ * @since 19-10-2026
+ * @param[out] radius The distance of each point from the origin
+ * @param[out] azimuth The angle of each point around the z axis in radians, within [-pi, pi]
+ * @param[out] inclination The angle of each point from the z axis in radians, within [0, pi]
+ * @param[in] points The cartesian coordinates of the points (may share arrays with the outputs)
+ * @param[in] count The number of points
+ * @param[in] accuracy The accuracy of the arctangent approximation
+ */
+LAC_MULTIVERSION(lac_cartesian_to_spherical_soa, (
+    float *radius,
+    float *azimuth,
+    float *inclination,
+    const LacSoaVec3_t *points,
+    const size_t count,
+    const LacCoordAccuracy_t accuracy
+), (radius, azimuth, inclination, points, count, accuracy))
+
+/**
+ * @brief Body of lac_cylindrical_to_cartesian_array(), instantiated for each ISA level by LAC_MULTIVERSION().
+ * @since 19-10-2026
+ */
+static LAC_ALWAYS_INLINE void _lac_cylindrical_to_cartesian_array(
+    vec3 *v_out,
+    const vec3 *v_in,
+    const size_t count,
+    const LacCoordAccuracy_t accuracy
+) {
+    _lac_convert_aos((float *)v_out, (const float *)v_in, 3, count, LAC_CONVERT_CYLINDRICAL_TO_CARTESIAN, accuracy);
+}
+
+/**
+ * @brief Converts an array of points from cylindrical to cartesian coordinates.
+ * @anchor lac_cylindrical_to_cartesian_array_anchor
+ * @since 19-10-2026
+ * @param[out] v_out The cartesian coordinates (x, y, z) of each point (may be the same array as __v_in__)
+ * @param[in] v_in The cylindrical coordinates (radius, azimuth, height) of each point, with the azimuth in radians
+ * @param[in] count The number of points in __v_in__ and __v_out__
+ * @param[in] accuracy The accuracy of the sine and cosine approximations
+ */
+LAC_MULTIVERSION(lac_cylindrical_to_cartesian_array, (
+    vec3 *v_out,
+    const vec3 *v_in,
+    const size_t count,
+    const LacCoordAccuracy_t accuracy
+), (v_out, v_in, count, accuracy))
+
+/**
+ * @brief Body of lac_cartesian_to_cylindrical_array(), instantiated for each ISA level by LAC_MULTIVERSION().
+ * @since 19-10-2026
+ */
+static LAC_ALWAYS_INLINE void _lac_cartesian_to_cylindrical_array(
+    vec3 *v_out,
+    const vec3 *v_in,
+    const size_t count,
+    const LacCoordAccuracy_t accuracy
+) {
+    _lac_convert_aos((float *)v_out, (const float *)v_in, 3, count, LAC_CONVERT_CARTESIAN_TO_CYLINDRICAL, accuracy);
+}
+
+/**
+ * @brief Converts an array of points from cartesian to cylindrical coordinates.
+ * @anchor lac_cartesian_to_cylindrical_array_anchor
+ * @since 19-10-2026
+ * @param[out] v_out The cylindrical coordinates (radius, azimuth, height) of each point, with the azimuth in radians within [-pi, pi] (may be the same array as __v_in__)
+ * @param[in] v_in The cartesian coordinates (x, y, z) of each point
+ * @param[in] count The number of points in __v_in__ and __v_out__
+ * @param[in] accuracy The accuracy of the arctangent approximation
+ */
+LAC_MULTIVERSION(lac_cartesian_to_cylindrical_array, (
+    vec3 *v_out,
+    const vec3 *v_in,
+    const size_t count,
+    const LacCoordAccuracy_t accuracy
+), (v_out, v_in, count, accuracy))
+
+/**
+ * @brief Body of lac_cylindrical_to_cartesian_soa(), instantiated for each ISA level by LAC_MULTIVERSION().
+ * @since 19-10-2026
+ */
+static LAC_ALWAYS_INLINE void _lac_cylindrical_to_cartesian_soa(
+    LacSoaVec3_t *out,
+    const float *radius,
+    const float *azimuth,
+    const float *height,
+    const size_t count,
+    const LacCoordAccuracy_t accuracy
+) {
+    float *const out_rows[3] = { out->x, out->y, out->z };
+    const float *const in_rows[3] = { radius, azimuth, height };
+
+    _lac_convert_soa(out_rows, in_rows, 3, count, LAC_CONVERT_CYLINDRICAL_TO_CARTESIAN, accuracy);
+}
+
+/**
+ * @brief Converts points in SoA layout from cylindrical to cartesian coordinates.
+ * @since 19-10-2026
+ * @param[out] out The cartesian coordinates of the points (may share arrays with the cylindrical coordinates)
+ * @param[in] radius The distance of each point from the z axis
+ * @param[in] azimuth The angle of each point around the z axis in radians
+ * @param[in] height The z component of each point
+ * @param[in] count The number of points
+ * @param[in] accuracy The accuracy of the sine and cosine approximations
+ */
+LAC_MULTIVERSION(lac_cylindrical_to_cartesian_soa, (
+    LacSoaVec3_t *out,
+    const float *radius,
+    const float *azimuth,
+    const float *height,
+    const size_t count,
+    const LacCoordAccuracy_t accuracy
+), (out, radius, azimuth, height, count, accuracy))
+
+/**
+ * @brief Body of lac_cartesian_to_cylindrical_soa(), instantiated for each ISA level by LAC_MULTIVERSION().
+ * @since 19-10-2026
+ */
+static LAC_ALWAYS_INLINE void _lac_cartesian_to_cylindrical_soa(
+    float *radius,
+    float *azimuth,
+    float *height,
+    const LacSoaVec3_t *points,
+    const size_t count,
+    const LacCoordAccuracy_t accuracy
+) {
+    float *const out_rows[3] = { radius, azimuth, height };
+    const float *const in_rows[3] = { points->x, points->y, points->z };
+
+    _lac_convert_soa(out_rows, in_rows, 3, count, LAC_CONVERT_CARTESIAN_TO_CYLINDRICAL, accuracy);
+}
+
+/**
+ * @brief Converts points in SoA layout from cartesian to cylindrical coordinates.
+ * @since 19-10-2026
+ * @param[out] radius The distance of each point from the z axis
+ * @param[out] azimuth The angle of each point around the z axis in radians, within [-pi, pi]
+ * @param[out] height The z component of each point
+ * @param[in] points The cartesian coordinates of the points (may share arrays with the outputs)
+ * @param[in] count The number of points
+ * @param[in] accuracy The accuracy of the arctangent approximation
+ */
+LAC_MULTIVERSION(lac_cartesian_to_cylindrical_soa, (
+    float *radius,
+    float *azimuth,
+    float *height,
+    const LacSoaVec3_t *points,
+    const size_t count,
+    const LacCoordAccuracy_t accuracy
+), (radius, azimuth, height, points, count, accuracy))
@@ -0,0 +1,122 @@
+/**
+ * @file dispatch.c
+ * @author Neil Kingdom
+ * @since 19-10-2026
+ * @version 1.0
+ * @brief Reports which instruction set the multi-versioned kernels were bound to.
+ *
+ * @section dispatch Load-Time Dispatch
+ *
+ * A library which is built for the instruction set of the build machine
+ * either leaves performance on the table (when built for a lowest common
+ * denominator such as SSE2) or crashes with an illegal instruction on older
+ * machines (when built for something newer). Instead, the hottest kernels
+ * (matrix products, normalization and the batch kernels) are compiled
+ * several times over within the same library, once for each level listed
+ * in LacIsaLevel_t.
+ *
+ * On x86_64, each of these functions calls through a pointer to one of its
+ * variants. The pointer starts out at a stub which, on the first call,
+ * asks lac_get_isa_level() for the best level the CPU supports, stores the
+ * matching variant in the pointer and calls it, so from then on a call
+ * costs one indirect jump. Setting the LAC_ISA environment variable to
+ * "default", "sse4.2" or "avx2" caps the level, which is useful for
+ * comparing the variants against each other in benchmarks. The level is
+ * worked out once per process and shared by every kernel, so they all bind
+ * the same variant, and the level reported is always the one in use.
+ *
+ * The variants are bound on first use rather than through GNU indirect
+ * functions (ifuncs), since an ifunc resolver runs while the dynamic linker
+ * is still relocating the library. It cannot safely read the environment
+ * there, and any call it makes into libc may not be bound yet. On other
+ * platforms, or when built with `make LAC_DISPATCH=0`, only the default
+ * variant is built.
+ *
+ * @subsection dispatch_related Related Functions
+ *
+ * - @ref lac_get_isa_level_anchor "lac_get_isa_level"
+ */
+
+#include "lac_dispatch.h"
+
+/* The level every kernel is bound to, or -1 until it has been worked out */
+static atomic_int _lac_isa_level = -1;
+
+/**
+ * @brief Chooses the highest level supported by the CPU, capped by the LAC_ISA environment variable.
+ * @since 19-10-2026
+ *
+ * An unrecognised value of LAC_ISA is ignored, and a level above what the CPU supports
+ * is never chosen.
+ *
+ * @returns The level
+ */
+static LacIsaLevel_t _lac_resolve_isa_level(void) {
+    LacIsaLevel_t level = LAC_ISA_DEFAULT;
+#if LAC_HAVE_DISPATCH
+    LacIsaLevel_t requested;
+    const char *forced;
+
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("sse4.2")) {
+        level = LAC_ISA_SSE42;
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        level = LAC_ISA_AVX2;
+    }
+
+    forced = getenv(LAC_ISA_ENV);
+    if (forced == NULL) {
+        return level;
+    } else if (strcmp(forced, "default") == 0) {
+        requested = LAC_ISA_DEFAULT;
+    } else if (strcmp(forced, "sse4.2") == 0) {
+        requested = LAC_ISA_SSE42;
+    } else if (strcmp(forced, "avx2") == 0) {
+        requested = LAC_ISA_AVX2;
+    } else {
+        return level;
+    }
+
+    level = (requested < level) ? requested : level;
+#endif
+    return level;
+}
+
+/**
+ * @brief Gets the instruction set level which the multi-versioned kernels use in this process.
+ * @anchor lac_get_isa_level_anchor
+ * @since 19-10-2026
+ *
+ * The level is worked out on the first call (which may be the first call to a kernel),
+ * from the CPU and the LAC_ISA environment variable at that time, and never changes
+ * afterwards.
+ *
+ * @returns The level
+ */
+LAC_DECL LacIsaLevel_t lac_get_isa_level(void) {
+    int level = atomic_load_explicit(&_lac_isa_level, memory_order_relaxed);
+
+    if (level < 0) {
+        level = (int)_lac_resolve_isa_level();
+        atomic_store_explicit(&_lac_isa_level, level, memory_order_relaxed);
+    }
+    return (LacIsaLevel_t)level;
+}
+
+/**
+ * @brief Gets the name of an instruction set level, as accepted by the LAC_ISA environment variable.
+ * @since 19-10-2026
+ * @param[in] level The level
+ * @returns The name of the level
+ */
+LAC_DECL const char *lac_get_isa_name(const LacIsaLevel_t level) {
+    switch (level) {
+        case LAC_ISA_AVX2:
+            return "avx2";
+        case LAC_ISA_SSE42:
+            return "sse4.2";
+        default:
+            return "default";
+    }
+}
@@ -0,0 +1,1190 @@
+/**
+ * @file grid.c
+ * @author Neil Kingdom
+ * @since 19-10-2026
+ * @version 1.0
+ * @brief Provides a uniform spatial hash grid for finding the points near a point.
+ *
+ * @section grid Spatial Hash Grids
+ *
+ * Particle simulations, flocking and point cloud filters all need, for each
+ * of n points, the other points within some fixed distance of it. Testing
+ * every pair takes n^2 distance tests. A uniform grid instead divides space
+ * into cubic cells, and sorts the points by the cell they fall in. When the
+ * cells are about as wide as the search radius, the neighbors of a point
+ * can only be in its own cell or the 26 around it, so each query tests a
+ * small, roughly constant number of points no matter how many there are.
+ *
+ * Space is unbounded but the points are not, so only the occupied cells are
+ * stored. Each cell is hashed (with the hash of Teschner et al.) into a
+ * table of buckets with at least as many buckets as there are points, and
+ * the occupied cells are laid out bucket by bucket. Finding a cell is then
+ * one hash and a short scan of its bucket. The points of each cell are kept
+ * contiguous, with their positions in SoA layout, so a query tests
+ * LAC_BATCH_BLOCK of them at once with SIMD instructions. Cells which lie
+ * further from the query point than the query radius (like the corners of
+ * the 3x3x3 block around it) are skipped before they are looked up.
+ *
+ * Points may lie anywhere within LAC_GRID_MAX_CELLS cells of the origin
+ * along each axis. A nearest neighbor query searches outwards from the cell
+ * holding the query point, one shell of cells at a time, and stops once the
+ * next shell is further away than the k-th closest point found so far.
+ *
+ * @subsection grid_related Related Functions
+ *
+ * - @ref lac_create_grid_anchor "lac_create_grid"
+ * - @ref lac_query_grid_radius_anchor "lac_query_grid_radius"
+ * - @ref lac_query_grid_nearest_anchor "lac_query_grid_nearest"
+ *
+ * @section gridbuild Parallel Counting Sort
+ *
+ * The points are sorted into their cells with a counting sort. One pass finds
+ * the cell and bucket of every point and counts the points in each bucket,
+ * a prefix sum over the counts gives each bucket its range of the sorted
+ * array, and a second pass scatters the points into those ranges. Given a
+ * scheduler (see scheduler.c), both passes run across threads, with atomic
+ * counters per bucket, and consecutive points in the same bucket are counted
+ * and scattered together so that points given in spatial order rarely touch
+ * the same counter from different threads. Each bucket is then sorted by
+ * cell (and by point index, so that the layout doesn't depend on the order
+ * in which threads scattered the points) to group the cells it holds.
+ *
+ * Points that move between frames usually stay in the same cell. Updating a
+ * grid first rewrites the positions in place and marks the points which
+ * changed cells. If only a few of them did (at most 1 in
+ * LAC_GRID_MERGE_FRACTION), those are sorted on their own and merged back
+ * in among the rest, which are still in order, in one pass over the grid.
+ * Only when many points changed cells is the counting sort repeated. Either
+ * way, the grid's memory is reused.
+ *
+ * @subsection gridbuild_related Related Functions
+ *
+ * - @ref lac_update_grid_anchor "lac_update_grid"
+ * - @ref lac_parallel_for_anchor "lac_parallel_for"
+ */
+
+#include <stdint.h>
+#include <stdatomic.h>
+#include <float.h>
+#include <math.h>
+
+#include "grid.h"
+#include "batch.h"
+#include "lac_simd.h"
+#include "lac_dispatch.h"
+
+/* Number of bits given to each axis of a cell key */
+#define LAC_GRID_KEY_BITS 21
+#define LAC_GRID_KEY_MASK ((1u << LAC_GRID_KEY_BITS) - 1u)
+/* Buckets up to this size are sorted by insertion, and larger ones by merging runs of this size */
+#define LAC_GRID_SORT_RUN 16
+/* Slack added to each cell's bounds, relative to their distance from the origin, to cover rounding */
+#define LAC_GRID_CELL_SLACK 1e-6f
+/* Each 2x2x2 block of cells hashes to this many consecutive buckets */
+#define LAC_GRID_BLOCK_BUCKETS 8
+/* Updates where at most 1 in this many points changed cells merge those points back in, rather than sorting again */
+#define LAC_GRID_MERGE_FRACTION 8
+/* Key of a sorted point which changed cells during an update, which is never the key of a cell */
+#define LAC_GRID_MOVED UINT64_MAX
+/* Returned when a cell holds no points */
+#define LAC_GRID_NO_CELL UINT32_MAX
+
+/*
+ * Sorted points occupy slots, which are grouped by cell, and the cells are grouped by bucket.
+ * The points of cell c are slots [cell_start[c], cell_start[c + 1]), and the cells of
+ * bucket b are [bucket_start[b], bucket_start[b + 1]).
+ */
+struct LacGrid {
+    float *x;
+    float *y;
+    float *z;
+    uint32_t *indices;
+    uint64_t *keys;
+    uint64_t *cell_keys;
+    uint32_t *cell_start;
+    uint32_t *bucket_start;
+    /* Scratch space for the build, indexed by point or by bucket */
+    uint64_t *point_keys;
+    uint32_t *point_buckets;
+    uint32_t *order;
+    uint32_t *bucket_offset;
+    /* The number of points in each bucket, which then become the cursors of the scatter */
+    atomic_uint *bucket_cursors;
+    size_t count;
+    size_t capacity;
+    size_t bucket_count;
+    size_t cell_count;
+    float cell_size;
+    float inv_cell_size;
+    int32_t cell_min[3];
+    int32_t cell_max[3];
+};
+
+typedef struct {
+    LacGrid_t *grid;
+    const vec3 *points;
+    lac_atomic_size_t moved;
+} LacGridBuild_t;
+
+/* The closest points found so far by a nearest neighbor query, sorted by distance */
+typedef struct {
+    uint32_t *indices;
+    float *dist_sq;
+    const float *center;
+    size_t k;
+    size_t found;
+    float bound;
+} LacGridNearest_t;
+
+/**
+ * @brief Calls __func__ over [0, __count__), across threads if there is a scheduler.
+ * @since 19-10-2026
+ * @param[out] scheduler The scheduler, or NULL to run on the calling thread
+ * @param[in] func The function to be called for each piece of the range
+ * @param[in] arg The argument passed to __func__
+ * @param[in] count The number of elements
+ */
+static void _lac_run_grid_range(LacScheduler_t *scheduler, LacRangeFunc_t func, void *arg, const size_t count) {
+    if (scheduler != NULL && count >= LAC_SCHEDULER_BATCH_GRAIN) {
+        lac_parallel_for(scheduler, func, arg, count, LAC_SCHEDULER_BATCH_GRAIN);
+    } else if (count > 0) {
+        func(arg, 0, count);
+    }
+}
+
+/**
+ * @brief Finds the cell coordinate of a position along one axis.
+ * @since 19-10-2026
+ * @param[in] v The position along the axis
+ * @param[in] inv_cell_size The reciprocal of the width of a cell
+ * @returns The cell coordinate, clamped to [-LAC_GRID_MAX_CELLS, LAC_GRID_MAX_CELLS)
+ */
+static inline int32_t _lac_get_grid_coord(const float v, const float inv_cell_size) {
+    const float c = floorf(v * inv_cell_size);
+
+    /* NaN lands in the first cell */
+    if (!(c >= (float)-LAC_GRID_MAX_CELLS)) {
+        return -LAC_GRID_MAX_CELLS;
+    }
+    if (c > (float)(LAC_GRID_MAX_CELLS - 1)) {
+        return LAC_GRID_MAX_CELLS - 1;
+    }
+    return (int32_t)c;
+}
+
+/**
+ * @brief Finds the cell holding a point.
+ * @since 19-10-2026
+ * @param[out] cell The cell coordinates
+ * @param[in] grid The grid
+ * @param[in] p The point
+ */
+static inline void _lac_get_grid_cell(int32_t *cell, const LacGrid_t *grid, const float *p) {
+    cell[0] = _lac_get_grid_coord(p[0], grid->inv_cell_size);
+    cell[1] = _lac_get_grid_coord(p[1], grid->inv_cell_size);
+    cell[2] = _lac_get_grid_coord(p[2], grid->inv_cell_size);
+}
+
+/**
+ * @brief Packs the coordinates of a cell into a key which is unique to it.
+ * @since 19-10-2026
+ * @param[in] cell The cell coordinates
+ * @returns The key
+ */
+static inline uint64_t _lac_get_grid_key(const int32_t *cell) {
+    return ((uint64_t)(uint32_t)(cell[0] + LAC_GRID_MAX_CELLS) << (2 * LAC_GRID_KEY_BITS))
+        | ((uint64_t)(uint32_t)(cell[1] + LAC_GRID_MAX_CELLS) << LAC_GRID_KEY_BITS)
+        | (uint64_t)(uint32_t)(cell[2] + LAC_GRID_MAX_CELLS);
+}
+
+/**
+ * @brief Unpacks the coordinates of a cell from its key.
+ * @since 19-10-2026
+ * @param[out] cell The cell coordinates
+ * @param[in] key The key
+ */
+static inline void _lac_get_grid_key_cell(int32_t *cell, const uint64_t key) {
+    cell[0] = (int32_t)((key >> (2 * LAC_GRID_KEY_BITS)) & LAC_GRID_KEY_MASK) - LAC_GRID_MAX_CELLS;
+    cell[1] = (int32_t)((key >> LAC_GRID_KEY_BITS) & LAC_GRID_KEY_MASK) - LAC_GRID_MAX_CELLS;
+    cell[2] = (int32_t)(key & LAC_GRID_KEY_MASK) - LAC_GRID_MAX_CELLS;
+}
+
+/**
+ * @brief Hashes a cell into one of the grid's buckets.
+ * @since 19-10-2026
+ *
+ * Each 2x2x2 block of cells is hashed as a whole, to a run of LAC_GRID_BLOCK_BUCKETS
+ * consecutive buckets, so that the cells around a point are mostly laid out together.
+ *
+ * @param[in] grid The grid
+ * @param[in] key The key of the cell
+ * @returns The bucket
+ */
+static inline uint32_t _lac_get_grid_bucket(const LacGrid_t *grid, const uint64_t key) {
+    const uint32_t x = (uint32_t)(key >> (2 * LAC_GRID_KEY_BITS)) & LAC_GRID_KEY_MASK;
+    const uint32_t y = (uint32_t)(key >> LAC_GRID_KEY_BITS) & LAC_GRID_KEY_MASK;
+    const uint32_t z = (uint32_t)key & LAC_GRID_KEY_MASK;
+    uint32_t h = ((x >> 1) * 73856093u) ^ ((y >> 1) * 19349663u) ^ ((z >> 1) * 83492791u);
+
+    h ^= h >> 16;
+    h &= (uint32_t)(grid->bucket_count / LAC_GRID_BLOCK_BUCKETS) - 1u;
+    return (h * LAC_GRID_BLOCK_BUCKETS) | (x & 1u) | ((y & 1u) << 1) | ((z & 1u) << 2);
+}
+
+/**
+ * @brief Finds an occupied cell.
+ * @since 19-10-2026
+ * @param[in] grid The grid
+ * @param[in] cell The cell coordinates
+ * @returns The index of the cell, or LAC_GRID_NO_CELL if it holds no points
+ */
+static inline uint32_t _lac_find_grid_cell(const LacGrid_t *grid, const int32_t *cell) {
+    const uint64_t key = _lac_get_grid_key(cell);
+    const uint32_t bucket = _lac_get_grid_bucket(grid, key);
+    uint32_t c;
+
+    for (c = grid->bucket_start[bucket]; c < grid->bucket_start[bucket + 1]; ++c) {
+        if (grid->cell_keys[c] == key) {
+            return c;
+        }
+    }
+    return LAC_GRID_NO_CELL;
+}
+
+/**
+ * @brief Finds the squared distance from a point to the nearest point of a cell.
+ * @since 19-10-2026
+ * @param[in] grid The grid
+ * @param[in] cell The cell coordinates
+ * @param[in] p The point
+ * @returns The squared distance, which is 0 if the point is inside the cell
+ */
+static inline float _lac_get_grid_cell_dist_sq(const LacGrid_t *grid, const int32_t *cell, const float *p) {
+    float lo, hi, slack, d, dist_sq = 0.0f;
+    size_t a;
+
+    for (a = 0; a < 3; ++a) {
+        lo = (float)cell[a] * grid->cell_size;
+        hi = lo + grid->cell_size;
+        slack = (((lo < 0.0f) ? -lo : lo) + grid->cell_size) * LAC_GRID_CELL_SLACK;
+        lo -= slack;
+        hi += slack;
+        d = (p[a] < lo) ? lo - p[a] : ((p[a] > hi) ? p[a] - hi : 0.0f);
+        dist_sq += d * d;
+    }
+    return dist_sq;
+}
+
+/**
+ * @brief Checks whether point __a__ comes before point __b__ once sorted by bucket, then by cell, and then by index.
+ * @since 19-10-2026
+ * @param[in] bucket_a The bucket of the first point
+ * @param[in] key_a The cell key of the first point
+ * @param[in] a The index of the first point
+ * @param[in] bucket_b The bucket of the second point
+ * @param[in] key_b The cell key of the second point
+ * @param[in] b The index of the second point
+ * @returns True if __a__ comes first
+ */
+static inline bool _lac_test_grid_order(
+    const uint32_t bucket_a,
+    const uint64_t key_a,
+    const uint32_t a,
+    const uint32_t bucket_b,
+    const uint64_t key_b,
+    const uint32_t b
+) {
+    if (bucket_a != bucket_b) {
+        return bucket_a < bucket_b;
+    }
+    return (key_a < key_b) || (key_a == key_b && a < b);
+}
+
+/**
+ * @brief Checks whether point __a__ comes before point __b__, going by the bucket and key found for each point.
+ * @since 19-10-2026
+ * @param[in] grid The grid
+ * @param[in] a The index of the first point
+ * @param[in] b The index of the second point
+ * @returns True if __a__ comes first
+ */
+static inline bool _lac_test_grid_point_order(const LacGrid_t *grid, const uint32_t a, const uint32_t b) {
+    return _lac_test_grid_order(grid->point_buckets[a], grid->point_keys[a], a, grid->point_buckets[b], grid->point_keys[b], b);
+}
+
+/**
+ * @brief Sorts points by bucket, then by cell, and then by index.
+ * @since 19-10-2026
+ * @param[in,out] order The points
+ * @param[out] scratch Space for __count__ points
+ * @param[in] grid The grid, holding the bucket and key found for each point
+ * @param[in] count The number of points
+ */
+static void _lac_sort_grid_points(uint32_t *order, uint32_t *scratch, const LacGrid_t *grid, const size_t count) {
+    uint32_t *src = order, *dst = scratch, *tmp, p;
+    size_t begin, mid, end, width, i, j, k;
+
+    for (begin = 0; begin < count; begin += LAC_GRID_SORT_RUN) {
+        end = (begin + LAC_GRID_SORT_RUN < count) ? begin + LAC_GRID_SORT_RUN : count;
+        for (i = begin + 1; i < end; ++i) {
+            p = order[i];
+            for (j = i; j > begin && _lac_test_grid_point_order(grid, p, order[j - 1]); --j) {
+                order[j] = order[j - 1];
+            }
+            order[j] = p;
+        }
+    }
+
+    for (width = LAC_GRID_SORT_RUN; width < count; width *= 2) {
+        for (begin = 0; begin < count; begin += 2 * width) {
+            mid = (begin + width < count) ? begin + width : count;
+            end = (begin + (2 * width) < count) ? begin + (2 * width) : count;
+            i = begin;
+            j = mid;
+            for (k = begin; k < end; ++k) {
+                if (i < mid && (j >= end || !_lac_test_grid_point_order(grid, src[j], src[i]))) {
+                    dst[k] = src[i++];
+                } else {
+                    dst[k] = src[j++];
+                }
+            }
+        }
+        tmp = src;
+        src = dst;
+        dst = tmp;
+    }
+
+    if (src != order) {
+        memcpy(order, src, count * sizeof(uint32_t));
+    }
+}
+
+/**
+ * @brief Range task which finds the cell and bucket of each point, and counts the points in each bucket.
+ * @since 19-10-2026
+ * @param[in] arg The build
+ * @param[in] begin The first point of the piece
+ * @param[in] end One past the last point of the piece
+ */
+static void _lac_key_grid_points(void *arg, size_t begin, size_t end) {
+    LacGridBuild_t *build = arg;
+    LacGrid_t *grid = build->grid;
+    int32_t cell[3];
+    uint32_t bucket;
+    size_t i, j;
+
+    for (i = begin; i < end; ++i) {
+        _lac_get_grid_cell(cell, grid, build->points[i]);
+        grid->point_keys[i] = _lac_get_grid_key(cell);
+        grid->point_buckets[i] = _lac_get_grid_bucket(grid, grid->point_keys[i]);
+    }
+
+    for (i = begin; i < end; i = j) {
+        bucket = grid->point_buckets[i];
+        for (j = i + 1; j < end && grid->point_buckets[j] == bucket; ++j) {}
+        atomic_fetch_add_explicit(&grid->bucket_cursors[bucket], (unsigned)(j - i), memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief Range task which scatters each point into its bucket's range of the sorted points.
+ * @since 19-10-2026
+ * @param[in] arg The build
+ * @param[in] begin The first point of the piece
+ * @param[in] end One past the last point of the piece
+ */
+static void _lac_scatter_grid_points(void *arg, size_t begin, size_t end) {
+    LacGridBuild_t *build = arg;
+    LacGrid_t *grid = build->grid;
+    uint32_t bucket, slot;
+    size_t i, j;
+
+    for (i = begin; i < end; i = j) {
+        bucket = grid->point_buckets[i];
+        for (j = i + 1; j < end && grid->point_buckets[j] == bucket; ++j) {}
+        slot = atomic_fetch_add_explicit(&grid->bucket_cursors[bucket], (unsigned)(j - i), memory_order_relaxed);
+        for (; i < j; ++i) {
+            grid->order[slot++] = (uint32_t)i;
+        }
+    }
+}
+
+/**
+ * @brief Range task which sorts the points of each bucket by cell, and counts the cells in each bucket.
+ * @since 19-10-2026
+ * @param[in] arg The build, whose bucket_start holds the counts afterwards
+ * @param[in] begin The first bucket of the piece
+ * @param[in] end One past the last bucket of the piece
+ */
+static void _lac_sort_grid_buckets(void *arg, size_t begin, size_t end) {
+    LacGridBuild_t *build = arg;
+    LacGrid_t *grid = build->grid;
+    size_t b, s, first, last;
+    uint32_t cells;
+
+    for (b = begin; b < end; ++b) {
+        first = grid->bucket_offset[b];
+        last = grid->bucket_offset[b + 1];
+
+        /* The indices aren't filled in until every bucket is sorted, so they serve as scratch space */
+        if (last - first > 1) {
+            _lac_sort_grid_points(&grid->order[first], &grid->indices[first], grid, last - first);
+        }
+
+        cells = 0;
+        for (s = first; s < last; ++s) {
+            if (s == first || grid->point_keys[grid->order[s]] != grid->point_keys[grid->order[s - 1]]) {
+                ++cells;
+            }
+        }
+        grid->bucket_start[b] = cells;
+    }
+}
+
+/**
+ * @brief Range task which copies the sorted points of each bucket into place, and records where each cell starts.
+ * @since 19-10-2026
+ * @param[in] arg The build
+ * @param[in] begin The first bucket of the piece
+ * @param[in] end One past the last bucket of the piece
+ */
+static void _lac_fill_grid_buckets(void *arg, size_t begin, size_t end) {
+    LacGridBuild_t *build = arg;
+    LacGrid_t *grid = build->grid;
+    size_t b, s, first, last;
+    uint32_t c, i;
+    uint64_t key;
+
+    for (b = begin; b < end; ++b) {
+        first = grid->bucket_offset[b];
+        last = grid->bucket_offset[b + 1];
+        c = grid->bucket_start[b];
+
+        for (s = first; s < last; ++s) {
+            i = grid->order[s];
+            key = grid->point_keys[i];
+            if (s == first || key != grid->keys[s - 1]) {
+                grid->cell_keys[c] = key;
+                grid->cell_start[c] = (uint32_t)s;
+                ++c;
+            }
+
+            grid->x[s] = build->points[i][0];
+            grid->y[s] = build->points[i][1];
+            grid->z[s] = build->points[i][2];
+            grid->indices[s] = i;
+            grid->keys[s] = key;
+        }
+    }
+}
+
+/**
+ * @brief Range task which copies the new position of each sorted point into place, and marks those that changed cells.
+ * @since 19-10-2026
+ * @param[in] arg The build, whose moved count is added to
+ * @param[in] begin The first slot of the piece
+ * @param[in] end One past the last slot of the piece
+ */
+static void _lac_move_grid_points(void *arg, size_t begin, size_t end) {
+    LacGridBuild_t *build = arg;
+    LacGrid_t *grid = build->grid;
+    const float *p;
+    int32_t cell[3];
+    uint64_t key;
+    uint32_t i;
+    size_t s, moved = 0;
+
+    for (s = begin; s < end; ++s) {
+        i = grid->indices[s];
+        p = build->points[i];
+        _lac_get_grid_cell(cell, grid, p);
+        key = _lac_get_grid_key(cell);
+        if (key != grid->keys[s]) {
+            grid->point_keys[i] = key;
+            grid->point_buckets[i] = _lac_get_grid_bucket(grid, key);
+            grid->keys[s] = LAC_GRID_MOVED;
+            ++moved;
+        }
+
+        grid->x[s] = p[0];
+        grid->y[s] = p[1];
+        grid->z[s] = p[2];
+    }
+
+    if (moved > 0) {
+        atomic_fetch_add_explicit(&build->moved, moved, memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief Finds the range of cell coordinates that the occupied cells of a grid lie within.
+ * @since 19-10-2026
+ * @param[in,out] grid The grid, whose cell_min and cell_max are written to
+ */
+static void _lac_bound_grid_cells(LacGrid_t *grid) {
+    int32_t cell[3];
+    size_t a, c;
+
+    for (a = 0; a < 3; ++a) {
+        grid->cell_min[a] = LAC_GRID_MAX_CELLS;
+        grid->cell_max[a] = -LAC_GRID_MAX_CELLS;
+    }
+    for (c = 0; c < grid->cell_count; ++c) {
+        _lac_get_grid_key_cell(cell, grid->cell_keys[c]);
+        for (a = 0; a < 3; ++a) {
+            grid->cell_min[a] = (cell[a] < grid->cell_min[a]) ? cell[a] : grid->cell_min[a];
+            grid->cell_max[a] = (cell[a] > grid->cell_max[a]) ? cell[a] : grid->cell_max[a];
+        }
+    }
+}
+
+/**
+ * @brief Copies a sorted point from one slot to another.
+ * @since 19-10-2026
+ * @param[in,out] grid The grid
+ * @param[in] dst The slot to copy to
+ * @param[in] src The slot to copy from
+ */
+static inline void _lac_copy_grid_slot(LacGrid_t *grid, const size_t dst, const size_t src) {
+    grid->x[dst] = grid->x[src];
+    grid->y[dst] = grid->y[src];
+    grid->z[dst] = grid->z[src];
+    grid->indices[dst] = grid->indices[src];
+    grid->keys[dst] = grid->keys[src];
+}
+
+/**
+ * @brief Moves the points which changed cells during an update to where they now belong.
+ * @since 19-10-2026
+ *
+ * The points that stayed put are still in order, so sorting just the points that moved
+ * and merging the two sequences gives the same layout as sorting every point again.
+ *
+ * @param[in,out] grid The grid, whose moved points are marked with LAC_GRID_MOVED
+ * @param[in] points The points
+ * @param[in] moved The number of points which changed cells, which is at most half of them
+ */
+static void _lac_merge_grid_points(LacGrid_t *grid, const vec3 *points, const size_t moved) {
+    const size_t count = grid->count;
+    size_t s, r, j, c, b;
+    uint32_t i, bucket;
+    uint64_t key;
+
+    /* Gather the points that moved, and pack the rest against the end in the same order */
+    r = count;
+    j = 0;
+    for (s = count; s-- > 0;) {
+        if (grid->keys[s] == LAC_GRID_MOVED) {
+            grid->order[j++] = grid->indices[s];
+        } else {
+            _lac_copy_grid_slot(grid, --r, s);
+        }
+    }
+    _lac_sort_grid_points(grid->order, &grid->order[moved], grid, moved);
+
+    /* Slots are only ever written behind the next packed point to be read */
+    j = 0;
+    for (s = 0; j < moved; ++s) {
+        i = grid->order[j];
+        if (r < count && _lac_test_grid_order(
+            _lac_get_grid_bucket(grid, grid->keys[r]), grid->keys[r], grid->indices[r],
+            grid->point_buckets[i], grid->point_keys[i], i
+        )) {
+            _lac_copy_grid_slot(grid, s, r++);
+        } else {
+            grid->x[s] = points[i][0];
+            grid->y[s] = points[i][1];
+            grid->z[s] = points[i][2];
+            grid->indices[s] = i;
+            grid->keys[s] = grid->point_keys[i];
+            ++j;
+        }
+    }
+
+    c = 0;
+    b = 0;
+    for (s = 0; s < count; ++s) {
+        key = grid->keys[s];
+        if (s > 0 && key == grid->keys[s - 1]) {
+            continue;
+        }
+        for (bucket = _lac_get_grid_bucket(grid, key); b <= bucket; ++b) {
+            grid->bucket_start[b] = (uint32_t)c;
+        }
+        grid->cell_keys[c] = key;
+        grid->cell_start[c] = (uint32_t)s;
+        ++c;
+    }
+    for (; b <= grid->bucket_count; ++b) {
+        grid->bucket_start[b] = (uint32_t)c;
+    }
+    grid->cell_count = c;
+    grid->cell_start[c] = (uint32_t)count;
+    _lac_bound_grid_cells(grid);
+}
+
+/**
+ * @brief Frees the arrays of a grid, leaving it without points.
+ * @since 19-10-2026
+ * @param[in,out] grid The grid
+ */
+static void _lac_free_grid_arrays(LacGrid_t *grid) {
+    free(grid->x);
+    free(grid->y);
+    free(grid->z);
+    free(grid->indices);
+    free(grid->keys);
+    free(grid->cell_keys);
+    free(grid->cell_start);
+    free(grid->bucket_start);
+    free(grid->point_keys);
+    free(grid->point_buckets);
+    free(grid->order);
+    free(grid->bucket_offset);
+    free(grid->bucket_cursors);
+
+    grid->x = grid->y = grid->z = NULL;
+    grid->indices = grid->cell_start = grid->bucket_start = NULL;
+    grid->point_buckets = grid->order = grid->bucket_offset = NULL;
+    grid->keys = grid->cell_keys = grid->point_keys = NULL;
+    grid->bucket_cursors = NULL;
+    grid->count = 0;
+    grid->capacity = 0;
+    grid->bucket_count = 0;
+    grid->cell_count = 0;
+}
+
+/**
+ * @brief Makes sure that a grid has room for a number of points.
+ * @since 19-10-2026
+ * @param[in,out] grid The grid, whose contents are lost if it has to grow
+ * @param[in] count The number of points
+ * @returns True if there is room, or false if the grid could not be allocated (leaving it without points)
+ */
+static bool _lac_reserve_grid(LacGrid_t *grid, const size_t count) {
+    const size_t capacity = (count > 0) ? count : 1;
+    size_t buckets = LAC_GRID_BLOCK_BUCKETS;
+
+    if (grid->x != NULL && capacity <= grid->capacity) {
+        return true;
+    }
+
+    /* At least one bucket per point keeps the expected number of cells per bucket below one */
+    while (buckets < capacity) {
+        buckets <<= 1;
+    }
+
+    _lac_free_grid_arrays(grid);
+    grid->x = malloc((capacity + LAC_BATCH_BLOCK) * sizeof(float));
+    grid->y = malloc((capacity + LAC_BATCH_BLOCK) * sizeof(float));
+    grid->z = malloc((capacity + LAC_BATCH_BLOCK) * sizeof(float));
+    grid->indices = malloc(capacity * sizeof(uint32_t));
+    grid->keys = malloc(capacity * sizeof(uint64_t));
+    grid->cell_keys = malloc(capacity * sizeof(uint64_t));
+    grid->cell_start = malloc((capacity + 1) * sizeof(uint32_t));
+    grid->bucket_start = malloc((buckets + 1) * sizeof(uint32_t));
+    grid->point_keys = malloc(capacity * sizeof(uint64_t));
+    grid->point_buckets = malloc(capacity * sizeof(uint32_t));
+    grid->order = malloc(capacity * sizeof(uint32_t));
+    grid->bucket_offset = malloc((buckets + 1) * sizeof(uint32_t));
+    grid->bucket_cursors = malloc(buckets * sizeof(atomic_uint));
+    if (
+        grid->x == NULL || grid->y == NULL || grid->z == NULL || grid->indices == NULL || grid->keys == NULL ||
+        grid->cell_keys == NULL || grid->cell_start == NULL || grid->bucket_start == NULL ||
+        grid->point_keys == NULL || grid->point_buckets == NULL || grid->order == NULL ||
+        grid->bucket_offset == NULL || grid->bucket_cursors == NULL
+    ) {
+        LAC_LOG("Failed to allocate grid", LAC_ERROR);
+        _lac_free_grid_arrays(grid);
+        return false;
+    }
+
+    grid->capacity = capacity;
+    grid->bucket_count = buckets;
+    return true;
+}
+
+/**
+ * @brief Sorts points into the cells of a grid.
+ * @since 19-10-2026
+ * @param[in,out] grid The grid, whose previous points are replaced
+ * @param[out] scheduler The scheduler to build with, or NULL to build on the calling thread
+ * @param[in] points The points
+ * @param[in] count The number of points
+ * @returns True if the grid was built, or false if it could not be allocated (leaving it without points)
+ */
+static bool _lac_build_grid(LacGrid_t *grid, LacScheduler_t *scheduler, const vec3 *points, const size_t count) {
+    LacGridBuild_t build;
+    uint32_t offset, n;
+    size_t b, c;
+
+    if (count >= UINT32_MAX) {
+        LAC_LOG("Too many points for a grid", LAC_ERROR);
+        _lac_free_grid_arrays(grid);
+        return false;
+    }
+    if (!_lac_reserve_grid(grid, count)) {
+        return false;
+    }
+
+    grid->count = count;
+    grid->cell_count = 0;
+    if (count == 0) {
+        return true;
+    }
+
+    build.grid = grid;
+    build.points = points;
+
+    for (b = 0; b < grid->bucket_count; ++b) {
+        atomic_init(&grid->bucket_cursors[b], 0);
+    }
+    _lac_run_grid_range(scheduler, _lac_key_grid_points, &build, count);
+
+    /* The counts become the cursors of the scatter */
+    offset = 0;
+    for (b = 0; b < grid->bucket_count; ++b) {
+        n = atomic_load_explicit(&grid->bucket_cursors[b], memory_order_relaxed);
+        grid->bucket_offset[b] = offset;
+        atomic_store_explicit(&grid->bucket_cursors[b], offset, memory_order_relaxed);
+        offset += n;
+    }
+    grid->bucket_offset[grid->bucket_count] = offset;
+    _lac_run_grid_range(scheduler, _lac_scatter_grid_points, &build, count);
+    _lac_run_grid_range(scheduler, _lac_sort_grid_buckets, &build, grid->bucket_count);
+
+    offset = 0;
+    for (b = 0; b < grid->bucket_count; ++b) {
+        n = grid->bucket_start[b];
+        grid->bucket_start[b] = offset;
+        offset += n;
+    }
+    grid->bucket_start[grid->bucket_count] = offset;
+    grid->cell_count = offset;
+    _lac_run_grid_range(scheduler, _lac_fill_grid_buckets, &build, grid->bucket_count);
+    grid->cell_start[grid->cell_count] = (uint32_t)count;
+
+    /* Pad the final partial block so that queries never read uninitialised positions */
+    for (c = count; c < count + LAC_BATCH_BLOCK; ++c) {
+        grid->x[c] = grid->y[c] = grid->z[c] = 0.0f;
+    }
+
+    _lac_bound_grid_cells(grid);
+
+    return true;
+}
+
+/**
+ * @brief Builds a uniform grid over a set of points.
+ * @anchor lac_create_grid_anchor
+ * @since 19-10-2026
+ *
+ * Queries report points by their index in __points__. The grid keeps its own copy of
+ * the points, so they may be freed or modified afterwards (although the grid then
+ * needs updating to reflect the changes).
+ *
+ * @param[out] scheduler The scheduler to build with, or NULL to build on the calling thread
+ * @param[in] points The points
+ * @param[in] count The number of points
+ * @param[in] cell_size The width of each cell, which is best set to about the radius of the queries
+ * @returns The grid, or NULL if the cell size is not positive and finite, or the grid could not be allocated
+ */
+LAC_DECL LacGrid_t *lac_create_grid(LacScheduler_t *scheduler, const vec3 *points, const size_t count, const float cell_size) {
+    LacGrid_t *grid;
+
+    if (!(cell_size > 0.0f && cell_size <= FLT_MAX)) {
+        LAC_LOG("Invalid grid cell size", LAC_ERROR);
+        return NULL;
+    }
+
+    grid = calloc(1, sizeof(LacGrid_t));
+    if (grid == NULL) {
+        LAC_LOG("Failed to allocate grid", LAC_ERROR);
+        return NULL;
+    }
+
+    grid->cell_size = cell_size;
+    grid->inv_cell_size = 1.0f / cell_size;
+    if (!_lac_build_grid(grid, scheduler, points, count)) {
+        lac_destroy_grid(grid);
+        return NULL;
+    }
+
+    return grid;
+}
+
+/**
+ * @brief Updates a grid after its points have moved, or been added or removed.
+ * @anchor lac_update_grid_anchor
+ * @since 19-10-2026
+ *
+ * When the number of points is unchanged, point i is taken to be the same point as
+ * before. The grid is then left in order if no point changed cells, and only the points
+ * which did are moved if there are few of them.
+ *
+ * @param[in,out] grid The grid
+ * @param[out] scheduler The scheduler to build with, or NULL to build on the calling thread
+ * @param[in] points The points
+ * @param[in] count The number of points
+ * @returns True if the grid was updated, or false if it could not be allocated (leaving it without points)
+ */
+LAC_DECL bool lac_update_grid(LacGrid_t *grid, LacScheduler_t *scheduler, const vec3 *points, const size_t count) {
+    LacGridBuild_t build;
+    size_t moved;
+
+    if (count == grid->count && count > 0) {
+        build.grid = grid;
+        build.points = points;
+        atomic_init(&build.moved, 0);
+        _lac_run_grid_range(scheduler, _lac_move_grid_points, &build, count);
+
+        moved = atomic_load(&build.moved);
+        if (moved <= count / LAC_GRID_MERGE_FRACTION) {
+            if (moved > 0) {
+                _lac_merge_grid_points(grid, points, moved);
+            }
+            return true;
+        }
+    }
+
+    return _lac_build_grid(grid, scheduler, points, count);
+}
+
+/**
+ * @brief Destroys a grid.
+ * @since 19-10-2026
+ * @param[in] grid The grid to be destroyed
+ */
+LAC_DECL void lac_destroy_grid(LacGrid_t *grid) {
+    if (grid == NULL) {
+        return;
+    }
+
+    _lac_free_grid_arrays(grid);
+    free(grid);
+}
+
+/**
+ * @brief Gets the number of points in a grid.
+ * @since 19-10-2026
+ * @param[in] grid The grid
+ * @returns The number of points
+ */
+LAC_DECL size_t lac_get_grid_point_count(const LacGrid_t *grid) {
+    return grid->count;
+}
+
+/**
+ * @brief Gets the number of occupied cells in a grid.
+ * @since 19-10-2026
+ * @param[in] grid The grid
+ * @returns The number of cells holding at least one point
+ */
+LAC_DECL size_t lac_get_grid_cell_count(const LacGrid_t *grid) {
+    return grid->cell_count;
+}
+
+/**
+ * @brief Finds the squared distances from a point to exactly LAC_BATCH_BLOCK sorted points.
+ * @since 19-10-2026
+ * @param[out] dist_sq The squared distance to each point
+ * @param[in] grid The grid
+ * @param[in] first The slot of the first point
+ * @param[in] center The point to measure from
+ * @param[in] max_dist_sq The largest squared distance to accept
+ * @returns A bit for each point, which is set if it is within the distance
+ */
+static LAC_VARIANT_INLINE unsigned _lac_test_grid_block(
+    float *dist_sq,
+    const LacGrid_t *grid,
+    const size_t first,
+    const float *center,
+    const float max_dist_sq
+) {
+    const lac_f32x8 dx = lac_simd_sub_f32x8(lac_simd_load_f32x8(&grid->x[first]), lac_simd_splat_f32x8(center[0]));
+    const lac_f32x8 dy = lac_simd_sub_f32x8(lac_simd_load_f32x8(&grid->y[first]), lac_simd_splat_f32x8(center[1]));
+    const lac_f32x8 dz = lac_simd_sub_f32x8(lac_simd_load_f32x8(&grid->z[first]), lac_simd_splat_f32x8(center[2]));
+    lac_f32x8 d;
+
+    d = lac_simd_mul_f32x8(dx, dx);
+    d = lac_simd_madd_f32x8(dy, dy, d);
+    d = lac_simd_madd_f32x8(dz, dz, d);
+    lac_simd_store_f32x8(dist_sq, d);
+    return lac_simd_bits_i32x8(lac_simd_le_f32x8(d, lac_simd_splat_f32x8(max_dist_sq)));
+}
+
+/**
+ * @brief Adds the points of a cell which are within a radius to the results of a radius query.
+ * @since 19-10-2026
+ * @param[out] indices The points found so far
+ * @param[in] max_indices The number of points which __indices__ can hold
+ * @param[in] found The number of points found so far
+ * @param[in] grid The grid
+ * @param[in] c The index of the cell
+ * @param[in] center The center of the query
+ * @param[in] radius_sq The squared radius of the query
+ * @returns The number of points found, including those in this cell
+ */
+static LAC_VARIANT_INLINE size_t _lac_gather_grid_radius(
+    uint32_t *indices,
+    const size_t max_indices,
+    size_t found,
+    const LacGrid_t *grid,
+    const uint32_t c,
+    const float *center,
+    const float radius_sq
+) {
+    const size_t end = grid->cell_start[c + 1];
+    float dist_sq[LAC_BATCH_BLOCK];
+    unsigned bits;
+    size_t s;
+
+    for (s = grid->cell_start[c]; s < end; s += LAC_BATCH_BLOCK) {
+        bits = _lac_test_grid_block(dist_sq, grid, s, center, radius_sq);
+        if (end - s < LAC_BATCH_BLOCK) {
+            bits &= (1u << (end - s)) - 1u;
+        }
+        for (; bits != 0; bits &= bits - 1u) {
+            if (found < max_indices) {
+                indices[found] = grid->indices[s + (size_t)__builtin_ctz(bits)];
+            }
+            ++found;
+        }
+    }
+    return found;
+}
+
+/**
+ * @brief Body of lac_query_grid_radius(), instantiated for each ISA level by LAC_MULTIVERSION_RETURN().
+ * @since 19-10-2026
+ */
+static LAC_ALWAYS_INLINE size_t _lac_query_grid_radius(
+    const LacGrid_t *grid,
+    uint32_t *indices,
+    const size_t max_indices,
+    const vec3 center,
+    const float radius
+) {
+    const float radius_sq = (float)fmin((double)radius * radius, FLT_MAX);
+    int32_t lo[3], hi[3], cell[3];
+    uint64_t volume = 1;
+    size_t found = 0, a, c;
+    uint32_t match;
+
+    if (grid->cell_count == 0 || !(radius >= 0.0f)) {
+        return 0;
+    }
+
+    for (a = 0; a < 3; ++a) {
+        lo[a] = _lac_get_grid_coord(center[a] - radius, grid->inv_cell_size);
+        hi[a] = _lac_get_grid_coord(center[a] + radius, grid->inv_cell_size);
+        lo[a] = (lo[a] > grid->cell_min[a]) ? lo[a] : grid->cell_min[a];
+        hi[a] = (hi[a] < grid->cell_max[a]) ? hi[a] : grid->cell_max[a];
+        if (lo[a] > hi[a]) {
+            return 0;
+        }
+        volume *= (uint64_t)(hi[a] - lo[a] + 1);
+    }
+
+    /* A radius much larger than the cells covers more cells than are occupied, so visit those instead */
+    if (volume > grid->cell_count) {
+        for (c = 0; c < grid->cell_count; ++c) {
+            _lac_get_grid_key_cell(cell, grid->cell_keys[c]);
+            if (_lac_get_grid_cell_dist_sq(grid, cell, center) <= radius_sq) {
+                found = _lac_gather_grid_radius(indices, max_indices, found, grid, (uint32_t)c, center, radius_sq);
+            }
+        }
+        return found;
+    }
+
+    for (cell[2] = lo[2]; cell[2] <= hi[2]; ++cell[2]) {
+        for (cell[1] = lo[1]; cell[1] <= hi[1]; ++cell[1]) {
+            for (cell[0] = lo[0]; cell[0] <= hi[0]; ++cell[0]) {
+                if (_lac_get_grid_cell_dist_sq(grid, cell, center) > radius_sq) {
+                    continue;
+                }
+                match = _lac_find_grid_cell(grid, cell);
+                if (match != LAC_GRID_NO_CELL) {
+                    found = _lac_gather_grid_radius(indices, max_indices, found, grid, match, center, radius_sq);
+                }
+            }
+        }
+    }
+
+    return found;
+}
+
+/**
+ * @brief Finds every point in a grid within a radius of a point.
+ * @anchor lac_query_grid_radius_anchor
+ * @since 19-10-2026
+ * @param[in] grid The grid
+ * @param[out] indices The points within the radius, in no particular order
+ * @param[in] max_indices The number of points which __indices__ can hold
+ * @param[in] center The center of the query
+ * @param[in] radius The radius of the query, where points exactly at the radius are included
+ * @returns The number of points within the radius, which may be more than __max_indices__
+ */
+LAC_MULTIVERSION_RETURN(size_t, lac_query_grid_radius, (
+    const LacGrid_t *grid,
+    uint32_t *indices,
+    const size_t max_indices,
+    const vec3 center,
+    const float radius
+), (grid, indices, max_indices, center, radius))
+
+/**
+ * @brief Adds the points of a cell to the results of a nearest neighbor query, if they are closer than the furthest found so far.
+ * @since 19-10-2026
+ * @param[in,out] nearest The closest points found so far
+ * @param[in] grid The grid
+ * @param[in] c The index of the cell
+ */
+static LAC_VARIANT_INLINE void _lac_gather_grid_nearest(LacGridNearest_t *nearest, const LacGrid_t *grid, const uint32_t c) {
+    const size_t end = grid->cell_start[c + 1];
+    float dist_sq[LAC_BATCH_BLOCK], d;
+    unsigned bits, lane;
+    size_t s, pos;
+
+    for (s = grid->cell_start[c]; s < end; s += LAC_BATCH_BLOCK) {
+        bits = _lac_test_grid_block(dist_sq, grid, s, nearest->center, nearest->bound);
+        if (end - s < LAC_BATCH_BLOCK) {
+            bits &= (1u << (end - s)) - 1u;
+        }
+
+        for (; bits != 0; bits &= bits - 1u) {
+            lane = (unsigned)__builtin_ctz(bits);
+            d = dist_sq[lane];
+            if (nearest->found == nearest->k) {
+                /* The bound may have shrunk since this block was tested */
+                if (!(d < nearest->dist_sq[nearest->k - 1])) {
+                    continue;
+                }
+                pos = nearest->k - 1;
+            } else {
+                pos = nearest->found++;
+            }
+
+            /* Insertion into the sorted results */
+            for (; pos > 0 && nearest->dist_sq[pos - 1] > d; --pos) {
+                nearest->dist_sq[pos] = nearest->dist_sq[pos - 1];
+                nearest->indices[pos] = nearest->indices[pos - 1];
+            }
+            nearest->dist_sq[pos] = d;
+            nearest->indices[pos] = grid->indices[s + lane];
+
+            if (nearest->found == nearest->k) {
+                nearest->bound = nearest->dist_sq[nearest->k - 1];
+            }
+        }
+    }
+}
+
+/**
+ * @brief Body of lac_query_grid_nearest(), instantiated for each ISA level by LAC_MULTIVERSION_RETURN().
+ * @since 19-10-2026
+ */
+static LAC_ALWAYS_INLINE size_t _lac_query_grid_nearest(
+    const LacGrid_t *grid,
+    uint32_t *indices,
+    float *dist_sq,
+    const size_t k,
+    const vec3 center,
+    const float max_radius
+) {
+    LacGridNearest_t nearest;
+    int32_t home[3], lo[3], hi[3], cell[3], ring, max_ring, step, d;
+    uint64_t side;
+    uint32_t match;
+    size_t a, c;
+    float gap;
+    bool shell;
+
+    if (grid->cell_count == 0 || k == 0 || !(max_radius >= 0.0f)) {
+        return 0;
+    }
+
+    nearest.indices = indices;
+    nearest.dist_sq = dist_sq;
+    nearest.center = center;
+    nearest.k = k;
+    nearest.found = 0;
+    nearest.bound = (float)fmin((double)max_radius * max_radius, FLT_MAX);
+
+    _lac_get_grid_cell(home, grid, center);
+    max_ring = 0;
+    for (a = 0; a < 3; ++a) {
+        d = (home[a] - grid->cell_min[a] > grid->cell_max[a] - home[a])
+            ? home[a] - grid->cell_min[a]
+            : grid->cell_max[a] - home[a];
+        max_ring = (d > max_ring) ? d : max_ring;
+    }
+
+    /* Every cell in ring r is at least r - 1 cells from the center, as the center may lie anywhere in its own cell */
+    for (ring = 0; ring <= max_ring; ++ring) {
+        gap = (float)(ring - 1) * grid->cell_size;
+        if (ring > 1 && gap * gap > nearest.bound) {
+            break;
+        }
+
+        /* Once the rings cover more cells than are occupied, visit the occupied cells which they haven't reached */
+        side = (uint64_t)((2 * ring) + 1);
+        if (side * side * side > grid->cell_count) {
+            for (c = 0; c < grid->cell_count; ++c) {
+                _lac_get_grid_key_cell(cell, grid->cell_keys[c]);
+                for (a = 0, shell = false; a < 3; ++a) {
+                    shell = shell || abs(cell[a] - home[a]) >= ring;
+                }
+                if (shell && _lac_get_grid_cell_dist_sq(grid, cell, center) <= nearest.bound) {
+                    _lac_gather_grid_nearest(&nearest, grid, (uint32_t)c);
+                }
+            }
+            break;
+        }
+
+        for (a = 0; a < 3; ++a) {
+            lo[a] = (home[a] - ring > grid->cell_min[a]) ? home[a] - ring : grid->cell_min[a];
+            hi[a] = (home[a] + ring < grid->cell_max[a]) ? home[a] + ring : grid->cell_max[a];
+        }
+
+        for (cell[2] = lo[2]; cell[2] <= hi[2]; ++cell[2]) {
+            for (cell[1] = lo[1]; cell[1] <= hi[1]; ++cell[1]) {
+                /* Inside the shell's faces, only the two cells at either end of the row belong to the ring */
+                shell = abs(cell[2] - home[2]) == ring || abs(cell[1] - home[1]) == ring;
+                step = shell ? 1 : 2 * ring;
+                for (cell[0] = shell ? lo[0] : home[0] - ring; cell[0] <= hi[0]; cell[0] += step) {
+                    if (cell[0] < lo[0] || _lac_get_grid_cell_dist_sq(grid, cell, center) > nearest.bound) {
+                        continue;
+                    }
+                    match = _lac_find_grid_cell(grid, cell);
+                    if (match != LAC_GRID_NO_CELL) {
+                        _lac_gather_grid_nearest(&nearest, grid, match);
+                    }
+                }
+            }
+        }
+    }
+
+    return nearest.found;
+}
+
+/**
+ * @brief Finds the points in a grid which are closest to a point.
+ * @anchor lac_query_grid_nearest_anchor
+ * @since 19-10-2026
+ * @param[in] grid The grid
+ * @param[out] indices The closest points, from closest to furthest
+ * @param[out] dist_sq The squared distance to each of the closest points
+ * @param[in] k The number of points to find, which __indices__ and __dist_sq__ must each hold
+ * @param[in] center The point to measure from
+ * @param[in] max_radius The distance beyond which points are ignored, e.g. FLT_MAX for no limit
+ * @returns The number of points found, which is less than __k__ if fewer are within __max_radius__
+ */
+LAC_MULTIVERSION_RETURN(size_t, lac_query_grid_nearest, (
+    const LacGrid_t *grid,
+    uint32_t *indices,
+    float *dist_sq,
+    const size_t k,
+    const vec3 center,
+    const float max_radius
+), (grid, indices, dist_sq, k, center, max_radius))
@@ -0,0 +1,236 @@
+/**
+ * @file jobqueue.c
+ * @author Neil Kingdom
+ * @since 19-10-2026
+ * @version 1.0
+ * @brief Provides a lock-free queue for handing transform batches from one thread to another.
+ *
+ * @section jobqueue Lock-Free Job Queue
+ *
+ * A common way of passing work between threads is a queue protected by a
+ * mutex. This is simple, but whenever the consumer holds the lock (or is
+ * descheduled by the OS while holding it), every producer that wants to
+ * push a job has to wait. Under load, these waits show up as long and
+ * unpredictable stalls.
+ *
+ * The job queue avoids locks altogether. It is a fixed size ring buffer
+ * in which every slot carries a sequence number. A producer claims a slot
+ * by atomically advancing the enqueue position with compare-and-swap,
+ * copies its job into the slot and then publishes it by updating the slot's
+ * sequence number. The consumer does the reverse at the dequeue position.
+ * Comparing a slot's sequence number against the position tells either
+ * side whether the slot is ready for it, so producers and consumers never
+ * wait on each other: if the ring is full, pushing simply fails and the
+ * producer can decide what to do (e.g. run the job itself). Any number of
+ * producers may push concurrently, and jobs are consumed in the order that
+ * their slots were claimed.
+ *
+ * The acquire and release orderings on each sequence number guarantee that
+ * the consumer sees the entire job (and the input data that it points to)
+ * before it begins transforming it.
+ *
+ * @subsection jobqueue_related Related Functions
+ *
+ * - @ref lac_create_job_queue_anchor "lac_create_job_queue"
+ * - @ref lac_push_job_queue_anchor "lac_push_job_queue"
+ * - @ref lac_pop_job_queue_anchor "lac_pop_job_queue"
+ * - @ref lac_drain_job_queue_anchor "lac_drain_job_queue"
+ */
+
+#include <stdalign.h>
+#include <stdatomic.h>
+
+#include "batch.h"
+#include "jobqueue.h"
+
+/* Keeps the producer and consumer positions on separate cache lines */
+#define LAC_CACHE_LINE 64
+
+typedef struct {
+    atomic_size_t sequence;
+    LacTransformJob_t job;
+} LacJobSlot_t;
+
+struct LacJobQueue {
+    alignas(LAC_CACHE_LINE) atomic_size_t enqueue_pos;
+    alignas(LAC_CACHE_LINE) atomic_size_t dequeue_pos;
+    alignas(LAC_CACHE_LINE) atomic_uint_fast64_t completed;
+    size_t mask;
+    LacJobSlot_t slots[];
+};
+
+/**
+ * @brief Creates a job queue which can hold at least __capacity__ jobs.
+ * @anchor lac_create_job_queue_anchor
+ * @since 19-10-2026
+ * @param[in] capacity The minimum number of jobs; it is rounded up to a power of 2
+ * @returns The queue, or NULL if it could not be allocated
+ */
+LAC_DECL LacJobQueue_t *lac_create_job_queue(const size_t capacity) {
+    LacJobQueue_t *queue;
+    size_t slots = 2, size, i;
+
+    while (slots < capacity) {
+        slots <<= 1;
+    }
+
+    /* aligned_alloc() requires the size to be a multiple of the alignment */
+    size = sizeof(LacJobQueue_t) + (slots * sizeof(LacJobSlot_t));
+    size = (size + (LAC_CACHE_LINE - 1)) & ~((size_t)LAC_CACHE_LINE - 1);
+
+    queue = aligned_alloc(LAC_CACHE_LINE, size);
+    if (queue == NULL) {
+        LAC_LOG("Failed to allocate job queue", LAC_ERROR);
+        return NULL;
+    }
+
+    atomic_init(&queue->enqueue_pos, 0);
+    atomic_init(&queue->dequeue_pos, 0);
+    atomic_init(&queue->completed, 0);
+    queue->mask = slots - 1;
+
+    /* Slot i is ready to accept the job at position i */
+    for (i = 0; i < slots; ++i) {
+        atomic_init(&queue->slots[i].sequence, i);
+    }
+
+    return queue;
+}
+
+/**
+ * @brief Destroys a job queue. Any jobs remaining in the queue are discarded.
+ * @since 19-10-2026
+ * @param[in] queue The queue to be destroyed
+ */
+LAC_DECL void lac_destroy_job_queue(LacJobQueue_t *queue) {
+    free(queue);
+}
+
+/**
+ * @brief Pushes a job onto the queue without blocking. Safe to call from multiple threads at once.
+ * @anchor lac_push_job_queue_anchor
+ * @since 19-10-2026
+ * @param[out] queue The queue
+ * @param[in] job The job to be copied into the queue
+ * @returns true if the job was queued, or false if the queue is full
+ */
+LAC_DECL bool lac_push_job_queue(LacJobQueue_t *queue, const LacTransformJob_t *job) {
+    LacJobSlot_t *slot;
+    size_t pos, seq;
+    intptr_t diff;
+
+    pos = atomic_load_explicit(&queue->enqueue_pos, memory_order_relaxed);
+    for (;;) {
+        slot = &queue->slots[pos & queue->mask];
+        seq = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+        diff = (intptr_t)seq - (intptr_t)pos;
+
+        if (diff == 0) {
+            /* The slot is free; try to claim it (on failure pos is reloaded) */
+            if (atomic_compare_exchange_weak_explicit(
+                    &queue->enqueue_pos, &pos, pos + 1,
+                    memory_order_relaxed, memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            /* The slot still holds the job from one lap ago */
+            return false;
+        } else {
+            /* Another producer claimed the slot first */
+            pos = atomic_load_explicit(&queue->enqueue_pos, memory_order_relaxed);
+        }
+    }
+
+    slot->job = *job;
+    atomic_store_explicit(&slot->sequence, pos + 1, memory_order_release);
+
+    return true;
+}
+
+/**
+ * @brief Pops the oldest job from the queue without blocking.
+ * @anchor lac_pop_job_queue_anchor
+ * @since 19-10-2026
+ * @param[out] job The job which was removed from the queue
+ * @param[out] queue The queue
+ * @returns true if a job was popped, or false if the queue is empty
+ */
+LAC_DECL bool lac_pop_job_queue(LacTransformJob_t *job, LacJobQueue_t *queue) {
+    LacJobSlot_t *slot;
+    size_t pos, seq;
+    intptr_t diff;
+
+    pos = atomic_load_explicit(&queue->dequeue_pos, memory_order_relaxed);
+    for (;;) {
+        slot = &queue->slots[pos & queue->mask];
+        seq = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+        diff = (intptr_t)seq - (intptr_t)(pos + 1);
+
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(
+                    &queue->dequeue_pos, &pos, pos + 1,
+                    memory_order_relaxed, memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            /* Nothing has been published to this slot yet */
+            return false;
+        } else {
+            pos = atomic_load_explicit(&queue->dequeue_pos, memory_order_relaxed);
+        }
+    }
+
+    *job = slot->job;
+
+    /* Hand the slot back to producers for the job one lap from now */
+    atomic_store_explicit(&slot->sequence, pos + queue->mask + 1, memory_order_release);
+
+    return true;
+}
+
+/**
+ * @brief Pops and runs jobs until the queue is empty or __max_jobs__ have been run.
+ * @anchor lac_drain_job_queue_anchor
+ * @since 19-10-2026
+ *
+ * Each job is run with lac_multiply_vec4_mat4_array(). Once a job's output has been
+ * written, the queue's completion counter is incremented with release ordering, so a
+ * producer which observes the new count through lac_get_job_queue_completed() may
+ * safely read the output or reuse the input.
+ *
+ * @param[out] queue The queue
+ * @param[in] max_jobs The maximum number of jobs to run, or 0 for no limit
+ * @returns The number of jobs which were run
+ */
+LAC_DECL size_t lac_drain_job_queue(LacJobQueue_t *queue, const size_t max_jobs) {
+    LacTransformJob_t job;
+    size_t ran = 0;
+
+    while ((max_jobs == 0 || ran < max_jobs) && lac_pop_job_queue(&job, queue)) {
+        lac_multiply_vec4_mat4_array(job.v_out, job.v_in, job.m_in, job.count);
+        atomic_fetch_add_explicit(&queue->completed, 1, memory_order_release);
+        ran++;
+    }
+
+    return ran;
+}
+
+/**
+ * @brief Gets the number of jobs that the queue can hold.
+ * @since 19-10-2026
+ * @param[in] queue The queue
+ * @returns The capacity of the queue
+ */
+LAC_DECL size_t lac_get_job_queue_capacity(const LacJobQueue_t *queue) {
+    return queue->mask + 1;
+}
+
+/**
+ * @brief Gets the number of jobs which have been run by lac_drain_job_queue().
+ * @since 19-10-2026
+ * @param[in] queue The queue
+ * @returns The total number of completed jobs
+ */
+LAC_DECL uint64_t lac_get_job_queue_completed(const LacJobQueue_t *queue) {
+    return atomic_load_explicit(&((LacJobQueue_t*)queue)->completed, memory_order_acquire);
+}
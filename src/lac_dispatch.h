@@ -0,0 +1,100 @@
+#ifndef LAC_DISPATCH_H
+#define LAC_DISPATCH_H
+
+/*
+ * Internal helpers for building the hot kernels in several ISA variants.
+ *
+ * A kernel is written once as a static always-inline function named _<name>, and
+ * LAC_MULTIVERSION(<name>, ...) then defines the public <name>. On x86_64 targets built
+ * with GCC or Clang, this instantiates the body for AVX2+FMA, SSE4.2 and the baseline
+ * ISA. Since the SIMD layer is made of inline functions, each variant is vectorized for
+ * its own target. <name> calls through a function pointer which starts out pointing at a
+ * binding stub; the first call picks the variant for lac_get_isa_level(), stores it in
+ * the pointer and forwards to it, so later calls cost one indirect call. Binding happens
+ * on first use rather than at load time (as an ifunc resolver would), when the
+ * environment can safely be read and every relocation has been applied. Elsewhere, or
+ * when built with LAC_NO_DISPATCH, <name> is simply a regular function.
+ * LAC_MULTIVERSION_RETURN(type, <name>, ...) does the same for a kernel which returns a
+ * value of the given type.
+ */
+
+#include <stdatomic.h>
+
+#include "lac_common.h"
+#include "dispatch.h"
+
+#if defined(__GNUC__) && defined(__x86_64__) && !defined(LAC_NO_DISPATCH)
+#if defined(__has_attribute)
+#if __has_attribute(target)
+#define LAC_HAVE_DISPATCH 1
+#endif
+#endif
+#endif
+
+#ifndef LAC_HAVE_DISPATCH
+#define LAC_HAVE_DISPATCH 0
+#endif
+
+#define LAC_ALWAYS_INLINE inline __attribute__((always_inline))
+
+/*
+ * For helpers which pass 8-wide vectors around, and are too large for the compiler to
+ * inline into every variant by itself. Unoptimized builds leave the SIMD layer out of
+ * line, where the calling convention for 8-wide vectors differs between the baseline and
+ * AVX2 variants, so the helper is then kept out of line too and built only once.
+ */
+#ifdef __OPTIMIZE__
+#define LAC_VARIANT_INLINE LAC_ALWAYS_INLINE
+#else
+#define LAC_VARIANT_INLINE inline
+#endif
+
+#if LAC_HAVE_DISPATCH
+
+/* Picks the variant of a kernel for the level returned by lac_get_isa_level() */
+#define _LAC_SELECT_VARIANT(name) \
+    ((lac_get_isa_level() == LAC_ISA_AVX2) ? name##_avx2 \
+        : (lac_get_isa_level() == LAC_ISA_SSE42) ? name##_sse42 : name##_default)
+
+/*
+ * The pointer may be bound by several threads at once, but they all store the same
+ * variant, so relaxed atomics are enough for the pointer to never be seen half written.
+ */
+#define LAC_MULTIVERSION(name, params, args) \
+    __attribute__((target("avx2,fma"))) static void name##_avx2 params { _##name args; } \
+    __attribute__((target("sse4.2"))) static void name##_sse42 params { _##name args; } \
+    static void name##_default params { _##name args; } \
+    static void name##_bind params; \
+    static void (*_Atomic name##_variant) params = name##_bind; \
+    static void name##_bind params { \
+        void (*variant) params = _LAC_SELECT_VARIANT(name); \
+        atomic_store_explicit(&name##_variant, variant, memory_order_relaxed); \
+        variant args; \
+    } \
+    LAC_DECL void name params { (atomic_load_explicit(&name##_variant, memory_order_relaxed)) args; }
+
+#define LAC_MULTIVERSION_RETURN(type, name, params, args) \
+    __attribute__((target("avx2,fma"))) static type name##_avx2 params { return _##name args; } \
+    __attribute__((target("sse4.2"))) static type name##_sse42 params { return _##name args; } \
+    static type name##_default params { return _##name args; } \
+    static type name##_bind params; \
+    static type (*_Atomic name##_variant) params = name##_bind; \
+    static type name##_bind params { \
+        type (*variant) params = _LAC_SELECT_VARIANT(name); \
+        atomic_store_explicit(&name##_variant, variant, memory_order_relaxed); \
+        return variant args; \
+    } \
+    LAC_DECL type name params { return (atomic_load_explicit(&name##_variant, memory_order_relaxed)) args; }
+
+#else
+
+/* Only the baseline variant is built */
+#define LAC_MULTIVERSION(name, params, args) \
+    LAC_DECL void name params { _##name args; }
+
+#define LAC_MULTIVERSION_RETURN(type, name, params, args) \
+    LAC_DECL type name params { return _##name args; }
+
+#endif /* LAC_HAVE_DISPATCH */
+
+#endif /* LAC_DISPATCH_H */
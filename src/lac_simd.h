@@ -0,0 +1,722 @@
+#ifndef LAC_SIMD_H
+#define LAC_SIMD_H
+
+/*
+ * Internal SIMD layer used by the kernels in vecmath.c, matmath.c, batch.c, ray.c, bvh.c,
+ * grid.c and sparse.c.
+ *
+ * With GCC or Clang, lac_f32x4 and lac_f32x8 are native vector types declared
+ * with __attribute__((vector_size)). The compiler lowers their arithmetic to
+ * whichever instruction set the build targets (SSE, AVX, NEON, ...), splitting or
+ * emulating wider vectors as needed, so the kernels are written once for every ISA.
+ * Other compilers, or builds with LAC_NO_SIMD defined, get plain structs with a
+ * scalar loop behind each operation.
+ *
+ * Every operation works lane by lane, and the reductions add their lanes in order
+ * from 0 upwards, so a kernel produces bit-for-bit the same result as the scalar
+ * expression that it replaces (unless -Ofast allows the compiler to reassociate).
+ */
+
+#include <stdint.h>
+#include <math.h>
+
+#include "lac_common.h"
+
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(LAC_NO_SIMD)
+#define LAC_SIMD_VECTOR_EXT 1
+typedef float lac_f32x4 __attribute__((vector_size(16)));
+typedef float lac_f32x8 __attribute__((vector_size(32)));
+typedef int lac_i32x4 __attribute__((vector_size(16)));
+typedef int lac_i32x8 __attribute__((vector_size(32)));
+#else
+#define LAC_SIMD_VECTOR_EXT 0
+typedef struct { float f[4]; } lac_f32x4;
+typedef struct { float f[8]; } lac_f32x8;
+typedef struct { int f[4]; } lac_i32x4;
+typedef struct { int f[8]; } lac_i32x8;
+#endif
+
+/* Applies OP to every lane of the scalar fallback */
+#define _LAC_SIMD_LANES(r, n, OP) do { \
+    size_t _i; \
+    for (_i = 0; _i < (n); ++_i) { \
+        (r).f[_i] = OP; \
+    } \
+} while (0)
+
+/**
+ * @brief Builds a vector from 4 individual lanes.
+ * @returns (a, b, c, d)
+ */
+static inline lac_f32x4 lac_simd_set_f32x4(const float a, const float b, const float c, const float d) {
+#if LAC_SIMD_VECTOR_EXT
+    return (lac_f32x4){ a, b, c, d };
+#else
+    lac_f32x4 r = { { a, b, c, d } };
+    return r;
+#endif
+}
+
+/**
+ * @brief Copies __s__ into every lane.
+ * @returns (s, s, s, s)
+ */
+static inline lac_f32x4 lac_simd_splat_f32x4(const float s) {
+    return lac_simd_set_f32x4(s, s, s, s);
+}
+
+/**
+ * @brief Gets lane __i__ of __v__.
+ * @returns v[i]
+ */
+static inline float lac_simd_get_f32x4(const lac_f32x4 v, const size_t i) {
+#if LAC_SIMD_VECTOR_EXT
+    return v[i];
+#else
+    return v.f[i];
+#endif
+}
+
+/**
+ * @brief Loads __n__ (1 to 4) floats, which need not be aligned, setting the remaining lanes to 0.
+ *
+ * A full vector is a single unaligned load. Shorter ones are built lane by lane, rather than
+ * copied over a zeroed vector, which would go through the stack and stall on the partial
+ * stores; __n__ should therefore be a constant, so that the branches fold away.
+ *
+ * @param[in] p The floats to be loaded
+ * @param[in] n The number of floats
+ * @returns The vector
+ */
+static inline lac_f32x4 lac_simd_load_f32x4(const float *p, const size_t n) {
+    lac_f32x4 r;
+
+    if (n >= 4) {
+        memcpy(&r, p, sizeof(r));
+        return r;
+    }
+    return lac_simd_set_f32x4(p[0], (n > 1) ? p[1] : 0.0f, (n > 2) ? p[2] : 0.0f, 0.0f);
+}
+
+/**
+ * @brief Stores the first __n__ (1 to 4) lanes of __v__ to memory which need not be aligned.
+ *
+ * As with lac_simd_load_f32x4(), a full vector is a single store and shorter ones are
+ * written lane by lane, so __n__ should be a constant.
+ *
+ * @param[out] p The destination
+ * @param[in] v The vector
+ * @param[in] n The number of lanes
+ */
+static inline void lac_simd_store_f32x4(float *p, const lac_f32x4 v, const size_t n) {
+    if (n >= 4) {
+        memcpy(p, &v, sizeof(v));
+        return;
+    }
+    p[0] = lac_simd_get_f32x4(v, 0);
+    if (n > 1) {
+        p[1] = lac_simd_get_f32x4(v, 1);
+    }
+    if (n > 2) {
+        p[2] = lac_simd_get_f32x4(v, 2);
+    }
+}
+
+/**
+ * @brief Adds two vectors.
+ * @returns a + b
+ */
+static inline lac_f32x4 lac_simd_add_f32x4(const lac_f32x4 a, const lac_f32x4 b) {
+#if LAC_SIMD_VECTOR_EXT
+    return a + b;
+#else
+    lac_f32x4 r;
+    _LAC_SIMD_LANES(r, 4, a.f[_i] + b.f[_i]);
+    return r;
+#endif
+}
+
+/**
+ * @brief Subtracts two vectors.
+ * @returns a - b
+ */
+static inline lac_f32x4 lac_simd_sub_f32x4(const lac_f32x4 a, const lac_f32x4 b) {
+#if LAC_SIMD_VECTOR_EXT
+    return a - b;
+#else
+    lac_f32x4 r;
+    _LAC_SIMD_LANES(r, 4, a.f[_i] - b.f[_i]);
+    return r;
+#endif
+}
+
+/**
+ * @brief Multiplies two vectors lane by lane.
+ * @returns a * b
+ */
+static inline lac_f32x4 lac_simd_mul_f32x4(const lac_f32x4 a, const lac_f32x4 b) {
+#if LAC_SIMD_VECTOR_EXT
+    return a * b;
+#else
+    lac_f32x4 r;
+    _LAC_SIMD_LANES(r, 4, a.f[_i] * b.f[_i]);
+    return r;
+#endif
+}
+
+/**
+ * @brief Divides two vectors lane by lane.
+ * @returns a / b
+ */
+static inline lac_f32x4 lac_simd_div_f32x4(const lac_f32x4 a, const lac_f32x4 b) {
+#if LAC_SIMD_VECTOR_EXT
+    return a / b;
+#else
+    lac_f32x4 r;
+    _LAC_SIMD_LANES(r, 4, a.f[_i] / b.f[_i]);
+    return r;
+#endif
+}
+
+/**
+ * @brief Multiplies and accumulates. The compiler may fuse this into an FMA where rounding rules allow.
+ * @returns (a * b) + c
+ */
+static inline lac_f32x4 lac_simd_madd_f32x4(const lac_f32x4 a, const lac_f32x4 b, const lac_f32x4 c) {
+    return lac_simd_add_f32x4(lac_simd_mul_f32x4(a, b), c);
+}
+
+/**
+ * @brief Takes the smaller of two vectors lane by lane.
+ * @returns (a < b) ? a : b
+ */
+static inline lac_f32x4 lac_simd_min_f32x4(const lac_f32x4 a, const lac_f32x4 b) {
+#if LAC_SIMD_VECTOR_EXT
+    const lac_i32x4 mask = a < b;
+    return (lac_f32x4)((mask & (lac_i32x4)a) | (~mask & (lac_i32x4)b));
+#else
+    lac_f32x4 r;
+    _LAC_SIMD_LANES(r, 4, (a.f[_i] < b.f[_i]) ? a.f[_i] : b.f[_i]);
+    return r;
+#endif
+}
+
+/**
+ * @brief Takes the larger of two vectors lane by lane.
+ * @returns (a > b) ? a : b
+ */
+static inline lac_f32x4 lac_simd_max_f32x4(const lac_f32x4 a, const lac_f32x4 b) {
+#if LAC_SIMD_VECTOR_EXT
+    const lac_i32x4 mask = a > b;
+    return (lac_f32x4)((mask & (lac_i32x4)a) | (~mask & (lac_i32x4)b));
+#else
+    lac_f32x4 r;
+    _LAC_SIMD_LANES(r, 4, (a.f[_i] > b.f[_i]) ? a.f[_i] : b.f[_i]);
+    return r;
+#endif
+}
+
+/**
+ * @brief Compares two vectors lane by lane.
+ * @returns A mask with every bit of a lane set where a <= b, or cleared otherwise
+ */
+static inline lac_i32x4 lac_simd_le_f32x4(const lac_f32x4 a, const lac_f32x4 b) {
+#if LAC_SIMD_VECTOR_EXT
+    return a <= b;
+#else
+    lac_i32x4 r;
+    _LAC_SIMD_LANES(r, 4, (a.f[_i] <= b.f[_i]) ? -1 : 0);
+    return r;
+#endif
+}
+
+/**
+ * @brief Intersects two masks.
+ * @returns a & b
+ */
+static inline lac_i32x4 lac_simd_and_i32x4(const lac_i32x4 a, const lac_i32x4 b) {
+#if LAC_SIMD_VECTOR_EXT
+    return a & b;
+#else
+    lac_i32x4 r;
+    _LAC_SIMD_LANES(r, 4, a.f[_i] & b.f[_i]);
+    return r;
+#endif
+}
+
+/**
+ * @brief Gathers one bit from each lane of a mask.
+ * @returns An integer where bit i is set if lane i of __mask__ is set
+ */
+static inline unsigned lac_simd_bits_i32x4(const lac_i32x4 mask) {
+    unsigned bits = 0;
+    size_t i;
+
+    for (i = 0; i < 4; ++i) {
+#if LAC_SIMD_VECTOR_EXT
+        bits |= (mask[i] != 0) ? (1u << i) : 0u;
+#else
+        bits |= (mask.f[i] != 0) ? (1u << i) : 0u;
+#endif
+    }
+    return bits;
+}
+
+/**
+ * @brief Adds the first __n__ lanes of __v__ together, in order.
+ * @returns v[0] + v[1] + ... + v[n - 1]
+ */
+static inline float lac_simd_sum_f32x4(const lac_f32x4 v, const size_t n) {
+    float sum = lac_simd_get_f32x4(v, 0);
+    size_t i;
+
+    for (i = 1; i < n; ++i) {
+        sum += lac_simd_get_f32x4(v, i);
+    }
+    return sum;
+}
+
+/**
+ * @brief Rotates the first 3 lanes to the left.
+ * @returns (v[1], v[2], v[0], v[3])
+ */
+static inline lac_f32x4 lac_simd_yzx_f32x4(const lac_f32x4 v) {
+#if LAC_SIMD_VECTOR_EXT && defined(__clang__)
+    return __builtin_shufflevector(v, v, 1, 2, 0, 3);
+#elif LAC_SIMD_VECTOR_EXT
+    return __builtin_shuffle(v, (lac_i32x4){ 1, 2, 0, 3 });
+#else
+    return lac_simd_set_f32x4(v.f[1], v.f[2], v.f[0], v.f[3]);
+#endif
+}
+
+/**
+ * @brief Rotates the first 3 lanes to the right.
+ * @returns (v[2], v[0], v[1], v[3])
+ */
+static inline lac_f32x4 lac_simd_zxy_f32x4(const lac_f32x4 v) {
+#if LAC_SIMD_VECTOR_EXT && defined(__clang__)
+    return __builtin_shufflevector(v, v, 2, 0, 1, 3);
+#elif LAC_SIMD_VECTOR_EXT
+    return __builtin_shuffle(v, (lac_i32x4){ 2, 0, 1, 3 });
+#else
+    return lac_simd_set_f32x4(v.f[2], v.f[0], v.f[1], v.f[3]);
+#endif
+}
+
+/**
+ * @brief Loads column __c__ of an __n__x__n__ matrix (2 <= n <= 4), respecting LAC_IS_ROW_MAJOR.
+ * @param[in] m_in The matrix
+ * @param[in] n The number of rows and columns
+ * @param[in] c The column to be loaded
+ * @returns The column in the first __n__ lanes, with the remaining lanes set to 0
+ */
+static inline lac_f32x4 lac_simd_load_column_f32x4(const float *m_in, const size_t n, const size_t c) {
+#if LAC_IS_ROW_MAJOR
+    return lac_simd_set_f32x4(
+        m_in[c],
+        m_in[n + c],
+        (n > 2) ? m_in[(2 * n) + c] : 0.0f,
+        (n > 3) ? m_in[(3 * n) + c] : 0.0f
+    );
+#else
+    return lac_simd_load_f32x4(&m_in[c * n], n);
+#endif
+}
+
+/**
+ * @brief Loads 8 floats, which need not be aligned.
+ * @param[in] p The floats to be loaded
+ * @returns The vector
+ */
+static inline lac_f32x8 lac_simd_load_f32x8(const float *p) {
+    lac_f32x8 r;
+
+    memcpy(&r, p, sizeof(r));
+    return r;
+}
+
+/**
+ * @brief Stores 8 floats to memory which need not be aligned.
+ * @param[out] p The destination
+ * @param[in] v The vector
+ */
+static inline void lac_simd_store_f32x8(float *p, const lac_f32x8 v) {
+    memcpy(p, &v, sizeof(v));
+}
+
+/**
+ * @brief Copies __s__ into every lane.
+ * @returns (s, s, s, s, s, s, s, s)
+ */
+static inline lac_f32x8 lac_simd_splat_f32x8(const float s) {
+#if LAC_SIMD_VECTOR_EXT
+    return (lac_f32x8){ s, s, s, s, s, s, s, s };
+#else
+    lac_f32x8 r;
+    _LAC_SIMD_LANES(r, 8, s);
+    return r;
+#endif
+}
+
+/**
+ * @brief Adds two vectors.
+ * @returns a + b
+ */
+static inline lac_f32x8 lac_simd_add_f32x8(const lac_f32x8 a, const lac_f32x8 b) {
+#if LAC_SIMD_VECTOR_EXT
+    return a + b;
+#else
+    lac_f32x8 r;
+    _LAC_SIMD_LANES(r, 8, a.f[_i] + b.f[_i]);
+    return r;
+#endif
+}
+
+/**
+ * @brief Subtracts two vectors.
+ * @returns a - b
+ */
+static inline lac_f32x8 lac_simd_sub_f32x8(const lac_f32x8 a, const lac_f32x8 b) {
+#if LAC_SIMD_VECTOR_EXT
+    return a - b;
+#else
+    lac_f32x8 r;
+    _LAC_SIMD_LANES(r, 8, a.f[_i] - b.f[_i]);
+    return r;
+#endif
+}
+
+/**
+ * @brief Multiplies two vectors lane by lane.
+ * @returns a * b
+ */
+static inline lac_f32x8 lac_simd_mul_f32x8(const lac_f32x8 a, const lac_f32x8 b) {
+#if LAC_SIMD_VECTOR_EXT
+    return a * b;
+#else
+    lac_f32x8 r;
+    _LAC_SIMD_LANES(r, 8, a.f[_i] * b.f[_i]);
+    return r;
+#endif
+}
+
+/**
+ * @brief Multiplies and accumulates. The compiler may fuse this into an FMA where rounding rules allow.
+ * @returns (a * b) + c
+ */
+static inline lac_f32x8 lac_simd_madd_f32x8(const lac_f32x8 a, const lac_f32x8 b, const lac_f32x8 c) {
+    return lac_simd_add_f32x8(lac_simd_mul_f32x8(a, b), c);
+}
+
+/**
+ * @brief Divides two vectors lane by lane.
+ * @returns a / b
+ */
+static inline lac_f32x8 lac_simd_div_f32x8(const lac_f32x8 a, const lac_f32x8 b) {
+#if LAC_SIMD_VECTOR_EXT
+    return a / b;
+#else
+    lac_f32x8 r;
+    _LAC_SIMD_LANES(r, 8, a.f[_i] / b.f[_i]);
+    return r;
+#endif
+}
+
+/**
+ * @brief Takes the smaller of two vectors lane by lane.
+ * @returns a < b ? a : b
+ */
+static inline lac_f32x8 lac_simd_min_f32x8(const lac_f32x8 a, const lac_f32x8 b) {
+#if LAC_SIMD_VECTOR_EXT
+    const lac_i32x8 mask = a < b;
+    return (lac_f32x8)((mask & (lac_i32x8)a) | (~mask & (lac_i32x8)b));
+#else
+    lac_f32x8 r;
+    _LAC_SIMD_LANES(r, 8, (a.f[_i] < b.f[_i]) ? a.f[_i] : b.f[_i]);
+    return r;
+#endif
+}
+
+/**
+ * @brief Takes the larger of two vectors lane by lane.
+ * @returns a > b ? a : b
+ */
+static inline lac_f32x8 lac_simd_max_f32x8(const lac_f32x8 a, const lac_f32x8 b) {
+#if LAC_SIMD_VECTOR_EXT
+    const lac_i32x8 mask = a > b;
+    return (lac_f32x8)((mask & (lac_i32x8)a) | (~mask & (lac_i32x8)b));
+#else
+    lac_f32x8 r;
+    _LAC_SIMD_LANES(r, 8, (a.f[_i] > b.f[_i]) ? a.f[_i] : b.f[_i]);
+    return r;
+#endif
+}
+
+/**
+ * @brief Clears the sign bit of every lane.
+ * @returns |a|
+ */
+static inline lac_f32x8 lac_simd_abs_f32x8(const lac_f32x8 a) {
+#if LAC_SIMD_VECTOR_EXT
+    return (lac_f32x8)((lac_i32x8)a & 0x7fffffff);
+#else
+    lac_f32x8 r;
+    _LAC_SIMD_LANES(r, 8, fabsf(a.f[_i]));
+    return r;
+#endif
+}
+
+/**
+ * @brief Takes the square root of every lane.
+ *
+ * There is no generic vector square root, so this is a loop over the lanes, which
+ * optimized builds turn into a single instruction where the target has one.
+ *
+ * @returns sqrt(a)
+ */
+static inline lac_f32x8 lac_simd_sqrt_f32x8(const lac_f32x8 a) {
+    lac_f32x8 r;
+    size_t i;
+
+    for (i = 0; i < 8; ++i) {
+#if LAC_SIMD_VECTOR_EXT
+        r[i] = sqrtf(a[i]);
+#else
+        r.f[i] = sqrtf(a.f[i]);
+#endif
+    }
+    return r;
+}
+
+/**
+ * @brief Converts every lane to an integer, rounding towards zero.
+ * @param[in] a The vector, whose lanes must lie within the range of an int
+ * @returns (int)a
+ */
+static inline lac_i32x8 lac_simd_to_i32x8(const lac_f32x8 a) {
+#if LAC_SIMD_VECTOR_EXT
+    return __builtin_convertvector(a, lac_i32x8);
+#else
+    lac_i32x8 r;
+    _LAC_SIMD_LANES(r, 8, (int)a.f[_i]);
+    return r;
+#endif
+}
+
+/**
+ * @brief Converts every lane of an integer vector to a float.
+ * @returns (float)a
+ */
+static inline lac_f32x8 lac_simd_to_f32x8(const lac_i32x8 a) {
+#if LAC_SIMD_VECTOR_EXT
+    return __builtin_convertvector(a, lac_f32x8);
+#else
+    lac_f32x8 r;
+    _LAC_SIMD_LANES(r, 8, (float)a.f[_i]);
+    return r;
+#endif
+}
+
+/**
+ * @brief Reinterprets the bits of every lane as an integer, e.g. to test the sign bit.
+ * @returns The bits of __a__
+ */
+static inline lac_i32x8 lac_simd_as_i32x8(const lac_f32x8 a) {
+#if LAC_SIMD_VECTOR_EXT
+    return (lac_i32x8)a;
+#else
+    lac_i32x8 r;
+    memcpy(&r, &a, sizeof(r));
+    return r;
+#endif
+}
+
+/**
+ * @brief Reinterprets the bits of every lane as a float.
+ * @returns The floats whose bits are __a__
+ */
+static inline lac_f32x8 lac_simd_as_f32x8(const lac_i32x8 a) {
+#if LAC_SIMD_VECTOR_EXT
+    return (lac_f32x8)a;
+#else
+    lac_f32x8 r;
+    memcpy(&r, &a, sizeof(r));
+    return r;
+#endif
+}
+
+/**
+ * @brief Returns __a__ unchanged, but hides its value from the optimizer.
+ *
+ * -Ofast lets the compiler reassociate arithmetic, which undoes any sequence that
+ * depends on an intermediate result being rounded, such as subtracting a constant
+ * that has been split into parts. Passing the intermediate result through here
+ * keeps it exactly as written, at the cost of a store and a load.
+ *
+ * @returns a
+ */
+static inline lac_f32x8 lac_simd_opaque_f32x8(lac_f32x8 a) {
+#if defined(__GNUC__) || defined(__clang__)
+    __asm__("" : "+m"(a));
+#endif
+    return a;
+}
+
+/**
+ * @brief Compares two vectors lane by lane.
+ * @returns A mask with every bit of a lane set where a < b, or cleared otherwise
+ */
+static inline lac_i32x8 lac_simd_lt_f32x8(const lac_f32x8 a, const lac_f32x8 b) {
+#if LAC_SIMD_VECTOR_EXT
+    return a < b;
+#else
+    lac_i32x8 r;
+    _LAC_SIMD_LANES(r, 8, (a.f[_i] < b.f[_i]) ? -1 : 0);
+    return r;
+#endif
+}
+
+/**
+ * @brief Compares two vectors lane by lane.
+ * @returns A mask with every bit of a lane set where a <= b, or cleared otherwise
+ */
+static inline lac_i32x8 lac_simd_le_f32x8(const lac_f32x8 a, const lac_f32x8 b) {
+#if LAC_SIMD_VECTOR_EXT
+    return a <= b;
+#else
+    lac_i32x8 r;
+    _LAC_SIMD_LANES(r, 8, (a.f[_i] <= b.f[_i]) ? -1 : 0);
+    return r;
+#endif
+}
+
+/**
+ * @brief Intersects two masks.
+ * @returns a & b
+ */
+static inline lac_i32x8 lac_simd_and_i32x8(const lac_i32x8 a, const lac_i32x8 b) {
+#if LAC_SIMD_VECTOR_EXT
+    return a & b;
+#else
+    lac_i32x8 r;
+    _LAC_SIMD_LANES(r, 8, a.f[_i] & b.f[_i]);
+    return r;
+#endif
+}
+
+/**
+ * @brief Unites two masks.
+ * @returns a | b
+ */
+static inline lac_i32x8 lac_simd_or_i32x8(const lac_i32x8 a, const lac_i32x8 b) {
+#if LAC_SIMD_VECTOR_EXT
+    return a | b;
+#else
+    lac_i32x8 r;
+    _LAC_SIMD_LANES(r, 8, a.f[_i] | b.f[_i]);
+    return r;
+#endif
+}
+
+/**
+ * @brief Copies __s__ into every lane of an integer vector.
+ * @returns (s, s, s, s, s, s, s, s)
+ */
+static inline lac_i32x8 lac_simd_splat_i32x8(const int s) {
+#if LAC_SIMD_VECTOR_EXT
+    return (lac_i32x8){ s, s, s, s, s, s, s, s };
+#else
+    lac_i32x8 r;
+    _LAC_SIMD_LANES(r, 8, s);
+    return r;
+#endif
+}
+
+/**
+ * @brief Compares two integer vectors lane by lane.
+ * @returns A mask with every bit of a lane set where a == b, or cleared otherwise
+ */
+static inline lac_i32x8 lac_simd_eq_i32x8(const lac_i32x8 a, const lac_i32x8 b) {
+#if LAC_SIMD_VECTOR_EXT
+    return a == b;
+#else
+    lac_i32x8 r;
+    _LAC_SIMD_LANES(r, 8, (a.f[_i] == b.f[_i]) ? -1 : 0);
+    return r;
+#endif
+}
+
+/**
+ * @brief Picks each lane from __a__ where __mask__ is set, or from __b__ where it is cleared.
+ * @param[in] mask A mask as returned by the comparisons, i.e. each lane is either all ones or all zeros
+ * @returns mask ? a : b
+ */
+static inline lac_f32x8 lac_simd_select_f32x8(const lac_i32x8 mask, const lac_f32x8 a, const lac_f32x8 b) {
+#if LAC_SIMD_VECTOR_EXT
+    return (lac_f32x8)((mask & (lac_i32x8)a) | (~mask & (lac_i32x8)b));
+#else
+    lac_f32x8 r;
+    _LAC_SIMD_LANES(r, 8, mask.f[_i] ? a.f[_i] : b.f[_i]);
+    return r;
+#endif
+}
+
+/**
+ * @brief Gathers one bit from each lane of a mask.
+ * @returns An integer where bit i is set if lane i of __mask__ is set
+ */
+static inline unsigned lac_simd_bits_i32x8(const lac_i32x8 mask) {
+    unsigned bits = 0;
+    size_t i;
+
+    for (i = 0; i < 8; ++i) {
+#if LAC_SIMD_VECTOR_EXT
+        bits |= (mask[i] != 0) ? (1u << i) : 0u;
+#else
+        bits |= (mask.f[i] != 0) ? (1u << i) : 0u;
+#endif
+    }
+    return bits;
+}
+
+/**
+ * @brief Loads the 8 floats of __base__ at the indices in __idx__.
+ * @param[in] base The floats to be loaded from
+ * @param[in] idx The index of each lane's float
+ * @returns (base[idx[0]], base[idx[1]], ..., base[idx[7]])
+ */
+static inline lac_f32x8 lac_simd_gather_f32x8(const float *base, const uint32_t *idx) {
+#if LAC_SIMD_VECTOR_EXT
+    return (lac_f32x8){
+        base[idx[0]], base[idx[1]], base[idx[2]], base[idx[3]],
+        base[idx[4]], base[idx[5]], base[idx[6]], base[idx[7]]
+    };
+#else
+    lac_f32x8 r;
+    size_t i;
+
+    for (i = 0; i < 8; ++i) {
+        r.f[i] = base[idx[i]];
+    }
+    return r;
+#endif
+}
+
+/**
+ * @brief Adds the 8 lanes of __v__ together, in order.
+ * @returns v[0] + v[1] + ... + v[7]
+ */
+static inline float lac_simd_sum_f32x8(const lac_f32x8 v) {
+    float lanes[8], sum;
+    size_t i;
+
+    lac_simd_store_f32x8(lanes, v);
+    sum = lanes[0];
+    for (i = 1; i < 8; ++i) {
+        sum += lanes[i];
+    }
+    return sum;
+}
+
+#endif /* LAC_SIMD_H */
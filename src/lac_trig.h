@@ -0,0 +1,177 @@
+#ifndef LAC_TRIG_H
+#define LAC_TRIG_H
+
+/*
+ * Internal polynomial approximations of sin, cos and atan2 over LAC_BATCH_BLOCK lanes,
+ * used by the kernels in coords.c and transforms.c. See coords.c for how they work.
+ *
+ * Like the other block helpers, these take and return their lanes through memory, so
+ * they can be called from every LAC_MULTIVERSION() variant (see lac_dispatch.h).
+ */
+
+#include "lac_common.h"
+#include "lac_simd.h"
+#include "lac_dispatch.h"
+
+/* pi/2 split into three parts, the first two with enough trailing zero bits that k * part is exact */
+#define LAC_TRIG_PIO2_1 1.5703125f
+#define LAC_TRIG_PIO2_2 4.837512969970703125e-4f
+#define LAC_TRIG_PIO2_3 7.54978995489188216e-8f
+
+#define LAC_TRIG_2_OVER_PI 0.636619772367581343f
+#define LAC_TRIG_PI 3.14159265358979324f
+#define LAC_TRIG_PIO2 1.57079632679489662f
+#define LAC_TRIG_PIO4 0.785398163397448310f
+
+/*
+ * The largest angle reduced with the parts of pi/2 above. k * PIO2_2 is only exact while k
+ * fits in 13 bits, i.e. up to about 12868 radians, so larger angles go to sinf() and cosf()
+ */
+#define LAC_TRIG_MAX_REDUCED 8192.0f
+
+/* tan(pi/8), above which the precise arctangent reduces t to (t - 1) / (t + 1) */
+#define LAC_TRIG_TAN_PIO8 0.414213562373095049f
+
+/**
+ * @brief Calculates the sine and cosine of exactly LAC_BATCH_BLOCK angles.
+ * @since 19-10-2026
+ * @param[out] sin_out The sines (must not be the same array as __angle__)
+ * @param[out] cos_out The cosines (must not be the same array as __angle__)
+ * @param[in] angle The angles in radians
+ * @param[in] precise If set to true, longer polynomials are used, with an absolute error of at most about 1e-7
+ */
+static LAC_VARIANT_INLINE void _lac_sincos_block(
+    float *sin_out,
+    float *cos_out,
+    const float *angle,
+    const bool precise
+) {
+    const lac_f32x8 angles = lac_simd_load_f32x8(angle), zero = lac_simd_splat_f32x8(0.0f);
+    lac_f32x8 x, half, k, r, z, s, c, sin_r, cos_r;
+    lac_i32x8 quadrant, swap;
+    size_t i;
+
+    /* Angles too large to reduce accurately, and infinities and NaNs, are replaced by the C library's results below */
+    x = lac_simd_select_f32x8(
+        lac_simd_lt_f32x8(lac_simd_abs_f32x8(angles), lac_simd_splat_f32x8(LAC_TRIG_MAX_REDUCED)), angles, zero
+    );
+
+    /* Round x * 2/pi to the nearest integer k, i.e. the quadrant that x lies in */
+    half = lac_simd_select_f32x8(lac_simd_lt_f32x8(x, zero), lac_simd_splat_f32x8(-0.5f), lac_simd_splat_f32x8(0.5f));
+    quadrant = lac_simd_to_i32x8(lac_simd_madd_f32x8(x, lac_simd_splat_f32x8(LAC_TRIG_2_OVER_PI), half));
+    k = lac_simd_to_f32x8(quadrant);
+
+    /*
+     * k * PIO2_1 and k * PIO2_2 are exact, so each step must be rounded before the next part
+     * is taken away, or -Ofast folds the parts back together into one inexact multiple of pi/2
+     */
+    r = lac_simd_opaque_f32x8(lac_simd_madd_f32x8(k, lac_simd_splat_f32x8(-LAC_TRIG_PIO2_1), x));
+    r = lac_simd_opaque_f32x8(lac_simd_madd_f32x8(k, lac_simd_splat_f32x8(-LAC_TRIG_PIO2_2), r));
+    r = lac_simd_opaque_f32x8(lac_simd_madd_f32x8(k, lac_simd_splat_f32x8(-LAC_TRIG_PIO2_3), r));
+    z = lac_simd_mul_f32x8(r, r);
+
+    if (precise) {
+        s = lac_simd_madd_f32x8(z, lac_simd_splat_f32x8(-1.9515295891e-4f), lac_simd_splat_f32x8(8.3321608736e-3f));
+        s = lac_simd_madd_f32x8(z, s, lac_simd_splat_f32x8(-1.6666654611e-1f));
+        c = lac_simd_madd_f32x8(z, lac_simd_splat_f32x8(2.443315711809948e-5f), lac_simd_splat_f32x8(-1.388731625493765e-3f));
+        c = lac_simd_madd_f32x8(z, c, lac_simd_splat_f32x8(4.166664568298827e-2f));
+        c = lac_simd_madd_f32x8(lac_simd_mul_f32x8(z, z), c, lac_simd_madd_f32x8(z, lac_simd_splat_f32x8(-0.5f), lac_simd_splat_f32x8(1.0f)));
+    } else {
+        s = lac_simd_madd_f32x8(z, lac_simd_splat_f32x8(8.152992326e-3f), lac_simd_splat_f32x8(-1.666283381e-1f));
+        c = lac_simd_madd_f32x8(z, lac_simd_splat_f32x8(4.048893588e-2f), lac_simd_splat_f32x8(-4.997763071e-1f));
+        c = lac_simd_madd_f32x8(z, c, lac_simd_splat_f32x8(1.0f));
+    }
+    s = lac_simd_madd_f32x8(lac_simd_mul_f32x8(r, z), s, r);
+
+    /* Odd quadrants swap the sine and cosine, and the sign of each follows its quadrant */
+    quadrant = lac_simd_and_i32x8(quadrant, lac_simd_splat_i32x8(3));
+    swap = lac_simd_eq_i32x8(lac_simd_and_i32x8(quadrant, lac_simd_splat_i32x8(1)), lac_simd_splat_i32x8(1));
+    sin_r = lac_simd_select_f32x8(swap, c, s);
+    cos_r = lac_simd_select_f32x8(swap, s, c);
+    sin_r = lac_simd_select_f32x8(
+        lac_simd_eq_i32x8(lac_simd_and_i32x8(quadrant, lac_simd_splat_i32x8(2)), lac_simd_splat_i32x8(2)),
+        lac_simd_sub_f32x8(zero, sin_r), sin_r
+    );
+    cos_r = lac_simd_select_f32x8(
+        lac_simd_or_i32x8(
+            lac_simd_eq_i32x8(quadrant, lac_simd_splat_i32x8(1)),
+            lac_simd_eq_i32x8(quadrant, lac_simd_splat_i32x8(2))
+        ),
+        lac_simd_sub_f32x8(zero, cos_r), cos_r
+    );
+
+    lac_simd_store_f32x8(sin_out, sin_r);
+    lac_simd_store_f32x8(cos_out, cos_r);
+    for (i = 0; i < LAC_BATCH_BLOCK; ++i) {
+        if (!(fabsf(angle[i]) < LAC_TRIG_MAX_REDUCED)) {
+            sin_out[i] = sinf(angle[i]);
+            cos_out[i] = cosf(angle[i]);
+        }
+    }
+}
+
+/**
+ * @brief Calculates the angle of exactly LAC_BATCH_BLOCK points from the x axis, like atan2f().
+ * @since 19-10-2026
+ * @param[out] angle_out The angles in radians, within [-pi, pi], with the sign of __y__; 0 where both __y__ and __x__ are 0
+ * @param[in] y The y components of the points
+ * @param[in] x The x components of the points
+ * @param[in] precise If set to true, a longer polynomial is used, with an absolute error of at most about 3e-7
+ */
+static LAC_VARIANT_INLINE void _lac_atan2_block(
+    float *angle_out,
+    const float *y,
+    const float *x,
+    const bool precise
+) {
+    const lac_f32x8 vy = lac_simd_load_f32x8(y), vx = lac_simd_load_f32x8(x), zero = lac_simd_splat_f32x8(0.0f);
+    const lac_f32x8 ax = lac_simd_abs_f32x8(vx), ay = lac_simd_abs_f32x8(vy);
+    const lac_f32x8 lo = lac_simd_min_f32x8(ax, ay), hi = lac_simd_max_f32x8(ax, ay);
+    const lac_i32x8 inf = lac_simd_splat_i32x8(0x7f800000);
+    lac_f32x8 num = lo, den = hi, offset = zero, t, z, p, a;
+    lac_i32x8 reduce;
+
+    if (precise) {
+        /* Above tan(pi/8), atan(t) = pi/4 + atan((t - 1) / (t + 1)), which keeps the polynomial short */
+        reduce = lac_simd_lt_f32x8(lac_simd_mul_f32x8(hi, lac_simd_splat_f32x8(LAC_TRIG_TAN_PIO8)), lo);
+        num = lac_simd_select_f32x8(reduce, lac_simd_sub_f32x8(lo, hi), lo);
+        den = lac_simd_select_f32x8(reduce, lac_simd_add_f32x8(lo, hi), hi);
+        offset = lac_simd_select_f32x8(reduce, lac_simd_splat_f32x8(LAC_TRIG_PIO4), zero);
+    }
+    t = lac_simd_select_f32x8(lac_simd_lt_f32x8(zero, den), lac_simd_div_f32x8(num, den), zero);
+    z = lac_simd_mul_f32x8(t, t);
+
+    if (precise) {
+        p = lac_simd_madd_f32x8(z, lac_simd_splat_f32x8(8.05374449538e-2f), lac_simd_splat_f32x8(-1.38776856032e-1f));
+        p = lac_simd_madd_f32x8(z, p, lac_simd_splat_f32x8(1.99777106478e-1f));
+        p = lac_simd_madd_f32x8(z, p, lac_simd_splat_f32x8(-3.33329491539e-1f));
+        a = lac_simd_add_f32x8(lac_simd_madd_f32x8(lac_simd_mul_f32x8(p, z), t, t), offset);
+    } else {
+        p = lac_simd_madd_f32x8(z, lac_simd_splat_f32x8(2.08351e-2f), lac_simd_splat_f32x8(-8.51330e-2f));
+        p = lac_simd_madd_f32x8(z, p, lac_simd_splat_f32x8(1.801410e-1f));
+        p = lac_simd_madd_f32x8(z, p, lac_simd_splat_f32x8(-3.302995e-1f));
+        p = lac_simd_madd_f32x8(z, p, lac_simd_splat_f32x8(9.998660e-1f));
+        a = lac_simd_mul_f32x8(p, t);
+    }
+
+    /*
+     * An infinite coordinate turns the ratio into inf / inf or finite / inf, so its angle is set
+     * outright. The test is on the bits, since -ffinite-math-only would fold a comparison away
+     */
+    a = lac_simd_select_f32x8(
+        lac_simd_eq_i32x8(lac_simd_as_i32x8(hi), inf),
+        lac_simd_select_f32x8(lac_simd_eq_i32x8(lac_simd_as_i32x8(lo), inf), lac_simd_splat_f32x8(LAC_TRIG_PIO4), zero),
+        a
+    );
+
+    /* Reflect the angle from the first octant into the octant of (x, y), giving -0 and -pi the sign of y */
+    a = lac_simd_select_f32x8(lac_simd_lt_f32x8(ax, ay), lac_simd_sub_f32x8(lac_simd_splat_f32x8(LAC_TRIG_PIO2), a), a);
+    a = lac_simd_select_f32x8(lac_simd_lt_f32x8(vx, zero), lac_simd_sub_f32x8(lac_simd_splat_f32x8(LAC_TRIG_PI), a), a);
+    a = lac_simd_as_f32x8(lac_simd_or_i32x8(
+        lac_simd_as_i32x8(a),
+        lac_simd_and_i32x8(lac_simd_as_i32x8(vy), lac_simd_splat_i32x8(INT32_MIN))
+    ));
+    lac_simd_store_f32x8(angle_out, a);
+}
+
+#endif /* LAC_TRIG_H */
@@ -0,0 +1,444 @@
+/**
+ * @file mapfile.c
+ * @author Neil Kingdom
+ * @since 19-10-2026
+ * @version 1.0
+ * @brief Provides a binary file format for arrays of vectors and matrices which can be memory-mapped.
+ *
+ * @section mmap Memory-Mapped Files
+ *
+ * The traditional way of loading data from disk is to allocate a buffer
+ * and read() the file into it. For very large files this has two costs:
+ * the program must wait for the entire file to be copied before it can
+ * start working, and for the duration of the copy, the data exists twice
+ * in memory (once in the kernel's page cache and once in the buffer).
+ *
+ * Memory-mapping a file with mmap() instead asks the kernel to make the
+ * pages of its page cache visible directly within our address space. No
+ * copy is made. Pages are only read from disk the first time that they
+ * are touched, and since they belong to the page cache rather than to our
+ * process, the kernel is free to evict them again under memory pressure.
+ * The result is that a pointer into the mapping can be handed straight to
+ * the batch kernels (see batch.c), which will stream through the file at
+ * the speed that the disk can deliver it.
+ *
+ * @section arrayfile Array File Format
+ *
+ * An array file begins with a fixed size header which is followed by the
+ * elements of the array, tightly packed. All fields are stored in the byte
+ * order of the machine that wrote the file, which the reader verifies using
+ * a known marker value.
+ *
+ * ```
+ * offset  size  field
+ * 0       8     magic ("LACARRAY")
+ * 8       4     version (LAC_ARRAY_FILE_VERSION)
+ * 12      4     byte order marker (0x01020304)
+ * 16      4     element type (LacArrayType_t)
+ * 20      4     element size in bytes
+ * 24      8     element count
+ * 32      8     offset of the first element (a multiple of LAC_ARRAY_FILE_ALIGN)
+ * 40      24    reserved (zero)
+ * ```
+ *
+ * Since mmap() always returns a page-aligned address, aligning the first
+ * element within the file guarantees that it is aligned in memory as well.
+ *
+ * @subsection arrayfile_related Related Functions
+ *
+ * - @ref lac_write_array_file_anchor "lac_write_array_file"
+ * - @ref lac_create_array_file_anchor "lac_create_array_file"
+ * - @ref lac_map_array_file_anchor "lac_map_array_file"
+ * - @ref lac_unmap_array_file_anchor "lac_unmap_array_file"
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "mapfile.h"
+
+#define LAC_ARRAY_FILE_MAGIC "LACARRAY"
+#define LAC_ARRAY_FILE_BYTE_ORDER 0x01020304u
+
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t byte_order;
+    uint32_t type;
+    uint32_t elem_size;
+    uint64_t count;
+    uint64_t data_offset;
+    uint8_t reserved[24];
+} LacArrayFileHeader_t;
+
+/**
+ * @brief Rounds __size__ up to the next multiple of LAC_ARRAY_FILE_ALIGN.
+ * @since 19-10-2026
+ * @param[in] size The size to be rounded
+ * @returns The rounded size
+ */
+static inline size_t _lac_align_array_offset(const size_t size) {
+    return (size + (LAC_ARRAY_FILE_ALIGN - 1)) & ~((size_t)LAC_ARRAY_FILE_ALIGN - 1);
+}
+
+/**
+ * @brief Fills in the header for an array of __count__ elements of type __type__.
+ * @since 19-10-2026
+ * @param[out] header The header to be filled in
+ * @param[in] type The type of each element
+ * @param[in] count The number of elements
+ */
+static void _lac_init_array_header(
+    LacArrayFileHeader_t *header,
+    const LacArrayType_t type,
+    const size_t count
+) {
+    memset(header, 0, sizeof(LacArrayFileHeader_t));
+    memcpy(header->magic, LAC_ARRAY_FILE_MAGIC, sizeof(header->magic));
+    header->version = LAC_ARRAY_FILE_VERSION;
+    header->byte_order = LAC_ARRAY_FILE_BYTE_ORDER;
+    header->type = (uint32_t)type;
+    header->elem_size = (uint32_t)lac_get_array_type_size(type);
+    header->count = (uint64_t)count;
+    header->data_offset = _lac_align_array_offset(sizeof(LacArrayFileHeader_t));
+}
+
+/**
+ * @brief Writes all __size__ bytes of __buf__ to __fd__, retrying on partial writes.
+ * @since 19-10-2026
+ * @param[in] fd The file descriptor to write to
+ * @param[in] buf The bytes to be written
+ * @param[in] size The number of bytes to be written
+ * @returns 0 on success, otherwise -1 and errno is set
+ */
+static int _lac_write_all(const int fd, const void *buf, const size_t size) {
+    const uint8_t *bytes = buf;
+    size_t written = 0;
+    ssize_t ret;
+
+    while (written < size) {
+        ret = write(fd, bytes + written, size - written);
+        if (ret < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return -1;
+        }
+        written += (size_t)ret;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Gets the size in bytes of one element of the given type.
+ * @since 19-10-2026
+ * @param[in] type The element type
+ * @returns The size of the element, or 0 if __type__ is not a valid LacArrayType_t
+ */
+LAC_DECL size_t lac_get_array_type_size(const LacArrayType_t type) {
+    switch (type) {
+        case LAC_ARRAY_VEC2:
+            return sizeof(vec2);
+        case LAC_ARRAY_VEC3:
+            return sizeof(vec3);
+        case LAC_ARRAY_VEC4:
+            return sizeof(vec4);
+        case LAC_ARRAY_MAT2:
+            return sizeof(mat2);
+        case LAC_ARRAY_MAT3:
+            return sizeof(mat3);
+        case LAC_ARRAY_MAT4:
+            return sizeof(mat4);
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Writes an array of vectors or matrices to a new array file.
+ * @anchor lac_write_array_file_anchor
+ * @since 19-10-2026
+ * @param[in] path The path of the file to be created (or truncated, if it exists)
+ * @param[in] data The first element of the array
+ * @param[in] type The type of each element
+ * @param[in] count The number of elements in __data__
+ * @returns 0 on success, otherwise -1 and errno is set
+ */
+LAC_DECL int lac_write_array_file(
+    const char *path,
+    const void *data,
+    const LacArrayType_t type,
+    const size_t count
+) {
+    LacArrayFileHeader_t header;
+    uint8_t padding[LAC_ARRAY_FILE_ALIGN] = { 0 };
+    int fd, saved_errno;
+
+    if (lac_get_array_type_size(type) == 0) {
+        LAC_LOG("Invalid array type", LAC_ERROR);
+        errno = EINVAL;
+        return -1;
+    }
+
+    _lac_init_array_header(&header, type, count);
+
+    fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        saved_errno = errno;
+        LAC_LOG("Failed to open array file for writing", LAC_ERROR);
+        errno = saved_errno;
+        return -1;
+    }
+
+    if (_lac_write_all(fd, &header, sizeof(header)) < 0
+        || _lac_write_all(fd, padding, header.data_offset - sizeof(header)) < 0
+        || _lac_write_all(fd, data, count * header.elem_size) < 0) {
+        saved_errno = errno;
+        LAC_LOG("Failed to write array file", LAC_ERROR);
+        close(fd);
+        errno = saved_errno;
+        return -1;
+    }
+
+    if (close(fd) < 0) {
+        saved_errno = errno;
+        LAC_LOG("Failed to close array file", LAC_ERROR);
+        errno = saved_errno;
+        return -1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Creates a new array file of __count__ elements and maps it for writing.
+ * @anchor lac_create_array_file_anchor
+ * @since 19-10-2026
+ *
+ * The elements are initially zero. This allows the output of a batch kernel to be
+ * written directly into the file, rather than into a buffer which is written out
+ * afterwards. Changes are flushed to disk when the array is unmapped.
+ *
+ * @param[out] mapped The mapped array
+ * @param[in] path The path of the file to be created (or truncated, if it exists)
+ * @param[in] type The type of each element
+ * @param[in] count The number of elements
+ * @returns 0 on success, otherwise -1 and errno is set
+ */
+LAC_DECL int lac_create_array_file(
+    LacMappedArray_t *mapped,
+    const char *path,
+    const LacArrayType_t type,
+    const size_t count
+) {
+    LacArrayFileHeader_t header;
+    int fd, saved_errno;
+
+    if (lac_get_array_type_size(type) == 0) {
+        LAC_LOG("Invalid array type", LAC_ERROR);
+        errno = EINVAL;
+        return -1;
+    }
+
+    _lac_init_array_header(&header, type, count);
+
+    fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        saved_errno = errno;
+        LAC_LOG("Failed to open array file for writing", LAC_ERROR);
+        errno = saved_errno;
+        return -1;
+    }
+
+    if (_lac_write_all(fd, &header, sizeof(header)) < 0
+        || ftruncate(fd, (off_t)(header.data_offset + (count * header.elem_size))) < 0) {
+        saved_errno = errno;
+        LAC_LOG("Failed to size array file", LAC_ERROR);
+        close(fd);
+        errno = saved_errno;
+        return -1;
+    }
+
+    if (close(fd) < 0) {
+        saved_errno = errno;
+        LAC_LOG("Failed to close array file", LAC_ERROR);
+        errno = saved_errno;
+        return -1;
+    }
+
+    return lac_map_array_file(mapped, path, true);
+}
+
+/**
+ * @brief Maps an array file into memory.
+ * @anchor lac_map_array_file_anchor
+ * @since 19-10-2026
+ *
+ * The header is validated before returning, so the typed pointers returned by the
+ * lac_get_mapped_*_array functions can be used without further checks. The file
+ * descriptor is closed before returning; the mapping remains valid until
+ * lac_unmap_array_file() is called.
+ *
+ * @param[out] mapped The mapped array
+ * @param[in] path The path of the array file
+ * @param[in] writable If set to true, writes to the array are carried through to the file
+ * @returns 0 on success, otherwise -1 and errno is set
+ */
+LAC_DECL int lac_map_array_file(
+    LacMappedArray_t *mapped,
+    const char *path,
+    const bool writable
+) {
+    LacArrayFileHeader_t header;
+    struct stat st;
+    size_t length, elem_size;
+    void *base;
+    int fd, saved_errno;
+
+    memset(mapped, 0, sizeof(LacMappedArray_t));
+
+    fd = open(path, writable ? O_RDWR : O_RDONLY);
+    if (fd < 0) {
+        saved_errno = errno;
+        LAC_LOG("Failed to open array file", LAC_ERROR);
+        errno = saved_errno;
+        return -1;
+    }
+
+    if (fstat(fd, &st) < 0) {
+        saved_errno = errno;
+        LAC_LOG("Failed to stat array file", LAC_ERROR);
+        close(fd);
+        errno = saved_errno;
+        return -1;
+    }
+
+    length = (size_t)st.st_size;
+    if (length < sizeof(LacArrayFileHeader_t)) {
+        LAC_LOG("Array file is too small to contain a header", LAC_ERROR);
+        close(fd);
+        errno = EINVAL;
+        return -1;
+    }
+
+    base = mmap(NULL, length, writable ? (PROT_READ | PROT_WRITE) : PROT_READ, MAP_SHARED, fd, 0);
+    saved_errno = errno;
+    close(fd);
+    if (base == MAP_FAILED) {
+        LAC_LOG("Failed to map array file", LAC_ERROR);
+        errno = saved_errno;
+        return -1;
+    }
+
+    /* Validate the header before trusting any of its fields */
+    memcpy(&header, base, sizeof(header));
+    elem_size = lac_get_array_type_size((LacArrayType_t)header.type);
+
+    if (memcmp(header.magic, LAC_ARRAY_FILE_MAGIC, sizeof(header.magic)) != 0
+        || header.version != LAC_ARRAY_FILE_VERSION
+        || header.byte_order != LAC_ARRAY_FILE_BYTE_ORDER
+        || elem_size == 0
+        || header.elem_size != elem_size
+        || header.data_offset % LAC_ARRAY_FILE_ALIGN != 0
+        || header.data_offset > length
+        || header.count > (length - header.data_offset) / elem_size) {
+        LAC_LOG("Array file has an invalid or unsupported header", LAC_ERROR);
+        munmap(base, length);
+        errno = EINVAL;
+        return -1;
+    }
+
+    /* The batch kernels read the array from front to back */
+    posix_madvise(base, length, POSIX_MADV_SEQUENTIAL);
+
+    mapped->base = base;
+    mapped->length = length;
+    mapped->data = (uint8_t*)base + header.data_offset;
+    mapped->count = (size_t)header.count;
+    mapped->type = (LacArrayType_t)header.type;
+    mapped->writable = writable;
+
+    return 0;
+}
+
+/**
+ * @brief Unmaps an array file which was mapped by lac_map_array_file() or lac_create_array_file().
+ * @anchor lac_unmap_array_file_anchor
+ * @since 19-10-2026
+ * @param[out] mapped The mapped array, which is reset to all zeroes
+ */
+LAC_DECL void lac_unmap_array_file(LacMappedArray_t *mapped) {
+    if (mapped->base != NULL) {
+        if (mapped->writable && msync(mapped->base, mapped->length, MS_SYNC) < 0) {
+            LAC_LOG("Failed to flush array file", LAC_WARNING);
+        }
+        munmap(mapped->base, mapped->length);
+    }
+
+    memset(mapped, 0, sizeof(LacMappedArray_t));
+}
+
+/**
+ * @brief Gets the elements of a mapped array file as vectors of length 2.
+ * @since 19-10-2026
+ * @param[in] mapped The mapped array
+ * @returns The first element of the array, or NULL if the file does not hold vectors of length 2
+ */
+LAC_DECL vec2 *lac_get_mapped_vec2_array(const LacMappedArray_t *mapped) {
+    return (mapped->type == LAC_ARRAY_VEC2) ? (vec2*)mapped->data : NULL;
+}
+
+/**
+ * @brief Gets the elements of a mapped array file as vectors of length 3.
+ * @since 19-10-2026
+ * @param[in] mapped The mapped array
+ * @returns The first element of the array, or NULL if the file does not hold vectors of length 3
+ */
+LAC_DECL vec3 *lac_get_mapped_vec3_array(const LacMappedArray_t *mapped) {
+    return (mapped->type == LAC_ARRAY_VEC3) ? (vec3*)mapped->data : NULL;
+}
+
+/**
+ * @brief Gets the elements of a mapped array file as vectors of length 4.
+ * @since 19-10-2026
+ * @param[in] mapped The mapped array
+ * @returns The first element of the array, or NULL if the file does not hold vectors of length 4
+ */
+LAC_DECL vec4 *lac_get_mapped_vec4_array(const LacMappedArray_t *mapped) {
+    return (mapped->type == LAC_ARRAY_VEC4) ? (vec4*)mapped->data : NULL;
+}
+
+/**
+ * @brief Gets the elements of a mapped array file as 2x2 matrices.
+ * @since 19-10-2026
+ * @param[in] mapped The mapped array
+ * @returns The first element of the array, or NULL if the file does not hold 2x2 matrices
+ */
+LAC_DECL mat2 *lac_get_mapped_mat2_array(const LacMappedArray_t *mapped) {
+    return (mapped->type == LAC_ARRAY_MAT2) ? (mat2*)mapped->data : NULL;
+}
+
+/**
+ * @brief Gets the elements of a mapped array file as 3x3 matrices.
+ * @since 19-10-2026
+ * @param[in] mapped The mapped array
+ * @returns The first element of the array, or NULL if the file does not hold 3x3 matrices
+ */
+LAC_DECL mat3 *lac_get_mapped_mat3_array(const LacMappedArray_t *mapped) {
+    return (mapped->type == LAC_ARRAY_MAT3) ? (mat3*)mapped->data : NULL;
+}
+
+/**
+ * @brief Gets the elements of a mapped array file as 4x4 matrices.
+ * @since 19-10-2026
+ * @param[in] mapped The mapped array
+ * @returns The first element of the array, or NULL if the file does not hold 4x4 matrices
+ */
+LAC_DECL mat4 *lac_get_mapped_mat4_array(const LacMappedArray_t *mapped) {
+    return (mapped->type == LAC_ARRAY_MAT4) ? (mat4*)mapped->data : NULL;
+}
@@ -41,6 +41,68 @@
  */
 
 #include "matmath.h"
+#include "lac_simd.h"
+#include "lac_dispatch.h"
+
+/**
+ * @brief Adds or subtracts two arrays of __count__ floats, 4 at a time, and any that are left over one by one.
+ * @since 19-10-2026
+ * @param[out] m_out The result
+ * @param[in] m_a The left-hand operand
+ * @param[in] m_b The right-hand operand
+ * @param[in] count The number of floats
+ * @param[in] subtract If set to true, __m_b__ is subtracted from __m_a__ instead of added to it
+ */
+static inline void _lac_add_elements(float *m_out, const float *m_a, const float *m_b, const size_t count, const bool subtract) {
+    lac_f32x4 a, b;
+    size_t i;
+
+    for (i = 0; (i + 4) <= count; i += 4) {
+        a = lac_simd_load_f32x4(&m_a[i], 4);
+        b = lac_simd_load_f32x4(&m_b[i], 4);
+        lac_simd_store_f32x4(&m_out[i], subtract ? lac_simd_sub_f32x4(a, b) : lac_simd_add_f32x4(a, b), 4);
+    }
+    for (i = count - (count % 4); i < count; ++i) {
+        m_out[i] = subtract ? (m_a[i] - m_b[i]) : (m_a[i] + m_b[i]);
+    }
+}
+
+/**
+ * @brief Multiplies two __n__x__n__ matrices (2 <= n <= 4) stored as rows, so that out[r] = sum of m_a[r][k] * m_b[k].
+ * @since 19-10-2026
+ *
+ * Each output row is built as a sum of the rows of __m_b__, scaled by the elements of the
+ * matching row of __m_a__. In column-major order, the same routine computes the product
+ * when called with the operands swapped, since each output column is a sum of the columns
+ * of the left-hand matrix scaled by the elements of a column of the right-hand matrix.
+ *
+ * Every row of __m_b__ is loaded before anything is stored, and each row of __m_a__ is read
+ * before the same row of the product is written, so __m_out__ may be either operand.
+ *
+ * @param[out] m_out The product matrix
+ * @param[in] m_a The matrix whose elements scale the rows of __m_b__
+ * @param[in] m_b The matrix whose rows are summed
+ * @param[in] n The number of rows and columns
+ */
+static inline void _lac_multiply_rows(float *m_out, const float *m_a, const float *m_b, const size_t n) {
+    lac_f32x4 rows[4], row;
+    size_t r, k;
+
+    /*
+     * Any row with 4 floats left behind it is loaded whole, since its extra lane, which holds
+     * the first element of the next row, only ever reaches a lane that is not stored
+     */
+    for (k = 0; k < n; ++k) {
+        rows[k] = lac_simd_load_f32x4(&m_b[k * n], ((k * n) + 4 <= n * n) ? 4 : n);
+    }
+    for (r = 0; r < n; ++r) {
+        row = lac_simd_mul_f32x4(lac_simd_splat_f32x4(m_a[r * n]), rows[0]);
+        for (k = 1; k < n; ++k) {
+            row = lac_simd_madd_f32x4(lac_simd_splat_f32x4(m_a[(r * n) + k]), rows[k], row);
+        }
+        lac_simd_store_f32x4(&m_out[r * n], row, n);
+    }
+}
 
 /**
  * @brief Adds two 2x2 matrices.
@@ -50,11 +112,7 @@
  * @param[in] m_b The addend matrix
  */
 LAC_DECL void lac_add_mat2(mat2 m_out, const mat2 m_a, const mat2 m_b) {
-    m_out[0] = m_a[0] + m_b[0];
-    m_out[1] = m_a[1] + m_b[1];
-
-    m_out[2] = m_a[2] + m_b[2];
-    m_out[3] = m_a[3] + m_b[3];
+    _lac_add_elements(m_out, m_a, m_b, 4, false);
 }
 
 /**
@@ -65,17 +123,7 @@ LAC_DECL void lac_add_mat2(mat2 m_out, const mat2 m_a, const mat2 m_b) {
  * @param[in] m_b The addend matrix
  */
 LAC_DECL void lac_add_mat3(mat3 m_out, const mat3 m_a, const mat3 m_b) {
-    m_out[0] = m_a[0] + m_b[0];
-    m_out[1] = m_a[1] + m_b[1];
-    m_out[2] = m_a[2] + m_b[2];
-
-    m_out[3] = m_a[3] + m_b[3];
-    m_out[4] = m_a[4] + m_b[4];
-    m_out[5] = m_a[5] + m_b[5];
-
-    m_out[6] = m_a[6] + m_b[6];
-    m_out[7] = m_a[7] + m_b[7];
-    m_out[8] = m_a[8] + m_b[8];
+    _lac_add_elements(m_out, m_a, m_b, 9, false);
 }
 
 /**
@@ -86,25 +134,7 @@ LAC_DECL void lac_add_mat3(mat3 m_out, const mat3 m_a, const mat3 m_b) {
  * @param[in] m_b The addend matrix
  */
 LAC_DECL void lac_add_mat4(mat4 m_out, const mat4 m_a, const mat4 m_b) {
-    m_out[0]  = m_a[0]  + m_b[0];
-    m_out[1]  = m_a[1]  + m_b[1];
-    m_out[2]  = m_a[2]  + m_b[2];
-    m_out[3]  = m_a[3]  + m_b[3];
-
-    m_out[4]  = m_a[4]  + m_b[4];
-    m_out[5]  = m_a[5]  + m_b[5];
-    m_out[6]  = m_a[6]  + m_b[6];
-    m_out[7]  = m_a[7]  + m_b[7];
-
-    m_out[8]  = m_a[8]  + m_b[8];
-    m_out[9]  = m_a[9]  + m_b[9];
-    m_out[10] = m_a[10] + m_b[10];
-    m_out[11] = m_a[11] + m_b[11];
-
-    m_out[12] = m_a[12] + m_b[12];
-    m_out[13] = m_a[13] + m_b[13];
-    m_out[14] = m_a[14] + m_b[14];
-    m_out[15] = m_a[15] + m_b[15];
+    _lac_add_elements(m_out, m_a, m_b, 16, false);
 }
 
 /**
@@ -115,11 +145,7 @@ LAC_DECL void lac_add_mat4(mat4 m_out, const mat4 m_a, const mat4 m_b) {
  * @param[in] m_b The subtrahend matrix
  */
 LAC_DECL void lac_subtract_mat2(mat2 m_out, const mat2 m_a, const mat2 m_b) {
-    m_out[0] = m_a[0] - m_b[0];
-    m_out[1] = m_a[1] - m_b[1];
-
-    m_out[2] = m_a[2] - m_b[2];
-    m_out[3] = m_a[3] - m_b[3];
+    _lac_add_elements(m_out, m_a, m_b, 4, true);
 }
 
 /**
@@ -130,17 +156,7 @@ LAC_DECL void lac_subtract_mat2(mat2 m_out, const mat2 m_a, const mat2 m_b) {
  * @param[in] m_b The subtrahend matrix
  */
 LAC_DECL void lac_subtract_mat3(mat3 m_out, const mat3 m_a, const mat3 m_b) {
-    m_out[0] = m_a[0] - m_b[0];
-    m_out[1] = m_a[1] - m_b[1];
-    m_out[2] = m_a[2] - m_b[2];
-
-    m_out[3] = m_a[3] - m_b[3];
-    m_out[4] = m_a[4] - m_b[4];
-    m_out[5] = m_a[5] - m_b[5];
-
-    m_out[6] = m_a[6] - m_b[6];
-    m_out[7] = m_a[7] - m_b[7];
-    m_out[8] = m_a[8] - m_b[8];
+    _lac_add_elements(m_out, m_a, m_b, 9, true);
 }
 
 /**
@@ -151,25 +167,7 @@ LAC_DECL void lac_subtract_mat3(mat3 m_out, const mat3 m_a, const mat3 m_b) {
  * @param[in] m_b The subtrahend matrix
  */
 LAC_DECL void lac_subtract_mat4(mat4 m_out, const mat4 m_a, const mat4 m_b) {
-    m_out[0]  = m_a[0]  - m_b[0];
-    m_out[1]  = m_a[1]  - m_b[1];
-    m_out[2]  = m_a[2]  - m_b[2];
-    m_out[3]  = m_a[3]  - m_b[3];
-
-    m_out[4]  = m_a[4]  - m_b[4];
-    m_out[5]  = m_a[5]  - m_b[5];
-    m_out[6]  = m_a[6]  - m_b[6];
-    m_out[7]  = m_a[7]  - m_b[7];
-
-    m_out[8]  = m_a[8]  - m_b[8];
-    m_out[9]  = m_a[9]  - m_b[9];
-    m_out[10] = m_a[10] - m_b[10];
-    m_out[11] = m_a[11] - m_b[11];
-
-    m_out[12] = m_a[12] - m_b[12];
-    m_out[13] = m_a[13] - m_b[13];
-    m_out[14] = m_a[14] - m_b[14];
-    m_out[15] = m_a[15] - m_b[15];
+    _lac_add_elements(m_out, m_a, m_b, 16, true);
 }
 
 /**
@@ -181,23 +179,11 @@ LAC_DECL void lac_subtract_mat4(mat4 m_out, const mat4 m_a, const mat4 m_b) {
  * @param[in] m_b The multiplier matrix
  */
 LAC_DECL void lac_multiply_mat2(mat2 m_out, const mat2 m_a, const mat2 m_b) {
-    mat2 _m_out = { 0 };
-
 #if LAC_IS_ROW_MAJOR
-    _m_out[0] = (m_a[0] * m_b[0]) + (m_a[1] * m_b[2]);
-    _m_out[1] = (m_a[0] * m_b[1]) + (m_a[1] * m_b[3]);
-
-    _m_out[2] = (m_a[2] * m_b[0]) + (m_a[3] * m_b[2]);
-    _m_out[3] = (m_a[2] * m_b[1]) + (m_a[3] * m_b[3]);
+    _lac_multiply_rows(m_out, m_a, m_b, 2);
 #else
-    _m_out[0] = (m_a[0] * m_b[0]) + (m_a[2] * m_b[1]);
-    _m_out[2] = (m_a[0] * m_b[2]) + (m_a[2] * m_b[3]);
-
-    _m_out[1] = (m_a[1] * m_b[0]) + (m_a[3] * m_b[1]);
-    _m_out[3] = (m_a[1] * m_b[2]) + (m_a[3] * m_b[3]);
+    _lac_multiply_rows(m_out, m_b, m_a, 2);
 #endif
-
-    memcpy(m_out, _m_out, sizeof(mat2));
 }
 
 /**
@@ -209,35 +195,23 @@ LAC_DECL void lac_multiply_mat2(mat2 m_out, const mat2 m_a, const mat2 m_b) {
  * @param[in] m_b The multiplier matrix
  */
 LAC_DECL void lac_multiply_mat3(mat3 m_out, const mat3 m_a, const mat3 m_b) {
-    mat3 _m_out = { 0 };
-
 #if LAC_IS_ROW_MAJOR
-    _m_out[0] = (m_a[0] * m_b[0]) + (m_a[1] * m_b[3]) + (m_a[2] * m_b[6]);
-    _m_out[1] = (m_a[0] * m_b[1]) + (m_a[1] * m_b[4]) + (m_a[2] * m_b[7]);
-    _m_out[2] = (m_a[0] * m_b[2]) + (m_a[1] * m_b[5]) + (m_a[2] * m_b[8]);
-
-    _m_out[3] = (m_a[3] * m_b[0]) + (m_a[4] * m_b[3]) + (m_a[5] * m_b[6]);
-    _m_out[4] = (m_a[3] * m_b[1]) + (m_a[4] * m_b[4]) + (m_a[5] * m_b[7]);
-    _m_out[5] = (m_a[3] * m_b[2]) + (m_a[4] * m_b[5]) + (m_a[5] * m_b[8]);
-
-    _m_out[6] = (m_a[6] * m_b[0]) + (m_a[7] * m_b[3]) + (m_a[8] * m_b[6]);
-    _m_out[7] = (m_a[6] * m_b[1]) + (m_a[7] * m_b[4]) + (m_a[8] * m_b[7]);
-    _m_out[8] = (m_a[6] * m_b[2]) + (m_a[7] * m_b[5]) + (m_a[8] * m_b[8]);
+    _lac_multiply_rows(m_out, m_a, m_b, 3);
 #else
-    _m_out[0] = (m_a[0] * m_b[0]) + (m_a[3] * m_b[1]) + (m_a[6] * m_b[2]);
-    _m_out[3] = (m_a[0] * m_b[3]) + (m_a[3] * m_b[4]) + (m_a[6] * m_b[5]);
-    _m_out[6] = (m_a[0] * m_b[6]) + (m_a[3] * m_b[7]) + (m_a[6] * m_b[8]);
-
-    _m_out[1] = (m_a[1] * m_b[0]) + (m_a[4] * m_b[1]) + (m_a[7] * m_b[2]);
-    _m_out[4] = (m_a[1] * m_b[3]) + (m_a[4] * m_b[4]) + (m_a[7] * m_b[5]);
-    _m_out[7] = (m_a[1] * m_b[6]) + (m_a[4] * m_b[7]) + (m_a[7] * m_b[8]);
-
-    _m_out[2] = (m_a[2] * m_b[0]) + (m_a[5] * m_b[1]) + (m_a[8] * m_b[2]);
-    _m_out[5] = (m_a[2] * m_b[3]) + (m_a[5] * m_b[4]) + (m_a[8] * m_b[5]);
-    _m_out[8] = (m_a[2] * m_b[6]) + (m_a[5] * m_b[7]) + (m_a[8] * m_b[8]);
+    _lac_multiply_rows(m_out, m_b, m_a, 3);
 #endif
+}
 
-    memcpy(m_out, _m_out, sizeof(mat3));
+/**
+ * @brief Body of lac_multiply_mat4(), instantiated for each ISA level by LAC_MULTIVERSION().
+ * @since 19-10-2026
+ */
+static LAC_ALWAYS_INLINE void _lac_multiply_mat4(mat4 m_out, const mat4 m_a, const mat4 m_b) {
+#if LAC_IS_ROW_MAJOR
+    _lac_multiply_rows(m_out, m_a, m_b, 4);
+#else
+    _lac_multiply_rows(m_out, m_b, m_a, 4);
+#endif
 }
 
 /**
@@ -248,53 +222,7 @@ LAC_DECL void lac_multiply_mat3(mat3 m_out, const mat3 m_a, const mat3 m_b) {
  * @param[in] m_a The multiplicand matrix
  * @param[in] m_b The multiplier matrix
  */
-LAC_DECL void lac_multiply_mat4(mat4 m_out, const mat4 m_a, const mat4 m_b) {
-    mat4 _m_out = { 0 };
-
-#if LAC_IS_ROW_MAJOR
-    _m_out[0]  = (m_a[0] * m_b[0])  + (m_a[1] * m_b[4])  + (m_a[2] * m_b[8])   + (m_a[3] * m_b[12]);
-    _m_out[1]  = (m_a[0] * m_b[1])  + (m_a[1] * m_b[5])  + (m_a[2] * m_b[9])   + (m_a[3] * m_b[13]);
-    _m_out[2]  = (m_a[0] * m_b[2])  + (m_a[1] * m_b[6])  + (m_a[2] * m_b[10])  + (m_a[3] * m_b[14]);
-    _m_out[3]  = (m_a[0] * m_b[3])  + (m_a[1] * m_b[7])  + (m_a[2] * m_b[11])  + (m_a[3] * m_b[15]);
-
-    _m_out[4]  = (m_a[4] * m_b[0])  + (m_a[5] * m_b[4])  + (m_a[6] * m_b[8])   + (m_a[7] * m_b[12]);
-    _m_out[5]  = (m_a[4] * m_b[1])  + (m_a[5] * m_b[5])  + (m_a[6] * m_b[9])   + (m_a[7] * m_b[13]);
-    _m_out[6]  = (m_a[4] * m_b[2])  + (m_a[5] * m_b[6])  + (m_a[6] * m_b[10])  + (m_a[7] * m_b[14]);
-    _m_out[7]  = (m_a[4] * m_b[3])  + (m_a[5] * m_b[7])  + (m_a[6] * m_b[11])  + (m_a[7] * m_b[15]);
-
-    _m_out[8]  = (m_a[8] * m_b[0])  + (m_a[9] * m_b[4])  + (m_a[10] * m_b[8])  + (m_a[11] * m_b[12]);
-    _m_out[9]  = (m_a[8] * m_b[1])  + (m_a[9] * m_b[5])  + (m_a[10] * m_b[9])  + (m_a[11] * m_b[13]);
-    _m_out[10] = (m_a[8] * m_b[2])  + (m_a[9] * m_b[6])  + (m_a[10] * m_b[10]) + (m_a[11] * m_b[14]);
-    _m_out[11] = (m_a[8] * m_b[3])  + (m_a[9] * m_b[7])  + (m_a[10] * m_b[11]) + (m_a[11] * m_b[15]);
-
-    _m_out[12] = (m_a[12] * m_b[0]) + (m_a[13] * m_b[4]) + (m_a[14] * m_b[8])  + (m_a[15] * m_b[12]);
-    _m_out[13] = (m_a[12] * m_b[1]) + (m_a[13] * m_b[5]) + (m_a[14] * m_b[9])  + (m_a[15] * m_b[13]);
-    _m_out[14] = (m_a[12] * m_b[2]) + (m_a[13] * m_b[6]) + (m_a[14] * m_b[10]) + (m_a[15] * m_b[14]);
-    _m_out[15] = (m_a[12] * m_b[3]) + (m_a[13] * m_b[7]) + (m_a[14] * m_b[11]) + (m_a[15] * m_b[15]);
-#else
-    _m_out[0]  = (m_a[0] * m_b[0])  + (m_a[4] * m_b[1])  + (m_a[8] * m_b[2])   + (m_a[12] * m_b[3]);
-    _m_out[4]  = (m_a[0] * m_b[4])  + (m_a[4] * m_b[5])  + (m_a[8] * m_b[6])   + (m_a[12] * m_b[7]);
-    _m_out[8]  = (m_a[0] * m_b[8])  + (m_a[4] * m_b[9])  + (m_a[8] * m_b[10])  + (m_a[12] * m_b[11]);
-    _m_out[12] = (m_a[0] * m_b[12]) + (m_a[4] * m_b[13]) + (m_a[8] * m_b[14])  + (m_a[12] * m_b[15]);
-
-    _m_out[1]  = (m_a[1] * m_b[0])  + (m_a[5] * m_b[1])  + (m_a[9] * m_b[2])   + (m_a[13] * m_b[3]);
-    _m_out[5]  = (m_a[1] * m_b[4])  + (m_a[5] * m_b[5])  + (m_a[9] * m_b[6])   + (m_a[13] * m_b[7]);
-    _m_out[9]  = (m_a[1] * m_b[8])  + (m_a[5] * m_b[9])  + (m_a[9] * m_b[10])  + (m_a[13] * m_b[11]);
-    _m_out[13] = (m_a[1] * m_b[12]) + (m_a[5] * m_b[13]) + (m_a[9] * m_b[14])  + (m_a[13] * m_b[15]);
-
-    _m_out[2]  = (m_a[2] * m_b[0])  + (m_a[6] * m_b[1])  + (m_a[10] * m_b[2])  + (m_a[14] * m_b[3]);
-    _m_out[6]  = (m_a[2] * m_b[4])  + (m_a[6] * m_b[5])  + (m_a[10] * m_b[6])  + (m_a[14] * m_b[7]);
-    _m_out[10] = (m_a[2] * m_b[8])  + (m_a[6] * m_b[9])  + (m_a[10] * m_b[10]) + (m_a[14] * m_b[11]);
-    _m_out[14] = (m_a[2] * m_b[12]) + (m_a[6] * m_b[13]) + (m_a[10] * m_b[14]) + (m_a[14] * m_b[15]);
-
-    _m_out[3]  = (m_a[3] * m_b[0])  + (m_a[7] * m_b[1])  + (m_a[11] * m_b[2])  + (m_a[15] * m_b[3]);
-    _m_out[7]  = (m_a[3] * m_b[4])  + (m_a[7] * m_b[5])  + (m_a[11] * m_b[6])  + (m_a[15] * m_b[7]);
-    _m_out[11] = (m_a[3] * m_b[8])  + (m_a[7] * m_b[9])  + (m_a[11] * m_b[10]) + (m_a[15] * m_b[11]);
-    _m_out[15] = (m_a[3] * m_b[12]) + (m_a[7] * m_b[13]) + (m_a[11] * m_b[14]) + (m_a[15] * m_b[15]);
-#endif
-
-    memcpy(m_out, _m_out, sizeof(mat4));
-}
+LAC_MULTIVERSION(lac_multiply_mat4, (mat4 m_out, const mat4 m_a, const mat4 m_b), (m_out, m_a, m_b))
 
 /**
  * @brief Transpose a 2x2 matrix.
@@ -0,0 +1,457 @@
+/**
+ * @file plane.c
+ * @author Neil Kingdom
+ * @since 19-10-2026
+ * @version 1.0
+ * @brief Contains functions for building planes and measuring points against them.
+ *
+ * @section plane Planes
+ *
+ * A plane is stored as a unit normal n and an offset d, such that a point
+ * p lies on the plane exactly when dot(n, p) + d = 0. For any other point,
+ * dot(n, p) + d is the signed distance from the plane to the point, which
+ * is positive on the side that the normal points towards (the front) and
+ * negative behind it. Given a point p0 on the plane, d is simply
+ * -dot(n, p0). When a plane is built from the corners of a triangle, the
+ * normal follows the winding order, i.e. the corners appear anticlockwise
+ * when the triangle is viewed from the front.
+ *
+ * Transforming a plane by a matrix M is not the same as transforming its
+ * normal like a direction. Normals must stay perpendicular to the plane,
+ * which requires the inverse transpose of M. Rather than inverting the
+ * whole matrix, lac_transform_plane() uses the cofactor matrix of the upper
+ * 3x3 block, which equals the inverse transpose scaled by the determinant.
+ * The scale disappears when the normal is renormalized, and the sign of
+ * the determinant keeps the front facing the right way under reflections.
+ *
+ * @subsection plane_related Related Functions
+ *
+ * - @ref lac_init_plane_anchor "lac_init_plane"
+ * - @ref lac_init_plane_from_points_anchor "lac_init_plane_from_points"
+ * - @ref lac_transform_plane_anchor "lac_transform_plane"
+ *
+ * @section planebatch Batch Plane Queries
+ *
+ * Clipping a mesh, projecting a decal or resolving a collision means
+ * measuring thousands of points against the same plane. Since the distance
+ * is a single multiply-add per component, the cost is dominated by getting
+ * the points into registers. The batch kernels take the points in SoA
+ * layout (see LacSoaVec3_t), where the x, y and z components each live in
+ * their own array, so each 8-wide vector is a single contiguous load with
+ * no transposing. lac_classify_plane_soa() packs the side of each point
+ * into bitmasks, with one bit per point, so that a clipper can skip whole
+ * bytes of points which all lie on the same side.
+ *
+ * @subsection planebatch_related Related Functions
+ *
+ * - @ref lac_calc_plane_distance_soa_anchor "lac_calc_plane_distance_soa"
+ * - @ref lac_classify_plane_soa_anchor "lac_classify_plane_soa"
+ * - @ref lac_project_plane_soa_anchor "lac_project_plane_soa"
+ */
+
+#include <math.h>
+
+#include "plane.h"
+#include "lac_simd.h"
+#include "lac_dispatch.h"
+
+/**
+ * @brief Gets the element at row r, column c of a 4x4 matrix.
+ * @since 19-10-2026
+ * @param[in] m_in The matrix
+ * @param[in] r The row
+ * @param[in] c The column
+ * @returns The element
+ */
+static inline float _lac_get_mat4_element(const mat4 m_in, const size_t r, const size_t c) {
+#if LAC_IS_ROW_MAJOR
+    return m_in[(r * 4) + c];
+#else
+    return m_in[(c * 4) + r];
+#endif
+}
+
+/**
+ * @brief Scales a plane to a unit normal.
+ * @since 19-10-2026
+ * @param[out] out The normalized plane (may be the same as __plane__); zeroed if the normal is zero
+ * @param[in] plane The plane to be normalized
+ * @returns True if the plane was normalized, or false if its normal is zero
+ */
+LAC_DECL bool lac_normalize_plane(LacPlane_t *out, const LacPlane_t *plane) {
+    const float *n = plane->normal;
+    float length = sqrtf((n[0] * n[0]) + (n[1] * n[1]) + (n[2] * n[2])), inv_length;
+
+    if (length == 0.0f) {
+        memset(out, 0, sizeof(LacPlane_t));
+        return false;
+    }
+
+    inv_length = 1.0f / length;
+    out->normal[0] = n[0] * inv_length;
+    out->normal[1] = n[1] * inv_length;
+    out->normal[2] = n[2] * inv_length;
+    out->d = plane->d * inv_length;
+    return true;
+}
+
+/**
+ * @brief Initializes the plane through a point with a given normal.
+ * @anchor lac_init_plane_anchor
+ * @since 19-10-2026
+ * @param[out] plane The plane to be initialized; zeroed if __v_normal__ is zero
+ * @param[in] v_point Any point on the plane
+ * @param[in] v_normal The direction that the front of the plane faces, which need not be unit length
+ * @returns True if the plane was initialized, or false if __v_normal__ is zero
+ */
+LAC_DECL bool lac_init_plane(LacPlane_t *plane, const vec3 v_point, const vec3 v_normal) {
+    plane->normal[0] = v_normal[0];
+    plane->normal[1] = v_normal[1];
+    plane->normal[2] = v_normal[2];
+    plane->d = -((v_normal[0] * v_point[0]) + (v_normal[1] * v_point[1]) + (v_normal[2] * v_point[2]));
+    return lac_normalize_plane(plane, plane);
+}
+
+/**
+ * @brief Initializes the plane through three points.
+ * @anchor lac_init_plane_from_points_anchor
+ * @since 19-10-2026
+ * @param[out] plane The plane to be initialized; zeroed if the points are collinear
+ * @param[in] v_a The first point
+ * @param[in] v_b The second point
+ * @param[in] v_c The third point; the points appear anticlockwise when viewed from the front
+ * @returns True if the plane was initialized, or false if the points are collinear
+ */
+LAC_DECL bool lac_init_plane_from_points(LacPlane_t *plane, const vec3 v_a, const vec3 v_b, const vec3 v_c) {
+    vec3 v_normal;
+    float ab[3], ac[3];
+    size_t c;
+
+    for (c = 0; c < 3; ++c) {
+        ab[c] = v_b[c] - v_a[c];
+        ac[c] = v_c[c] - v_a[c];
+    }
+    v_normal[0] = (ab[1] * ac[2]) - (ab[2] * ac[1]);
+    v_normal[1] = (ab[2] * ac[0]) - (ab[0] * ac[2]);
+    v_normal[2] = (ab[0] * ac[1]) - (ab[1] * ac[0]);
+
+    return lac_init_plane(plane, v_a, v_normal);
+}
+
+/**
+ * @brief Transforms a plane, such that the points on the transformed plane are the transformed points of the original.
+ * @anchor lac_transform_plane_anchor
+ * @since 19-10-2026
+ *
+ * The matrix is treated as an affine transform, i.e. its bottom row is assumed to be
+ * (0, 0, 0, 1), and must be invertible.
+ *
+ * @param[out] out The transformed plane, which is normalized (may be the same as __plane__)
+ * @param[in] plane The plane to be transformed
+ * @param[in] m_in The transformation matrix
+ */
+LAC_DECL void lac_transform_plane(LacPlane_t *out, const LacPlane_t *plane, const mat4 m_in) {
+    float m[3][3], cofactor[3][3], point[3], normal[3], det, length_sq, scale;
+    size_t r, c;
+
+    for (r = 0; r < 3; ++r) {
+        for (c = 0; c < 3; ++c) {
+            m[r][c] = _lac_get_mat4_element(m_in, r, c);
+        }
+    }
+    for (r = 0; r < 3; ++r) {
+        for (c = 0; c < 3; ++c) {
+            cofactor[r][c] = (m[(r + 1) % 3][(c + 1) % 3] * m[(r + 2) % 3][(c + 2) % 3]) -
+                             (m[(r + 1) % 3][(c + 2) % 3] * m[(r + 2) % 3][(c + 1) % 3]);
+        }
+    }
+    det = (m[0][0] * cofactor[0][0]) + (m[0][1] * cofactor[0][1]) + (m[0][2] * cofactor[0][2]);
+
+    /* The point on the plane nearest the origin, carried through the matrix */
+    length_sq = (plane->normal[0] * plane->normal[0]) + (plane->normal[1] * plane->normal[1]) +
+                (plane->normal[2] * plane->normal[2]);
+    scale = (length_sq != 0.0f) ? (-plane->d / length_sq) : 0.0f;
+    for (r = 0; r < 3; ++r) {
+        point[r] = _lac_get_mat4_element(m_in, r, 3);
+        for (c = 0; c < 3; ++c) {
+            point[r] += m[r][c] * plane->normal[c] * scale;
+        }
+    }
+
+    for (r = 0; r < 3; ++r) {
+        normal[r] = 0.0f;
+        for (c = 0; c < 3; ++c) {
+            normal[r] += cofactor[r][c] * plane->normal[c];
+        }
+        normal[r] = (det < 0.0f) ? -normal[r] : normal[r];
+    }
+
+    lac_init_plane(out, point, normal);
+}
+
+/**
+ * @brief Gets the signed distance from a plane to a point.
+ * @since 19-10-2026
+ * @param[out] distance The distance, which is positive in front of the plane and negative behind it
+ * @param[in] plane The plane, which must be normalized for __distance__ to be a true distance
+ * @param[in] v_point The point
+ */
+LAC_DECL void lac_calc_plane_distance(float *distance, const LacPlane_t *plane, const vec3 v_point) {
+    *distance = (plane->normal[0] * v_point[0]) + (plane->normal[1] * v_point[1]) +
+                (plane->normal[2] * v_point[2]) + plane->d;
+}
+
+/**
+ * @brief Gets the signed distances of exactly LAC_BATCH_BLOCK points from a plane.
+ * @since 19-10-2026
+ * @param[out] distances The distances
+ * @param[in] x The x components of the points
+ * @param[in] y The y components of the points
+ * @param[in] z The z components of the points
+ * @param[in] plane The plane
+ */
+static LAC_VARIANT_INLINE void _lac_calc_plane_distance_block(
+    float *distances,
+    const float *x,
+    const float *y,
+    const float *z,
+    const LacPlane_t *plane
+) {
+    lac_f32x8 dist = lac_simd_splat_f32x8(plane->d);
+
+    dist = lac_simd_madd_f32x8(lac_simd_splat_f32x8(plane->normal[0]), lac_simd_load_f32x8(x), dist);
+    dist = lac_simd_madd_f32x8(lac_simd_splat_f32x8(plane->normal[1]), lac_simd_load_f32x8(y), dist);
+    dist = lac_simd_madd_f32x8(lac_simd_splat_f32x8(plane->normal[2]), lac_simd_load_f32x8(z), dist);
+    lac_simd_store_f32x8(distances, dist);
+}
+
+/**
+ * @brief Sorts exactly LAC_BATCH_BLOCK points into those in front of and behind a plane.
+ * @since 19-10-2026
+ * @param[out] front A bit for each point further than __epsilon__ in front of the plane
+ * @param[out] back A bit for each point further than __epsilon__ behind the plane
+ * @param[in] x The x components of the points
+ * @param[in] y The y components of the points
+ * @param[in] z The z components of the points
+ * @param[in] plane The plane
+ * @param[in] epsilon The distance within which a point counts as on the plane
+ */
+static LAC_VARIANT_INLINE void _lac_classify_plane_block(
+    unsigned *front,
+    unsigned *back,
+    const float *x,
+    const float *y,
+    const float *z,
+    const LacPlane_t *plane,
+    const float epsilon
+) {
+    float distances[LAC_BATCH_BLOCK];
+    lac_f32x8 dist;
+
+    _lac_calc_plane_distance_block(distances, x, y, z, plane);
+    dist = lac_simd_load_f32x8(distances);
+    *front = lac_simd_bits_i32x8(lac_simd_lt_f32x8(lac_simd_splat_f32x8(epsilon), dist));
+    *back = lac_simd_bits_i32x8(lac_simd_lt_f32x8(dist, lac_simd_splat_f32x8(-epsilon)));
+}
+
+/**
+ * @brief Moves exactly LAC_BATCH_BLOCK points onto a plane, along its normal.
+ * @since 19-10-2026
+ * @param[out] out_x The x components of the projected points
+ * @param[out] out_y The y components of the projected points
+ * @param[out] out_z The z components of the projected points
+ * @param[in] x The x components of the points
+ * @param[in] y The y components of the points
+ * @param[in] z The z components of the points
+ * @param[in] plane The plane
+ */
+static LAC_VARIANT_INLINE void _lac_project_plane_block(
+    float *out_x,
+    float *out_y,
+    float *out_z,
+    const float *x,
+    const float *y,
+    const float *z,
+    const LacPlane_t *plane
+) {
+    float distances[LAC_BATCH_BLOCK];
+    lac_f32x8 dist;
+
+    _lac_calc_plane_distance_block(distances, x, y, z, plane);
+    dist = lac_simd_load_f32x8(distances);
+    lac_simd_store_f32x8(out_x, lac_simd_sub_f32x8(lac_simd_load_f32x8(x), lac_simd_mul_f32x8(lac_simd_splat_f32x8(plane->normal[0]), dist)));
+    lac_simd_store_f32x8(out_y, lac_simd_sub_f32x8(lac_simd_load_f32x8(y), lac_simd_mul_f32x8(lac_simd_splat_f32x8(plane->normal[1]), dist)));
+    lac_simd_store_f32x8(out_z, lac_simd_sub_f32x8(lac_simd_load_f32x8(z), lac_simd_mul_f32x8(lac_simd_splat_f32x8(plane->normal[2]), dist)));
+}
+
+/**
+ * @brief Body of lac_calc_plane_distance_soa(), instantiated for each ISA level by LAC_MULTIVERSION().
+ * @since 19-10-2026
+ */
+static LAC_ALWAYS_INLINE void _lac_calc_plane_distance_soa(
+    float *distances,
+    const LacSoaVec3_t *points,
+    const LacPlane_t *plane,
+    const size_t count
+) {
+    float tail[4][LAC_BATCH_BLOCK] = { { 0 } };
+    size_t i, remaining;
+
+    for (i = 0; i + LAC_BATCH_BLOCK <= count; i += LAC_BATCH_BLOCK) {
+        _lac_calc_plane_distance_block(&distances[i], &points->x[i], &points->y[i], &points->z[i], plane);
+    }
+
+    /* Pad the final partial block so that it can share the same code path */
+    remaining = count - i;
+    if (remaining > 0) {
+        memcpy(tail[0], &points->x[i], remaining * sizeof(float));
+        memcpy(tail[1], &points->y[i], remaining * sizeof(float));
+        memcpy(tail[2], &points->z[i], remaining * sizeof(float));
+        _lac_calc_plane_distance_block(tail[3], tail[0], tail[1], tail[2], plane);
+        memcpy(&distances[i], tail[3], remaining * sizeof(float));
+    }
+}
+
+/**
+ * @brief Gets the signed distance from a plane to each point in an SoA array.
+ * @anchor lac_calc_plane_distance_soa_anchor
+ * @since 19-10-2026
+ * @param[out] distances The distance to each point, which is positive in front of the plane and negative behind it
+ * @param[in] points The points
+ * @param[in] plane The plane, which must be normalized for __distances__ to be true distances
+ * @param[in] count The number of points in __points__ and __distances__
+ */
+LAC_MULTIVERSION(lac_calc_plane_distance_soa, (
+    float *distances,
+    const LacSoaVec3_t *points,
+    const LacPlane_t *plane,
+    const size_t count
+), (distances, points, plane, count))
+
+/**
+ * @brief Body of lac_classify_plane_soa(), instantiated for each ISA level by LAC_MULTIVERSION_RETURN().
+ * @since 19-10-2026
+ */
+static LAC_ALWAYS_INLINE uint8_t _lac_classify_plane_soa(
+    uint8_t *front,
+    uint8_t *back,
+    uint8_t *on,
+    const LacSoaVec3_t *points,
+    const LacPlane_t *plane,
+    const float epsilon,
+    const size_t count
+) {
+    float tail[3][LAC_BATCH_BLOCK] = { { 0 } };
+    unsigned front_bits, back_bits, on_bits, valid, sides = 0;
+    size_t i, remaining;
+
+    for (i = 0; i < count; i += LAC_BATCH_BLOCK) {
+        remaining = count - i;
+        if (remaining >= LAC_BATCH_BLOCK) {
+            _lac_classify_plane_block(&front_bits, &back_bits, &points->x[i], &points->y[i], &points->z[i], plane, epsilon);
+            valid = 0xffu;
+        } else {
+            /* Pad the final partial block, and leave the padding out of every mask */
+            memcpy(tail[0], &points->x[i], remaining * sizeof(float));
+            memcpy(tail[1], &points->y[i], remaining * sizeof(float));
+            memcpy(tail[2], &points->z[i], remaining * sizeof(float));
+            _lac_classify_plane_block(&front_bits, &back_bits, tail[0], tail[1], tail[2], plane, epsilon);
+            valid = (1u << remaining) - 1u;
+        }
+
+        front_bits &= valid;
+        back_bits &= valid;
+        on_bits = valid & ~(front_bits | back_bits);
+        sides |= (front_bits ? LAC_PLANE_FRONT : 0) | (back_bits ? LAC_PLANE_BACK : 0) | (on_bits ? LAC_PLANE_ON : 0);
+
+        if (front != NULL) {
+            front[i / LAC_BATCH_BLOCK] = (uint8_t)front_bits;
+        }
+        if (back != NULL) {
+            back[i / LAC_BATCH_BLOCK] = (uint8_t)back_bits;
+        }
+        if (on != NULL) {
+            on[i / LAC_BATCH_BLOCK] = (uint8_t)on_bits;
+        }
+    }
+
+    return (uint8_t)sides;
+}
+
+/**
+ * @brief Sorts each point in an SoA array into those in front of, behind and on a plane.
+ * @anchor lac_classify_plane_soa_anchor
+ * @since 19-10-2026
+ *
+ * Each mask holds one bit per point, where bit (i % 8) of byte (i / 8) belongs to point
+ * i, so each mask needs (__count__ + 7) / 8 bytes. Every point has exactly one of its
+ * three bits set, and the unused bits of the final byte are cleared.
+ *
+ * @param[out] front A bit for each point further than __epsilon__ in front of the plane, or NULL
+ * @param[out] back A bit for each point further than __epsilon__ behind the plane, or NULL
+ * @param[out] on A bit for each point within __epsilon__ of the plane, or NULL
+ * @param[in] points The points
+ * @param[in] plane The plane
+ * @param[in] epsilon The distance within which a point counts as on the plane
+ * @param[in] count The number of points in __points__
+ * @returns A bitwise OR of the LacPlaneSide_t values which at least one point lies on, e.g. both LAC_PLANE_FRONT and LAC_PLANE_BACK if the plane splits the points
+ */
+LAC_MULTIVERSION_RETURN(uint8_t, lac_classify_plane_soa, (
+    uint8_t *front,
+    uint8_t *back,
+    uint8_t *on,
+    const LacSoaVec3_t *points,
+    const LacPlane_t *plane,
+    const float epsilon,
+    const size_t count
+), (front, back, on, points, plane, epsilon, count))
+
+/**
+ * @brief Body of lac_project_plane_soa(), instantiated for each ISA level by LAC_MULTIVERSION().
+ * @since 19-10-2026
+ */
+static LAC_ALWAYS_INLINE void _lac_project_plane_soa(
+    LacSoaVec3_t *out,
+    const LacSoaVec3_t *points,
+    const LacPlane_t *plane,
+    const size_t count
+) {
+    float tail[6][LAC_BATCH_BLOCK] = { { 0 } };
+    size_t i, remaining;
+
+    for (i = 0; i + LAC_BATCH_BLOCK <= count; i += LAC_BATCH_BLOCK) {
+        _lac_project_plane_block(
+            &out->x[i], &out->y[i], &out->z[i],
+            &points->x[i], &points->y[i], &points->z[i],
+            plane
+        );
+    }
+
+    /* Pad the final partial block so that it can share the same code path */
+    remaining = count - i;
+    if (remaining > 0) {
+        memcpy(tail[0], &points->x[i], remaining * sizeof(float));
+        memcpy(tail[1], &points->y[i], remaining * sizeof(float));
+        memcpy(tail[2], &points->z[i], remaining * sizeof(float));
+        _lac_project_plane_block(tail[3], tail[4], tail[5], tail[0], tail[1], tail[2], plane);
+        memcpy(&out->x[i], tail[3], remaining * sizeof(float));
+        memcpy(&out->y[i], tail[4], remaining * sizeof(float));
+        memcpy(&out->z[i], tail[5], remaining * sizeof(float));
+    }
+}
+
+/**
+ * @brief Moves each point in an SoA array onto a plane, along the plane's normal.
+ * @anchor lac_project_plane_soa_anchor
+ * @since 19-10-2026
+ * @param[out] out The projected points (may be the same arrays as __points__)
+ * @param[in] points The points
+ * @param[in] plane The plane, which must be normalized
+ * @param[in] count The number of points in __points__ and __out__
+ */
+LAC_MULTIVERSION(lac_project_plane_soa, (
+    LacSoaVec3_t *out,
+    const LacSoaVec3_t *points,
+    const LacPlane_t *plane,
+    const size_t count
+), (out, points, plane, count))
@@ -0,0 +1,427 @@
+/**
+ * @file profile.c
+ * @author Neil Kingdom
+ * @since 19-10-2026
+ * @version 1.0
+ * @brief Counts calls and measures the time spent in each function of an instrumented build.
+ *
+ * @section instrumented Instrumented Builds
+ *
+ * Most functions in this library take a few dozen nanoseconds, so a sampling
+ * profiler rarely catches one in the act, and when it does, the samples tend
+ * to be attributed to whichever function it was inlined into. To see where
+ * the time goes, the library can instead be built with `make
+ * PROFILE=INSTRUMENTED`. This passes -finstrument-functions to the compiler,
+ * which makes every public function call __cyg_profile_func_enter() on entry
+ * and __cyg_profile_func_exit() on exit. Static helpers (prefixed with _lac_)
+ * and the inline functions of the headers are excluded, so that their cost is
+ * counted as part of the public function that uses them.
+ *
+ * The hooks read the CPU's timestamp counter (rdtsc on x86, or a monotonic
+ * clock in nanoseconds elsewhere) and keep, for each function, the number of
+ * calls, the total number of ticks, and a histogram in which bucket i counts
+ * the calls which took between 2^i and 2^(i+1) - 1 ticks. Times are inclusive,
+ * i.e. they include the functions that a function calls. Every thread keeps
+ * its own table, so the hooks never take a lock or contend for a cache line;
+ * lac_get_profile_snapshot() adds the tables of all threads together.
+ *
+ * In an instrumented build, the multi-versioned kernels (see dispatch.c) are
+ * built for the baseline instruction set only, so that each is profiled as
+ * one function rather than as a stub and the variant it calls. Function names are looked up with
+ * dladdr(), which only sees exported symbols; when liblac.a is linked into an
+ * executable, link with -rdynamic for names to be available.
+ *
+ * In every other build, no hooks are compiled in, and the functions below
+ * report that profiling is disabled.
+ *
+ * @subsection instrumented_related Related Functions
+ *
+ * - @ref lac_get_profile_snapshot_anchor "lac_get_profile_snapshot"
+ * - @ref lac_reset_profile_anchor "lac_reset_profile"
+ * - @ref lac_dump_profile_json_anchor "lac_dump_profile_json"
+ */
+
+#define _GNU_SOURCE
+
+#include "profile.h"
+
+#ifdef LAC_INSTRUMENTED
+
+#include <dlfcn.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define LAC_PROFILE_CLOCK "rdtsc"
+#else
+#define LAC_PROFILE_CLOCK "ns"
+#endif
+
+/* Size of the hash table of each thread (a power of 2, at least twice LAC_PROFILE_MAX_FUNCS) */
+#define LAC_PROFILE_SLOTS (2 * LAC_PROFILE_MAX_FUNCS)
+/* Calls nested deeper than this are counted but not timed */
+#define LAC_PROFILE_MAX_DEPTH 64
+
+/* Counters are written only by their own thread, but may be read or reset by any thread */
+typedef struct {
+    _Atomic(const void*) func;
+    atomic_uint_fast64_t calls;
+    atomic_uint_fast64_t ticks;
+    atomic_uint_fast64_t histogram[LAC_PROFILE_BUCKETS];
+} LacProfileSlot_t;
+
+typedef struct LacProfileThread {
+    struct LacProfileThread *next;
+    size_t depth;
+    uint64_t start[LAC_PROFILE_MAX_DEPTH];
+    LacProfileSlot_t slots[LAC_PROFILE_SLOTS];
+} LacProfileThread_t;
+
+/* Every thread's table, kept after the thread exits so that its calls are still reported */
+static LacProfileThread_t *_lac_profile_threads = NULL;
+static pthread_mutex_t _lac_profile_lock = PTHREAD_MUTEX_INITIALIZER;
+static _Thread_local LacProfileThread_t *_lac_profile_thread = NULL;
+/* Set while a thread is allocating its table, in case malloc() is itself instrumented */
+static _Thread_local bool _lac_profile_busy = false;
+
+void __cyg_profile_func_enter(void *func, void *call_site) __attribute__((no_instrument_function));
+void __cyg_profile_func_exit(void *func, void *call_site) __attribute__((no_instrument_function));
+
+/**
+ * @brief Reads the clock used to time calls.
+ * @since 19-10-2026
+ * @returns The current tick count
+ */
+static inline uint64_t _lac_profile_read_clock(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000u) + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+/**
+ * @brief Gets the table of the calling thread, creating and registering it on first use.
+ * @since 19-10-2026
+ * @returns The table, or NULL if it could not be allocated
+ */
+static LacProfileThread_t *_lac_profile_get_thread(void) {
+    LacProfileThread_t *thread = _lac_profile_thread;
+
+    if (thread != NULL || _lac_profile_busy) {
+        return thread;
+    }
+
+    _lac_profile_busy = true;
+    thread = calloc(1, sizeof(LacProfileThread_t));
+    if (thread != NULL) {
+        pthread_mutex_lock(&_lac_profile_lock);
+        thread->next = _lac_profile_threads;
+        _lac_profile_threads = thread;
+        pthread_mutex_unlock(&_lac_profile_lock);
+        _lac_profile_thread = thread;
+    }
+    _lac_profile_busy = false;
+    return thread;
+}
+
+/**
+ * @brief Finds the slot of __func__ in a table, claiming an empty one if it has none yet.
+ * @since 19-10-2026
+ * @param[in] thread The table
+ * @param[in] func The address of the function
+ * @returns The slot, or NULL if the table is full
+ */
+static LacProfileSlot_t *_lac_profile_find_slot(LacProfileThread_t *thread, const void *func) {
+    size_t i, n;
+    const void *owner;
+
+    /* Fibonacci hashing of the address; functions are at least 16 bytes apart */
+    i = (size_t)((((uintptr_t)func >> 4) * UINT64_C(11400714819323198485)) >> 40) & (LAC_PROFILE_SLOTS - 1);
+    for (n = 0; n < LAC_PROFILE_MAX_FUNCS; ++n) {
+        owner = atomic_load_explicit(&thread->slots[i].func, memory_order_relaxed);
+        if (owner == func) {
+            return &thread->slots[i];
+        }
+        if (owner == NULL) {
+            atomic_store_explicit(&thread->slots[i].func, func, memory_order_release);
+            return &thread->slots[i];
+        }
+        i = (i + 1) & (LAC_PROFILE_SLOTS - 1);
+    }
+    return NULL;
+}
+
+/**
+ * @brief Adds __value__ to a counter owned by the calling thread, without a read-modify-write instruction.
+ * @since 19-10-2026
+ */
+static inline void _lac_profile_add(atomic_uint_fast64_t *counter, const uint64_t value) {
+    atomic_store_explicit(counter, atomic_load_explicit(counter, memory_order_relaxed) + value, memory_order_relaxed);
+}
+
+/**
+ * @brief Called by the compiler on entry to every instrumented function.
+ * @since 19-10-2026
+ * @param[in] func The address of the function
+ * @param[in] call_site The address that it was called from
+ */
+void __cyg_profile_func_enter(void *func, void *call_site) {
+    LacProfileThread_t *thread = _lac_profile_get_thread();
+
+    (void)func;
+    (void)call_site;
+    if (thread == NULL) {
+        return;
+    }
+    if (thread->depth < LAC_PROFILE_MAX_DEPTH) {
+        thread->start[thread->depth] = _lac_profile_read_clock();
+    }
+    thread->depth++;
+}
+
+/**
+ * @brief Called by the compiler on exit from every instrumented function.
+ * @since 19-10-2026
+ * @param[in] func The address of the function
+ * @param[in] call_site The address that it was called from
+ */
+void __cyg_profile_func_exit(void *func, void *call_site) {
+    const uint64_t end = _lac_profile_read_clock();
+    LacProfileThread_t *thread = _lac_profile_thread;
+    LacProfileSlot_t *slot;
+    uint64_t elapsed;
+    size_t bucket;
+
+    (void)call_site;
+    if (thread == NULL || thread->depth == 0) {
+        return;
+    }
+    thread->depth--;
+
+    slot = _lac_profile_find_slot(thread, func);
+    if (slot == NULL) {
+        return;
+    }
+    _lac_profile_add(&slot->calls, 1);
+    if (thread->depth < LAC_PROFILE_MAX_DEPTH) {
+        elapsed = end - thread->start[thread->depth];
+        bucket = (elapsed > 1) ? (size_t)(63 - __builtin_clzll(elapsed)) : 0;
+        if (bucket >= LAC_PROFILE_BUCKETS) {
+            bucket = LAC_PROFILE_BUCKETS - 1;
+        }
+        _lac_profile_add(&slot->ticks, elapsed);
+        _lac_profile_add(&slot->histogram[bucket], 1);
+    }
+}
+
+/**
+ * @brief Reports whether the library was built with PROFILE=INSTRUMENTED.
+ * @since 19-10-2026
+ * @returns True if calls are being recorded
+ */
+LAC_DECL bool lac_is_profile_enabled(void) {
+    return true;
+}
+
+/**
+ * @brief Copies the statistics of every function called so far, summed across all threads.
+ * @anchor lac_get_profile_snapshot_anchor
+ * @since 19-10-2026
+ *
+ * Functions are reported in the order in which they are first found. The statistics of
+ * threads which are still running may change while they are being copied, so an entry may
+ * reflect part of a call that was in progress (e.g. its count but not yet its ticks).
+ *
+ * @param[out] entries The snapshot; may be NULL if __max_entries__ is 0
+ * @param[in] max_entries The number of entries that __entries__ can hold
+ * @returns The number of functions recorded. If this is more than __max_entries__, only the first
+ * __max_entries__ were copied, and the value is an upper bound on the number of entries needed.
+ */
+LAC_DECL size_t lac_get_profile_snapshot(LacProfileEntry_t *entries, const size_t max_entries) {
+    LacProfileThread_t *thread;
+    LacProfileSlot_t *slot;
+    LacProfileEntry_t *entry;
+    const void *func;
+    Dl_info info;
+    size_t count = 0, i, j, b;
+
+    pthread_mutex_lock(&_lac_profile_lock);
+    for (thread = _lac_profile_threads; thread != NULL; thread = thread->next) {
+        for (i = 0; i < LAC_PROFILE_SLOTS; ++i) {
+            slot = &thread->slots[i];
+            func = atomic_load_explicit(&slot->func, memory_order_acquire);
+            if (func == NULL) {
+                continue;
+            }
+
+            /* Merge with the same function from another thread, if it's already in the snapshot */
+            entry = NULL;
+            for (j = 0; j < count && j < max_entries; ++j) {
+                if (entries[j].func == func) {
+                    entry = &entries[j];
+                    break;
+                }
+            }
+            if (entry == NULL) {
+                if (count++ >= max_entries) {
+                    continue;
+                }
+                entry = &entries[count - 1];
+                memset(entry, 0, sizeof(LacProfileEntry_t));
+                entry->func = func;
+                entry->name = (dladdr(func, &info) != 0 && info.dli_saddr == func) ? info.dli_sname : NULL;
+            }
+
+            entry->calls += atomic_load_explicit(&slot->calls, memory_order_relaxed);
+            entry->ticks += atomic_load_explicit(&slot->ticks, memory_order_relaxed);
+            for (b = 0; b < LAC_PROFILE_BUCKETS; ++b) {
+                entry->histogram[b] += atomic_load_explicit(&slot->histogram[b], memory_order_relaxed);
+            }
+        }
+    }
+    pthread_mutex_unlock(&_lac_profile_lock);
+
+    return count;
+}
+
+/**
+ * @brief Sets the statistics of every function in every thread back to 0.
+ * @anchor lac_reset_profile_anchor
+ * @since 19-10-2026
+ *
+ * Calls which complete in other threads while the statistics are being reset may or may
+ * not be counted afterwards.
+ */
+LAC_DECL void lac_reset_profile(void) {
+    LacProfileThread_t *thread;
+    LacProfileSlot_t *slot;
+    size_t i, b;
+
+    pthread_mutex_lock(&_lac_profile_lock);
+    for (thread = _lac_profile_threads; thread != NULL; thread = thread->next) {
+        for (i = 0; i < LAC_PROFILE_SLOTS; ++i) {
+            slot = &thread->slots[i];
+            atomic_store_explicit(&slot->calls, 0, memory_order_relaxed);
+            atomic_store_explicit(&slot->ticks, 0, memory_order_relaxed);
+            for (b = 0; b < LAC_PROFILE_BUCKETS; ++b) {
+                atomic_store_explicit(&slot->histogram[b], 0, memory_order_relaxed);
+            }
+        }
+    }
+    pthread_mutex_unlock(&_lac_profile_lock);
+}
+
+/**
+ * @brief Writes a snapshot of the statistics to __stream__ as a JSON object.
+ * @anchor lac_dump_profile_json_anchor
+ * @since 19-10-2026
+ *
+ * The object looks like the following, where each histogram stops at its last non-empty
+ * bucket and "name" is null for functions whose symbol could not be found.
+ *
+ * ```
+ * {"enabled": true, "clock": "rdtsc", "functions": [
+ *   {"name": "lac_multiply_mat4", "address": "0x7f...", "calls": 1000, "ticks": 52000, "histogram": [0, 0, 0, 0, 0, 980, 20]}
+ * ]}
+ * ```
+ *
+ * @param[in] stream The stream to write to
+ * @returns 0 on success, otherwise -1 and errno is set
+ */
+LAC_DECL int lac_dump_profile_json(FILE *stream) {
+    LacProfileEntry_t *entries;
+    size_t count, i, b, last;
+
+    /* Size the snapshot first, leaving room for a function called in the meantime */
+    count = lac_get_profile_snapshot(NULL, 0);
+    entries = calloc(count + 1, sizeof(LacProfileEntry_t));
+    if (entries == NULL) {
+        return -1;
+    }
+    count = lac_get_profile_snapshot(entries, count + 1);
+
+    fprintf(stream, "{\"enabled\": true, \"clock\": \"%s\", \"functions\": [", LAC_PROFILE_CLOCK);
+    for (i = 0; i < count; ++i) {
+        fprintf(stream, "%s\n  {\"name\": ", (i > 0) ? "," : "");
+        if (entries[i].name != NULL) {
+            fprintf(stream, "\"%s\"", entries[i].name);
+        } else {
+            fprintf(stream, "null");
+        }
+        fprintf(
+            stream,
+            ", \"address\": \"%p\", \"calls\": %llu, \"ticks\": %llu, \"histogram\": [",
+            entries[i].func,
+            (unsigned long long)entries[i].calls,
+            (unsigned long long)entries[i].ticks
+        );
+
+        last = 0;
+        for (b = 0; b < LAC_PROFILE_BUCKETS; ++b) {
+            if (entries[i].histogram[b] != 0) {
+                last = b;
+            }
+        }
+        for (b = 0; b <= last; ++b) {
+            fprintf(stream, "%s%llu", (b > 0) ? ", " : "", (unsigned long long)entries[i].histogram[b]);
+        }
+        fprintf(stream, "]}");
+    }
+    fprintf(stream, "%s]}\n", (count > 0) ? "\n" : "");
+
+    free(entries);
+    return ferror(stream) ? -1 : 0;
+}
+
+#else
+
+/**
+ * @brief Reports whether the library was built with PROFILE=INSTRUMENTED.
+ * @since 19-10-2026
+ * @returns True if calls are being recorded
+ */
+LAC_DECL bool lac_is_profile_enabled(void) {
+    return false;
+}
+
+/**
+ * @brief Copies the statistics of every function called so far, summed across all threads.
+ * @anchor lac_get_profile_snapshot_anchor
+ * @since 19-10-2026
+ * @param[out] entries The snapshot; may be NULL if __max_entries__ is 0
+ * @param[in] max_entries The number of entries that __entries__ can hold
+ * @returns The number of functions recorded, which is always 0 unless built with PROFILE=INSTRUMENTED
+ */
+LAC_DECL size_t lac_get_profile_snapshot(LacProfileEntry_t *entries, const size_t max_entries) {
+    (void)entries;
+    (void)max_entries;
+    return 0;
+}
+
+/**
+ * @brief Sets the statistics of every function in every thread back to 0.
+ * @anchor lac_reset_profile_anchor
+ * @since 19-10-2026
+ */
+LAC_DECL void lac_reset_profile(void) {
+}
+
+/**
+ * @brief Writes a snapshot of the statistics to __stream__ as a JSON object.
+ * @anchor lac_dump_profile_json_anchor
+ * @since 19-10-2026
+ * @param[in] stream The stream to write to
+ * @returns 0 on success, otherwise -1 and errno is set
+ */
+LAC_DECL int lac_dump_profile_json(FILE *stream) {
+    fprintf(stream, "{\"enabled\": false, \"functions\": []}\n");
+    return ferror(stream) ? -1 : 0;
+}
+
+#endif /* LAC_INSTRUMENTED */
@@ -0,0 +1,476 @@
+/**
+ * @file ray.c
+ * @author Neil Kingdom
+ * @since 19-10-2026
+ * @version 1.0
+ * @brief Contains ray-triangle intersection kernels for single rays and packets of rays.
+ *
+ * @section raytri Ray-Triangle Intersection
+ *
+ * A ray is made up of an origin o and a direction d, and reaches the point
+ * o + td at distance t. The Möller–Trumbore algorithm finds where a ray
+ * meets the plane of a triangle (v0, v1, v2) in terms of the barycentric
+ * coordinates u and v, which give the hit point as v0 + u(v1 - v0) + v(v2 - v0).
+ * Writing e1 = v1 - v0, e2 = v2 - v0 and s = o - v0, and solving with
+ * Cramer's rule gives:
+ *
+ * p = d × e2, q = s × e1, det = e1 · p
+ * u = (s · p) / det, v = (d · q) / det, t = (e2 · q) / det
+ *
+ * The ray hits the triangle if det is not 0 (i.e. the ray is not parallel
+ * to the plane), u and v are both at least 0, u + v is at most 1, and t
+ * lies between the ray's tmin and the distance to the nearest hit found so
+ * far. Each hit found therefore shortens the ray, so that testing a ray
+ * against a list of triangles leaves it holding the nearest hit. Both sides
+ * of a triangle can be hit.
+ *
+ * @subsection raytri_related Related Functions
+ *
+ * - @ref lac_init_ray_anchor "lac_init_ray"
+ * - @ref lac_init_ray_hit_anchor "lac_init_ray_hit"
+ * - @ref lac_intersect_ray_triangle_anchor "lac_intersect_ray_triangle"
+ *
+ * @section raypacket Packets
+ *
+ * Testing one ray against one triangle at a time with the functions from
+ * vecmath.c spends most of its time on call overhead and on scalar maths.
+ * The packet kernels instead work on LAC_RAY_PACKET rays or triangles at
+ * once, stored in SoA layout (see batch.c), so that every step of the
+ * algorithm above is a single 8-wide SIMD operation. There are two kinds
+ * of packet. A packet of rays which start out close together and point in
+ * similar directions (such as the rays through neighbouring pixels, or the
+ * beams of a lidar sweep) can be tested against one triangle at a time,
+ * while a single ray can be tested against a packet of triangles, such as
+ * the triangles in a leaf of a BVH. In both cases, the 8 lanes run the exact
+ * same instructions, and a mask keeps track of which lanes actually hit.
+ *
+ * @subsection raypacket_related Related Functions
+ *
+ * - @ref lac_init_ray_packet_anchor "lac_init_ray_packet"
+ * - @ref lac_init_triangle_packet_anchor "lac_init_triangle_packet"
+ * - @ref lac_intersect_ray_packet_triangle_anchor "lac_intersect_ray_packet_triangle"
+ * - @ref lac_intersect_ray_triangle_packet_anchor "lac_intersect_ray_triangle_packet"
+ */
+
+#include "ray.h"
+#include "vecmath.h"
+#include "lac_simd.h"
+#include "lac_dispatch.h"
+
+/* Determinants closer to 0 than this are treated as rays parallel to the triangle */
+#define LAC_RAY_DET_EPSILON 1e-12f
+
+/**
+ * @brief Takes the cross product of two SoA vectors of length 3.
+ * @since 19-10-2026
+ * @param[out] v_out The cross products
+ * @param[in] v_a The left-hand vectors
+ * @param[in] v_b The right-hand vectors
+ */
+static inline void _lac_cross_f32x8(lac_f32x8 v_out[3], const lac_f32x8 v_a[3], const lac_f32x8 v_b[3]) {
+    v_out[0] = lac_simd_sub_f32x8(lac_simd_mul_f32x8(v_a[1], v_b[2]), lac_simd_mul_f32x8(v_a[2], v_b[1]));
+    v_out[1] = lac_simd_sub_f32x8(lac_simd_mul_f32x8(v_a[2], v_b[0]), lac_simd_mul_f32x8(v_a[0], v_b[2]));
+    v_out[2] = lac_simd_sub_f32x8(lac_simd_mul_f32x8(v_a[0], v_b[1]), lac_simd_mul_f32x8(v_a[1], v_b[0]));
+}
+
+/**
+ * @brief Takes the dot product of two SoA vectors of length 3.
+ * @since 19-10-2026
+ * @param[in] v_a The left-hand vectors
+ * @param[in] v_b The right-hand vectors
+ * @returns The dot products
+ */
+static inline lac_f32x8 _lac_dot_f32x8(const lac_f32x8 v_a[3], const lac_f32x8 v_b[3]) {
+    return lac_simd_madd_f32x8(v_a[2], v_b[2], lac_simd_madd_f32x8(v_a[1], v_b[1], lac_simd_mul_f32x8(v_a[0], v_b[0])));
+}
+
+/**
+ * @brief Runs Möller–Trumbore on 8 ray-triangle pairs at once.
+ * @since 19-10-2026
+ *
+ * Either the rays or the triangles may be the same in every lane, which is how both
+ * kinds of packet share this kernel.
+ *
+ * @param[out] t The distance along each ray to its hit point
+ * @param[out] u The barycentric coordinate of each hit point along e1
+ * @param[out] v The barycentric coordinate of each hit point along e2
+ * @param[in] o The ray origins
+ * @param[in] d The ray directions
+ * @param[in] v0 The first vertex of each triangle
+ * @param[in] e1 The first edge of each triangle
+ * @param[in] e2 The second edge of each triangle
+ * @param[in] tmin The distance that each hit must be beyond
+ * @param[in] tmax The distance that each hit must be within
+ * @returns A mask of the lanes where the ray hits the triangle
+ */
+static inline lac_i32x8 _lac_moller_trumbore_f32x8(
+    lac_f32x8 *t,
+    lac_f32x8 *u,
+    lac_f32x8 *v,
+    const lac_f32x8 o[3],
+    const lac_f32x8 d[3],
+    const lac_f32x8 v0[3],
+    const lac_f32x8 e1[3],
+    const lac_f32x8 e2[3],
+    const lac_f32x8 tmin,
+    const lac_f32x8 tmax
+) {
+    const lac_f32x8 zero = lac_simd_splat_f32x8(0.0f), one = lac_simd_splat_f32x8(1.0f);
+    lac_f32x8 s[3], p[3], q[3], det, inv_det;
+    lac_i32x8 mask;
+    size_t c;
+
+    for (c = 0; c < 3; ++c) {
+        s[c] = lac_simd_sub_f32x8(o[c], v0[c]);
+    }
+    _lac_cross_f32x8(p, d, e2);
+    _lac_cross_f32x8(q, s, e1);
+    det = _lac_dot_f32x8(e1, p);
+
+    /* Lanes which are parallel divide by 1 instead, so that no lane produces an infinity or NaN */
+    mask = lac_simd_or_i32x8(
+        lac_simd_lt_f32x8(lac_simd_splat_f32x8(LAC_RAY_DET_EPSILON), det),
+        lac_simd_lt_f32x8(det, lac_simd_splat_f32x8(-LAC_RAY_DET_EPSILON))
+    );
+    inv_det = lac_simd_div_f32x8(one, lac_simd_select_f32x8(mask, det, one));
+
+    *u = lac_simd_mul_f32x8(_lac_dot_f32x8(s, p), inv_det);
+    *v = lac_simd_mul_f32x8(_lac_dot_f32x8(d, q), inv_det);
+    *t = lac_simd_mul_f32x8(_lac_dot_f32x8(e2, q), inv_det);
+
+    mask = lac_simd_and_i32x8(mask, lac_simd_le_f32x8(zero, *u));
+    mask = lac_simd_and_i32x8(mask, lac_simd_le_f32x8(zero, *v));
+    mask = lac_simd_and_i32x8(mask, lac_simd_le_f32x8(lac_simd_add_f32x8(*u, *v), one));
+    mask = lac_simd_and_i32x8(mask, lac_simd_lt_f32x8(tmin, *t));
+    return lac_simd_and_i32x8(mask, lac_simd_lt_f32x8(*t, tmax));
+}
+
+/**
+ * @brief Initializes a ray.
+ * @anchor lac_init_ray_anchor
+ * @since 19-10-2026
+ *
+ * The direction need not be normalized, in which case hit distances are measured in
+ * multiples of its length.
+ *
+ * @param[out] ray The ray to be initialized
+ * @param[in] v_origin The point that the ray starts from
+ * @param[in] v_direction The direction of the ray
+ * @param[in] tmin The distance that hits must be beyond, e.g. a small offset to avoid hitting the surface that the ray leaves
+ * @param[in] tmax The distance that hits must be within, e.g. FLT_MAX for an unbounded ray
+ */
+LAC_DECL void lac_init_ray(LacRay_t *ray, const vec3 v_origin, const vec3 v_direction, const float tmin, const float tmax) {
+    memcpy(ray->origin, v_origin, sizeof(vec3));
+    memcpy(ray->direction, v_direction, sizeof(vec3));
+    ray->tmin = tmin;
+    ray->tmax = tmax;
+}
+
+/**
+ * @brief Initializes a hit record to hold no hit yet, so that only hits within the ray's tmax are accepted.
+ * @anchor lac_init_ray_hit_anchor
+ * @since 19-10-2026
+ * @param[out] hit The hit record to be initialized
+ * @param[in] ray The ray which the hit record belongs to
+ */
+LAC_DECL void lac_init_ray_hit(LacRayHit_t *hit, const LacRay_t *ray) {
+    hit->t = ray->tmax;
+    hit->u = 0.0f;
+    hit->v = 0.0f;
+    hit->prim = LAC_RAY_NO_HIT;
+}
+
+/**
+ * @brief Packs up to LAC_RAY_PACKET rays into SoA layout, and initializes their hit records.
+ * @anchor lac_init_ray_packet_anchor
+ * @since 19-10-2026
+ *
+ * Lanes beyond __count__ are filled with rays that never hit anything.
+ *
+ * @param[out] packet The packet of rays
+ * @param[out] hits The hit records, as initialized by lac_init_ray_hit() for each ray
+ * @param[in] rays The rays to be packed
+ * @param[in] count The number of rays in __rays__ (at most LAC_RAY_PACKET)
+ */
+LAC_DECL void lac_init_ray_packet(LacRayPacket_t *packet, LacRayHitPacket_t *hits, const LacRay_t *rays, const size_t count) {
+    LacRayHit_t hit;
+    size_t i, c;
+
+    memset(packet, 0, sizeof(LacRayPacket_t));
+    memset(hits, 0, sizeof(LacRayHitPacket_t));
+
+    for (i = 0; i < LAC_RAY_PACKET; ++i) {
+        hits->prim[i] = LAC_RAY_NO_HIT;
+    }
+
+    for (i = 0; i < count && i < LAC_RAY_PACKET; ++i) {
+        for (c = 0; c < 3; ++c) {
+            packet->origin[c][i] = rays[i].origin[c];
+            packet->direction[c][i] = rays[i].direction[c];
+        }
+        packet->tmin[i] = rays[i].tmin;
+
+        lac_init_ray_hit(&hit, &rays[i]);
+        hits->t[i] = hit.t;
+    }
+}
+
+/**
+ * @brief Packs up to LAC_RAY_PACKET triangles of a mesh into SoA layout.
+ * @anchor lac_init_triangle_packet_anchor
+ * @since 19-10-2026
+ *
+ * Lanes beyond __count__ are filled with degenerate triangles that are never hit.
+ *
+ * @param[out] packet The packet of triangles
+ * @param[in] vertices The vertex positions of the mesh
+ * @param[in] indices The 3 vertex indices of each triangle in the mesh, or NULL if triangle i is made up of vertices 3i, 3i + 1 and 3i + 2
+ * @param[in] prims The triangles to be packed, given by their index within the mesh
+ * @param[in] count The number of triangles in __prims__ (at most LAC_RAY_PACKET)
+ */
+LAC_DECL void lac_init_triangle_packet(
+    LacTrianglePacket_t *packet,
+    const vec3 *vertices,
+    const uint32_t *indices,
+    const uint32_t *prims,
+    const size_t count
+) {
+    const float *v0, *v1, *v2;
+    size_t i, c, first;
+
+    memset(packet, 0, sizeof(LacTrianglePacket_t));
+
+    for (i = 0; i < LAC_RAY_PACKET; ++i) {
+        packet->prim[i] = LAC_RAY_NO_HIT;
+    }
+
+    for (i = 0; i < count && i < LAC_RAY_PACKET; ++i) {
+        first = (size_t)prims[i] * 3;
+        v0 = vertices[(indices != NULL) ? indices[first] : first];
+        v1 = vertices[(indices != NULL) ? indices[first + 1] : (first + 1)];
+        v2 = vertices[(indices != NULL) ? indices[first + 2] : (first + 2)];
+
+        for (c = 0; c < 3; ++c) {
+            packet->v0[c][i] = v0[c];
+            packet->e1[c][i] = v1[c] - v0[c];
+            packet->e2[c][i] = v2[c] - v0[c];
+        }
+        packet->prim[i] = prims[i];
+    }
+}
+
+/**
+ * @brief Tests a single ray against a single triangle.
+ * @anchor lac_intersect_ray_triangle_anchor
+ * @since 19-10-2026
+ * @param[in,out] hit The nearest hit so far, which is replaced if the triangle is hit any nearer
+ * @param[in] ray The ray
+ * @param[in] v0 The first vertex of the triangle
+ * @param[in] v1 The second vertex of the triangle
+ * @param[in] v2 The third vertex of the triangle
+ * @param[in] prim The index of the triangle, which is recorded in __hit__
+ * @returns True if __hit__ was replaced, or false otherwise
+ */
+LAC_DECL bool lac_intersect_ray_triangle(
+    LacRayHit_t *hit,
+    const LacRay_t *ray,
+    const vec3 v0,
+    const vec3 v1,
+    const vec3 v2,
+    const uint32_t prim
+) {
+    vec3 e1, e2, s, p, q;
+    float det, inv_det, u, v, t;
+
+    lac_subtract_vec3(e1, v1, v0);
+    lac_subtract_vec3(e2, v2, v0);
+    lac_subtract_vec3(s, ray->origin, v0);
+    lac_calc_cross_prod(p, ray->direction, e2);
+    lac_calc_cross_prod(q, s, e1);
+    lac_calc_dot_prod_vec3(&det, e1, p);
+
+    if (det <= LAC_RAY_DET_EPSILON && det >= -LAC_RAY_DET_EPSILON) {
+        return false;
+    }
+    inv_det = 1.0f / det;
+
+    lac_calc_dot_prod_vec3(&u, s, p);
+    u *= inv_det;
+    if (u < 0.0f || u > 1.0f) {
+        return false;
+    }
+
+    lac_calc_dot_prod_vec3(&v, ray->direction, q);
+    v *= inv_det;
+    if (v < 0.0f || (u + v) > 1.0f) {
+        return false;
+    }
+
+    lac_calc_dot_prod_vec3(&t, e2, q);
+    t *= inv_det;
+    if (t <= ray->tmin || t >= hit->t) {
+        return false;
+    }
+
+    hit->t = t;
+    hit->u = u;
+    hit->v = v;
+    hit->prim = prim;
+    return true;
+}
+
+/**
+ * @brief Tests a packet of rays against a single triangle, as described by lac_intersect_ray_packet_triangle().
+ * @since 19-10-2026
+ */
+static LAC_VARIANT_INLINE uint8_t _lac_test_ray_packet(
+    LacRayHitPacket_t *hits,
+    const LacRayPacket_t *rays,
+    const vec3 v0,
+    const vec3 v1,
+    const vec3 v2,
+    const uint32_t prim
+) {
+    lac_f32x8 o[3], d[3], tri_v0[3], e1[3], e2[3], t, u, v, tmax;
+    lac_i32x8 mask;
+    unsigned bits;
+    size_t i, c;
+
+    for (c = 0; c < 3; ++c) {
+        o[c] = lac_simd_load_f32x8(rays->origin[c]);
+        d[c] = lac_simd_load_f32x8(rays->direction[c]);
+        tri_v0[c] = lac_simd_splat_f32x8(v0[c]);
+        e1[c] = lac_simd_splat_f32x8(v1[c] - v0[c]);
+        e2[c] = lac_simd_splat_f32x8(v2[c] - v0[c]);
+    }
+    tmax = lac_simd_load_f32x8(hits->t);
+
+    mask = _lac_moller_trumbore_f32x8(&t, &u, &v, o, d, tri_v0, e1, e2, lac_simd_load_f32x8(rays->tmin), tmax);
+    bits = lac_simd_bits_i32x8(mask);
+    if (bits == 0) {
+        return 0;
+    }
+
+    lac_simd_store_f32x8(hits->t, lac_simd_select_f32x8(mask, t, tmax));
+    lac_simd_store_f32x8(hits->u, lac_simd_select_f32x8(mask, u, lac_simd_load_f32x8(hits->u)));
+    lac_simd_store_f32x8(hits->v, lac_simd_select_f32x8(mask, v, lac_simd_load_f32x8(hits->v)));
+    for (i = 0; i < LAC_RAY_PACKET; ++i) {
+        if (bits & (1u << i)) {
+            hits->prim[i] = prim;
+        }
+    }
+
+    return (uint8_t)bits;
+}
+
+/**
+ * @brief Body of lac_intersect_ray_packet_triangle(), instantiated for each ISA level by LAC_MULTIVERSION_RETURN().
+ * @since 19-10-2026
+ */
+static LAC_ALWAYS_INLINE uint8_t _lac_intersect_ray_packet_triangle(
+    LacRayHitPacket_t *hits,
+    const LacRayPacket_t *rays,
+    const vec3 v0,
+    const vec3 v1,
+    const vec3 v2,
+    const uint32_t prim
+) {
+    return _lac_test_ray_packet(hits, rays, v0, v1, v2, prim);
+}
+
+/**
+ * @brief Tests a packet of rays against a single triangle.
+ * @anchor lac_intersect_ray_packet_triangle_anchor
+ * @since 19-10-2026
+ * @param[in,out] hits The nearest hit of each ray so far, which is replaced wherever the triangle is hit any nearer
+ * @param[in] rays The packet of rays, as built by lac_init_ray_packet()
+ * @param[in] v0 The first vertex of the triangle
+ * @param[in] v1 The second vertex of the triangle
+ * @param[in] v2 The third vertex of the triangle
+ * @param[in] prim The index of the triangle, which is recorded in __hits__
+ * @returns A mask where bit i is set if the hit of ray i was replaced
+ */
+LAC_MULTIVERSION_RETURN(uint8_t, lac_intersect_ray_packet_triangle, (
+    LacRayHitPacket_t *hits,
+    const LacRayPacket_t *rays,
+    const vec3 v0,
+    const vec3 v1,
+    const vec3 v2,
+    const uint32_t prim
+), (hits, rays, v0, v1, v2, prim))
+
+/**
+ * @brief Tests a single ray against a packet of triangles, as described by lac_intersect_ray_triangle_packet().
+ * @since 19-10-2026
+ */
+static LAC_VARIANT_INLINE bool _lac_test_triangle_packet(
+    LacRayHit_t *hit,
+    const LacRay_t *ray,
+    const LacTrianglePacket_t *triangles
+) {
+    lac_f32x8 o[3], d[3], v0[3], e1[3], e2[3], t, u, v;
+    float t_lanes[LAC_RAY_PACKET], u_lanes[LAC_RAY_PACKET], v_lanes[LAC_RAY_PACKET];
+    unsigned bits;
+    size_t i, nearest, c;
+
+    for (c = 0; c < 3; ++c) {
+        o[c] = lac_simd_splat_f32x8(ray->origin[c]);
+        d[c] = lac_simd_splat_f32x8(ray->direction[c]);
+        v0[c] = lac_simd_load_f32x8(triangles->v0[c]);
+        e1[c] = lac_simd_load_f32x8(triangles->e1[c]);
+        e2[c] = lac_simd_load_f32x8(triangles->e2[c]);
+    }
+
+    bits = lac_simd_bits_i32x8(_lac_moller_trumbore_f32x8(
+        &t, &u, &v, o, d, v0, e1, e2,
+        lac_simd_splat_f32x8(ray->tmin),
+        lac_simd_splat_f32x8(hit->t)
+    ));
+    if (bits == 0) {
+        return false;
+    }
+
+    /* Several triangles may be hit, so keep the nearest */
+    lac_simd_store_f32x8(t_lanes, t);
+    nearest = LAC_RAY_PACKET;
+    for (i = 0; i < LAC_RAY_PACKET; ++i) {
+        if ((bits & (1u << i)) && (nearest == LAC_RAY_PACKET || t_lanes[i] < t_lanes[nearest])) {
+            nearest = i;
+        }
+    }
+
+    hit->t = t_lanes[nearest];
+    lac_simd_store_f32x8(u_lanes, u);
+    lac_simd_store_f32x8(v_lanes, v);
+    hit->u = u_lanes[nearest];
+    hit->v = v_lanes[nearest];
+    hit->prim = triangles->prim[nearest];
+    return true;
+}
+
+/**
+ * @brief Body of lac_intersect_ray_triangle_packet(), instantiated for each ISA level by LAC_MULTIVERSION_RETURN().
+ * @since 19-10-2026
+ */
+static LAC_ALWAYS_INLINE bool _lac_intersect_ray_triangle_packet(
+    LacRayHit_t *hit,
+    const LacRay_t *ray,
+    const LacTrianglePacket_t *triangles
+) {
+    return _lac_test_triangle_packet(hit, ray, triangles);
+}
+
+/**
+ * @brief Tests a single ray against a packet of triangles.
+ * @anchor lac_intersect_ray_triangle_packet_anchor
+ * @since 19-10-2026
+ * @param[in,out] hit The nearest hit so far, which is replaced if any of the triangles is hit any nearer
+ * @param[in] ray The ray
+ * @param[in] triangles The packet of triangles, as built by lac_init_triangle_packet()
+ * @returns True if __hit__ was replaced, or false otherwise
+ */
+LAC_MULTIVERSION_RETURN(bool, lac_intersect_ray_triangle_packet, (
+    LacRayHit_t *hit,
+    const LacRay_t *ray,
+    const LacTrianglePacket_t *triangles
+), (hit, ray, triangles))
@@ -0,0 +1,647 @@
+/**
+ * @file scheduler.c
+ * @author Neil Kingdom
+ * @since 19-10-2026
+ * @version 1.0
+ * @brief Provides a work-stealing task scheduler for running batch kernels across threads.
+ *
+ * @section scheduler Work Stealing
+ *
+ * The simplest way of spreading a frame's work over several threads is to
+ * cut it into one equal share per thread. This works well when every piece
+ * of work costs the same, but a frame usually mixes very different jobs
+ * (e.g. a short skeleton chain next to a transform of a million vertices).
+ * With a static split, threads which finish their share early sit idle
+ * while the slowest thread carries on alone.
+ *
+ * A work-stealing scheduler balances the load as it runs. Every thread owns
+ * a double-ended queue (deque) of tasks. A thread pushes new tasks onto the
+ * bottom of its own deque and also takes its next task from the bottom, so
+ * it works through its most recent (and most cache friendly) tasks first.
+ * When a thread runs out of work, it picks another thread and steals the
+ * task from the top of that thread's deque instead. The top holds the
+ * oldest task, which in a recursive split is also the largest one, so a
+ * single steal tends to give the thief plenty to do.
+ *
+ * Large arrays are handled by range tasks which split themselves lazily.
+ * Before running, a range task which is larger than its grain pushes its
+ * upper half as a new task and keeps the lower half, repeating until the
+ * remainder is small enough to be processed directly. If no thread is free
+ * to steal the halves, the owning thread simply runs them itself, so the
+ * split costs little more than a loop when the machine is busy.
+ *
+ * Tasks are counted in task groups. A thread waiting on a group keeps
+ * running (or stealing) tasks for as long as it can find any, which means
+ * that tasks may safely submit and wait on further tasks themselves. Once
+ * the group's remaining tasks are all running on other threads, it sleeps
+ * until one of them brings the group's count to zero, or until new tasks
+ * are queued which it could help with.
+ *
+ * @subsection scheduler_related Related Functions
+ *
+ * - @ref lac_create_scheduler_anchor "lac_create_scheduler"
+ * - @ref lac_submit_task_anchor "lac_submit_task"
+ * - @ref lac_submit_range_task_anchor "lac_submit_range_task"
+ * - @ref lac_wait_task_group_anchor "lac_wait_task_group"
+ * - @ref lac_parallel_for_anchor "lac_parallel_for"
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdalign.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#include "batch.h"
+#include "scheduler.h"
+
+/* Initial number of tasks which a deque can hold; deques grow as needed */
+#define LAC_DEQUE_CAPACITY 256
+
+typedef struct {
+    LacTaskFunc_t func;
+    LacRangeFunc_t range_func;
+    void *arg;
+    size_t begin;
+    size_t end;
+    size_t grain;
+    LacTaskGroup_t *group;
+} LacTask_t;
+
+/* Tasks are stored at top..bottom-1 (modulo the capacity); the owner uses the bottom and thieves the top */
+typedef struct {
+    alignas(64) pthread_mutex_t lock;
+    LacTask_t *tasks;
+    size_t capacity;
+    size_t top;
+    size_t bottom;
+} LacDeque_t;
+
+typedef struct {
+    LacScheduler_t *scheduler;
+    size_t index;
+} LacWorker_t;
+
+struct LacScheduler {
+    LacDeque_t deques[LAC_SCHEDULER_MAX_THREADS];
+    LacWorker_t workers[LAC_SCHEDULER_MAX_THREADS];
+    pthread_t threads[LAC_SCHEDULER_MAX_THREADS];
+    size_t num_threads;
+    atomic_size_t queued;
+    atomic_size_t sleepers;
+    atomic_size_t waiters;
+    atomic_bool shutdown;
+    pthread_mutex_t idle_lock;
+    pthread_cond_t idle;
+    pthread_cond_t done;
+};
+
+typedef struct {
+    void *v_out;
+    const void *v_in;
+    const float *m_in;
+} LacParallelBatch_t;
+
+static _Thread_local LacWorker_t *_lac_current_worker = NULL;
+static _Thread_local uint32_t _lac_steal_seed = 0;
+
+/**
+ * @brief Gets the deque which the calling thread pushes to and pops from.
+ * @since 19-10-2026
+ *
+ * Worker threads use their own deque. Every other thread (including the one which
+ * created the scheduler) shares deque 0.
+ *
+ * @param[in] scheduler The scheduler
+ * @returns The index of the deque
+ */
+static size_t _lac_get_deque_index(const LacScheduler_t *scheduler) {
+    if (_lac_current_worker != NULL && _lac_current_worker->scheduler == scheduler) {
+        return _lac_current_worker->index;
+    }
+    return 0;
+}
+
+/**
+ * @brief Pushes a task onto the bottom of a deque, growing the deque if it is full.
+ * @since 19-10-2026
+ * @param[out] scheduler The scheduler, whose idle workers and waiting threads are woken
+ * @param[out] deque The deque
+ * @param[in] task The task to be copied into the deque
+ * @returns true on success, or false if the deque could not be grown
+ */
+static bool _lac_push_deque(LacScheduler_t *scheduler, LacDeque_t *deque, const LacTask_t *task) {
+    LacTask_t *tasks;
+    size_t capacity, i;
+
+    pthread_mutex_lock(&deque->lock);
+
+    if (deque->bottom - deque->top == deque->capacity) {
+        capacity = deque->capacity * 2;
+        tasks = malloc(capacity * sizeof(LacTask_t));
+        if (tasks == NULL) {
+            pthread_mutex_unlock(&deque->lock);
+            return false;
+        }
+        for (i = deque->top; i < deque->bottom; ++i) {
+            tasks[i & (capacity - 1)] = deque->tasks[i & (deque->capacity - 1)];
+        }
+        free(deque->tasks);
+        deque->tasks = tasks;
+        deque->capacity = capacity;
+    }
+
+    deque->tasks[deque->bottom & (deque->capacity - 1)] = *task;
+    deque->bottom++;
+
+    pthread_mutex_unlock(&deque->lock);
+
+    /* Pairs with the check made by a worker or a waiting thread before it goes to sleep */
+    atomic_fetch_add(&scheduler->queued, 1);
+    if (atomic_load(&scheduler->sleepers) > 0 || atomic_load(&scheduler->waiters) > 0) {
+        pthread_mutex_lock(&scheduler->idle_lock);
+        pthread_cond_signal(&scheduler->idle);
+        pthread_cond_broadcast(&scheduler->done);
+        pthread_mutex_unlock(&scheduler->idle_lock);
+    }
+
+    return true;
+}
+
+/**
+ * @brief Takes a task from one end of a deque.
+ * @since 19-10-2026
+ * @param[out] task The task which was taken
+ * @param[out] scheduler The scheduler
+ * @param[out] deque The deque
+ * @param[in] steal true to take the oldest task (top), or false to take the newest (bottom)
+ * @returns true if a task was taken, or false if the deque is empty
+ */
+static bool _lac_take_deque(LacTask_t *task, LacScheduler_t *scheduler, LacDeque_t *deque, const bool steal) {
+    bool found = false;
+
+    pthread_mutex_lock(&deque->lock);
+    if (deque->bottom != deque->top) {
+        if (steal) {
+            *task = deque->tasks[deque->top & (deque->capacity - 1)];
+            deque->top++;
+        } else {
+            deque->bottom--;
+            *task = deque->tasks[deque->bottom & (deque->capacity - 1)];
+        }
+        found = true;
+    }
+    pthread_mutex_unlock(&deque->lock);
+
+    if (found) {
+        atomic_fetch_sub(&scheduler->queued, 1);
+    }
+
+    return found;
+}
+
+/**
+ * @brief Finds the next task for a thread, first in its own deque and then in the others'.
+ * @since 19-10-2026
+ * @param[out] task The task which was found
+ * @param[out] scheduler The scheduler
+ * @param[in] index The index of the calling thread's deque
+ * @returns true if a task was found
+ */
+static bool _lac_find_task(LacTask_t *task, LacScheduler_t *scheduler, const size_t index) {
+    size_t start, i, victim;
+
+    if (_lac_take_deque(task, scheduler, &scheduler->deques[index], false)) {
+        return true;
+    }
+
+    /* Start at a random victim so that thieves do not all pile onto the same deque */
+    _lac_steal_seed = (_lac_steal_seed * 1664525u) + 1013904223u + (uint32_t)index;
+    start = (size_t)(_lac_steal_seed >> 16) % scheduler->num_threads;
+
+    for (i = 0; i < scheduler->num_threads; ++i) {
+        victim = (start + i) % scheduler->num_threads;
+        if (victim != index && _lac_take_deque(task, scheduler, &scheduler->deques[victim], true)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief Gets the grain used for a range of __count__ elements when none is given.
+ * @since 19-10-2026
+ *
+ * The range is split into about 8 pieces per thread, so that there are enough to balance
+ * the load, but never below LAC_SCHEDULER_MIN_GRAIN elements, where queueing a piece would
+ * cost more than running it.
+ *
+ * @param[in] scheduler The scheduler
+ * @param[in] count The number of elements in the range
+ * @returns The grain
+ */
+static size_t _lac_get_default_grain(const LacScheduler_t *scheduler, const size_t count) {
+    const size_t grain = count / (scheduler->num_threads * 8);
+    return (grain > LAC_SCHEDULER_MIN_GRAIN) ? grain : LAC_SCHEDULER_MIN_GRAIN;
+}
+
+/**
+ * @brief Runs a task, first splitting off the upper halves of a range task until it is within its grain.
+ * @since 19-10-2026
+ * @param[out] scheduler The scheduler
+ * @param[in] index The index of the calling thread's deque
+ * @param[in] task The task
+ */
+static void _lac_run_task(LacScheduler_t *scheduler, const size_t index, LacTask_t *task) {
+    LacTask_t half;
+
+    if (task->range_func != NULL) {
+        while (task->end - task->begin > task->grain) {
+            half = *task;
+            half.begin = task->begin + ((task->end - task->begin) / 2);
+
+            atomic_fetch_add_explicit(&task->group->pending, 1, memory_order_relaxed);
+            if (!_lac_push_deque(scheduler, &scheduler->deques[index], &half)) {
+                /* Out of memory; run the remainder in one go instead */
+                atomic_fetch_sub_explicit(&task->group->pending, 1, memory_order_relaxed);
+                break;
+            }
+            task->end = half.begin;
+        }
+        task->range_func(task->arg, task->begin, task->end);
+    } else {
+        task->func(task->arg);
+    }
+
+    /*
+     * Publishes the task's writes to the thread waiting on the group, and wakes it if this was
+     * the group's last task. Pairs with the check made by a waiting thread before it goes to sleep
+     */
+    if (atomic_fetch_sub(&task->group->pending, 1) == 1 && atomic_load(&scheduler->waiters) > 0) {
+        pthread_mutex_lock(&scheduler->idle_lock);
+        pthread_cond_broadcast(&scheduler->done);
+        pthread_mutex_unlock(&scheduler->idle_lock);
+    }
+}
+
+/**
+ * @brief Entry point of each worker thread.
+ * @since 19-10-2026
+ * @param[in] arg The worker
+ * @returns NULL
+ */
+static void *_lac_run_worker(void *arg) {
+    LacWorker_t *worker = arg;
+    LacScheduler_t *scheduler = worker->scheduler;
+    LacTask_t task;
+
+    _lac_current_worker = worker;
+    _lac_steal_seed = (uint32_t)worker->index;
+
+    while (!atomic_load(&scheduler->shutdown)) {
+        if (_lac_find_task(&task, scheduler, worker->index)) {
+            _lac_run_task(scheduler, worker->index, &task);
+            continue;
+        }
+
+        pthread_mutex_lock(&scheduler->idle_lock);
+        atomic_fetch_add(&scheduler->sleepers, 1);
+        while (atomic_load(&scheduler->queued) == 0 && !atomic_load(&scheduler->shutdown)) {
+            pthread_cond_wait(&scheduler->idle, &scheduler->idle_lock);
+        }
+        atomic_fetch_sub(&scheduler->sleepers, 1);
+        pthread_mutex_unlock(&scheduler->idle_lock);
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Creates a scheduler which runs tasks on __num_threads__ threads.
+ * @anchor lac_create_scheduler_anchor
+ * @since 19-10-2026
+ *
+ * __num_threads__ - 1 worker threads are started. The remaining thread is whichever
+ * thread calls lac_wait_task_group(), which runs tasks while it waits.
+ *
+ * @param[in] num_threads The number of threads, or 0 for one per online CPU. Clamped to LAC_SCHEDULER_MAX_THREADS
+ * @returns The scheduler, or NULL if it could not be created
+ */
+LAC_DECL LacScheduler_t *lac_create_scheduler(const size_t num_threads) {
+    LacScheduler_t *scheduler;
+    long cpus;
+    size_t i;
+
+    scheduler = aligned_alloc(alignof(LacScheduler_t), sizeof(LacScheduler_t));
+    if (scheduler == NULL) {
+        LAC_LOG("Failed to allocate scheduler", LAC_ERROR);
+        return NULL;
+    }
+    memset(scheduler, 0, sizeof(LacScheduler_t));
+
+    scheduler->num_threads = num_threads;
+    if (num_threads == 0) {
+        cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        scheduler->num_threads = (cpus > 0) ? (size_t)cpus : 1;
+    }
+    if (scheduler->num_threads > LAC_SCHEDULER_MAX_THREADS) {
+        scheduler->num_threads = LAC_SCHEDULER_MAX_THREADS;
+    }
+
+    atomic_init(&scheduler->queued, 0);
+    atomic_init(&scheduler->sleepers, 0);
+    atomic_init(&scheduler->waiters, 0);
+    atomic_init(&scheduler->shutdown, false);
+    pthread_mutex_init(&scheduler->idle_lock, NULL);
+    pthread_cond_init(&scheduler->idle, NULL);
+    pthread_cond_init(&scheduler->done, NULL);
+
+    for (i = 0; i < scheduler->num_threads; ++i) {
+        pthread_mutex_init(&scheduler->deques[i].lock, NULL);
+        scheduler->deques[i].capacity = LAC_DEQUE_CAPACITY;
+        scheduler->deques[i].tasks = malloc(LAC_DEQUE_CAPACITY * sizeof(LacTask_t));
+        scheduler->workers[i].scheduler = scheduler;
+        scheduler->workers[i].index = i;
+
+        if (scheduler->deques[i].tasks == NULL) {
+            LAC_LOG("Failed to allocate scheduler deque", LAC_ERROR);
+            scheduler->num_threads = i + 1;
+            atomic_store(&scheduler->shutdown, true);
+            lac_destroy_scheduler(scheduler);
+            return NULL;
+        }
+    }
+
+    for (i = 1; i < scheduler->num_threads; ++i) {
+        if (pthread_create(&scheduler->threads[i], NULL, _lac_run_worker, &scheduler->workers[i]) != 0) {
+            LAC_LOG("Failed to start scheduler thread", LAC_ERROR);
+
+            /* Only join the threads which were started */
+            atomic_store(&scheduler->shutdown, true);
+            pthread_mutex_lock(&scheduler->idle_lock);
+            pthread_cond_broadcast(&scheduler->idle);
+            pthread_mutex_unlock(&scheduler->idle_lock);
+            while (--i > 0) {
+                pthread_join(scheduler->threads[i], NULL);
+            }
+            lac_destroy_scheduler(scheduler);
+            return NULL;
+        }
+    }
+
+    return scheduler;
+}
+
+/**
+ * @brief Stops the worker threads and destroys a scheduler.
+ * @since 19-10-2026
+ *
+ * Every task group should be waited on beforehand; tasks which are still queued are discarded.
+ *
+ * @param[in] scheduler The scheduler to be destroyed
+ */
+LAC_DECL void lac_destroy_scheduler(LacScheduler_t *scheduler) {
+    size_t i;
+
+    if (!atomic_exchange(&scheduler->shutdown, true)) {
+        pthread_mutex_lock(&scheduler->idle_lock);
+        pthread_cond_broadcast(&scheduler->idle);
+        pthread_mutex_unlock(&scheduler->idle_lock);
+
+        for (i = 1; i < scheduler->num_threads; ++i) {
+            pthread_join(scheduler->threads[i], NULL);
+        }
+    }
+
+    for (i = 0; i < scheduler->num_threads; ++i) {
+        free(scheduler->deques[i].tasks);
+        pthread_mutex_destroy(&scheduler->deques[i].lock);
+    }
+
+    pthread_cond_destroy(&scheduler->idle);
+    pthread_cond_destroy(&scheduler->done);
+    pthread_mutex_destroy(&scheduler->idle_lock);
+    free(scheduler);
+}
+
+/**
+ * @brief Gets the number of threads which run a scheduler's tasks, including the waiting thread.
+ * @since 19-10-2026
+ * @param[in] scheduler The scheduler
+ * @returns The number of threads
+ */
+LAC_DECL size_t lac_get_scheduler_thread_count(const LacScheduler_t *scheduler) {
+    return scheduler->num_threads;
+}
+
+/**
+ * @brief Initializes an empty task group.
+ * @since 19-10-2026
+ * @param[out] group The task group
+ */
+LAC_DECL void lac_init_task_group(LacTaskGroup_t *group) {
+    atomic_init(&group->pending, 0);
+}
+
+/**
+ * @brief Submits a task which calls __func__(__arg__) as part of __group__.
+ * @anchor lac_submit_task_anchor
+ * @since 19-10-2026
+ * @param[out] scheduler The scheduler
+ * @param[out] group The task group which the task is counted in
+ * @param[in] func The function to be called
+ * @param[in] arg The argument passed to __func__
+ * @returns true on success, or false if the task could not be queued
+ */
+LAC_DECL bool lac_submit_task(LacScheduler_t *scheduler, LacTaskGroup_t *group, LacTaskFunc_t func, void *arg) {
+    LacTask_t task = { func, NULL, arg, 0, 0, 0, group };
+
+    atomic_fetch_add_explicit(&group->pending, 1, memory_order_relaxed);
+    if (!_lac_push_deque(scheduler, &scheduler->deques[_lac_get_deque_index(scheduler)], &task)) {
+        atomic_fetch_sub_explicit(&group->pending, 1, memory_order_relaxed);
+        LAC_LOG("Failed to submit task", LAC_ERROR);
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Submits a task which calls __func__(__arg__, b, e) over sub-ranges [b, e) of [__begin__, __end__).
+ * @anchor lac_submit_range_task_anchor
+ * @since 19-10-2026
+ *
+ * The range is split recursively in halves until each piece holds at most __grain__
+ * elements, and the pieces may run on any thread in any order.
+ *
+ * @param[out] scheduler The scheduler
+ * @param[out] group The task group which the task is counted in
+ * @param[in] func The function to be called for each piece
+ * @param[in] arg The argument passed to __func__
+ * @param[in] begin The first index of the range
+ * @param[in] end One past the last index of the range
+ * @param[in] grain The largest piece which is not split further, or 0 to pick one giving about 8 pieces per thread, but no less than LAC_SCHEDULER_MIN_GRAIN
+ * @returns true on success, or false if the task could not be queued
+ */
+LAC_DECL bool lac_submit_range_task(
+    LacScheduler_t *scheduler,
+    LacTaskGroup_t *group,
+    LacRangeFunc_t func,
+    void *arg,
+    const size_t begin,
+    const size_t end,
+    const size_t grain
+) {
+    LacTask_t task = { NULL, func, arg, begin, end, grain, group };
+
+    if (begin >= end) {
+        return true;
+    }
+    if (grain == 0) {
+        task.grain = _lac_get_default_grain(scheduler, end - begin);
+    }
+
+    atomic_fetch_add_explicit(&group->pending, 1, memory_order_relaxed);
+    if (!_lac_push_deque(scheduler, &scheduler->deques[_lac_get_deque_index(scheduler)], &task)) {
+        atomic_fetch_sub_explicit(&group->pending, 1, memory_order_relaxed);
+        LAC_LOG("Failed to submit range task", LAC_ERROR);
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Runs tasks on the calling thread until every task in __group__ has finished.
+ * @anchor lac_wait_task_group_anchor
+ * @since 19-10-2026
+ * @param[out] scheduler The scheduler
+ * @param[in] group The task group
+ */
+LAC_DECL void lac_wait_task_group(LacScheduler_t *scheduler, LacTaskGroup_t *group) {
+    const size_t index = _lac_get_deque_index(scheduler);
+    LacTask_t task;
+
+    while (atomic_load(&group->pending) > 0) {
+        if (_lac_find_task(&task, scheduler, index)) {
+            _lac_run_task(scheduler, index, &task);
+            continue;
+        }
+
+        /* The remaining tasks are running on other threads, so sleep until one of them finishes */
+        pthread_mutex_lock(&scheduler->idle_lock);
+        atomic_fetch_add(&scheduler->waiters, 1);
+        while (atomic_load(&group->pending) > 0 && atomic_load(&scheduler->queued) == 0) {
+            pthread_cond_wait(&scheduler->done, &scheduler->idle_lock);
+        }
+        atomic_fetch_sub(&scheduler->waiters, 1);
+        pthread_mutex_unlock(&scheduler->idle_lock);
+    }
+}
+
+/**
+ * @brief Calls __func__ over [0, __count__) in parallel and waits for it to finish.
+ * @anchor lac_parallel_for_anchor
+ * @since 19-10-2026
+ * @param[out] scheduler The scheduler
+ * @param[in] func The function to be called for each piece of the range
+ * @param[in] arg The argument passed to __func__
+ * @param[in] count The number of elements
+ * @param[in] grain The largest piece which is not split further, or 0 to pick one giving about 8 pieces per thread, but no less than LAC_SCHEDULER_MIN_GRAIN
+ */
+LAC_DECL void lac_parallel_for(
+    LacScheduler_t *scheduler,
+    LacRangeFunc_t func,
+    void *arg,
+    const size_t count,
+    const size_t grain
+) {
+    LacTaskGroup_t group;
+
+    lac_init_task_group(&group);
+    if (!lac_submit_range_task(scheduler, &group, func, arg, 0, count, grain)) {
+        func(arg, 0, count);
+        return;
+    }
+    lac_wait_task_group(scheduler, &group);
+}
+
+/**
+ * @brief Range task used by lac_parallel_multiply_vec2_mat2_array().
+ * @since 19-10-2026
+ * @param[in] arg The batch
+ * @param[in] begin The first vector of the piece
+ * @param[in] end One past the last vector of the piece
+ */
+static void _lac_parallel_multiply_vec2_mat2(void *arg, size_t begin, size_t end) {
+    LacParallelBatch_t *batch = arg;
+    lac_multiply_vec2_mat2_array((vec2*)batch->v_out + begin, (const vec2*)batch->v_in + begin, batch->m_in, end - begin);
+}
+
+/**
+ * @brief Range task used by lac_parallel_multiply_vec3_mat3_array().
+ * @since 19-10-2026
+ * @param[in] arg The batch
+ * @param[in] begin The first vector of the piece
+ * @param[in] end One past the last vector of the piece
+ */
+static void _lac_parallel_multiply_vec3_mat3(void *arg, size_t begin, size_t end) {
+    LacParallelBatch_t *batch = arg;
+    lac_multiply_vec3_mat3_array((vec3*)batch->v_out + begin, (const vec3*)batch->v_in + begin, batch->m_in, end - begin);
+}
+
+/**
+ * @brief Range task used by lac_parallel_multiply_vec4_mat4_array().
+ * @since 19-10-2026
+ * @param[in] arg The batch
+ * @param[in] begin The first vector of the piece
+ * @param[in] end One past the last vector of the piece
+ */
+static void _lac_parallel_multiply_vec4_mat4(void *arg, size_t begin, size_t end) {
+    LacParallelBatch_t *batch = arg;
+    lac_multiply_vec4_mat4_array((vec4*)batch->v_out + begin, (const vec4*)batch->v_in + begin, batch->m_in, end - begin);
+}
+
+/**
+ * @brief Multiplies an array of vectors of length 2 by a 2x2 matrix using every thread of __scheduler__.
+ * @since 19-10-2026
+ * @param[out] scheduler The scheduler
+ * @param[out] v_out The output array; may be the same as __v_in__
+ * @param[in] v_in The input array
+ * @param[in] m_in The input matrix
+ * @param[in] count The number of vectors
+ */
+LAC_DECL void lac_parallel_multiply_vec2_mat2_array(LacScheduler_t *scheduler, vec2 *v_out, const vec2 *v_in, const mat2 m_in, const size_t count) {
+    LacParallelBatch_t batch = { v_out, v_in, m_in };
+    lac_parallel_for(scheduler, _lac_parallel_multiply_vec2_mat2, &batch, count, LAC_SCHEDULER_BATCH_GRAIN);
+}
+
+/**
+ * @brief Multiplies an array of vectors of length 3 by a 3x3 matrix using every thread of __scheduler__.
+ * @since 19-10-2026
+ * @param[out] scheduler The scheduler
+ * @param[out] v_out The output array; may be the same as __v_in__
+ * @param[in] v_in The input array
+ * @param[in] m_in The input matrix
+ * @param[in] count The number of vectors
+ */
+LAC_DECL void lac_parallel_multiply_vec3_mat3_array(LacScheduler_t *scheduler, vec3 *v_out, const vec3 *v_in, const mat3 m_in, const size_t count) {
+    LacParallelBatch_t batch = { v_out, v_in, m_in };
+    lac_parallel_for(scheduler, _lac_parallel_multiply_vec3_mat3, &batch, count, LAC_SCHEDULER_BATCH_GRAIN);
+}
+
+/**
+ * @brief Multiplies an array of vectors of length 4 by a 4x4 matrix using every thread of __scheduler__.
+ * @since 19-10-2026
+ * @param[out] scheduler The scheduler
+ * @param[out] v_out The output array; may be the same as __v_in__
+ * @param[in] v_in The input array
+ * @param[in] m_in The input matrix
+ * @param[in] count The number of vectors
+ */
+LAC_DECL void lac_parallel_multiply_vec4_mat4_array(LacScheduler_t *scheduler, vec4 *v_out, const vec4 *v_in, const mat4 m_in, const size_t count) {
+    LacParallelBatch_t batch = { v_out, v_in, m_in };
+    lac_parallel_for(scheduler, _lac_parallel_multiply_vec4_mat4, &batch, count, LAC_SCHEDULER_BATCH_GRAIN);
+}
@@ -0,0 +1,627 @@
+/**
+ * @file sparse.c
+ * @author Neil Kingdom
+ * @since 19-10-2026
+ * @version 1.0
+ * @brief Provides sparse matrices in compressed sparse row form, and their products with vectors.
+ *
+ * @section sparse Sparse Matrices
+ *
+ * The systems solved by cloth and finite element simulations have one row
+ * and one column per degree of freedom, so tens of thousands of each, but
+ * each row only couples a degree of freedom to its few neighbors. Storing
+ * such a matrix densely would take gigabytes which are almost all zero.
+ *
+ * A compressed sparse row (CSR) matrix stores only the entries which are
+ * present. The entries are laid out row by row, each row sorted by column,
+ * with the column of each entry in one array and its value in another. A
+ * third array holds where each row starts, so the entries of row r are
+ * [row_start[r], row_start[r + 1]).
+ *
+ * When every degree of freedom is a 3D vector (the position of a cloth
+ * particle, or the displacement of a mesh node), entries come in 3x3 blocks
+ * which are all present or all absent. A block compressed sparse row (BSR)
+ * matrix stores one column index per block instead of per entry, and keeps
+ * the 9 entries of each block together as a mat3, which is a third of the
+ * indices and far fewer lookups into the vector being multiplied.
+ *
+ * Both are assembled from a list of (row, column, value) triplets in any
+ * order. Triplets at the same position are added together, which is how
+ * the contributions of the elements sharing a node are accumulated in an
+ * assembly loop. The triplets are put in order by two counting sorts, one
+ * by column and then one by row, which are stable, so duplicates are always
+ * added in the order they were given and the result doesn't depend on
+ * anything but the triplets. Entries given explicitly as 0 are stored, so
+ * that a matrix assembled each frame keeps the same structure.
+ *
+ * @subsection sparse_related Related Functions
+ *
+ * - @ref lac_init_csr_anchor "lac_init_csr"
+ * - @ref lac_transpose_csr_anchor "lac_transpose_csr"
+ * - @ref lac_init_bsr3_anchor "lac_init_bsr3"
+ * - @ref lac_transpose_bsr3_anchor "lac_transpose_bsr3"
+ *
+ * @section spmv Sparse Matrix-Vector Products
+ *
+ * Each row of a CSR product is the dot product of the row's values with the
+ * entries of the vector at the row's columns. Rows of at least
+ * LAC_BATCH_BLOCK entries are multiplied LAC_BATCH_BLOCK entries at a time,
+ * loading that many values at once and gathering the matching entries of the
+ * vector into a SIMD vector, with the rest of each row done one entry at a
+ * time. Each 3x3 block of a BSR product is added in as three columns of the
+ * block, each scaled by one entry of the vector.
+ *
+ * Rows are independent, so given a scheduler (see scheduler.c) the product
+ * is split across threads by rows. Rows can hold very different numbers of
+ * entries, so rather than giving each task the same number of rows, the
+ * rows are split where the count of rows plus entries crosses a multiple of
+ * LAC_SPARSE_PART_SIZE. Each task finds its rows with a binary search of the
+ * row starts, and multiplies them as a matrix of its own which shares the
+ * arrays of the whole.
+ *
+ * @subsection spmv_related Related Functions
+ *
+ * - @ref lac_multiply_csr_vec_anchor "lac_multiply_csr_vec"
+ * - @ref lac_parallel_multiply_csr_vec_anchor "lac_parallel_multiply_csr_vec"
+ * - @ref lac_multiply_bsr3_vec_anchor "lac_multiply_bsr3_vec"
+ * - @ref lac_parallel_multiply_bsr3_vec_anchor "lac_parallel_multiply_bsr3_vec"
+ */
+
+#include <stdint.h>
+
+#include "sparse.h"
+#include "batch.h"
+#include "lac_simd.h"
+#include "lac_dispatch.h"
+
+/* Number of rows plus entries (or blocks) multiplied by each task of a parallel product */
+#define LAC_SPARSE_PART_SIZE 16384
+
+/* A product being split across threads, by rows */
+typedef struct {
+    const void *matrix;
+    const void *x;
+    void *y;
+    const uint32_t *row_start;
+    size_t rows;
+    size_t parts;
+} LacSparseProduct_t;
+
+/**
+ * @brief Finds where an entry of an __n__x__n__ block is stored, respecting LAC_IS_ROW_MAJOR.
+ * @since 19-10-2026
+ * @param[in] n The number of rows and columns in the block
+ * @param[in] r The row of the entry
+ * @param[in] c The column of the entry
+ * @returns The index of the entry within the block
+ */
+static inline size_t _lac_get_sparse_element(const size_t n, const size_t r, const size_t c) {
+#if LAC_IS_ROW_MAJOR
+    return (r * n) + c;
+#else
+    return (c * n) + r;
+#endif
+}
+
+/**
+ * @brief Releases the arrays of a CSR matrix, or of a BSR matrix viewed as one.
+ * @since 19-10-2026
+ * @param[out] csr The matrix, which is reset to all zeroes
+ */
+static void _lac_free_sparse(LacCsr_t *csr) {
+    free(csr->row_start);
+    free(csr->col_index);
+    free(csr->values);
+    memset(csr, 0, sizeof(LacCsr_t));
+}
+
+/**
+ * @brief Assembles a sparse matrix of __n__x__n__ blocks from triplets.
+ * @since 19-10-2026
+ *
+ * The result is held in a LacCsr_t whose rows, columns and entries are
+ * blocks, with the __n__ * __n__ values of each block stored together.
+ *
+ * @param[out] out The matrix
+ * @param[in] rows The number of rows of blocks
+ * @param[in] cols The number of columns of blocks
+ * @param[in] n The number of rows and columns in each block
+ * @param[in] triplets The entries, whose rows and columns count single entries rather than blocks
+ * @param[in] count The number of triplets
+ * @returns 0 on success, otherwise -1 and errno is set
+ */
+static int _lac_build_sparse(
+    LacCsr_t *out,
+    const size_t rows,
+    const size_t cols,
+    const size_t n,
+    const LacTriplet_t *triplets,
+    const size_t count
+) {
+    const size_t size = n * n;
+    uint32_t *col_offset = NULL, *row_offset = NULL, *by_col = NULL, *order = NULL;
+    size_t i, r, k, begin, end, e, nnz = 0;
+    uint32_t c = 0;
+    int result = -1;
+
+    memset(out, 0, sizeof(LacCsr_t));
+
+    if (rows > UINT32_MAX || cols > UINT32_MAX || count >= UINT32_MAX) {
+        LAC_LOG("Sparse matrix is too large", LAC_ERROR);
+        errno = EINVAL;
+        return -1;
+    }
+    for (i = 0; i < count; ++i) {
+        if (triplets[i].row >= rows * n || triplets[i].col >= cols * n) {
+            LAC_LOG("Sparse matrix entry lies outside the matrix", LAC_ERROR);
+            errno = EINVAL;
+            return -1;
+        }
+    }
+
+    col_offset = calloc(cols + 1, sizeof(uint32_t));
+    row_offset = calloc(rows + 1, sizeof(uint32_t));
+    by_col = malloc((count + 1) * sizeof(uint32_t));
+    order = malloc((count + 1) * sizeof(uint32_t));
+    out->row_start = malloc((rows + 1) * sizeof(uint32_t));
+    if (col_offset == NULL || row_offset == NULL || by_col == NULL || order == NULL || out->row_start == NULL) {
+        goto cleanup;
+    }
+
+    /* Sorting stably by column and then by row leaves the triplets in order, with duplicates as given */
+    for (i = 0; i < count; ++i) {
+        ++col_offset[(triplets[i].col / n) + 1];
+        ++row_offset[(triplets[i].row / n) + 1];
+    }
+    for (k = 0; k < cols; ++k) {
+        col_offset[k + 1] += col_offset[k];
+    }
+    for (r = 0; r < rows; ++r) {
+        row_offset[r + 1] += row_offset[r];
+    }
+    for (i = 0; i < count; ++i) {
+        by_col[col_offset[triplets[i].col / n]++] = (uint32_t)i;
+    }
+    for (k = 0; k < count; ++k) {
+        i = by_col[k];
+        order[row_offset[triplets[i].row / n]++] = (uint32_t)i;
+    }
+
+    /* Each row's triplets now end where the next row's began, so row r holds [row_offset[r - 1], row_offset[r]) */
+    for (r = 0, begin = 0; r < rows; ++r, begin = end) {
+        end = row_offset[r];
+        out->row_start[r] = (uint32_t)nnz;
+        for (k = begin; k < end; ++k) {
+            if (k == begin || triplets[order[k]].col / n != c) {
+                c = (uint32_t)(triplets[order[k]].col / n);
+                ++nnz;
+            }
+        }
+    }
+    out->row_start[rows] = (uint32_t)nnz;
+
+    out->col_index = malloc((nnz + 1) * sizeof(uint32_t));
+    out->values = calloc((nnz * size) + 1, sizeof(float));
+    if (out->col_index == NULL || out->values == NULL) {
+        goto cleanup;
+    }
+
+    for (r = 0, begin = 0; r < rows; ++r, begin = end) {
+        end = row_offset[r];
+        e = out->row_start[r];
+        for (k = begin; k < end; ++k) {
+            i = order[k];
+            c = (uint32_t)(triplets[i].col / n);
+            if (k == begin || c != out->col_index[e - 1]) {
+                out->col_index[e++] = c;
+            }
+            out->values[((e - 1) * size) + _lac_get_sparse_element(n, triplets[i].row % n, triplets[i].col % n)]
+                += triplets[i].value;
+        }
+    }
+
+    out->rows = rows;
+    out->cols = cols;
+    out->nnz = nnz;
+    result = 0;
+
+cleanup:
+    if (result != 0) {
+        LAC_LOG("Failed to allocate sparse matrix", LAC_ERROR);
+        _lac_free_sparse(out);
+        errno = ENOMEM;
+    }
+    free(col_offset);
+    free(row_offset);
+    free(by_col);
+    free(order);
+
+    return result;
+}
+
+/**
+ * @brief Transposes a sparse matrix of __n__x__n__ blocks, including each block.
+ * @since 19-10-2026
+ * @param[out] out The transposed matrix
+ * @param[in] in The matrix, held as in _lac_build_sparse()
+ * @param[in] n The number of rows and columns in each block
+ * @returns 0 on success, otherwise -1 and errno is set
+ */
+static int _lac_transpose_sparse(LacCsr_t *out, const LacCsr_t *in, const size_t n) {
+    const size_t size = n * n;
+    uint32_t *cursor;
+    size_t r, e, d, i, j;
+
+    memset(out, 0, sizeof(LacCsr_t));
+
+    cursor = malloc((in->cols + 1) * sizeof(uint32_t));
+    out->row_start = calloc(in->cols + 1, sizeof(uint32_t));
+    out->col_index = malloc((in->nnz + 1) * sizeof(uint32_t));
+    out->values = malloc(((in->nnz * size) + 1) * sizeof(float));
+    if (cursor == NULL || out->row_start == NULL || out->col_index == NULL || out->values == NULL) {
+        LAC_LOG("Failed to allocate sparse matrix", LAC_ERROR);
+        free(cursor);
+        _lac_free_sparse(out);
+        errno = ENOMEM;
+        return -1;
+    }
+
+    /* A counting sort by column, which visits the rows in order and so leaves each new row sorted */
+    for (e = 0; e < in->nnz; ++e) {
+        ++out->row_start[in->col_index[e] + 1];
+    }
+    for (r = 0; r < in->cols; ++r) {
+        out->row_start[r + 1] += out->row_start[r];
+    }
+    memcpy(cursor, out->row_start, in->cols * sizeof(uint32_t));
+
+    for (r = 0; r < in->rows; ++r) {
+        for (e = in->row_start[r]; e < in->row_start[r + 1]; ++e) {
+            d = cursor[in->col_index[e]]++;
+            out->col_index[d] = (uint32_t)r;
+            for (i = 0; i < n; ++i) {
+                for (j = 0; j < n; ++j) {
+                    out->values[(d * size) + _lac_get_sparse_element(n, j, i)]
+                        = in->values[(e * size) + _lac_get_sparse_element(n, i, j)];
+                }
+            }
+        }
+    }
+
+    out->rows = in->cols;
+    out->cols = in->rows;
+    out->nnz = in->nnz;
+    free(cursor);
+
+    return 0;
+}
+
+/**
+ * @brief Views a BSR matrix as a sparse matrix of 3x3 blocks.
+ * @since 19-10-2026
+ * @param[out] view The view, which shares the arrays of __bsr__
+ * @param[in] bsr The matrix
+ */
+static void _lac_view_bsr3(LacCsr_t *view, const LacBsr3_t *bsr) {
+    view->rows = bsr->block_rows;
+    view->cols = bsr->block_cols;
+    view->nnz = bsr->block_count;
+    view->row_start = bsr->row_start;
+    view->col_index = bsr->col_index;
+    view->values = (float*)bsr->blocks;
+}
+
+/**
+ * @brief Moves a sparse matrix of 3x3 blocks into a BSR matrix.
+ * @since 19-10-2026
+ * @param[out] bsr The matrix, which takes ownership of the arrays of __csr__
+ * @param[in] csr The sparse matrix of 3x3 blocks
+ */
+static void _lac_move_to_bsr3(LacBsr3_t *bsr, const LacCsr_t *csr) {
+    bsr->block_rows = csr->rows;
+    bsr->block_cols = csr->cols;
+    bsr->block_count = csr->nnz;
+    bsr->row_start = csr->row_start;
+    bsr->col_index = csr->col_index;
+    bsr->blocks = (mat3*)csr->values;
+}
+
+/**
+ * @brief Finds the first row multiplied by one part of a parallel product.
+ * @since 19-10-2026
+ * @param[in] product The product
+ * @param[in] p The part, where __product__->parts gives one past the last row
+ * @returns The first row of the part
+ */
+static size_t _lac_find_sparse_part(const LacSparseProduct_t *product, const size_t p) {
+    const size_t target = (p * (product->rows + product->row_start[product->rows])) / product->parts;
+    size_t lo = 0, hi = product->rows, mid;
+
+    if (p >= product->parts) {
+        return product->rows;
+    }
+
+    /* The first row where the rows and entries before it reach the target */
+    while (lo < hi) {
+        mid = lo + ((hi - lo) / 2);
+        if ((size_t)product->row_start[mid] + mid < target) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/**
+ * @brief Splits a product into parts and multiplies them, across threads if there is a scheduler.
+ * @since 19-10-2026
+ * @param[out] scheduler The scheduler, or NULL to run on the calling thread
+ * @param[in] func The range task, which multiplies the rows of a range of parts
+ * @param[in,out] product The product
+ */
+static void _lac_run_sparse_product(LacScheduler_t *scheduler, LacRangeFunc_t func, LacSparseProduct_t *product) {
+    const size_t work = product->rows + product->row_start[product->rows];
+
+    product->parts = (work + LAC_SPARSE_PART_SIZE - 1) / LAC_SPARSE_PART_SIZE;
+    if (scheduler != NULL && product->parts > 1) {
+        lac_parallel_for(scheduler, func, product, product->parts, 1);
+    } else if (product->rows > 0) {
+        product->parts = 1;
+        func(product, 0, 1);
+    }
+}
+
+/**
+ * @brief Assembles a CSR matrix from triplets, adding together those at the same position.
+ * @anchor lac_init_csr_anchor
+ * @since 19-10-2026
+ * @param[out] csr The matrix to be initialized
+ * @param[in] rows The number of rows
+ * @param[in] cols The number of columns
+ * @param[in] triplets The entries, in any order
+ * @param[in] count The number of triplets
+ * @returns 0 on success, otherwise -1 and errno is set. If a triplet lies outside the matrix, errno is set to EINVAL
+ */
+LAC_DECL int lac_init_csr(LacCsr_t *csr, const size_t rows, const size_t cols, const LacTriplet_t *triplets, const size_t count) {
+    return _lac_build_sparse(csr, rows, cols, 1, triplets, count);
+}
+
+/**
+ * @brief Releases the memory owned by a CSR matrix.
+ * @since 19-10-2026
+ * @param[out] csr The matrix, which is reset to all zeroes
+ */
+LAC_DECL void lac_free_csr(LacCsr_t *csr) {
+    _lac_free_sparse(csr);
+}
+
+/**
+ * @brief Creates the transpose of a CSR matrix.
+ * @anchor lac_transpose_csr_anchor
+ * @since 19-10-2026
+ * @param[out] out The matrix to be initialized with the transpose; must not be __csr__
+ * @param[in] csr The matrix
+ * @returns 0 on success, otherwise -1 and errno is set
+ */
+LAC_DECL int lac_transpose_csr(LacCsr_t *out, const LacCsr_t *csr) {
+    return _lac_transpose_sparse(out, csr, 1);
+}
+
+/**
+ * @brief Multiplies LAC_BATCH_BLOCK entries of a row at a time, then the rest one at a time.
+ * @since 19-10-2026
+ * @param[in] values The values of the matrix
+ * @param[in] col_index The columns of the matrix
+ * @param[in] x The vector
+ * @param[in] begin The first entry of the row
+ * @param[in] end One past the last entry of the row
+ * @returns The dot product of the row and __x__
+ */
+static LAC_VARIANT_INLINE float _lac_dot_csr_row(
+    const float *values,
+    const uint32_t *col_index,
+    const float *x,
+    const size_t begin,
+    const size_t end
+) {
+    lac_f32x8 acc;
+    float sum = 0.0f;
+    size_t k = begin;
+
+    if (end - begin >= LAC_BATCH_BLOCK) {
+        acc = lac_simd_splat_f32x8(0.0f);
+        for (; k + LAC_BATCH_BLOCK <= end; k += LAC_BATCH_BLOCK) {
+            acc = lac_simd_madd_f32x8(lac_simd_load_f32x8(&values[k]), lac_simd_gather_f32x8(x, &col_index[k]), acc);
+        }
+        sum = lac_simd_sum_f32x8(acc);
+    }
+    for (; k < end; ++k) {
+        sum += values[k] * x[col_index[k]];
+    }
+    return sum;
+}
+
+/**
+ * @brief Body of lac_multiply_csr_vec(), instantiated for each ISA level by LAC_MULTIVERSION().
+ * @since 19-10-2026
+ */
+static LAC_ALWAYS_INLINE void _lac_multiply_csr_vec(float *y, const LacCsr_t *csr, const float *x) {
+    size_t r;
+
+    for (r = 0; r < csr->rows; ++r) {
+        y[r] = _lac_dot_csr_row(csr->values, csr->col_index, x, csr->row_start[r], csr->row_start[r + 1]);
+    }
+}
+
+/**
+ * @brief Multiplies a CSR matrix by a vector.
+ * @anchor lac_multiply_csr_vec_anchor
+ * @since 19-10-2026
+ * @param[out] y The product, of length __csr__->rows; must not overlap __x__
+ * @param[in] csr The matrix
+ * @param[in] x The vector, of length __csr__->cols
+ */
+LAC_MULTIVERSION(lac_multiply_csr_vec, (float *y, const LacCsr_t *csr, const float *x), (y, csr, x))
+
+/**
+ * @brief Range task used by lac_parallel_multiply_csr_vec().
+ * @since 19-10-2026
+ * @param[in] arg The product
+ * @param[in] begin The first part
+ * @param[in] end One past the last part
+ */
+static void _lac_multiply_csr_part(void *arg, size_t begin, size_t end) {
+    const LacSparseProduct_t *product = arg;
+    LacCsr_t rows = *(const LacCsr_t*)product->matrix;
+    const size_t first = _lac_find_sparse_part(product, begin);
+
+    /* The rows of the parts, as a matrix whose row starts still index the whole's entries */
+    rows.rows = _lac_find_sparse_part(product, end) - first;
+    rows.row_start += first;
+    lac_multiply_csr_vec((float*)product->y + first, &rows, product->x);
+}
+
+/**
+ * @brief Multiplies a CSR matrix by a vector, splitting the rows across the threads of __scheduler__.
+ * @anchor lac_parallel_multiply_csr_vec_anchor
+ * @since 19-10-2026
+ * @param[out] scheduler The scheduler, or NULL to run on the calling thread
+ * @param[out] y The product, of length __csr__->rows; must not overlap __x__
+ * @param[in] csr The matrix
+ * @param[in] x The vector, of length __csr__->cols
+ */
+LAC_DECL void lac_parallel_multiply_csr_vec(LacScheduler_t *scheduler, float *y, const LacCsr_t *csr, const float *x) {
+    LacSparseProduct_t product = { csr, x, y, csr->row_start, csr->rows, 0 };
+    _lac_run_sparse_product(scheduler, _lac_multiply_csr_part, &product);
+}
+
+/**
+ * @brief Assembles a BSR matrix of 3x3 blocks from triplets, adding together those at the same position.
+ * @anchor lac_init_bsr3_anchor
+ * @since 19-10-2026
+ *
+ * Each triplet gives a single entry, so the entry at (row, col) lands in block
+ * (row / 3, col / 3). Blocks with any entry given are stored, with the entries
+ * not given set to 0.
+ *
+ * @param[out] bsr The matrix to be initialized
+ * @param[in] block_rows The number of rows of blocks (a third of the rows)
+ * @param[in] block_cols The number of columns of blocks (a third of the columns)
+ * @param[in] triplets The entries, in any order
+ * @param[in] count The number of triplets
+ * @returns 0 on success, otherwise -1 and errno is set. If a triplet lies outside the matrix, errno is set to EINVAL
+ */
+LAC_DECL int lac_init_bsr3(
+    LacBsr3_t *bsr,
+    const size_t block_rows,
+    const size_t block_cols,
+    const LacTriplet_t *triplets,
+    const size_t count
+) {
+    LacCsr_t blocks;
+
+    memset(bsr, 0, sizeof(LacBsr3_t));
+    if (_lac_build_sparse(&blocks, block_rows, block_cols, LAC_BSR_BLOCK, triplets, count) != 0) {
+        return -1;
+    }
+    _lac_move_to_bsr3(bsr, &blocks);
+
+    return 0;
+}
+
+/**
+ * @brief Releases the memory owned by a BSR matrix.
+ * @since 19-10-2026
+ * @param[out] bsr The matrix, which is reset to all zeroes
+ */
+LAC_DECL void lac_free_bsr3(LacBsr3_t *bsr) {
+    free(bsr->row_start);
+    free(bsr->col_index);
+    free(bsr->blocks);
+    memset(bsr, 0, sizeof(LacBsr3_t));
+}
+
+/**
+ * @brief Creates the transpose of a BSR matrix, which transposes each block as well.
+ * @anchor lac_transpose_bsr3_anchor
+ * @since 19-10-2026
+ * @param[out] out The matrix to be initialized with the transpose; must not be __bsr__
+ * @param[in] bsr The matrix
+ * @returns 0 on success, otherwise -1 and errno is set
+ */
+LAC_DECL int lac_transpose_bsr3(LacBsr3_t *out, const LacBsr3_t *bsr) {
+    LacCsr_t view, blocks;
+
+    memset(out, 0, sizeof(LacBsr3_t));
+    _lac_view_bsr3(&view, bsr);
+    if (_lac_transpose_sparse(&blocks, &view, LAC_BSR_BLOCK) != 0) {
+        return -1;
+    }
+    _lac_move_to_bsr3(out, &blocks);
+
+    return 0;
+}
+
+/**
+ * @brief Body of lac_multiply_bsr3_vec(), instantiated for each ISA level by LAC_MULTIVERSION().
+ * @since 19-10-2026
+ */
+static LAC_ALWAYS_INLINE void _lac_multiply_bsr3_vec(vec3 *y, const LacBsr3_t *bsr, const vec3 *x) {
+    const float *block, *v;
+    lac_f32x4 acc;
+    size_t r, e;
+
+    for (r = 0; r < bsr->block_rows; ++r) {
+        acc = lac_simd_splat_f32x4(0.0f);
+        for (e = bsr->row_start[r]; e < bsr->row_start[r + 1]; ++e) {
+            block = bsr->blocks[e];
+            v = x[bsr->col_index[e]];
+            acc = lac_simd_madd_f32x4(lac_simd_load_column_f32x4(block, 3, 0), lac_simd_splat_f32x4(v[0]), acc);
+            acc = lac_simd_madd_f32x4(lac_simd_load_column_f32x4(block, 3, 1), lac_simd_splat_f32x4(v[1]), acc);
+            acc = lac_simd_madd_f32x4(lac_simd_load_column_f32x4(block, 3, 2), lac_simd_splat_f32x4(v[2]), acc);
+        }
+        lac_simd_store_f32x4(y[r], acc, 3);
+    }
+}
+
+/**
+ * @brief Multiplies a BSR matrix by a vector of 3D vectors.
+ * @anchor lac_multiply_bsr3_vec_anchor
+ * @since 19-10-2026
+ * @param[out] y The product, of length __bsr__->block_rows; must not overlap __x__
+ * @param[in] bsr The matrix
+ * @param[in] x The vector, of length __bsr__->block_cols
+ */
+LAC_MULTIVERSION(lac_multiply_bsr3_vec, (vec3 *y, const LacBsr3_t *bsr, const vec3 *x), (y, bsr, x))
+
+/**
+ * @brief Range task used by lac_parallel_multiply_bsr3_vec().
+ * @since 19-10-2026
+ * @param[in] arg The product
+ * @param[in] begin The first part
+ * @param[in] end One past the last part
+ */
+static void _lac_multiply_bsr3_part(void *arg, size_t begin, size_t end) {
+    const LacSparseProduct_t *product = arg;
+    LacBsr3_t rows = *(const LacBsr3_t*)product->matrix;
+    const size_t first = _lac_find_sparse_part(product, begin);
+
+    rows.block_rows = _lac_find_sparse_part(product, end) - first;
+    rows.row_start += first;
+    lac_multiply_bsr3_vec((vec3*)product->y + first, &rows, product->x);
+}
+
+/**
+ * @brief Multiplies a BSR matrix by a vector of 3D vectors, splitting the rows across the threads of __scheduler__.
+ * @anchor lac_parallel_multiply_bsr3_vec_anchor
+ * @since 19-10-2026
+ * @param[out] scheduler The scheduler, or NULL to run on the calling thread
+ * @param[out] y The product, of length __bsr__->block_rows; must not overlap __x__
+ * @param[in] bsr The matrix
+ * @param[in] x The vector, of length __bsr__->block_cols
+ */
+LAC_DECL void lac_parallel_multiply_bsr3_vec(LacScheduler_t *scheduler, vec3 *y, const LacBsr3_t *bsr, const vec3 *x) {
+    LacSparseProduct_t product = { bsr, x, y, bsr->row_start, bsr->block_rows, 0 };
+    _lac_run_sparse_product(scheduler, _lac_multiply_bsr3_part, &product);
+}
@@ -0,0 +1,469 @@
+/**
+ * @file sphere.c
+ * @author Neil Kingdom
+ * @since 19-10-2026
+ * @version 1.0
+ * @brief Contains functions for building, merging and comparing bounding spheres.
+ *
+ * @section sphere Bounding Spheres
+ *
+ * A bounding sphere is the cheapest bound to test against: two spheres
+ * overlap exactly when the distance between their centers is no more than
+ * the sum of their radii, and unlike a box, a sphere stays the same shape
+ * when its object rotates. The catch is that finding the smallest sphere
+ * around a set of points is expensive, so lac_init_sphere_from_points()
+ * instead uses Ritter's method, which gives a sphere that is typically
+ * within 5-20% of the smallest radius in two passes over the points:
+ *
+ * 1. Find the points with the smallest and largest x, y and z components.
+ *    Of those three pairs, start with the sphere whose diameter is the pair
+ *    that lies furthest apart.
+ * 2. For each point outside the current sphere, grow the sphere just enough
+ *    to contain both the old sphere and the point. The new sphere touches
+ *    the point, and the far side of the old sphere.
+ *
+ * After the first few points, almost every point already lies inside the
+ * sphere, so the second pass is dominated by the distance checks rather
+ * than the growth. Those checks are performed on LAC_BATCH_BLOCK points at
+ * once in SoA layout (see batch.c), and a block only falls back to growing
+ * the sphere one point at a time when at least one of its points is outside.
+ *
+ * An empty sphere is represented with a negative radius, so that merging it
+ * with any sphere gives back that sphere, and it overlaps nothing.
+ *
+ * @subsection sphere_related Related Functions
+ *
+ * - @ref lac_init_sphere_from_points_anchor "lac_init_sphere_from_points"
+ * - @ref lac_test_sphere_overlap_anchor "lac_test_sphere_overlap"
+ *
+ * @section spheremerge Merging and Transforming Spheres
+ *
+ * The smallest sphere around two spheres lies on the line through their
+ * centers, touching the far side of each, so its diameter is the distance
+ * between the centers plus both radii (unless one of the spheres already
+ * contains the other). This makes it cheap to compute the bounds of a node
+ * in a hierarchy from the bounds of its children.
+ *
+ * A sphere stays a sphere under rotation and translation, but non-uniform
+ * scaling and shearing stretch it into an ellipsoid. To stay conservative,
+ * the radius is scaled by an upper bound on the most that the upper 3x3
+ * part M of the matrix stretches any direction (its spectral norm). That is
+ * the square root of the largest eigenvalue of M^T M, which by Gershgorin's
+ * theorem is at most the largest sum of the absolute values along a row of
+ * M^T M. When the columns of M are orthogonal, as for a rotation followed
+ * by a scale, M^T M is diagonal and the bound is exact: the length of the
+ * longest column.
+ *
+ * @subsection spheremerge_related Related Functions
+ *
+ * - @ref lac_merge_sphere_anchor "lac_merge_sphere"
+ * - @ref lac_merge_sphere_array_anchor "lac_merge_sphere_array"
+ * - @ref lac_transform_sphere_anchor "lac_transform_sphere"
+ * - @ref lac_transform_sphere_array_anchor "lac_transform_sphere_array"
+ */
+
+#include <math.h>
+
+#include "sphere.h"
+#include "batch.h"
+#include "lac_simd.h"
+#include "lac_dispatch.h"
+
+/**
+ * @brief Gets the element at row r, column c of a 4x4 matrix.
+ * @since 19-10-2026
+ * @param[in] m_in The matrix
+ * @param[in] r The row
+ * @param[in] c The column
+ * @returns The element
+ */
+static inline float _lac_get_mat4_element(const mat4 m_in, const size_t r, const size_t c) {
+#if LAC_IS_ROW_MAJOR
+    return m_in[(r * 4) + c];
+#else
+    return m_in[(c * 4) + r];
+#endif
+}
+
+/**
+ * @brief Initializes an empty sphere.
+ * @since 19-10-2026
+ * @param[out] sphere The sphere to be initialized
+ */
+LAC_DECL void lac_init_sphere(LacSphere_t *sphere) {
+    sphere->center[0] = 0.0f;
+    sphere->center[1] = 0.0f;
+    sphere->center[2] = 0.0f;
+    sphere->radius = -1.0f;
+}
+
+/**
+ * @brief Grows a sphere just enough to contain a point, if it does not already.
+ * @since 19-10-2026
+ * @param[in,out] sphere The sphere
+ * @param[in] v_point The point
+ */
+static inline void _lac_grow_sphere(LacSphere_t *sphere, const vec3 v_point) {
+    float d[3], dist_sq, dist, radius, scale;
+    size_t c;
+
+    dist_sq = 0.0f;
+    for (c = 0; c < 3; ++c) {
+        d[c] = v_point[c] - sphere->center[c];
+        dist_sq += d[c] * d[c];
+    }
+    if (dist_sq <= sphere->radius * sphere->radius) {
+        return;
+    }
+
+    /* The old sphere's far side stays on the new sphere, so the center moves towards the point */
+    dist = sqrtf(dist_sq);
+    radius = 0.5f * (sphere->radius + dist);
+    scale = (radius - sphere->radius) / dist;
+    for (c = 0; c < 3; ++c) {
+        sphere->center[c] += d[c] * scale;
+    }
+    sphere->radius = radius;
+}
+
+/**
+ * @brief Grows a sphere to contain exactly LAC_BATCH_BLOCK points.
+ * @since 19-10-2026
+ * @param[in,out] sphere The sphere
+ * @param[in] points The points
+ */
+static LAC_VARIANT_INLINE void _lac_grow_sphere_block(LacSphere_t *sphere, const vec3 *points) {
+    float soa[3][LAC_BATCH_BLOCK];
+    lac_f32x8 d, dist_sq;
+    size_t i, c;
+
+    /* Transpose the block so that each component fills one 8-wide vector */
+    for (i = 0; i < LAC_BATCH_BLOCK; ++i) {
+        for (c = 0; c < 3; ++c) {
+            soa[c][i] = points[i][c];
+        }
+    }
+
+    dist_sq = lac_simd_splat_f32x8(0.0f);
+    for (c = 0; c < 3; ++c) {
+        d = lac_simd_sub_f32x8(lac_simd_load_f32x8(soa[c]), lac_simd_splat_f32x8(sphere->center[c]));
+        dist_sq = lac_simd_madd_f32x8(d, d, dist_sq);
+    }
+
+    /* Each growth moves the sphere, so the points are then revisited one at a time in order */
+    if (lac_simd_bits_i32x8(lac_simd_lt_f32x8(lac_simd_splat_f32x8(sphere->radius * sphere->radius), dist_sq)) != 0) {
+        for (i = 0; i < LAC_BATCH_BLOCK; ++i) {
+            _lac_grow_sphere(sphere, points[i]);
+        }
+    }
+}
+
+/**
+ * @brief Body of lac_init_sphere_from_points(), instantiated for each ISA level by LAC_MULTIVERSION().
+ * @since 19-10-2026
+ */
+static LAC_ALWAYS_INLINE void _lac_init_sphere_from_points(LacSphere_t *sphere, const vec3 *points, const size_t count) {
+    size_t lo[3] = { 0, 0, 0 }, hi[3] = { 0, 0, 0 };
+    float lo_val[3], hi_val[3], d, dist_sq, best_dist_sq = -1.0f;
+    size_t i, c, k, axis = 0;
+
+    if (count == 0) {
+        lac_init_sphere(sphere);
+        return;
+    }
+
+    /* Start with the sphere across whichever pair of extreme points is furthest apart */
+    for (c = 0; c < 3; ++c) {
+        lo_val[c] = points[0][c];
+        hi_val[c] = points[0][c];
+    }
+    for (i = 1; i < count; ++i) {
+        for (c = 0; c < 3; ++c) {
+            if (points[i][c] < lo_val[c]) {
+                lo_val[c] = points[i][c];
+                lo[c] = i;
+            }
+            if (points[i][c] > hi_val[c]) {
+                hi_val[c] = points[i][c];
+                hi[c] = i;
+            }
+        }
+    }
+    for (c = 0; c < 3; ++c) {
+        dist_sq = 0.0f;
+        for (k = 0; k < 3; ++k) {
+            d = points[hi[c]][k] - points[lo[c]][k];
+            dist_sq += d * d;
+        }
+        if (dist_sq > best_dist_sq) {
+            best_dist_sq = dist_sq;
+            axis = c;
+        }
+    }
+    for (c = 0; c < 3; ++c) {
+        sphere->center[c] = 0.5f * (points[lo[axis]][c] + points[hi[axis]][c]);
+    }
+    sphere->radius = 0.5f * sqrtf(best_dist_sq);
+
+    for (i = 0; i + LAC_BATCH_BLOCK <= count; i += LAC_BATCH_BLOCK) {
+        _lac_grow_sphere_block(sphere, &points[i]);
+    }
+    for (; i < count; ++i) {
+        _lac_grow_sphere(sphere, points[i]);
+    }
+}
+
+/**
+ * @brief Initializes an approximately minimal sphere which contains every point in an array.
+ * @anchor lac_init_sphere_from_points_anchor
+ * @since 19-10-2026
+ *
+ * Every point lies within the sphere, to within rounding. The sphere is usually a little
+ * larger than the smallest possible one (see the section on Ritter's method above).
+ *
+ * @param[out] sphere The sphere to be initialized; it is empty if __count__ is 0
+ * @param[in] points The points
+ * @param[in] count The number of points
+ */
+LAC_MULTIVERSION(lac_init_sphere_from_points, (
+    LacSphere_t *sphere,
+    const vec3 *points,
+    const size_t count
+), (sphere, points, count))
+
+/**
+ * @brief Finds the smallest sphere around two spheres, shared by the single sphere and array functions.
+ * @since 19-10-2026
+ * @param[out] out The merged sphere (may be the same as __a__ or __b__)
+ * @param[in] a The first sphere
+ * @param[in] b The second sphere
+ */
+static LAC_ALWAYS_INLINE void _lac_merge_sphere_pair(LacSphere_t *out, const LacSphere_t *a, const LacSphere_t *b) {
+    float d[3], dist_sq = 0.0f, dist, radius, scale;
+    size_t c;
+
+    for (c = 0; c < 3; ++c) {
+        d[c] = b->center[c] - a->center[c];
+        dist_sq += d[c] * d[c];
+    }
+    dist = sqrtf(dist_sq);
+
+    /* Either sphere may already contain the other, which also covers empty spheres */
+    if (b->radius < 0.0f || dist + b->radius <= a->radius) {
+        *out = *a;
+        return;
+    }
+    if (a->radius < 0.0f || dist + a->radius <= b->radius) {
+        *out = *b;
+        return;
+    }
+
+    radius = 0.5f * (dist + a->radius + b->radius);
+    scale = (radius - a->radius) / dist;
+    for (c = 0; c < 3; ++c) {
+        out->center[c] = a->center[c] + (d[c] * scale);
+    }
+    out->radius = radius;
+}
+
+/**
+ * @brief Gets the smallest sphere which contains two spheres.
+ * @anchor lac_merge_sphere_anchor
+ * @since 19-10-2026
+ * @param[out] out The merged sphere (may be the same as __a__ or __b__)
+ * @param[in] a The first sphere
+ * @param[in] b The second sphere
+ */
+LAC_DECL void lac_merge_sphere(LacSphere_t *out, const LacSphere_t *a, const LacSphere_t *b) {
+    _lac_merge_sphere_pair(out, a, b);
+}
+
+/**
+ * @brief Body of lac_merge_sphere_array(), instantiated for each ISA level by LAC_MULTIVERSION().
+ * @since 19-10-2026
+ */
+static LAC_ALWAYS_INLINE void _lac_merge_sphere_array(
+    LacSphere_t *out,
+    const LacSphere_t *a,
+    const LacSphere_t *b,
+    const size_t count
+) {
+    size_t i;
+
+    for (i = 0; i < count; ++i) {
+        _lac_merge_sphere_pair(&out[i], &a[i], &b[i]);
+    }
+}
+
+/**
+ * @brief Merges each pair of spheres from two arrays, e.g. to build one level of a hierarchy from the level below.
+ * @anchor lac_merge_sphere_array_anchor
+ * @since 19-10-2026
+ * @param[out] out The merged spheres (may be the same array as __a__ or __b__)
+ * @param[in] a The first sphere of each pair
+ * @param[in] b The second sphere of each pair
+ * @param[in] count The number of spheres in __out__, __a__ and __b__
+ */
+LAC_MULTIVERSION(lac_merge_sphere_array, (
+    LacSphere_t *out,
+    const LacSphere_t *a,
+    const LacSphere_t *b,
+    const size_t count
+), (out, a, b, count))
+
+/**
+ * @brief Transforms a sphere, shared by the single sphere and array functions.
+ * @since 19-10-2026
+ * @param[out] out The transformed sphere (may be the same as __sphere__)
+ * @param[in] sphere The sphere to be transformed
+ * @param[in] m_in The transformation matrix
+ */
+static LAC_ALWAYS_INLINE void _lac_transform_sphere_one(LacSphere_t *out, const LacSphere_t *sphere, const float * restrict m_in) {
+    float center[3], gram[3][3], bound, max_bound = 0.0f;
+    size_t r, c, k;
+
+    /* The dot products of the first three columns with each other, i.e. M^T M */
+    for (c = 0; c < 3; ++c) {
+        for (k = 0; k < 3; ++k) {
+            gram[c][k] = 0.0f;
+            for (r = 0; r < 3; ++r) {
+                gram[c][k] += _lac_get_mat4_element(m_in, r, c) * _lac_get_mat4_element(m_in, r, k);
+            }
+        }
+    }
+    for (c = 0; c < 3; ++c) {
+        bound = fabsf(gram[c][0]) + fabsf(gram[c][1]) + fabsf(gram[c][2]);
+        max_bound = (bound > max_bound) ? bound : max_bound;
+    }
+
+    for (r = 0; r < 3; ++r) {
+        center[r] = _lac_get_mat4_element(m_in, r, 3);
+        for (c = 0; c < 3; ++c) {
+            center[r] += _lac_get_mat4_element(m_in, r, c) * sphere->center[c];
+        }
+    }
+
+    for (r = 0; r < 3; ++r) {
+        out->center[r] = center[r];
+    }
+    out->radius = (sphere->radius < 0.0f) ? sphere->radius : sphere->radius * sqrtf(max_bound);
+}
+
+/**
+ * @brief Gets a sphere which contains a sphere after it has been transformed.
+ * @anchor lac_transform_sphere_anchor
+ * @since 19-10-2026
+ *
+ * The matrix is treated as an affine transform, i.e. its bottom row is assumed to be
+ * (0, 0, 0, 1). The radius is scaled by an upper bound on how far the matrix stretches
+ * any direction, so the result always contains the transformed sphere, and is the
+ * smallest such sphere when the first three columns of the matrix are orthogonal (e.g.
+ * any combination of translation, rotation and scale in which the scale is applied first).
+ *
+ * @param[out] out The transformed sphere (may be the same as __sphere__); it is empty if __sphere__ is empty
+ * @param[in] sphere The sphere to be transformed
+ * @param[in] m_in The transformation matrix
+ */
+LAC_DECL void lac_transform_sphere(LacSphere_t *out, const LacSphere_t *sphere, const mat4 m_in) {
+    _lac_transform_sphere_one(out, sphere, m_in);
+}
+
+/**
+ * @brief Body of lac_transform_sphere_array(), instantiated for each ISA level by LAC_MULTIVERSION().
+ * @since 19-10-2026
+ */
+static LAC_ALWAYS_INLINE void _lac_transform_sphere_array(
+    LacSphere_t *out,
+    const LacSphere_t *in,
+    const mat4 * restrict m_in,
+    const size_t count
+) {
+    size_t i;
+
+    for (i = 0; i < count; ++i) {
+        _lac_transform_sphere_one(&out[i], &in[i], m_in[i]);
+    }
+}
+
+/**
+ * @brief Transforms each sphere in an array by its own matrix, e.g. an object's model space bounds by its model matrix.
+ * @anchor lac_transform_sphere_array_anchor
+ * @since 19-10-2026
+ * @param[out] out The transformed spheres (may be the same array as __in__)
+ * @param[in] in The spheres to be transformed
+ * @param[in] m_in The affine transformation matrix of each sphere
+ * @param[in] count The number of spheres in __in__, __out__ and __m_in__
+ */
+LAC_MULTIVERSION(lac_transform_sphere_array, (
+    LacSphere_t *out,
+    const LacSphere_t *in,
+    const mat4 *m_in,
+    const size_t count
+), (out, in, m_in, count))
+
+/**
+ * @brief Checks whether two spheres overlap. Spheres which only touch count as overlapping.
+ * @anchor lac_test_sphere_overlap_anchor
+ * @since 19-10-2026
+ * @param[in] a The first sphere
+ * @param[in] b The second sphere
+ * @returns True if the spheres overlap, or false otherwise
+ */
+LAC_DECL bool lac_test_sphere_overlap(const LacSphere_t *a, const LacSphere_t *b) {
+    float d, dist_sq = 0.0f, radius = a->radius + b->radius;
+    size_t c;
+
+    for (c = 0; c < 3; ++c) {
+        d = b->center[c] - a->center[c];
+        dist_sq += d * d;
+    }
+    return a->radius >= 0.0f && b->radius >= 0.0f && dist_sq <= radius * radius;
+}
+
+/**
+ * @brief Body of lac_test_sphere_overlap_array(), instantiated for each ISA level by LAC_MULTIVERSION_RETURN().
+ * @since 19-10-2026
+ */
+static LAC_ALWAYS_INLINE size_t _lac_test_sphere_overlap_array(
+    bool *results,
+    const LacSphere_t *spheres,
+    const LacSphere_t *query,
+    const size_t count
+) {
+    const float qx = query->center[0], qy = query->center[1], qz = query->center[2], qr = query->radius;
+    float dx, dy, dz, radius;
+    size_t i, found = 0;
+
+    if (qr < 0.0f) {
+        memset(results, 0, count * sizeof(bool));
+        return 0;
+    }
+
+    /* Branch-free, so that the compiler can vectorize across spheres */
+    for (i = 0; i < count; ++i) {
+        dx = spheres[i].center[0] - qx;
+        dy = spheres[i].center[1] - qy;
+        dz = spheres[i].center[2] - qz;
+        radius = spheres[i].radius + qr;
+        results[i] = (spheres[i].radius >= 0.0f) & ((dx * dx) + (dy * dy) + (dz * dz) <= radius * radius);
+        found += results[i];
+    }
+
+    return found;
+}
+
+/**
+ * @brief Checks which spheres in an array overlap a query sphere, e.g. to cull objects against a sphere of influence.
+ * @since 19-10-2026
+ * @param[out] results Whether each sphere overlaps __query__
+ * @param[in] spheres The spheres to be tested
+ * @param[in] query The query sphere
+ * @param[in] count The number of spheres in __spheres__ and __results__
+ * @returns The number of overlapping spheres
+ */
+LAC_MULTIVERSION_RETURN(size_t, lac_test_sphere_overlap_array, (
+    bool *results,
+    const LacSphere_t *spheres,
+    const LacSphere_t *query,
+    const size_t count
+), (results, spheres, query, count))
@@ -0,0 +1,344 @@
+/**
+ * @file stream.c
+ * @author Neil Kingdom
+ * @since 19-10-2026
+ * @version 1.0
+ * @brief Provides drivers which apply the batch kernels to data that does not fit in memory.
+ *
+ * @section stream Streaming Transforms
+ *
+ * When a data set is larger than the available memory, it has to be
+ * processed in pieces (commonly called chunks): read a chunk from disk,
+ * transform it, write it back out and move on to the next one. Done one
+ * step at a time, the CPU sits idle while the disk is busy and vice versa,
+ * so the total time is the sum of the time spent reading, computing and
+ * writing.
+ *
+ * The streaming driver instead overlaps the three steps by giving each of
+ * them its own thread and cycling a small, fixed number of buffers between
+ * them. While the compute stage transforms chunk N, the read stage is
+ * already filling the next buffer with chunk N+1 and the write stage is
+ * draining chunk N-1. Each buffer moves through the states
+ *
+ * ```
+ * EMPTY --(read)--> FILLED --(compute)--> COMPUTED --(write)--> EMPTY
+ * ```
+ *
+ * and a stage only ever waits when the buffer that it needs next is still
+ * owned by another stage. Since transforming a chunk is far quicker than
+ * reading or writing it, the throughput approaches the bandwidth of the
+ * disk rather than the sum of all three steps.
+ *
+ * @subsection stream_related Related Functions
+ *
+ * - @ref lac_stream_multiply_vec4_mat4_anchor "lac_stream_multiply_vec4_mat4"
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdint.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#include "batch.h"
+#include "stream.h"
+
+/* Every buffer may need up to LAC_STREAM_ALIGN bytes of padding in front of it */
+_Static_assert(
+    LAC_STREAM_BUFFERS * (LAC_STREAM_CHUNK_SIZE + LAC_STREAM_ALIGN) <= LAC_THREAD_ARENA_SIZE,
+    "the thread arena must hold the default stream buffers"
+);
+
+typedef enum {
+    LAC_STREAM_EMPTY,
+    LAC_STREAM_FILLED,
+    LAC_STREAM_COMPUTED
+} LacStreamState_t;
+
+typedef struct {
+    uint8_t *data;
+    size_t size;
+    bool last;
+    LacStreamState_t state;
+} LacStreamSlot_t;
+
+typedef struct {
+    LacStreamSlot_t slots[LAC_STREAM_BUFFERS];
+    pthread_mutex_t lock;
+    pthread_cond_t changed;
+    size_t chunk_size;
+    int fd_in;
+    int fd_out;
+    int error;
+} LacStream_t;
+
+/**
+ * @brief Records the first error raised by any stage and wakes all other stages so that they can exit.
+ * @since 19-10-2026
+ * @param[out] stream The stream
+ * @param[in] error The errno value to be recorded
+ */
+static void _lac_fail_stream(LacStream_t *stream, const int error) {
+    pthread_mutex_lock(&stream->lock);
+    if (stream->error == 0) {
+        stream->error = error;
+    }
+    pthread_cond_broadcast(&stream->changed);
+    pthread_mutex_unlock(&stream->lock);
+}
+
+/**
+ * @brief Blocks until __slot__ reaches __state__ or another stage fails.
+ * @since 19-10-2026
+ * @param[in] stream The stream
+ * @param[in] slot The buffer to wait for
+ * @param[in] state The state which the calling stage consumes
+ * @returns true if the slot is ready, or false if the stream has failed
+ */
+static bool _lac_wait_stream_slot(LacStream_t *stream, LacStreamSlot_t *slot, const LacStreamState_t state) {
+    bool ready;
+
+    pthread_mutex_lock(&stream->lock);
+    while (slot->state != state && stream->error == 0) {
+        pthread_cond_wait(&stream->changed, &stream->lock);
+    }
+    ready = (stream->error == 0);
+    pthread_mutex_unlock(&stream->lock);
+
+    return ready;
+}
+
+/**
+ * @brief Hands __slot__ over to the next stage.
+ * @since 19-10-2026
+ * @param[out] stream The stream
+ * @param[out] slot The buffer being handed over
+ * @param[in] state The state which the next stage consumes
+ */
+static void _lac_advance_stream_slot(LacStream_t *stream, LacStreamSlot_t *slot, const LacStreamState_t state) {
+    pthread_mutex_lock(&stream->lock);
+    slot->state = state;
+    pthread_cond_broadcast(&stream->changed);
+    pthread_mutex_unlock(&stream->lock);
+}
+
+/**
+ * @brief Releases the buffers of a stream, either back to the heap or to __scratch__.
+ * @since 19-10-2026
+ * @param[out] stream The stream
+ * @param[out] scratch The arena that the buffers were allocated from, or NULL
+ * @param[in] mark The position of __scratch__ before the buffers were allocated
+ */
+static void _lac_free_stream_buffers(LacStream_t *stream, LacArena_t *scratch, const LacArenaMark_t mark) {
+    size_t i;
+
+    if (scratch != NULL) {
+        lac_reset_arena_to_mark(scratch, mark);
+    } else {
+        for (i = 0; i < LAC_STREAM_BUFFERS; ++i) {
+            free(stream->slots[i].data);
+        }
+    }
+}
+
+/**
+ * @brief Read stage; fills each empty buffer with the next chunk of the input.
+ * @since 19-10-2026
+ * @param[in] arg The stream
+ * @returns NULL
+ */
+static void *_lac_read_stream(void *arg) {
+    LacStream_t *stream = arg;
+    LacStreamSlot_t *slot;
+    size_t seq, filled;
+    ssize_t ret;
+
+    for (seq = 0; ; ++seq) {
+        slot = &stream->slots[seq % LAC_STREAM_BUFFERS];
+        if (!_lac_wait_stream_slot(stream, slot, LAC_STREAM_EMPTY)) {
+            return NULL;
+        }
+
+        /* Short reads are retried so that every chunk but the last is completely full */
+        filled = 0;
+        while (filled < stream->chunk_size) {
+            ret = read(stream->fd_in, slot->data + filled, stream->chunk_size - filled);
+            if (ret < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                _lac_fail_stream(stream, errno);
+                return NULL;
+            } else if (ret == 0) {
+                break;
+            }
+            filled += (size_t)ret;
+        }
+
+        slot->size = filled;
+        slot->last = (filled < stream->chunk_size);
+        _lac_advance_stream_slot(stream, slot, LAC_STREAM_FILLED);
+
+        if (slot->last) {
+            return NULL;
+        }
+    }
+}
+
+/**
+ * @brief Write stage; drains each computed buffer to the output.
+ * @since 19-10-2026
+ * @param[in] arg The stream
+ * @returns NULL
+ */
+static void *_lac_write_stream(void *arg) {
+    LacStream_t *stream = arg;
+    LacStreamSlot_t *slot;
+    size_t seq, written;
+    ssize_t ret;
+    bool last;
+
+    for (seq = 0; ; ++seq) {
+        slot = &stream->slots[seq % LAC_STREAM_BUFFERS];
+        if (!_lac_wait_stream_slot(stream, slot, LAC_STREAM_COMPUTED)) {
+            return NULL;
+        }
+
+        written = 0;
+        while (written < slot->size) {
+            ret = write(stream->fd_out, slot->data + written, slot->size - written);
+            if (ret < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                _lac_fail_stream(stream, errno);
+                return NULL;
+            }
+            written += (size_t)ret;
+        }
+
+        last = slot->last;
+        _lac_advance_stream_slot(stream, slot, LAC_STREAM_EMPTY);
+
+        if (last) {
+            return NULL;
+        }
+    }
+}
+
+/**
+ * @brief Streams an array of vectors of length 4 from one file descriptor to another, multiplying each by a 4x4 matrix.
+ * @anchor lac_stream_multiply_vec4_mat4_anchor
+ * @since 19-10-2026
+ *
+ * The input is read until end of file as tightly packed vec4 elements (e.g. the
+ * elements of an array file following its header; see mapfile.c), and the products
+ * are written to __fd_out__ in the same order. Reading, computing and writing run
+ * concurrently on separate threads using LAC_STREAM_BUFFERS buffers of __chunk_size__
+ * bytes each, so memory usage is bounded regardless of the size of the input. The
+ * descriptors are used from their current offsets and are not closed.
+ *
+ * @param[in] fd_out The file descriptor that the products are written to
+ * @param[in] fd_in The file descriptor that the vectors are read from
+ * @param[in] m_in The input matrix
+ * @param[in] chunk_size The size of each buffer in bytes, or 0 for LAC_STREAM_CHUNK_SIZE
+ * @param[in] scratch An arena to allocate the buffers from, or NULL to allocate them from the heap
+ * @returns 0 on success, otherwise -1 and errno is set. If the input ends part way through a vector, errno is set to EINVAL
+ */
+LAC_DECL int lac_stream_multiply_vec4_mat4(
+    const int fd_out,
+    const int fd_in,
+    const mat4 m_in,
+    const size_t chunk_size,
+    LacArena_t *scratch
+) {
+    LacStream_t stream;
+    LacArenaMark_t mark = 0;
+    LacStreamSlot_t *slot;
+    pthread_t reader, writer;
+    size_t seq, i;
+    bool last;
+    int ret;
+
+    memset(&stream, 0, sizeof(stream));
+    stream.fd_in = fd_in;
+    stream.fd_out = fd_out;
+    stream.chunk_size = (chunk_size == 0) ? LAC_STREAM_CHUNK_SIZE : chunk_size;
+    stream.chunk_size = (stream.chunk_size + (LAC_STREAM_ALIGN - 1)) & ~((size_t)LAC_STREAM_ALIGN - 1);
+
+    if (scratch != NULL) {
+        mark = lac_get_arena_mark(scratch);
+    }
+
+    for (i = 0; i < LAC_STREAM_BUFFERS; ++i) {
+        if (scratch != NULL) {
+            stream.slots[i].data = lac_alloc_arena(scratch, stream.chunk_size, LAC_STREAM_ALIGN);
+        } else if (posix_memalign((void**)&stream.slots[i].data, LAC_STREAM_ALIGN, stream.chunk_size) != 0) {
+            stream.slots[i].data = NULL;
+        }
+
+        if (stream.slots[i].data == NULL) {
+            LAC_LOG("Failed to allocate stream buffer", LAC_ERROR);
+            _lac_free_stream_buffers(&stream, scratch, mark);
+            errno = ENOMEM;
+            return -1;
+        }
+    }
+
+    pthread_mutex_init(&stream.lock, NULL);
+    pthread_cond_init(&stream.changed, NULL);
+
+    if (pthread_create(&reader, NULL, _lac_read_stream, &stream) != 0) {
+        stream.error = EAGAIN;
+        goto cleanup;
+    }
+    if (pthread_create(&writer, NULL, _lac_write_stream, &stream) != 0) {
+        _lac_fail_stream(&stream, EAGAIN);
+        pthread_join(reader, NULL);
+        goto cleanup;
+    }
+
+    /* The calling thread acts as the compute stage */
+    for (seq = 0; ; ++seq) {
+        slot = &stream.slots[seq % LAC_STREAM_BUFFERS];
+        if (!_lac_wait_stream_slot(&stream, slot, LAC_STREAM_FILLED)) {
+            break;
+        }
+
+        if (slot->size % sizeof(vec4) != 0) {
+            _lac_fail_stream(&stream, EINVAL);
+            break;
+        }
+
+        lac_multiply_vec4_mat4_array(
+            (vec4*)slot->data,
+            (const vec4*)slot->data,
+            m_in,
+            slot->size / sizeof(vec4)
+        );
+
+        last = slot->last;
+        _lac_advance_stream_slot(&stream, slot, LAC_STREAM_COMPUTED);
+
+        if (last) {
+            break;
+        }
+    }
+
+    pthread_join(reader, NULL);
+    pthread_join(writer, NULL);
+
+cleanup:
+    pthread_cond_destroy(&stream.changed);
+    pthread_mutex_destroy(&stream.lock);
+    _lac_free_stream_buffers(&stream, scratch, mark);
+
+    ret = stream.error;
+    if (ret != 0) {
+        LAC_LOG("Failed to stream array", LAC_ERROR);
+        errno = ret;
+        return -1;
+    }
+
+    return 0;
+}
@@ -75,9 +75,65 @@
  *
  * - @ref lac_get_point_at_mat4_anchor "lac_get_point_at_mat4"
  * - @ref lac_invert_mat4_anchor "lac_invert_mat4"
+ *
+ * @section decompose Decomposition
+ *
+ * Transforms often arrive already baked into a matrix, e.g. from an asset
+ * file, when what is wanted are its parts: to blend between two poses, or
+ * to store them in fewer bytes. An affine matrix can be split into a
+ * translation, which is simply its last column, and a 3x3 part, which is
+ * taken apart as rotation * shear * scale. The columns of the 3x3 part are
+ * orthonormalized one after another; the length of each is its scale, and
+ * whatever it had along the columns before it is the shear. If the
+ * determinant is negative, the transform mirrors space, and no rotation
+ * can do that, so the reflection is given to the x scale. The rotation is
+ * returned both as a quaternion and as the angles taken by
+ * lac_get_rotation_mat4(). The array version works on 8 matrices at a time.
+ *
+ * @subsection decompose_related Related Functions
+ *
+ * - @ref lac_decompose_mat4_anchor "lac_decompose_mat4"
+ * - @ref lac_decompose_mat4_array_anchor "lac_decompose_mat4_array"
+ *
+ * @section orthonormal Orthonormalization
+ *
+ * A rotation matrix which is updated a little at a time, e.g. by
+ * multiplying in a small turn every frame, slowly picks up rounding
+ * error, until its axes are no longer quite unit length or quite at
+ * right angles. Rather than rebuilding it from angles every so often, it
+ * can simply be pulled back to the nearest rotation. Gram-Schmidt does
+ * so by keeping the direction of the x axis, making the y axis
+ * perpendicular to it, and then the z axis perpendicular to both, which
+ * is cheap but puts most of the correction into y and z. The symmetric correction instead finds the
+ * nearest orthonormal matrix, i.e. the orthonormal factor of the polar
+ * decomposition, which treats every axis alike. Both are run on 8
+ * matrices at a time.
+ *
+ * @subsection orthonormal_related Related Functions
+ *
+ * - @ref lac_orthonormalize_mat3_array_anchor "lac_orthonormalize_mat3_array"
+ * - @ref lac_orthonormalize_mat4_array_anchor "lac_orthonormalize_mat4_array"
  */
 
+#include <float.h>
+
 #include "transforms.h"
+#include "batch.h"
+#include "lac_simd.h"
+#include "lac_dispatch.h"
+#include "lac_trig.h"
+
+/* The smallest scale, relative to the largest, below which a matrix is taken to be singular */
+#define LAC_TRANSFORM_SINGULAR_EPSILON 1e-6f
+
+/* The cosine of ry below which rx and rz can no longer be told apart */
+#define LAC_DECOMPOSE_GIMBAL_EPSILON 1e-6f
+
+/* The most Newton steps taken by the symmetric orthonormalization, which even badly scaled matrices stay within */
+#define LAC_ORTHONORMALIZE_MAX_ITERATIONS 10
+
+/* The squared change in a Newton step, below which the next step would no longer change a float */
+#define LAC_ORTHONORMALIZE_TOLERANCE 1e-8f
 
 /**
  * The identity matrix is a special matrix that is essentially
@@ -505,38 +561,31 @@ LAC_DECL void lac_get_point_at_mat4(
  * @param[in] m_in The matrix to be inverted
  */
 LAC_DECL void lac_invert_mat4(mat4 m_out, const mat4 m_in) {
-    float dot_prod;
+    lac_f32x4 dot_prods;
     mat4 _m_out = { 0 };
 
-    lac_calc_dot_prod_vec3(
-        &dot_prod,
-        (vec3){ m_in[3], m_in[7], m_in[11] },
-        (vec3){ m_in[0], m_in[4], m_in[8] }
-    );
+    /*
+     * Dot the translation with the first three columns at once, as the first three rows
+     * scaled by its components; the fourth lane is never read
+     */
+    dot_prods = lac_simd_mul_f32x4(lac_simd_load_f32x4(&m_in[0], 4), lac_simd_splat_f32x4(m_in[3]));
+    dot_prods = lac_simd_madd_f32x4(lac_simd_load_f32x4(&m_in[4], 4), lac_simd_splat_f32x4(m_in[7]), dot_prods);
+    dot_prods = lac_simd_madd_f32x4(lac_simd_load_f32x4(&m_in[8], 4), lac_simd_splat_f32x4(m_in[11]), dot_prods);
+
     _m_out[0] = m_in[0];
     _m_out[1] = m_in[4];
     _m_out[2] = m_in[8];
-    _m_out[3] = -dot_prod;
+    _m_out[3] = -lac_simd_get_f32x4(dot_prods, 0);
 
-    lac_calc_dot_prod_vec3(
-        &dot_prod,
-        (vec3){ m_in[3], m_in[7], m_in[11] },
-        (vec3){ m_in[1], m_in[5], m_in[9] }
-    );
     _m_out[4] = m_in[1];
     _m_out[5] = m_in[5];
     _m_out[6] = m_in[9];
-    _m_out[7] = -dot_prod;
+    _m_out[7] = -lac_simd_get_f32x4(dot_prods, 1);
 
-    lac_calc_dot_prod_vec3(
-        &dot_prod,
-        (vec3){ m_in[3], m_in[7], m_in[11] },
-        (vec3){ m_in[2], m_in[6], m_in[10] }
-    );
     _m_out[8]  = m_in[2];
     _m_out[9]  = m_in[6];
     _m_out[10] = m_in[10];
-    _m_out[11] = -dot_prod;
+    _m_out[11] = -lac_simd_get_f32x4(dot_prods, 2);
 
     _m_out[12] = 0.0f;
     _m_out[13] = 0.0f;
@@ -573,3 +622,559 @@ LAC_DECL void lac_get_projection_mat4(
 
     memcpy(m_out, proj_mat, sizeof(mat4));
 }
+
+/**
+ * @brief Gets the index of the element at row __r__ and column __c__ of an __n__ x __n__ matrix, whatever its storage order.
+ * @since 19-10-2026
+ * @param[in] n The number of rows and columns
+ * @param[in] r The row
+ * @param[in] c The column
+ * @returns The index
+ */
+static inline size_t _lac_get_element_index(const size_t n, const size_t r, const size_t c) {
+#if LAC_IS_ROW_MAJOR
+    return (r * n) + c;
+#else
+    return (c * n) + r;
+#endif
+}
+
+/**
+ * @brief Orthonormalizes the columns of exactly LAC_BATCH_BLOCK 3x3 matrices, one column after another.
+ *
+ * The first column keeps its direction, and each later column loses whatever it had
+ * along the columns before it.
+ *
+ * @since 19-10-2026
+ * @param[out] rot The orthonormal matrices, as rot[row][column][lane], or the identity where the matrix is singular
+ * @param[out] lengths The length of each column once the earlier columns are taken out of it
+ * @param[out] dots What column 1 had along column 0, then what column 2 had along columns 0 and 1
+ * @param[in] elem The matrices, as elem[row][column][lane]
+ * @param[in] sign Either 1 or -1 in each lane, by which the first column is multiplied
+ * @returns A bitmask where bit i is set if matrix i is singular
+ */
+static LAC_VARIANT_INLINE unsigned _lac_gram_schmidt_block(
+    float rot[3][3][LAC_BATCH_BLOCK],
+    float lengths[3][LAC_BATCH_BLOCK],
+    float dots[3][LAC_BATCH_BLOCK],
+    float elem[3][4][LAC_BATCH_BLOCK],
+    const float *sign
+) {
+    const lac_f32x8 zero = lac_simd_splat_f32x8(0.0f), one = lac_simd_splat_f32x8(1.0f);
+    const lac_f32x8 tiny = lac_simd_splat_f32x8(FLT_MIN);
+    lac_f32x8 c0[3], c1[3], c2[3], sx, sy, sz, inv, d01, d02, d12;
+    lac_i32x8 singular;
+    size_t r;
+
+    for (r = 0; r < 3; ++r) {
+        c0[r] = lac_simd_load_f32x8(elem[r][0]);
+        c1[r] = lac_simd_load_f32x8(elem[r][1]);
+        c2[r] = lac_simd_load_f32x8(elem[r][2]);
+    }
+
+    sx = lac_simd_mul_f32x8(c0[0], c0[0]);
+    sx = lac_simd_madd_f32x8(c0[1], c0[1], sx);
+    sx = lac_simd_sqrt_f32x8(lac_simd_madd_f32x8(c0[2], c0[2], sx));
+    inv = lac_simd_div_f32x8(lac_simd_load_f32x8(sign), lac_simd_max_f32x8(sx, tiny));
+    for (r = 0; r < 3; ++r) {
+        c0[r] = lac_simd_mul_f32x8(c0[r], inv);
+    }
+
+    d01 = lac_simd_mul_f32x8(c0[0], c1[0]);
+    d01 = lac_simd_madd_f32x8(c0[1], c1[1], d01);
+    d01 = lac_simd_madd_f32x8(c0[2], c1[2], d01);
+    for (r = 0; r < 3; ++r) {
+        c1[r] = lac_simd_sub_f32x8(c1[r], lac_simd_mul_f32x8(d01, c0[r]));
+    }
+    sy = lac_simd_mul_f32x8(c1[0], c1[0]);
+    sy = lac_simd_madd_f32x8(c1[1], c1[1], sy);
+    sy = lac_simd_sqrt_f32x8(lac_simd_madd_f32x8(c1[2], c1[2], sy));
+    inv = lac_simd_div_f32x8(one, lac_simd_max_f32x8(sy, tiny));
+    for (r = 0; r < 3; ++r) {
+        c1[r] = lac_simd_mul_f32x8(c1[r], inv);
+    }
+
+    d02 = lac_simd_mul_f32x8(c0[0], c2[0]);
+    d02 = lac_simd_madd_f32x8(c0[1], c2[1], d02);
+    d02 = lac_simd_madd_f32x8(c0[2], c2[2], d02);
+    d12 = lac_simd_mul_f32x8(c1[0], c2[0]);
+    d12 = lac_simd_madd_f32x8(c1[1], c2[1], d12);
+    d12 = lac_simd_madd_f32x8(c1[2], c2[2], d12);
+    for (r = 0; r < 3; ++r) {
+        c2[r] = lac_simd_sub_f32x8(c2[r], lac_simd_madd_f32x8(d02, c0[r], lac_simd_mul_f32x8(d12, c1[r])));
+    }
+    sz = lac_simd_mul_f32x8(c2[0], c2[0]);
+    sz = lac_simd_madd_f32x8(c2[1], c2[1], sz);
+    sz = lac_simd_sqrt_f32x8(lac_simd_madd_f32x8(c2[2], c2[2], sz));
+    inv = lac_simd_div_f32x8(one, lac_simd_max_f32x8(sz, tiny));
+    for (r = 0; r < 3; ++r) {
+        c2[r] = lac_simd_mul_f32x8(c2[r], inv);
+    }
+
+    singular = lac_simd_le_f32x8(
+        lac_simd_min_f32x8(sx, lac_simd_min_f32x8(sy, sz)),
+        lac_simd_mul_f32x8(lac_simd_splat_f32x8(LAC_TRANSFORM_SINGULAR_EPSILON), lac_simd_max_f32x8(sx, lac_simd_max_f32x8(sy, sz)))
+    );
+    for (r = 0; r < 3; ++r) {
+        lac_simd_store_f32x8(rot[r][0], lac_simd_select_f32x8(singular, (r == 0) ? one : zero, c0[r]));
+        lac_simd_store_f32x8(rot[r][1], lac_simd_select_f32x8(singular, (r == 1) ? one : zero, c1[r]));
+        lac_simd_store_f32x8(rot[r][2], lac_simd_select_f32x8(singular, (r == 2) ? one : zero, c2[r]));
+    }
+    lac_simd_store_f32x8(lengths[0], sx);
+    lac_simd_store_f32x8(lengths[1], sy);
+    lac_simd_store_f32x8(lengths[2], sz);
+    lac_simd_store_f32x8(dots[0], d01);
+    lac_simd_store_f32x8(dots[1], d02);
+    lac_simd_store_f32x8(dots[2], d12);
+
+    return lac_simd_bits_i32x8(singular);
+}
+
+/**
+ * @brief Finds the nearest orthonormal matrices to exactly LAC_BATCH_BLOCK 3x3 matrices.
+ *
+ * This is the orthonormal factor of the polar decomposition, found by the scaled Newton
+ * iteration X = (g * X + X^-T / g) / 2, where g evens out the sizes of X and its inverse.
+ * Near an orthonormal matrix, each step squares the error, so matrices which have only
+ * drifted are done after one or two steps.
+ *
+ * @since 19-10-2026
+ * @param[out] rot The orthonormal matrices, as rot[row][column][lane], or the identity where the matrix is singular
+ * @param[in] elem The matrices, as elem[row][column][lane]
+ * @returns A bitmask where bit i is set if matrix i is singular
+ */
+static LAC_VARIANT_INLINE unsigned _lac_polar_block(float rot[3][3][LAC_BATCH_BLOCK], float elem[3][4][LAC_BATCH_BLOCK]) {
+    const lac_f32x8 zero = lac_simd_splat_f32x8(0.0f), one = lac_simd_splat_f32x8(1.0f), half = lac_simd_splat_f32x8(0.5f);
+    lac_f32x8 col[3][3], cof[3][3], det, norm_sq, cof_sq, gamma, inv, change, next;
+    lac_i32x8 singular;
+    size_t iter, c, r;
+
+    for (c = 0; c < 3; ++c) {
+        for (r = 0; r < 3; ++r) {
+            col[c][r] = lac_simd_load_f32x8(elem[r][c]);
+        }
+    }
+
+    /*
+     * A singular matrix has no inverse to average with, so it is swapped for the identity.
+     * It is singular when its determinant is tiny next to the product of its column lengths.
+     */
+    det = lac_simd_mul_f32x8(col[0][0], lac_simd_sub_f32x8(lac_simd_mul_f32x8(col[1][1], col[2][2]), lac_simd_mul_f32x8(col[1][2], col[2][1])));
+    det = lac_simd_madd_f32x8(col[0][1], lac_simd_sub_f32x8(lac_simd_mul_f32x8(col[1][2], col[2][0]), lac_simd_mul_f32x8(col[1][0], col[2][2])), det);
+    det = lac_simd_madd_f32x8(col[0][2], lac_simd_sub_f32x8(lac_simd_mul_f32x8(col[1][0], col[2][1]), lac_simd_mul_f32x8(col[1][1], col[2][0])), det);
+    norm_sq = one;
+    for (c = 0; c < 3; ++c) {
+        norm_sq = lac_simd_mul_f32x8(norm_sq, lac_simd_madd_f32x8(col[c][0], col[c][0], lac_simd_madd_f32x8(col[c][1], col[c][1], lac_simd_mul_f32x8(col[c][2], col[c][2]))));
+    }
+    singular = lac_simd_le_f32x8(
+        lac_simd_mul_f32x8(det, det),
+        lac_simd_mul_f32x8(lac_simd_splat_f32x8(LAC_TRANSFORM_SINGULAR_EPSILON * LAC_TRANSFORM_SINGULAR_EPSILON), norm_sq)
+    );
+    for (c = 0; c < 3; ++c) {
+        for (r = 0; r < 3; ++r) {
+            col[c][r] = lac_simd_select_f32x8(singular, (r == c) ? one : zero, col[c][r]);
+        }
+    }
+
+    for (iter = 0; iter < LAC_ORTHONORMALIZE_MAX_ITERATIONS; ++iter) {
+        /* The columns of the cofactor matrix, which is det(X) * X^-T */
+        for (c = 0; c < 3; ++c) {
+            for (r = 0; r < 3; ++r) {
+                cof[c][r] = lac_simd_sub_f32x8(
+                    lac_simd_mul_f32x8(col[(c + 1) % 3][(r + 1) % 3], col[(c + 2) % 3][(r + 2) % 3]),
+                    lac_simd_mul_f32x8(col[(c + 1) % 3][(r + 2) % 3], col[(c + 2) % 3][(r + 1) % 3])
+                );
+            }
+        }
+        det = lac_simd_mul_f32x8(col[0][0], cof[0][0]);
+        det = lac_simd_madd_f32x8(col[0][1], cof[0][1], det);
+        det = lac_simd_madd_f32x8(col[0][2], cof[0][2], det);
+
+        norm_sq = zero;
+        cof_sq = zero;
+        for (c = 0; c < 3; ++c) {
+            for (r = 0; r < 3; ++r) {
+                norm_sq = lac_simd_madd_f32x8(col[c][r], col[c][r], norm_sq);
+                cof_sq = lac_simd_madd_f32x8(cof[c][r], cof[c][r], cof_sq);
+            }
+        }
+
+        /* g^2 = |X^-1| / |X|, where |X^-1| = |cof| / |det| */
+        gamma = lac_simd_sqrt_f32x8(lac_simd_div_f32x8(
+            lac_simd_sqrt_f32x8(lac_simd_div_f32x8(cof_sq, norm_sq)),
+            lac_simd_abs_f32x8(det)
+        ));
+        inv = lac_simd_div_f32x8(half, lac_simd_mul_f32x8(gamma, det));
+        gamma = lac_simd_mul_f32x8(gamma, half);
+
+        change = zero;
+        for (c = 0; c < 3; ++c) {
+            for (r = 0; r < 3; ++r) {
+                next = lac_simd_madd_f32x8(gamma, col[c][r], lac_simd_mul_f32x8(inv, cof[c][r]));
+                change = lac_simd_madd_f32x8(lac_simd_sub_f32x8(next, col[c][r]), lac_simd_sub_f32x8(next, col[c][r]), change);
+                col[c][r] = next;
+            }
+        }
+
+        /* The next step would square this change, which is then below the precision of a float */
+        if (lac_simd_bits_i32x8(lac_simd_le_f32x8(change, lac_simd_splat_f32x8(LAC_ORTHONORMALIZE_TOLERANCE))) == 0xffu) {
+            break;
+        }
+    }
+
+    for (c = 0; c < 3; ++c) {
+        for (r = 0; r < 3; ++r) {
+            lac_simd_store_f32x8(rot[r][c], col[c][r]);
+        }
+    }
+
+    return lac_simd_bits_i32x8(singular);
+}
+
+/**
+ * @brief Decomposes exactly LAC_BATCH_BLOCK matrices, one in each lane.
+ * @since 19-10-2026
+ * @param[out] parts The parts of each matrix
+ * @param[in] m_in The matrices
+ * @returns A bitmask where bit i is set if matrix i is singular
+ */
+static LAC_VARIANT_INLINE unsigned _lac_decompose_block(LacTransformParts_t *parts, const mat4 *m_in) {
+    float elem[3][4][LAC_BATCH_BLOCK], rot[3][3][LAC_BATCH_BLOCK], lengths[3][LAC_BATCH_BLOCK];
+    float dots[3][LAC_BATCH_BLOCK], shear[3][LAC_BATCH_BLOCK], sign[LAC_BATCH_BLOCK];
+    float quat[4][LAC_BATCH_BLOCK], euler[3][LAC_BATCH_BLOCK], num[3][LAC_BATCH_BLOCK], den[3][LAC_BATCH_BLOCK];
+    const lac_f32x8 zero = lac_simd_splat_f32x8(0.0f), one = lac_simd_splat_f32x8(1.0f);
+    const lac_f32x8 tiny = lac_simd_splat_f32x8(FLT_MIN);
+    lac_f32x8 c0[3], c1[3], c2[3], det, flip;
+    lac_f32x8 m00, m01, m02, m10, m11, m12, m20, m21, m22, qw, qx, qy, qz, best, big, inv;
+    lac_f32x8 a, b, c, d, e, f, x, y, z, w, cy;
+    lac_i32x8 reflected, gimbal, pick;
+    unsigned reflected_bits, singular_bits;
+    size_t i, r, k;
+
+    /* Transpose the block, so that each lane holds one matrix */
+    for (r = 0; r < 3; ++r) {
+        for (k = 0; k < 4; ++k) {
+            for (i = 0; i < LAC_BATCH_BLOCK; ++i) {
+                elem[r][k][i] = m_in[i][_lac_get_element_index(4, r, k)];
+            }
+        }
+    }
+
+    for (r = 0; r < 3; ++r) {
+        c0[r] = lac_simd_load_f32x8(elem[r][0]);
+        c1[r] = lac_simd_load_f32x8(elem[r][1]);
+        c2[r] = lac_simd_load_f32x8(elem[r][2]);
+    }
+
+    /* A negative determinant means that the transform is a reflection, which is folded into the x scale */
+    det = lac_simd_mul_f32x8(c0[0], lac_simd_sub_f32x8(lac_simd_mul_f32x8(c1[1], c2[2]), lac_simd_mul_f32x8(c1[2], c2[1])));
+    det = lac_simd_madd_f32x8(c0[1], lac_simd_sub_f32x8(lac_simd_mul_f32x8(c1[2], c2[0]), lac_simd_mul_f32x8(c1[0], c2[2])), det);
+    det = lac_simd_madd_f32x8(c0[2], lac_simd_sub_f32x8(lac_simd_mul_f32x8(c1[0], c2[1]), lac_simd_mul_f32x8(c1[1], c2[0])), det);
+    reflected = lac_simd_lt_f32x8(det, zero);
+    lac_simd_store_f32x8(sign, lac_simd_select_f32x8(reflected, lac_simd_splat_f32x8(-1.0f), one));
+
+    /*
+     * The length of each orthonormalized column is its scale, and what it had along the
+     * columns before it is the shear. Singular matrices have no rotation to speak of, so
+     * they are given none, and no shear or reflection either.
+     */
+    singular_bits = _lac_gram_schmidt_block(rot, lengths, dots, elem, sign);
+    reflected_bits = lac_simd_bits_i32x8(reflected) & ~singular_bits;
+    lac_simd_store_f32x8(shear[0], lac_simd_div_f32x8(lac_simd_load_f32x8(dots[0]), lac_simd_max_f32x8(lac_simd_load_f32x8(lengths[1]), tiny)));
+    lac_simd_store_f32x8(shear[1], lac_simd_div_f32x8(lac_simd_load_f32x8(dots[1]), lac_simd_max_f32x8(lac_simd_load_f32x8(lengths[2]), tiny)));
+    lac_simd_store_f32x8(shear[2], lac_simd_div_f32x8(lac_simd_load_f32x8(dots[2]), lac_simd_max_f32x8(lac_simd_load_f32x8(lengths[2]), tiny)));
+
+    m00 = lac_simd_load_f32x8(rot[0][0]);
+    m01 = lac_simd_load_f32x8(rot[0][1]);
+    m02 = lac_simd_load_f32x8(rot[0][2]);
+    m10 = lac_simd_load_f32x8(rot[1][0]);
+    m11 = lac_simd_load_f32x8(rot[1][1]);
+    m12 = lac_simd_load_f32x8(rot[1][2]);
+    m20 = lac_simd_load_f32x8(rot[2][0]);
+    m21 = lac_simd_load_f32x8(rot[2][1]);
+    m22 = lac_simd_load_f32x8(rot[2][2]);
+
+    /*
+     * The quaternion is taken from whichever of its components is largest, which keeps
+     * the division well away from 0. Each candidate is 4 times that component squared.
+     */
+    qw = lac_simd_add_f32x8(one, lac_simd_add_f32x8(m00, lac_simd_add_f32x8(m11, m22)));
+    qx = lac_simd_add_f32x8(one, lac_simd_sub_f32x8(m00, lac_simd_add_f32x8(m11, m22)));
+    qy = lac_simd_add_f32x8(one, lac_simd_sub_f32x8(m11, lac_simd_add_f32x8(m00, m22)));
+    qz = lac_simd_add_f32x8(one, lac_simd_sub_f32x8(m22, lac_simd_add_f32x8(m00, m11)));
+    best = lac_simd_max_f32x8(lac_simd_max_f32x8(qw, qx), lac_simd_max_f32x8(qy, qz));
+    big = lac_simd_mul_f32x8(lac_simd_splat_f32x8(0.5f), lac_simd_sqrt_f32x8(best));
+    inv = lac_simd_div_f32x8(lac_simd_splat_f32x8(0.25f), big);
+
+    a = lac_simd_mul_f32x8(lac_simd_sub_f32x8(m21, m12), inv);
+    b = lac_simd_mul_f32x8(lac_simd_sub_f32x8(m02, m20), inv);
+    c = lac_simd_mul_f32x8(lac_simd_sub_f32x8(m10, m01), inv);
+    d = lac_simd_mul_f32x8(lac_simd_add_f32x8(m01, m10), inv);
+    e = lac_simd_mul_f32x8(lac_simd_add_f32x8(m02, m20), inv);
+    f = lac_simd_mul_f32x8(lac_simd_add_f32x8(m12, m21), inv);
+
+    /* Starting from z, each later pick wins ties, so w is preferred, then x, then y */
+    x = e;
+    y = f;
+    z = big;
+    w = c;
+    pick = lac_simd_le_f32x8(qz, qy);
+    x = lac_simd_select_f32x8(pick, d, x);
+    y = lac_simd_select_f32x8(pick, big, y);
+    z = lac_simd_select_f32x8(pick, f, z);
+    w = lac_simd_select_f32x8(pick, b, w);
+    pick = lac_simd_le_f32x8(lac_simd_max_f32x8(qy, qz), qx);
+    x = lac_simd_select_f32x8(pick, big, x);
+    y = lac_simd_select_f32x8(pick, d, y);
+    z = lac_simd_select_f32x8(pick, e, z);
+    w = lac_simd_select_f32x8(pick, a, w);
+    pick = lac_simd_le_f32x8(best, qw);
+    x = lac_simd_select_f32x8(pick, a, x);
+    y = lac_simd_select_f32x8(pick, b, y);
+    z = lac_simd_select_f32x8(pick, c, z);
+    w = lac_simd_select_f32x8(pick, big, w);
+
+    /* q and -q are the same rotation, so pick the one with a positive w */
+    flip = lac_simd_select_f32x8(lac_simd_lt_f32x8(w, zero), lac_simd_splat_f32x8(-1.0f), one);
+    lac_simd_store_f32x8(quat[0], lac_simd_mul_f32x8(x, flip));
+    lac_simd_store_f32x8(quat[1], lac_simd_mul_f32x8(y, flip));
+    lac_simd_store_f32x8(quat[2], lac_simd_mul_f32x8(z, flip));
+    lac_simd_store_f32x8(quat[3], lac_simd_mul_f32x8(w, flip));
+
+    /*
+     * The rotation is Rz * Ry * Rx. When cos(ry) is close to 0, rx and rz turn about the
+     * same axis, so the whole of that turn is given to rx, and rz is left at atan2(0, 1).
+     */
+    cy = lac_simd_sqrt_f32x8(lac_simd_madd_f32x8(m00, m00, lac_simd_mul_f32x8(m10, m10)));
+    gimbal = lac_simd_le_f32x8(cy, lac_simd_splat_f32x8(LAC_DECOMPOSE_GIMBAL_EPSILON));
+    lac_simd_store_f32x8(num[0], lac_simd_select_f32x8(gimbal, lac_simd_sub_f32x8(zero, m12), m21));
+    lac_simd_store_f32x8(den[0], lac_simd_select_f32x8(gimbal, m11, m22));
+    lac_simd_store_f32x8(num[1], lac_simd_sub_f32x8(zero, m20));
+    lac_simd_store_f32x8(den[1], cy);
+    lac_simd_store_f32x8(num[2], lac_simd_select_f32x8(gimbal, zero, m10));
+    lac_simd_store_f32x8(den[2], lac_simd_select_f32x8(gimbal, one, m00));
+    for (r = 0; r < 3; ++r) {
+        _lac_atan2_block(euler[r], num[r], den[r], true);
+    }
+
+    for (i = 0; i < LAC_BATCH_BLOCK; ++i) {
+        for (r = 0; r < 3; ++r) {
+            parts[i].translation[r] = elem[r][3][i];
+            parts[i].scale[r] = lengths[r][i];
+            parts[i].shear[r] = (singular_bits & (1u << i)) ? 0.0f : shear[r][i];
+            parts[i].euler[r] = euler[r][i];
+        }
+        for (r = 0; r < 4; ++r) {
+            parts[i].rotation[r] = quat[r][i];
+        }
+        parts[i].reflected = (reflected_bits & (1u << i)) != 0;
+        if (parts[i].reflected) {
+            parts[i].scale[0] = -parts[i].scale[0];
+        }
+    }
+
+    return singular_bits;
+}
+
+/**
+ * @brief Body of lac_decompose_mat4_array(), instantiated for each ISA level by LAC_MULTIVERSION_RETURN().
+ * @since 19-10-2026
+ */
+static LAC_ALWAYS_INLINE size_t _lac_decompose_mat4_array(
+    LacTransformParts_t *parts,
+    const mat4 *m_in,
+    const size_t count
+) {
+    LacTransformParts_t tail_parts[LAC_BATCH_BLOCK];
+    mat4 tail[LAC_BATCH_BLOCK];
+    size_t i, j, remaining, singular = 0;
+    unsigned bits;
+
+    for (i = 0; i + LAC_BATCH_BLOCK <= count; i += LAC_BATCH_BLOCK) {
+        for (bits = _lac_decompose_block(&parts[i], &m_in[i]); bits != 0; bits &= bits - 1u) {
+            ++singular;
+        }
+    }
+
+    /* Pad the final partial block with identity matrices so that it can share the same code path */
+    remaining = count - i;
+    if (remaining > 0) {
+        memcpy(tail, &m_in[i], remaining * sizeof(mat4));
+        for (j = remaining; j < LAC_BATCH_BLOCK; ++j) {
+            memcpy(tail[j], lac_ident_mat4, sizeof(mat4));
+        }
+        bits = _lac_decompose_block(tail_parts, (const mat4 *)tail) & ((1u << remaining) - 1u);
+        for (; bits != 0; bits &= bits - 1u) {
+            ++singular;
+        }
+        memcpy(&parts[i], tail_parts, remaining * sizeof(LacTransformParts_t));
+    }
+
+    return singular;
+}
+
+/**
+ * @brief Decomposes an array of affine transforms into translation, rotation, shear and scale, e.g. when importing baked instances.
+ * @anchor lac_decompose_mat4_array_anchor
+ * @since 19-10-2026
+ * @param[out] parts The parts of each matrix
+ * @param[in] m_in The matrices, whose bottom rows are taken to be (0, 0, 0, 1)
+ * @param[in] count The number of matrices in __m_in__ and __parts__
+ * @returns The number of singular matrices, which are given an identity rotation and no shear
+ */
+LAC_MULTIVERSION_RETURN(size_t, lac_decompose_mat4_array, (
+    LacTransformParts_t *parts,
+    const mat4 *m_in,
+    const size_t count
+), (parts, m_in, count))
+
+/**
+ * @brief Decomposes an affine transform into translation, rotation, shear and scale.
+ * @anchor lac_decompose_mat4_anchor
+ * @since 19-10-2026
+ * @param[out] parts The parts of the matrix
+ * @param[in] m_in The matrix, whose bottom row is taken to be (0, 0, 0, 1)
+ * @returns False if the matrix is singular, in which case it is given an identity rotation and no shear
+ */
+LAC_DECL bool lac_decompose_mat4(LacTransformParts_t *parts, const mat4 m_in) {
+    return lac_decompose_mat4_array(parts, (const mat4 *)m_in, 1) == 0;
+}
+
+/**
+ * @brief Orthonormalizes the 3x3 parts of an array of __n__ x __n__ matrices, leaving their other elements as they are.
+ * @since 19-10-2026
+ * @param[out] m_out The orthonormalized matrices, which may be the same as __m_in__
+ * @param[in] m_in The matrices, one after another
+ * @param[in] n The number of rows and columns in each matrix, i.e. 3 or 4
+ * @param[in] count The number of matrices
+ * @param[in] mode How the matrices are orthonormalized
+ * @returns The number of singular matrices
+ */
+static LAC_ALWAYS_INLINE size_t _lac_orthonormalize_elements(
+    float *m_out,
+    const float *m_in,
+    const size_t n,
+    const size_t count,
+    const LacOrthonormalizeMode_t mode
+) {
+    float elem[3][4][LAC_BATCH_BLOCK], rot[3][3][LAC_BATCH_BLOCK], lengths[3][LAC_BATCH_BLOCK];
+    float dots[3][LAC_BATCH_BLOCK], sign[LAC_BATCH_BLOCK], tail[LAC_BATCH_BLOCK * 16];
+    const float *block;
+    size_t i, j, r, c, lanes, singular = 0;
+    unsigned bits;
+
+    for (j = 0; j < LAC_BATCH_BLOCK; ++j) {
+        sign[j] = 1.0f;
+    }
+
+    for (i = 0; i < count; i += LAC_BATCH_BLOCK) {
+        lanes = count - i;
+        block = &m_in[i * n * n];
+
+        /* Pad the final partial block with identity matrices so that it can share the same code path */
+        if (lanes < LAC_BATCH_BLOCK) {
+            memcpy(tail, block, lanes * n * n * sizeof(float));
+            for (j = lanes; j < LAC_BATCH_BLOCK; ++j) {
+                for (r = 0; r < n; ++r) {
+                    for (c = 0; c < n; ++c) {
+                        tail[(j * n * n) + _lac_get_element_index(n, r, c)] = (r == c) ? 1.0f : 0.0f;
+                    }
+                }
+            }
+            block = tail;
+        } else {
+            lanes = LAC_BATCH_BLOCK;
+        }
+
+        for (r = 0; r < 3; ++r) {
+            for (c = 0; c < 3; ++c) {
+                for (j = 0; j < LAC_BATCH_BLOCK; ++j) {
+                    elem[r][c][j] = block[(j * n * n) + _lac_get_element_index(n, r, c)];
+                }
+            }
+        }
+
+        if (mode == LAC_ORTHONORMALIZE_SYMMETRIC) {
+            bits = _lac_polar_block(rot, elem);
+        } else {
+            bits = _lac_gram_schmidt_block(rot, lengths, dots, elem, sign);
+        }
+        for (bits &= (1u << lanes) - 1u; bits != 0; bits &= bits - 1u) {
+            ++singular;
+        }
+
+        /* Anything outside of the 3x3 part is copied across as it is */
+        if (m_out != m_in) {
+            memcpy(&m_out[i * n * n], &m_in[i * n * n], lanes * n * n * sizeof(float));
+        }
+        for (j = 0; j < lanes; ++j) {
+            for (r = 0; r < 3; ++r) {
+                for (c = 0; c < 3; ++c) {
+                    m_out[((i + j) * n * n) + _lac_get_element_index(n, r, c)] = rot[r][c][j];
+                }
+            }
+        }
+    }
+
+    return singular;
+}
+
+/**
+ * @brief Body of lac_orthonormalize_mat3_array(), instantiated for each ISA level by LAC_MULTIVERSION_RETURN().
+ * @since 19-10-2026
+ */
+static LAC_ALWAYS_INLINE size_t _lac_orthonormalize_mat3_array(
+    mat3 *m_out,
+    const mat3 *m_in,
+    const size_t count,
+    const LacOrthonormalizeMode_t mode
+) {
+    return _lac_orthonormalize_elements((float *)m_out, (const float *)m_in, 3, count, mode);
+}
+
+/**
+ * @brief Re-orthonormalizes an array of rotation matrices which have drifted, e.g. after being updated incrementally every frame.
+ * @anchor lac_orthonormalize_mat3_array_anchor
+ * @since 19-10-2026
+ * @param[out] m_out The orthonormalized matrices, which may be the same as __m_in__
+ * @param[in] m_in The matrices
+ * @param[in] count The number of matrices in __m_in__ and __m_out__
+ * @param[in] mode LAC_ORTHONORMALIZE_GRAM_SCHMIDT to keep the x axis where it is, or LAC_ORTHONORMALIZE_SYMMETRIC for the nearest orthonormal matrix
+ * @returns The number of singular matrices, which are replaced by the identity
+ */
+LAC_MULTIVERSION_RETURN(size_t, lac_orthonormalize_mat3_array, (
+    mat3 *m_out,
+    const mat3 *m_in,
+    const size_t count,
+    const LacOrthonormalizeMode_t mode
+), (m_out, m_in, count, mode))
+
+/**
+ * @brief Body of lac_orthonormalize_mat4_array(), instantiated for each ISA level by LAC_MULTIVERSION_RETURN().
+ * @since 19-10-2026
+ */
+static LAC_ALWAYS_INLINE size_t _lac_orthonormalize_mat4_array(
+    mat4 *m_out,
+    const mat4 *m_in,
+    const size_t count,
+    const LacOrthonormalizeMode_t mode
+) {
+    return _lac_orthonormalize_elements((float *)m_out, (const float *)m_in, 4, count, mode);
+}
+
+/**
+ * @brief Re-orthonormalizes the rotations of an array of transforms which have drifted, leaving their translations as they are.
+ * @anchor lac_orthonormalize_mat4_array_anchor
+ * @since 19-10-2026
+ * @param[out] m_out The orthonormalized matrices, which may be the same as __m_in__
+ * @param[in] m_in The matrices, of which only the upper-left 3x3 part is changed
+ * @param[in] count The number of matrices in __m_in__ and __m_out__
+ * @param[in] mode LAC_ORTHONORMALIZE_GRAM_SCHMIDT to keep the x axis where it is, or LAC_ORTHONORMALIZE_SYMMETRIC for the nearest orthonormal matrix
+ * @returns The number of singular matrices, whose 3x3 parts are replaced by the identity
+ */
+LAC_MULTIVERSION_RETURN(size_t, lac_orthonormalize_mat4_array, (
+    mat4 *m_out,
+    const mat4 *m_in,
+    const size_t count,
+    const LacOrthonormalizeMode_t mode
+), (m_out, m_in, count, mode))
@@ -89,6 +89,10 @@
  * coordinate to get x and likewise the length times sin of the angle for
  * the y component.
  *
+ * These functions convert a single point using the C library. For whole
+ * arrays of points, see coords.c, which also covers the spherical and
+ * cylindrical coordinates of 3D points.
+ *
  * @subsection polarcart_related Related Functions
  *
  * - @ref lac_cartesian_to_polar_anchor "lac_cartesian_to_polar"
@@ -96,6 +100,8 @@
  */
 
 #include "lac_common.h"
+#include "lac_simd.h"
+#include "lac_dispatch.h"
 
 /**
  * @brief Calculates the sum between two vectors of length 2.
@@ -105,8 +111,7 @@
  * @param v_b[in] The Addend vector
  */
 LAC_DECL void lac_add_vec2(vec2 v_out, const vec2 v_a, const vec2 v_b) {
-    v_out[0] = v_a[0] + v_b[0];
-    v_out[1] = v_a[1] + v_b[1];
+    lac_simd_store_f32x4(v_out, lac_simd_add_f32x4(lac_simd_load_f32x4(v_a, 2), lac_simd_load_f32x4(v_b, 2)), 2);
 }
 
 /**
@@ -117,9 +122,7 @@ LAC_DECL void lac_add_vec2(vec2 v_out, const vec2 v_a, const vec2 v_b) {
  * @param[in] v_b The Addend vector
  */
 LAC_DECL void lac_add_vec3(vec3 v_out, const vec3 v_a, const vec3 v_b) {
-    v_out[0] = v_a[0] + v_b[0];
-    v_out[1] = v_a[1] + v_b[1];
-    v_out[2] = v_a[2] + v_b[2];
+    lac_simd_store_f32x4(v_out, lac_simd_add_f32x4(lac_simd_load_f32x4(v_a, 3), lac_simd_load_f32x4(v_b, 3)), 3);
 }
 
 /**
@@ -130,10 +133,7 @@ LAC_DECL void lac_add_vec3(vec3 v_out, const vec3 v_a, const vec3 v_b) {
  * @param[in] v_b The Addend vector
  */
 LAC_DECL void lac_add_vec4(vec4 v_out, const vec4 v_a, const vec4 v_b) {
-    v_out[0] = v_a[0] + v_b[0];
-    v_out[1] = v_a[1] + v_b[1];
-    v_out[2] = v_a[2] + v_b[2];
-    v_out[3] = v_a[3] + v_b[3];
+    lac_simd_store_f32x4(v_out, lac_simd_add_f32x4(lac_simd_load_f32x4(v_a, 4), lac_simd_load_f32x4(v_b, 4)), 4);
 }
 
 /**
@@ -144,8 +144,7 @@ LAC_DECL void lac_add_vec4(vec4 v_out, const vec4 v_a, const vec4 v_b) {
  * @param[in] v_b The subtrahend vector
  */
 LAC_DECL void lac_subtract_vec2(vec2 v_out, const vec2 v_a, const vec2 v_b) {
-    v_out[0] = v_a[0] - v_b[0];
-    v_out[1] = v_a[1] - v_b[1];
+    lac_simd_store_f32x4(v_out, lac_simd_sub_f32x4(lac_simd_load_f32x4(v_a, 2), lac_simd_load_f32x4(v_b, 2)), 2);
 }
 
 /**
@@ -156,9 +155,7 @@ LAC_DECL void lac_subtract_vec2(vec2 v_out, const vec2 v_a, const vec2 v_b) {
  * @param[in] v_b The subtrahend vector
  */
 LAC_DECL void lac_subtract_vec3(vec3 v_out, const vec3 v_a, const vec3 v_b) {
-    v_out[0] = v_a[0] - v_b[0];
-    v_out[1] = v_a[1] - v_b[1];
-    v_out[2] = v_a[2] - v_b[2];
+    lac_simd_store_f32x4(v_out, lac_simd_sub_f32x4(lac_simd_load_f32x4(v_a, 3), lac_simd_load_f32x4(v_b, 3)), 3);
 }
 
 /**
@@ -169,10 +166,7 @@ LAC_DECL void lac_subtract_vec3(vec3 v_out, const vec3 v_a, const vec3 v_b) {
  * @param[in] v_b The subtrahend vector
  */
 LAC_DECL void lac_subtract_vec4(vec4 v_out, const vec4 v_a, const vec4 v_b) {
-    v_out[0] = v_a[0] - v_b[0];
-    v_out[1] = v_a[1] - v_b[1];
-    v_out[2] = v_a[2] - v_b[2];
-    v_out[3] = v_a[3] - v_b[3];
+    lac_simd_store_f32x4(v_out, lac_simd_sub_f32x4(lac_simd_load_f32x4(v_a, 4), lac_simd_load_f32x4(v_b, 4)), 4);
 }
 
 /**
@@ -183,8 +177,7 @@ LAC_DECL void lac_subtract_vec4(vec4 v_out, const vec4 v_a, const vec4 v_b) {
  * @param[in] scalar A constant representing the multiplier
  */
 LAC_DECL void lac_multiply_vec2(vec2 v_out, const vec2 v_in, const float scalar) {
-    v_out[0] = v_in[0] * scalar;
-    v_out[1] = v_in[1] * scalar;
+    lac_simd_store_f32x4(v_out, lac_simd_mul_f32x4(lac_simd_load_f32x4(v_in, 2), lac_simd_splat_f32x4(scalar)), 2);
 }
 
 /**
@@ -195,9 +188,7 @@ LAC_DECL void lac_multiply_vec2(vec2 v_out, const vec2 v_in, const float scalar)
  * @param[in] scalar A constant representing the multiplier
  */
 LAC_DECL void lac_multiply_vec3(vec3 v_out, const vec3 v_in, const float scalar) {
-    v_out[0] = v_in[0] * scalar;
-    v_out[1] = v_in[1] * scalar;
-    v_out[2] = v_in[2] * scalar;
+    lac_simd_store_f32x4(v_out, lac_simd_mul_f32x4(lac_simd_load_f32x4(v_in, 3), lac_simd_splat_f32x4(scalar)), 3);
 }
 
 /**
@@ -208,10 +199,7 @@ LAC_DECL void lac_multiply_vec3(vec3 v_out, const vec3 v_in, const float scalar)
  * @param[in] scalar A constant representing the multiplier
  */
 LAC_DECL void lac_multiply_vec4(vec4 v_out, const vec4 v_in, const float scalar) {
-    v_out[0] = v_in[0] * scalar;
-    v_out[1] = v_in[1] * scalar;
-    v_out[2] = v_in[2] * scalar;
-    v_out[3] = v_in[3] * scalar;
+    lac_simd_store_f32x4(v_out, lac_simd_mul_f32x4(lac_simd_load_f32x4(v_in, 4), lac_simd_splat_f32x4(scalar)), 4);
 }
 
 /**
@@ -222,17 +210,16 @@ LAC_DECL void lac_multiply_vec4(vec4 v_out, const vec4 v_in, const float scalar)
  * @param[in] m_in The input matrix
  */
 LAC_DECL void lac_multiply_vec2_mat2(vec2 v_out, const vec2 v_in, const mat2 m_in) {
-    vec2 _v_out = { 0 };
+    lac_f32x4 v_res;
+    size_t c;
 
-#if LAC_IS_ROW_MAJOR
-    _v_out[0] = (m_in[0] * v_in[0]) + (m_in[1] * v_in[1]);
-    _v_out[1] = (m_in[2] * v_in[0]) + (m_in[3] * v_in[1]);
-#else
-    _v_out[0] = (m_in[0] * v_in[0]) + (m_in[2] * v_in[1]);
-    _v_out[1] = (m_in[1] * v_in[0]) + (m_in[3] * v_in[1]);
-#endif
+    /* Sum the columns of the matrix, each scaled by the matching component of the vector */
+    v_res = lac_simd_mul_f32x4(lac_simd_load_column_f32x4(m_in, 2, 0), lac_simd_splat_f32x4(v_in[0]));
+    for (c = 1; c < 2; ++c) {
+        v_res = lac_simd_madd_f32x4(lac_simd_load_column_f32x4(m_in, 2, c), lac_simd_splat_f32x4(v_in[c]), v_res);
+    }
 
-    memcpy(v_out, _v_out, sizeof(vec2));
+    lac_simd_store_f32x4(v_out, v_res, 2);
 }
 
 /**
@@ -243,19 +230,33 @@ LAC_DECL void lac_multiply_vec2_mat2(vec2 v_out, const vec2 v_in, const mat2 m_i
  * @param[in] m_in The input matrix
  */
 LAC_DECL void lac_multiply_vec3_mat3(vec3 v_out, const vec3 v_in, const mat3 m_in) {
-    vec3 _v_out = { 0 };
-
-#if LAC_IS_ROW_MAJOR
-    _v_out[0] = (m_in[0] * v_in[0]) + (m_in[1] * v_in[1]) + (m_in[2] * v_in[2]);
-    _v_out[1] = (m_in[3] * v_in[0]) + (m_in[4] * v_in[1]) + (m_in[5] * v_in[2]);
-    _v_out[2] = (m_in[6] * v_in[0]) + (m_in[7] * v_in[1]) + (m_in[8] * v_in[2]);
-#else
-    _v_out[0] = (m_in[0] * v_in[0]) + (m_in[3] * v_in[1]) + (m_in[6] * v_in[2]);
-    _v_out[1] = (m_in[1] * v_in[0]) + (m_in[4] * v_in[1]) + (m_in[7] * v_in[2]);
-    _v_out[2] = (m_in[2] * v_in[0]) + (m_in[5] * v_in[1]) + (m_in[8] * v_in[2]);
-#endif
-
-    memcpy(v_out, _v_out, sizeof(vec3));
+    lac_f32x4 v_res;
+    size_t c;
+
+    /* Sum the columns of the matrix, each scaled by the matching component of the vector */
+    v_res = lac_simd_mul_f32x4(lac_simd_load_column_f32x4(m_in, 3, 0), lac_simd_splat_f32x4(v_in[0]));
+    for (c = 1; c < 3; ++c) {
+        v_res = lac_simd_madd_f32x4(lac_simd_load_column_f32x4(m_in, 3, c), lac_simd_splat_f32x4(v_in[c]), v_res);
+    }
+
+    lac_simd_store_f32x4(v_out, v_res, 3);
+}
+
+/**
+ * @brief Body of lac_multiply_vec4_mat4(), instantiated for each ISA level by LAC_MULTIVERSION().
+ * @since 19-10-2026
+ */
+static LAC_ALWAYS_INLINE void _lac_multiply_vec4_mat4(vec4 v_out, const vec4 v_in, const mat4 m_in) {
+    lac_f32x4 v_res;
+    size_t c;
+
+    /* Sum the columns of the matrix, each scaled by the matching component of the vector */
+    v_res = lac_simd_mul_f32x4(lac_simd_load_column_f32x4(m_in, 4, 0), lac_simd_splat_f32x4(v_in[0]));
+    for (c = 1; c < 4; ++c) {
+        v_res = lac_simd_madd_f32x4(lac_simd_load_column_f32x4(m_in, 4, c), lac_simd_splat_f32x4(v_in[c]), v_res);
+    }
+
+    lac_simd_store_f32x4(v_out, v_res, 4);
 }
 
 /**
@@ -265,23 +266,7 @@ LAC_DECL void lac_multiply_vec3_mat3(vec3 v_out, const vec3 v_in, const mat3 m_i
  * @param[in] v_in The input vector
  * @param[in] m_in The input matrix
  */
-LAC_DECL void lac_multiply_vec4_mat4(vec4 v_out, const vec4 v_in, const mat4 m_in) {
-    vec4 _v_out = { 0 };
-
-#if LAC_IS_ROW_MAJOR
-    _v_out[0] = (m_in[0]  * v_in[0]) + (m_in[1]  * v_in[1]) + (m_in[2]  * v_in[2]) + (m_in[3]  * v_in[3]);
-    _v_out[1] = (m_in[4]  * v_in[0]) + (m_in[5]  * v_in[1]) + (m_in[6]  * v_in[2]) + (m_in[7]  * v_in[3]);
-    _v_out[2] = (m_in[8]  * v_in[0]) + (m_in[9]  * v_in[1]) + (m_in[10] * v_in[2]) + (m_in[11] * v_in[3]);
-    _v_out[3] = (m_in[12] * v_in[0]) + (m_in[13] * v_in[1]) + (m_in[14] * v_in[2]) + (m_in[15] * v_in[3]);
-#else
-    _v_out[0] = (m_in[0] * v_in[0]) + (m_in[4] * v_in[1]) + (m_in[8]  * v_in[2]) + (m_in[12] * v_in[3]);
-    _v_out[1] = (m_in[1] * v_in[0]) + (m_in[5] * v_in[1]) + (m_in[9]  * v_in[2]) + (m_in[13] * v_in[3]);
-    _v_out[2] = (m_in[2] * v_in[0]) + (m_in[6] * v_in[1]) + (m_in[10] * v_in[2]) + (m_in[14] * v_in[3]);
-    _v_out[3] = (m_in[3] * v_in[0]) + (m_in[7] * v_in[1]) + (m_in[11] * v_in[2]) + (m_in[15] * v_in[3]);
-#endif
-
-    memcpy(v_out, _v_out, sizeof(vec4));
-}
+LAC_MULTIVERSION(lac_multiply_vec4_mat4, (vec4 v_out, const vec4 v_in, const mat4 m_in), (v_out, v_in, m_in))
 
 /**
  * @brief Reduces a vector of length 2 by a factor of __scalar__.
@@ -296,8 +281,7 @@ LAC_DECL void lac_divide_vec2(vec2 v_out, const vec2 v_in, const float scalar) {
         v_out[0] = 0.0f;
         v_out[1] = 0.0f;
     } else {
-        v_out[0] = v_in[0] / scalar;
-        v_out[1] = v_in[1] / scalar;
+        lac_simd_store_f32x4(v_out, lac_simd_div_f32x4(lac_simd_load_f32x4(v_in, 2), lac_simd_splat_f32x4(scalar)), 2);
     }
 }
 
@@ -315,9 +299,7 @@ LAC_DECL void lac_divide_vec3(vec3 v_out, const vec3 v_in, const float scalar) {
         v_out[1] = 0.0f;
         v_out[2] = 0.0f;
     } else {
-        v_out[0] = v_in[0] / scalar;
-        v_out[1] = v_in[1] / scalar;
-        v_out[2] = v_in[2] / scalar;
+        lac_simd_store_f32x4(v_out, lac_simd_div_f32x4(lac_simd_load_f32x4(v_in, 3), lac_simd_splat_f32x4(scalar)), 3);
     }
 }
 
@@ -336,13 +318,52 @@ LAC_DECL void lac_divide_vec4(vec4 v_out, const vec4 v_in, const float scalar) {
         v_out[2] = 0.0f;
         v_out[3] = 0.0f;
     } else {
-        v_out[0] = v_in[0] / scalar;
-        v_out[1] = v_in[1] / scalar;
-        v_out[2] = v_in[2] / scalar;
-        v_out[3] = v_in[3] / scalar;
+        lac_simd_store_f32x4(v_out, lac_simd_div_f32x4(lac_simd_load_f32x4(v_in, 4), lac_simd_splat_f32x4(scalar)), 4);
     }
 }
 
+/**
+ * @brief Linearly interpolates between two vectors of length 2.
+ * @since 19-10-2026
+ * @param[out] v_out The interpolated vector, i.e. __v_a__ + __t__ * (__v_b__ - __v_a__)
+ * @param[in] v_a The vector at t = 0
+ * @param[in] v_b The vector at t = 1
+ * @param[in] t The interpolation factor, which may lie outside [0, 1] to extrapolate
+ */
+LAC_DECL void lac_lerp_vec2(vec2 v_out, const vec2 v_a, const vec2 v_b, const float t) {
+    const lac_f32x4 a = lac_simd_load_f32x4(v_a, 2);
+
+    lac_simd_store_f32x4(v_out, lac_simd_madd_f32x4(lac_simd_sub_f32x4(lac_simd_load_f32x4(v_b, 2), a), lac_simd_splat_f32x4(t), a), 2);
+}
+
+/**
+ * @brief Linearly interpolates between two vectors of length 3.
+ * @since 19-10-2026
+ * @param[out] v_out The interpolated vector, i.e. __v_a__ + __t__ * (__v_b__ - __v_a__)
+ * @param[in] v_a The vector at t = 0
+ * @param[in] v_b The vector at t = 1
+ * @param[in] t The interpolation factor, which may lie outside [0, 1] to extrapolate
+ */
+LAC_DECL void lac_lerp_vec3(vec3 v_out, const vec3 v_a, const vec3 v_b, const float t) {
+    const lac_f32x4 a = lac_simd_load_f32x4(v_a, 3);
+
+    lac_simd_store_f32x4(v_out, lac_simd_madd_f32x4(lac_simd_sub_f32x4(lac_simd_load_f32x4(v_b, 3), a), lac_simd_splat_f32x4(t), a), 3);
+}
+
+/**
+ * @brief Linearly interpolates between two vectors of length 4.
+ * @since 19-10-2026
+ * @param[out] v_out The interpolated vector, i.e. __v_a__ + __t__ * (__v_b__ - __v_a__)
+ * @param[in] v_a The vector at t = 0
+ * @param[in] v_b The vector at t = 1
+ * @param[in] t The interpolation factor, which may lie outside [0, 1] to extrapolate
+ */
+LAC_DECL void lac_lerp_vec4(vec4 v_out, const vec4 v_a, const vec4 v_b, const float t) {
+    const lac_f32x4 a = lac_simd_load_f32x4(v_a, 4);
+
+    lac_simd_store_f32x4(v_out, lac_simd_madd_f32x4(lac_simd_sub_f32x4(lac_simd_load_f32x4(v_b, 4), a), lac_simd_splat_f32x4(t), a), 4);
+}
+
 /**
  * @brief Calculates the dot product given two vectors of length 2.
  * @anchor lac_calc_dot_prod_vec2_anchor
@@ -352,7 +373,7 @@ LAC_DECL void lac_divide_vec4(vec4 v_out, const vec4 v_in, const float scalar) {
  * @param[in] v_b The right-hand operand for the operation
  */
 LAC_DECL void lac_calc_dot_prod_vec2(float *dot_prod, const vec2 v_a, const vec2 v_b) {
-    *dot_prod = (v_a[0] * v_b[0]) + (v_a[1] * v_b[1]);
+    *dot_prod = lac_simd_sum_f32x4(lac_simd_mul_f32x4(lac_simd_load_f32x4(v_a, 2), lac_simd_load_f32x4(v_b, 2)), 2);
 }
 
 /**
@@ -364,7 +385,7 @@ LAC_DECL void lac_calc_dot_prod_vec2(float *dot_prod, const vec2 v_a, const vec2
  * @param[in] v_b The right-hand operand for the operation
  */
 LAC_DECL void lac_calc_dot_prod_vec3(float *dot_prod, const vec3 v_a, const vec3 v_b) {
-    *dot_prod = (v_a[0] * v_b[0]) + (v_a[1] * v_b[1]) + (v_a[2] * v_b[2]);
+    *dot_prod = lac_simd_sum_f32x4(lac_simd_mul_f32x4(lac_simd_load_f32x4(v_a, 3), lac_simd_load_f32x4(v_b, 3)), 3);
 }
 
 /**
@@ -376,7 +397,7 @@ LAC_DECL void lac_calc_dot_prod_vec3(float *dot_prod, const vec3 v_a, const vec3
  * @param[in] v_b The right-hand operand for the operation
  */
 LAC_DECL void lac_calc_dot_prod_vec4(float *dot_prod, const vec4 v_a, const vec4 v_b) {
-    *dot_prod = (v_a[0] * v_b[0]) + (v_a[1] * v_b[1]) + (v_a[2] * v_b[2]) + (v_a[3] * v_b[3]);
+    *dot_prod = lac_simd_sum_f32x4(lac_simd_mul_f32x4(lac_simd_load_f32x4(v_a, 4), lac_simd_load_f32x4(v_b, 4)), 4);
 }
 
 /**
@@ -388,13 +409,14 @@ LAC_DECL void lac_calc_dot_prod_vec4(float *dot_prod, const vec4 v_a, const vec4
  * @param[in] v_b The right-hand operand for the operation
  */
 LAC_DECL void lac_calc_cross_prod(vec3 v_out, const vec3 v_a, const vec3 v_b) {
-    vec3 _v_out = { 0 };
-
-    _v_out[0] = (v_a[1] * v_b[2]) - (v_a[2] * v_b[1]);
-    _v_out[1] = (v_a[2] * v_b[0]) - (v_a[0] * v_b[2]);
-    _v_out[2] = (v_a[0] * v_b[1]) - (v_a[1] * v_b[0]);
-
-    memcpy(v_out, _v_out, sizeof(vec3));
+    const lac_f32x4 a = lac_simd_load_f32x4(v_a, 3);
+    const lac_f32x4 b = lac_simd_load_f32x4(v_b, 3);
+
+    /* (a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x) */
+    lac_simd_store_f32x4(v_out, lac_simd_sub_f32x4(
+        lac_simd_mul_f32x4(lac_simd_yzx_f32x4(a), lac_simd_zxy_f32x4(b)),
+        lac_simd_mul_f32x4(lac_simd_zxy_f32x4(a), lac_simd_yzx_f32x4(b))
+    ), 3);
 }
 
 /**
@@ -404,7 +426,9 @@ LAC_DECL void lac_calc_cross_prod(vec3 v_out, const vec3 v_a, const vec3 v_b) {
  * @param[in] v_in The vector for which the magnitude is calculated
  */
 LAC_DECL void lac_calc_magnitude_vec2(float *magnitude, const vec2 v_in) {
-    *magnitude = sqrtf((v_in[0] * v_in[0]) + (v_in[1] * v_in[1]));
+    lac_f32x4 v = lac_simd_load_f32x4(v_in, 2);
+
+    *magnitude = sqrtf(lac_simd_sum_f32x4(lac_simd_mul_f32x4(v, v), 2));
 }
 
 /**
@@ -414,7 +438,9 @@ LAC_DECL void lac_calc_magnitude_vec2(float *magnitude, const vec2 v_in) {
  * @param[in] v_in The vector for which the magnitude is calculated
  */
 LAC_DECL void lac_calc_magnitude_vec3(float *magnitude, const vec3 v_in) {
-    *magnitude = sqrtf((v_in[0] * v_in[0]) + (v_in[1] * v_in[1]) + (v_in[2] * v_in[2]));
+    lac_f32x4 v = lac_simd_load_f32x4(v_in, 3);
+
+    *magnitude = sqrtf(lac_simd_sum_f32x4(lac_simd_mul_f32x4(v, v), 3));
 }
 
 /**
@@ -424,24 +450,22 @@ LAC_DECL void lac_calc_magnitude_vec3(float *magnitude, const vec3 v_in) {
  * @param[in] v_in The vector for which the magnitude is calculated
  */
 LAC_DECL void lac_calc_magnitude_vec4(float *magnitude, const vec4 v_in) {
-    *magnitude = sqrtf((v_in[0] * v_in[0]) + (v_in[1] * v_in[1]) + (v_in[2] * v_in[2]) + (v_in[3] * v_in[3]));
+    lac_f32x4 v = lac_simd_load_f32x4(v_in, 4);
+
+    *magnitude = sqrtf(lac_simd_sum_f32x4(lac_simd_mul_f32x4(v, v), 4));
 }
 
 /**
- * @brief Normalize a vector of length 2.
- * @anchor lac_normalize_vec2_anchor
- * @since 17-10-2023
- * @param[out] v_out The normalized vector
- * @param[in] v_in The vector to be normalized
+ * @brief Body of lac_normalize_vec2(), instantiated for each ISA level by LAC_MULTIVERSION().
+ * @since 19-10-2026
  */
-LAC_DECL void lac_normalize_vec2(vec2 v_out, const vec2 v_in) {
+static LAC_ALWAYS_INLINE void _lac_normalize_vec2(vec2 v_out, const vec2 v_in) {
     float magnitude, inv_magnitude;
 
     lac_calc_magnitude_vec2(&magnitude, v_in);
     if (magnitude != 0.0f) {
         inv_magnitude = 1.0f / magnitude;
-        v_out[0] = v_in[0] * inv_magnitude;
-        v_out[1] = v_in[1] * inv_magnitude;
+        lac_simd_store_f32x4(v_out, lac_simd_mul_f32x4(lac_simd_load_f32x4(v_in, 2), lac_simd_splat_f32x4(inv_magnitude)), 2);
     } else {
         v_out[0] = 0.0f;
         v_out[1] = 0.0f;
@@ -449,21 +473,25 @@ LAC_DECL void lac_normalize_vec2(vec2 v_out, const vec2 v_in) {
 }
 
 /**
- * @brief Normalize a vector of length 3.
- * @anchor lac_normalize_vec3_anchor
+ * @brief Normalize a vector of length 2.
+ * @anchor lac_normalize_vec2_anchor
  * @since 17-10-2023
  * @param[out] v_out The normalized vector
  * @param[in] v_in The vector to be normalized
  */
-LAC_DECL void lac_normalize_vec3(vec3 v_out, const vec3 v_in) {
+LAC_MULTIVERSION(lac_normalize_vec2, (vec2 v_out, const vec2 v_in), (v_out, v_in))
+
+/**
+ * @brief Body of lac_normalize_vec3(), instantiated for each ISA level by LAC_MULTIVERSION().
+ * @since 19-10-2026
+ */
+static LAC_ALWAYS_INLINE void _lac_normalize_vec3(vec3 v_out, const vec3 v_in) {
     float magnitude, inv_magnitude;
 
     lac_calc_magnitude_vec3(&magnitude, v_in);
     if (magnitude != 0.0f) {
         inv_magnitude = 1.0f / magnitude;
-        v_out[0] = v_in[0] * inv_magnitude;
-        v_out[1] = v_in[1] * inv_magnitude;
-        v_out[2] = v_in[2] * inv_magnitude;
+        lac_simd_store_f32x4(v_out, lac_simd_mul_f32x4(lac_simd_load_f32x4(v_in, 3), lac_simd_splat_f32x4(inv_magnitude)), 3);
     } else {
         v_out[0] = 0.0f;
         v_out[1] = 0.0f;
@@ -472,22 +500,25 @@ LAC_DECL void lac_normalize_vec3(vec3 v_out, const vec3 v_in) {
 }
 
 /**
- * @brief Normalize a vector of length 4.
- * @anchor lac_normalize_vec4_anchor
+ * @brief Normalize a vector of length 3.
+ * @anchor lac_normalize_vec3_anchor
  * @since 17-10-2023
  * @param[out] v_out The normalized vector
  * @param[in] v_in The vector to be normalized
  */
-LAC_DECL void lac_normalize_vec4(vec4 v_out, const vec4 v_in) {
+LAC_MULTIVERSION(lac_normalize_vec3, (vec3 v_out, const vec3 v_in), (v_out, v_in))
+
+/**
+ * @brief Body of lac_normalize_vec4(), instantiated for each ISA level by LAC_MULTIVERSION().
+ * @since 19-10-2026
+ */
+static LAC_ALWAYS_INLINE void _lac_normalize_vec4(vec4 v_out, const vec4 v_in) {
     float magnitude, inv_magnitude;
 
     lac_calc_magnitude_vec4(&magnitude, v_in);
     if (magnitude != 0.0f) {
         inv_magnitude = 1.0f / magnitude;
-        v_out[0] = v_in[0] * inv_magnitude;
-        v_out[1] = v_in[1] * inv_magnitude;
-        v_out[2] = v_in[2] * inv_magnitude;
-        v_out[3] = v_in[3] * inv_magnitude;
+        lac_simd_store_f32x4(v_out, lac_simd_mul_f32x4(lac_simd_load_f32x4(v_in, 4), lac_simd_splat_f32x4(inv_magnitude)), 4);
     } else {
         v_out[0] = 0.0f;
         v_out[1] = 0.0f;
@@ -496,6 +527,15 @@ LAC_DECL void lac_normalize_vec4(vec4 v_out, const vec4 v_in) {
     }
 }
 
+/**
+ * @brief Normalize a vector of length 4.
+ * @anchor lac_normalize_vec4_anchor
+ * @since 17-10-2023
+ * @param[out] v_out The normalized vector
+ * @param[in] v_in The vector to be normalized
+ */
+LAC_MULTIVERSION(lac_normalize_vec4, (vec4 v_out, const vec4 v_in), (v_out, v_in))
+
 /**
  * @brief Convert polar coordinates given by __angle__ and __len__ to cartesian space.
  * @anchor lac_polar_to_cartesian_anchor
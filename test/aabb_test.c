@@ -0,0 +1,169 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <float.h>
+#include <check.h>
+
+#include "lac_common.h"
+#include "aabb.h"
+#include "vecmath.h"
+#include "matmath.h"
+#include "transforms.h"
+
+#define BOXES 19
+
+/* The bounds of the 8 transformed corners, which lac_transform_aabb() must match */
+static void transform_corners(LacAabb_t *out, const LacAabb_t *box, const mat4 m_in) {
+    vec4 v_corner, v_out;
+    size_t i, c;
+
+    lac_init_aabb(out);
+    for (i = 0; i < 8; ++i) {
+        for (c = 0; c < 3; ++c) {
+            v_corner[c] = (i & (1u << c)) ? box->max[c] : box->min[c];
+        }
+        v_corner[3] = 1.0f;
+        lac_multiply_vec4_mat4(v_out, v_corner, m_in);
+        lac_expand_aabb(out, v_out);
+    }
+}
+
+static void make_transform(mat4 m_out, const size_t i) {
+    mat4 m_rotation, m_scale, m_translation, m_tmp;
+
+    lac_get_rotation_mat4(m_rotation, 0.3f * (float)i, 0.7f - (0.1f * (float)i), 0.2f * (float)(i % 5));
+    lac_get_scalar_mat4(m_scale, 1.0f + (0.25f * (float)(i % 3)), 0.5f, 2.0f);
+    lac_get_translation_mat4(m_translation, (float)i, -2.0f * (float)i, 3.0f);
+    lac_multiply_mat4(m_tmp, m_rotation, m_scale);
+    lac_multiply_mat4(m_out, m_translation, m_tmp);
+}
+
+START_TEST(AabbBasics) {
+    const vec3 points[] = { { 1.0f, -2.0f, 3.0f }, { -1.0f, 4.0f, 0.0f }, { 0.5f, 0.0f, 5.0f } };
+    const vec3 v_far = { 10.0f, 10.0f, 10.0f };
+    LacAabb_t box, other, merged, empty;
+    vec3 v_center;
+    float area;
+
+    lac_init_aabb(&empty);
+    lac_calc_aabb_surface_area(&area, &empty);
+    ck_assert_float_eq(area, 0.0f);
+
+    lac_init_aabb_from_points(&box, points, 3);
+    ck_assert_float_eq(box.min[0], -1.0f);
+    ck_assert_float_eq(box.min[1], -2.0f);
+    ck_assert_float_eq(box.min[2], 0.0f);
+    ck_assert_float_eq(box.max[0], 1.0f);
+    ck_assert_float_eq(box.max[1], 4.0f);
+    ck_assert_float_eq(box.max[2], 5.0f);
+
+    lac_calc_aabb_center(v_center, &box);
+    ck_assert_float_eq(v_center[1], 1.0f);
+    lac_calc_aabb_surface_area(&area, &box);
+    ck_assert_float_eq(area, 2.0f * ((2.0f * 6.0f) + (6.0f * 5.0f) + (5.0f * 2.0f)));
+
+    /* Merging with an empty box changes nothing, and an empty box overlaps nothing */
+    lac_merge_aabb(&merged, &box, &empty);
+    ck_assert_mem_eq(&merged, &box, sizeof(LacAabb_t));
+    ck_assert(!lac_test_aabb_overlap(&box, &empty));
+
+    lac_init_aabb_from_points(&other, &v_far, 1);
+    ck_assert(!lac_test_aabb_overlap(&box, &other));
+    lac_expand_aabb(&other, points[0]);
+    ck_assert(lac_test_aabb_overlap(&box, &other));
+    lac_merge_aabb(&merged, &box, &other);
+    ck_assert_float_eq(merged.max[0], 10.0f);
+    ck_assert_float_eq(merged.min[1], -2.0f);
+}
+END_TEST
+
+START_TEST(AabbTransform) {
+    LacAabb_t box, expected, actual;
+    mat4 m_in;
+    size_t i, c;
+
+    box.min[0] = -1.0f; box.min[1] = 2.0f; box.min[2] = -3.0f;
+    box.max[0] = 2.0f;  box.max[1] = 2.5f; box.max[2] = 1.0f;
+
+    for (i = 0; i < BOXES; ++i) {
+        make_transform(m_in, i);
+        transform_corners(&expected, &box, m_in);
+        lac_transform_aabb(&actual, &box, m_in);
+        for (c = 0; c < 3; ++c) {
+            ck_assert_float_eq_tol(actual.min[c], expected.min[c], 1e-4f);
+            ck_assert_float_eq_tol(actual.max[c], expected.max[c], 1e-4f);
+        }
+    }
+
+    /* Transforming in place, and transforming an empty box */
+    actual = box;
+    lac_transform_aabb(&actual, &actual, m_in);
+    for (c = 0; c < 3; ++c) {
+        ck_assert_float_eq_tol(actual.min[c], expected.min[c], 1e-4f);
+    }
+    lac_init_aabb(&box);
+    lac_transform_aabb(&actual, &box, m_in);
+    ck_assert_mem_eq(&actual, &box, sizeof(LacAabb_t));
+}
+END_TEST
+
+START_TEST(AabbTransformArray) {
+    LacAabb_t in[BOXES], out[BOXES], expected;
+    mat4 m_in[BOXES];
+    size_t i, c;
+
+    /* An odd count, so that the final block is padded */
+    for (i = 0; i < BOXES; ++i) {
+        make_transform(m_in[i], i);
+        for (c = 0; c < 3; ++c) {
+            in[i].min[c] = -1.0f - (float)c + (0.1f * (float)i);
+            in[i].max[c] = in[i].min[c] + 0.5f + (float)(i % 4);
+        }
+    }
+    lac_init_aabb(&in[5]);
+
+    lac_transform_aabb_array(out, in, (const mat4 *)m_in, BOXES);
+    for (i = 0; i < BOXES; ++i) {
+        lac_transform_aabb(&expected, &in[i], m_in[i]);
+        for (c = 0; c < 3; ++c) {
+            ck_assert_float_eq_tol(out[i].min[c], expected.min[c], 1e-4f);
+            ck_assert_float_eq_tol(out[i].max[c], expected.max[c], 1e-4f);
+        }
+    }
+    ck_assert(out[5].min[0] > out[5].max[0]);
+
+    /* In place gives the same result */
+    lac_transform_aabb_array(in, in, (const mat4 *)m_in, BOXES);
+    ck_assert_mem_eq(in, out, sizeof(out));
+}
+END_TEST
+
+Suite *buffer_suite(void) {
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Aabb");
+
+    /* Core test cases */
+    tc_core = tcase_create("Core");
+    tcase_add_test(tc_core, AabbBasics);
+    tcase_add_test(tc_core, AabbTransform);
+    tcase_add_test(tc_core, AabbTransformArray);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+int main(void) {
+    int num_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = buffer_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    num_failed = srunner_ntests_failed(sr);
+    printf("%s\n", num_failed ? "At least one test failed" : "All tests passed");
+    srunner_free(sr);
+    return (!num_failed ? EXIT_SUCCESS : EXIT_FAILURE);
+}
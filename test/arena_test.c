@@ -0,0 +1,113 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <check.h>
+
+#include "lac_common.h"
+#include "arena.h"
+
+START_TEST(ArenaAllocation) {
+    LacArena_t arena;
+    uint8_t *a, *b, *c;
+
+    ck_assert_int_eq(lac_init_arena(&arena, 256), 0);
+
+    a = lac_alloc_arena(&arena, 1, 0);
+    b = lac_alloc_arena(&arena, sizeof(mat4), 16);
+    c = lac_alloc_arena(&arena, sizeof(vec3), 0);
+    ck_assert_ptr_nonnull(a);
+    ck_assert_ptr_nonnull(b);
+    ck_assert_ptr_nonnull(c);
+    ck_assert_uint_eq((uintptr_t)a % LAC_ARENA_ALIGN, 0);
+    ck_assert_uint_eq((uintptr_t)b % 16, 0);
+    ck_assert_uint_eq((uintptr_t)c % LAC_ARENA_ALIGN, 0);
+    ck_assert_ptr_eq(b, a + 16);
+
+    /* Requests which do not fit fail without disturbing the arena */
+    ck_assert_ptr_null(lac_alloc_arena(&arena, 256, 0));
+    ck_assert_ptr_nonnull(lac_alloc_arena(&arena, 64, 0));
+
+    lac_free_arena(&arena);
+    ck_assert_ptr_null(arena.base);
+}
+END_TEST
+
+START_TEST(ArenaMarks) {
+    uint8_t buffer[512];
+    LacArena_t arena;
+    LacArenaMark_t mark;
+    uint8_t *a, *b;
+
+    lac_init_arena_from_buffer(&arena, buffer, sizeof(buffer));
+
+    lac_alloc_arena(&arena, 100, 1);
+    mark = lac_get_arena_mark(&arena);
+    ck_assert_uint_eq(mark, 100);
+
+    a = lac_alloc_arena(&arena, 200, 1);
+    lac_reset_arena_to_mark(&arena, mark);
+    b = lac_alloc_arena(&arena, 200, 1);
+    ck_assert_ptr_eq(a, b);
+    ck_assert_uint_eq(arena.peak, 300);
+
+    lac_reset_arena(&arena);
+    ck_assert_uint_eq(lac_get_arena_mark(&arena), 0);
+    ck_assert_ptr_eq(lac_alloc_arena(&arena, 1, 1), buffer);
+
+    /* Freeing an arena over a caller owned buffer must not free the buffer */
+    lac_free_arena(&arena);
+}
+END_TEST
+
+static void *get_thread_arena(void *arg) {
+    (void)arg;
+    return lac_get_thread_arena();
+}
+
+START_TEST(ArenaPerThread) {
+    LacArena_t *main_arena, *other_arena;
+    pthread_t thread;
+
+    main_arena = lac_get_thread_arena();
+    ck_assert_ptr_nonnull(main_arena);
+    ck_assert_ptr_eq(lac_get_thread_arena(), main_arena);
+    ck_assert_uint_eq(main_arena->capacity, LAC_THREAD_ARENA_SIZE);
+
+    ck_assert_int_eq(pthread_create(&thread, NULL, get_thread_arena, NULL), 0);
+    pthread_join(thread, (void**)&other_arena);
+    ck_assert_ptr_nonnull(other_arena);
+    ck_assert(other_arena != main_arena);
+}
+END_TEST
+
+Suite *buffer_suite(void) {
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Arenas");
+
+    /* Core test cases */
+    tc_core = tcase_create("Core");
+    tcase_add_test(tc_core, ArenaAllocation);
+    tcase_add_test(tc_core, ArenaMarks);
+    tcase_add_test(tc_core, ArenaPerThread);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+int main(void) {
+    int num_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = buffer_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    num_failed = srunner_ntests_failed(sr);
+    printf("%s\n", num_failed ? "At least one test failed" : "All tests passed");
+    srunner_free(sr);
+    return (!num_failed ? EXIT_SUCCESS : EXIT_FAILURE);
+}
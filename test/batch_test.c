@@ -0,0 +1,205 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <float.h>
+#include <math.h>
+#include <check.h>
+
+#include "lac_common.h"
+#include "vecmath.h"
+#include "batch.h"
+
+/* The ULPs allowed between a projected coordinate and its exact value */
+#define MAX_ULPS 4
+
+/*
+ * Checks that a projected coordinate is within MAX_ULPS of __expected__. Under -Ofast, 1 / w may
+ * be a refined reciprocal estimate, and the products may be fused, so the ULPs are counted at the
+ * size of the viewport, which is what cancels to give coordinates near 0.
+ */
+static void assert_projected(const float actual, const float expected, const float extent) {
+    ck_assert_float_eq_tol(actual, expected, MAX_ULPS * FLT_EPSILON * fmaxf(fabsf(expected), extent));
+}
+
+START_TEST(ArrayMultiplication) {
+    mat4 m4 = {
+        1,  2,  3,  4,
+        5,  6,  7,  8,
+        9,  10, 11, 12,
+        13, 14, 15, 16
+    };
+
+    vec4 v4_in[11];
+    vec4 v4_expected[11];
+    vec4 v4_actual[11];
+    size_t i;
+
+    for (i = 0; i < 11; ++i) {
+        v4_in[i][0] = (float)i;
+        v4_in[i][1] = (float)(i * 2);
+        v4_in[i][2] = (float)(10 - i);
+        v4_in[i][3] = 1.0f;
+        lac_multiply_vec4_mat4(v4_expected[i], v4_in[i], m4);
+    }
+
+    lac_multiply_vec4_mat4_array(v4_actual, (const vec4 *)v4_in, m4, 11);
+    ck_assert_mem_eq(v4_actual, v4_expected, sizeof(v4_expected));
+
+    /* Transforming in-place must give the same result */
+    lac_multiply_vec4_mat4_array(v4_in, (const vec4 *)v4_in, m4, 11);
+    ck_assert_mem_eq(v4_in, v4_expected, sizeof(v4_expected));
+}
+END_TEST
+
+START_TEST(ProjectVertices) {
+    mat4 m4_mvp = {
+        1,  0,  0,  0,
+        0,  1,  0,  0,
+        0,  0,  1,  0,
+        0,  0,  0,  1
+    };
+
+    LacViewport_t viewport = { 0.0f, 0.0f, 100.0f, 50.0f, 0.0f, 1.0f };
+
+    /* Not a multiple of LAC_BATCH_BLOCK so that the tail path is taken too */
+    vec4 v4_in[10] = {
+        { 0.5f, -0.5f,  0.0f, 1.0f },
+        { 1.0f,  1.0f,  1.0f, 2.0f },
+        { 2.0f,  0.0f,  0.0f, 1.0f },
+        {-2.0f,  0.0f,  0.0f, 1.0f },
+        { 0.0f,  2.0f,  0.0f, 1.0f },
+        { 0.0f, -2.0f,  0.0f, 1.0f },
+        { 0.0f,  0.0f, -2.0f, 1.0f },
+        { 0.0f,  0.0f,  2.0f, 1.0f },
+        { 0.0f,  0.0f,  0.0f, 0.0f },
+        {-1.0f, -1.0f, -1.0f, 1.0f }
+    };
+
+    vec3 v3_expected[10] = {
+        { 75.0f, 12.5f, 0.0f },
+        { 75.0f, 37.5f, 0.5f }
+    };
+
+    uint8_t codes_expected[10] = {
+        0,
+        0,
+        LAC_CLIP_RIGHT,
+        LAC_CLIP_LEFT,
+        LAC_CLIP_TOP,
+        LAC_CLIP_BOTTOM,
+        LAC_CLIP_NEAR,
+        LAC_CLIP_FAR,
+        LAC_CLIP_W,
+        0
+    };
+
+    vec3 v3_actual[10] = { { 0 } };
+    uint8_t codes_actual[10] = { 0 };
+    size_t i, c;
+
+    lac_project_vec4_array(v3_actual, codes_actual, (const vec4 *)v4_in, m4_mvp, &viewport, 10, false);
+    ck_assert_mem_eq(codes_actual, codes_expected, sizeof(codes_expected));
+    for (i = 0; i < 2; ++i) {
+        for (c = 0; c < 3; ++c) {
+            assert_projected(v3_actual[i][c], v3_expected[i][c], viewport.width);
+        }
+    }
+    assert_projected(v3_actual[9][0], 0.0f, viewport.width);
+    assert_projected(v3_actual[9][1], 0.0f, viewport.width);
+    assert_projected(v3_actual[9][2], -1.0f, 1.0f);
+
+    /* Depth remapping takes NDC [-1, 1] onto [min_depth, max_depth] */
+    lac_project_vec4_array(v3_actual, codes_actual, (const vec4 *)v4_in, m4_mvp, &viewport, 10, true);
+    assert_projected(v3_actual[0][2], 0.5f, 1.0f);
+    assert_projected(v3_actual[1][2], 0.75f, 1.0f);
+    assert_projected(v3_actual[9][2], 0.0f, 1.0f);
+}
+END_TEST
+
+START_TEST(BlendArrays) {
+    vec3 v3_a[13], v3_b[13], v3_c[13], v3_expected[13], v3_actual[13];
+    const vec3 *v3_poses[3] = { v3_a, v3_b, v3_c };
+    const float weights[3] = { 0.5f, 0.25f, 0.25f };
+    mat4 m4_a[3], m4_b[3], m4_actual[3];
+    const mat4 *m4_poses[2] = { m4_a, m4_b };
+    const float m4_weights[2] = { 0.75f, 0.25f };
+    size_t i, c;
+
+    for (i = 0; i < 13; ++i) {
+        for (c = 0; c < 3; ++c) {
+            v3_a[i][c] = (float)(i + c);
+            v3_b[i][c] = (float)(i * c) - 4.0f;
+            v3_c[i][c] = 8.0f - (float)c;
+        }
+    }
+
+    /* 13 vectors of 3 floats leave a partial block at the end */
+    lac_lerp_vec3_array(v3_actual, (const vec3 *)v3_a, (const vec3 *)v3_b, 0.25f, 13);
+    for (i = 0; i < 13; ++i) {
+        lac_lerp_vec3(v3_expected[i], v3_a[i], v3_b[i], 0.25f);
+    }
+    ck_assert_mem_eq(v3_actual, v3_expected, sizeof(v3_expected));
+
+    lac_multiply_add_vec3_array(v3_actual, (const vec3 *)v3_a, 0.5f, (const vec3 *)v3_b, 13);
+    for (i = 0; i < 13; ++i) {
+        for (c = 0; c < 3; ++c) {
+            ck_assert_float_eq(v3_actual[i][c], (v3_a[i][c] * 0.5f) + v3_b[i][c]);
+        }
+    }
+
+    lac_blend_vec3_array(v3_actual, v3_poses, weights, 3, 13);
+    for (i = 0; i < 13; ++i) {
+        for (c = 0; c < 3; ++c) {
+            ck_assert_float_eq(v3_actual[i][c], (v3_a[i][c] * 0.5f) + (v3_b[i][c] * 0.25f) + (v3_c[i][c] * 0.25f));
+        }
+    }
+
+    /* Blending in place, into the first input */
+    memcpy(v3_expected, v3_actual, sizeof(v3_actual));
+    lac_blend_vec3_array(v3_a, v3_poses, weights, 3, 13);
+    ck_assert_mem_eq(v3_a, v3_expected, sizeof(v3_expected));
+
+    /* No inputs at all gives zeros */
+    lac_blend_vec3_array(v3_actual, v3_poses, weights, 0, 13);
+    ck_assert_float_eq(v3_actual[12][2], 0.0f);
+
+    for (i = 0; i < 3 * 16; ++i) {
+        m4_a[i / 16][i % 16] = (float)i;
+        m4_b[i / 16][i % 16] = 100.0f - (float)(i * 2);
+    }
+    lac_blend_mat4_array(m4_actual, m4_poses, m4_weights, 2, 3);
+    for (i = 0; i < 3 * 16; ++i) {
+        ck_assert_float_eq(m4_actual[i / 16][i % 16], (m4_a[i / 16][i % 16] * 0.75f) + (m4_b[i / 16][i % 16] * 0.25f));
+    }
+}
+END_TEST
+
+Suite *buffer_suite(void) {
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Batch");
+
+    /* Core test cases */
+    tc_core = tcase_create("Core");
+    tcase_add_test(tc_core, ArrayMultiplication);
+    tcase_add_test(tc_core, ProjectVertices);
+    tcase_add_test(tc_core, BlendArrays);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+int main(void) {
+    int num_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = buffer_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    num_failed = srunner_ntests_failed(sr);
+    printf("%s\n", num_failed ? "At least one test failed" : "All tests passed");
+    srunner_free(sr);
+    return (!num_failed ? EXIT_SUCCESS : EXIT_FAILURE);
+}
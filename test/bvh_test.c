@@ -0,0 +1,279 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <float.h>
+#include <check.h>
+
+#include "lac_common.h"
+#include "aabb.h"
+#include "bvh.h"
+
+/* Enough triangles that the threaded build bins the root across threads */
+#define TRIANGLES (80 * 1024)
+#define BOXES 5000
+#define RAYS 48
+#define QUERIES 64
+
+static uint32_t seed;
+
+static float random_float(const float min, const float max) {
+    seed = (seed * 1664525u) + 1013904223u;
+    return min + ((max - min) * (float)(seed >> 8) / (float)(1u << 24));
+}
+
+/* Small triangles scattered through a 100-unit cube, sharing vertices through an index buffer */
+static void make_mesh(vec3 *vertices, uint32_t *indices, const size_t count) {
+    size_t i, k, c;
+
+    seed = 1234;
+    for (i = 0; i < count; ++i) {
+        for (c = 0; c < 3; ++c) {
+            vertices[3 * i][c] = random_float(-50.0f, 50.0f);
+        }
+        for (k = 1; k < 3; ++k) {
+            for (c = 0; c < 3; ++c) {
+                vertices[(3 * i) + k][c] = vertices[3 * i][c] + random_float(-1.0f, 1.0f);
+            }
+        }
+        /* Reverse the winding of every other triangle */
+        indices[3 * i] = (uint32_t)(3 * i);
+        indices[(3 * i) + 1] = (uint32_t)((3 * i) + ((i % 2) ? 2 : 1));
+        indices[(3 * i) + 2] = (uint32_t)((3 * i) + ((i % 2) ? 1 : 2));
+    }
+}
+
+static void make_ray(LacRay_t *ray) {
+    vec3 v_origin, v_target, v_direction;
+    size_t c;
+
+    for (c = 0; c < 3; ++c) {
+        v_origin[c] = random_float(-60.0f, 60.0f);
+        v_target[c] = random_float(-20.0f, 20.0f);
+        v_direction[c] = v_target[c] - v_origin[c];
+    }
+    lac_init_ray(ray, v_origin, v_direction, 0.0f, FLT_MAX);
+}
+
+static void make_box(LacAabb_t *box, const float size) {
+    vec3 v_point;
+    size_t c;
+
+    for (c = 0; c < 3; ++c) {
+        v_point[c] = random_float(-50.0f, 50.0f);
+    }
+    lac_init_aabb(box);
+    lac_expand_aabb(box, v_point);
+    for (c = 0; c < 3; ++c) {
+        v_point[c] += random_float(0.0f, size);
+    }
+    lac_expand_aabb(box, v_point);
+}
+
+/* The same slab test as the BVH, for comparing against every box in turn */
+static bool intersect_box(float *t, const LacAabb_t *box, const LacRay_t *ray, const float tmax) {
+    float t_near = ray->tmin, t_far = tmax, t1, t2;
+    size_t c;
+
+    for (c = 0; c < 3; ++c) {
+        t1 = (box->min[c] - ray->origin[c]) / ray->direction[c];
+        t2 = (box->max[c] - ray->origin[c]) / ray->direction[c];
+        t_near = fmaxf(t_near, fminf(t1, t2));
+        t_far = fminf(t_far, fmaxf(t1, t2));
+    }
+
+    *t = t_near;
+    return t_near <= t_far && t_near < tmax;
+}
+
+static int compare_prims(const void *a, const void *b) {
+    const uint32_t x = *(const uint32_t*)a, y = *(const uint32_t*)b;
+    return (x > y) - (x < y);
+}
+
+static void check_triangles(LacScheduler_t *scheduler, const vec3 *vertices, const uint32_t *indices) {
+    LacRayHit_t expected, actual;
+    LacAabb_t bounds;
+    LacRay_t ray;
+    LacBvh_t *bvh;
+    uint32_t i, p;
+    size_t r;
+
+    bvh = lac_create_bvh_triangles(scheduler, vertices, indices, TRIANGLES);
+    ck_assert_ptr_nonnull(bvh);
+    ck_assert_uint_gt(lac_get_bvh_node_count(bvh), 0);
+    ck_assert_uint_ge(lac_get_bvh_leaf_count(bvh), TRIANGLES / LAC_BVH_MAX_LEAF);
+
+    lac_get_bvh_bounds(&bounds, bvh);
+    ck_assert_float_ge(bounds.min[0], -51.0f);
+    ck_assert_float_le(bounds.max[0], 51.0f);
+
+    seed = 99;
+    for (r = 0; r < RAYS; ++r) {
+        make_ray(&ray);
+
+        lac_init_ray_hit(&expected, &ray);
+        for (p = 0; p < TRIANGLES; ++p) {
+            i = 3 * p;
+            lac_intersect_ray_triangle(&expected, &ray, vertices[indices[i]], vertices[indices[i + 1]], vertices[indices[i + 2]], p);
+        }
+
+        lac_init_ray_hit(&actual, &ray);
+        ck_assert(lac_intersect_bvh_ray(bvh, &actual, &ray) == (expected.prim != LAC_RAY_NO_HIT));
+        if (expected.prim != LAC_RAY_NO_HIT) {
+            ck_assert_float_eq_tol(actual.t, expected.t, 1e-4f);
+            ck_assert_uint_lt(actual.prim, TRIANGLES);
+        }
+    }
+
+    lac_destroy_bvh(bvh);
+}
+
+START_TEST(BvhTriangles) {
+    LacScheduler_t *scheduler;
+    vec3 *vertices;
+    uint32_t *indices;
+
+    vertices = malloc(3 * TRIANGLES * sizeof(vec3));
+    indices = malloc(3 * TRIANGLES * sizeof(uint32_t));
+    ck_assert_ptr_nonnull(vertices);
+    ck_assert_ptr_nonnull(indices);
+    make_mesh(vertices, indices, TRIANGLES);
+
+    /* The serial and threaded builds must agree with testing every triangle */
+    check_triangles(NULL, vertices, indices);
+
+    scheduler = lac_create_scheduler(4);
+    ck_assert_ptr_nonnull(scheduler);
+    check_triangles(scheduler, vertices, indices);
+    lac_destroy_scheduler(scheduler);
+
+    free(vertices);
+    free(indices);
+}
+END_TEST
+
+START_TEST(BvhBoxes) {
+    uint32_t expected[BOXES], actual[BOXES];
+    LacRayHit_t expected_hit, actual_hit;
+    LacScheduler_t *scheduler;
+    LacAabb_t boxes[BOXES], query;
+    LacRay_t ray;
+    LacBvh_t *bvh;
+    size_t i, q, count, found;
+    float t;
+
+    seed = 7;
+    for (i = 0; i < BOXES; ++i) {
+        make_box(&boxes[i], 4.0f);
+    }
+
+    scheduler = lac_create_scheduler(4);
+    ck_assert_ptr_nonnull(scheduler);
+    bvh = lac_create_bvh(scheduler, boxes, BOXES);
+    ck_assert_ptr_nonnull(bvh);
+
+    for (q = 0; q < QUERIES; ++q) {
+        make_box(&query, 20.0f);
+
+        count = 0;
+        for (i = 0; i < BOXES; ++i) {
+            if (lac_test_aabb_overlap(&boxes[i], &query)) {
+                expected[count++] = (uint32_t)i;
+            }
+        }
+
+        found = lac_query_bvh_aabb(bvh, actual, BOXES, &query);
+        ck_assert_uint_eq(found, count);
+        qsort(actual, found, sizeof(uint32_t), compare_prims);
+        for (i = 0; i < count; ++i) {
+            ck_assert_uint_eq(actual[i], expected[i]);
+        }
+
+        /* The total is still counted when the output is too small */
+        ck_assert_uint_eq(lac_query_bvh_aabb(bvh, actual, count / 2, &query), count);
+
+        make_ray(&ray);
+        lac_init_ray_hit(&expected_hit, &ray);
+        for (i = 0; i < BOXES; ++i) {
+            if (intersect_box(&t, &boxes[i], &ray, expected_hit.t)) {
+                expected_hit.t = t;
+                expected_hit.prim = (uint32_t)i;
+            }
+        }
+
+        lac_init_ray_hit(&actual_hit, &ray);
+        ck_assert(lac_intersect_bvh_ray(bvh, &actual_hit, &ray) == (expected_hit.prim != LAC_RAY_NO_HIT));
+        if (expected_hit.prim != LAC_RAY_NO_HIT) {
+            ck_assert_float_eq_tol(actual_hit.t, expected_hit.t, 1e-4f);
+        }
+    }
+
+    lac_destroy_bvh(bvh);
+    lac_destroy_scheduler(scheduler);
+}
+END_TEST
+
+START_TEST(BvhDegenerate) {
+    LacAabb_t boxes[1000], query;
+    vec3 v_point = { 1.0f, 2.0f, 3.0f };
+    uint32_t prims[1000];
+    LacRayHit_t hit;
+    LacRay_t ray;
+    LacBvh_t *bvh;
+    size_t i;
+
+    for (i = 0; i < 1000; ++i) {
+        lac_init_aabb_from_points(&boxes[i], &v_point, 1);
+    }
+
+    /* Without primitives there is nothing to hit */
+    bvh = lac_create_bvh(NULL, boxes, 0);
+    ck_assert_ptr_nonnull(bvh);
+    ck_assert_uint_eq(lac_get_bvh_node_count(bvh), 0);
+    make_ray(&ray);
+    lac_init_ray_hit(&hit, &ray);
+    ck_assert(!lac_intersect_bvh_ray(bvh, &hit, &ray));
+    lac_init_aabb_from_points(&query, &v_point, 1);
+    ck_assert_uint_eq(lac_query_bvh_aabb(bvh, prims, 1000, &query), 0);
+    lac_destroy_bvh(bvh);
+
+    /* Identical boxes cannot be binned apart, so they are split down the middle instead */
+    bvh = lac_create_bvh(NULL, boxes, 1000);
+    ck_assert_ptr_nonnull(bvh);
+    ck_assert_uint_ge(lac_get_bvh_leaf_count(bvh), 1000 / LAC_BVH_MAX_LEAF);
+    ck_assert_uint_eq(lac_query_bvh_aabb(bvh, prims, 1000, &query), 1000);
+    lac_destroy_bvh(bvh);
+}
+END_TEST
+
+Suite *buffer_suite(void) {
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Bvh");
+
+    /* Core test cases */
+    tc_core = tcase_create("Core");
+    tcase_set_timeout(tc_core, 60);
+    tcase_add_test(tc_core, BvhTriangles);
+    tcase_add_test(tc_core, BvhBoxes);
+    tcase_add_test(tc_core, BvhDegenerate);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+int main(void) {
+    int num_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = buffer_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    num_failed = srunner_ntests_failed(sr);
+    printf("%s\n", num_failed ? "At least one test failed" : "All tests passed");
+    srunner_free(sr);
+    return (!num_failed ? EXIT_SUCCESS : EXIT_FAILURE);
+}
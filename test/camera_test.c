@@ -0,0 +1,123 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <check.h>
+
+#include "lac_common.h"
+#include "matmath.h"
+#include "transforms.h"
+#include "camera.h"
+
+START_TEST(CameraMatrices) {
+    vec3 v_eye = { 1, 2, 3 };
+    vec3 v_target = { 0, 0, 0 };
+    vec3 v_up = { 0, 0, 1 };
+    mat4 m4_point_at, m4_view, m4_proj, m4_view_proj;
+    mat4 m4_actual;
+    LacCamera_t camera;
+
+    lac_init_camera(&camera, v_eye, v_target, v_up, 0.75f, 1.5f, 0.1f, 100.0f);
+
+    lac_get_point_at_mat4(m4_point_at, v_eye, v_target, v_up);
+    lac_invert_mat4(m4_view, m4_point_at);
+    lac_get_projection_mat4(m4_proj, 0.75f, 1.5f, 0.1f, 100.0f);
+    lac_multiply_mat4(m4_view_proj, m4_proj, m4_view);
+
+    lac_get_camera_view_mat4(m4_actual, &camera);
+    ck_assert_mem_eq(m4_actual, m4_view, sizeof(mat4));
+
+    lac_get_camera_inv_view_mat4(m4_actual, &camera);
+    ck_assert_mem_eq(m4_actual, m4_point_at, sizeof(mat4));
+
+    lac_get_camera_projection_mat4(m4_actual, &camera);
+    ck_assert_mem_eq(m4_actual, m4_proj, sizeof(mat4));
+
+    lac_get_camera_view_projection_mat4(m4_actual, &camera);
+    ck_assert_mem_eq(m4_actual, m4_view_proj, sizeof(mat4));
+}
+END_TEST
+
+START_TEST(CameraInverses) {
+    vec3 v_eye = { 4, -2, 1 };
+    vec3 v_target = { 0, 1, 0 };
+    vec3 v_up = { 0, 0, 1 };
+    mat4 m4_a, m4_b, m4_product;
+    LacCamera_t camera;
+    size_t i;
+
+    lac_init_camera(&camera, v_eye, v_target, v_up, 0.5625f, 1.2f, 0.5f, 50.0f);
+
+    lac_get_camera_projection_mat4(m4_a, &camera);
+    lac_get_camera_inv_projection_mat4(m4_b, &camera);
+    lac_multiply_mat4(m4_product, m4_a, m4_b);
+    for (i = 0; i < 16; ++i) {
+        ck_assert_float_eq_tol(m4_product[i], lac_ident_mat4[i], 1e-5f);
+    }
+
+    lac_get_camera_view_projection_mat4(m4_a, &camera);
+    lac_get_camera_inv_view_projection_mat4(m4_b, &camera);
+    lac_multiply_mat4(m4_product, m4_a, m4_b);
+    for (i = 0; i < 16; ++i) {
+        ck_assert_float_eq_tol(m4_product[i], lac_ident_mat4[i], 1e-4f);
+    }
+}
+END_TEST
+
+START_TEST(CameraGeneration) {
+    vec3 v_eye = { 1, 2, 3 };
+    vec3 v_target = { 0, 0, 0 };
+    vec3 v_up = { 0, 0, 1 };
+    mat4 m4_view_before, m4_view_after, m4_proj_before, m4_proj_after;
+    uint64_t generation;
+    LacCamera_t camera;
+
+    lac_init_camera(&camera, v_eye, v_target, v_up, 0.75f, 1.5f, 0.1f, 100.0f);
+    lac_get_camera_view_mat4(m4_view_before, &camera);
+    lac_get_camera_projection_mat4(m4_proj_before, &camera);
+    generation = lac_get_camera_generation(&camera);
+
+    /* Setting an input to its current value is not a change */
+    lac_set_camera_eye(&camera, v_eye);
+    lac_set_camera_aspect(&camera, 0.75f);
+    ck_assert_uint_eq(lac_get_camera_generation(&camera), generation);
+
+    /* Changing the aspect ratio only affects the projection */
+    lac_set_camera_aspect(&camera, 0.5f);
+    ck_assert_uint_ne(lac_get_camera_generation(&camera), generation);
+
+    lac_get_camera_view_mat4(m4_view_after, &camera);
+    lac_get_camera_projection_mat4(m4_proj_after, &camera);
+    ck_assert_mem_eq(m4_view_after, m4_view_before, sizeof(mat4));
+    ck_assert_float_eq_tol(m4_proj_after[0], m4_proj_before[0] * 1.5f, 1e-5f);
+}
+END_TEST
+
+Suite *buffer_suite(void) {
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Camera");
+
+    /* Core test cases */
+    tc_core = tcase_create("Core");
+    tcase_add_test(tc_core, CameraMatrices);
+    tcase_add_test(tc_core, CameraInverses);
+    tcase_add_test(tc_core, CameraGeneration);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+int main(void) {
+    int num_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = buffer_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    num_failed = srunner_ntests_failed(sr);
+    printf("%s\n", num_failed ? "At least one test failed" : "All tests passed");
+    srunner_free(sr);
+    return (!num_failed ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,292 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <check.h>
+
+#include "lac_common.h"
+#include "coords.h"
+#include "vecmath.h"
+
+/* An odd count, so that the final block is padded */
+#define POINTS 203
+/* How far apart, in ULPs, the SoA and array forms of a conversion may be */
+#define MAX_ULPS 4
+
+static uint32_t seed;
+
+static float random_float(const float min, const float max) {
+    seed = (seed * 1664525u) + 1013904223u;
+    return min + ((max - min) * (float)(seed >> 8) / (float)(1u << 24));
+}
+
+/* The largest absolute error allowed for each accuracy, relative to the size of the result */
+static float get_tolerance(const LacCoordAccuracy_t accuracy) {
+    return (accuracy == LAC_COORD_PRECISE) ? 1e-6f : 2e-5f;
+}
+
+/*
+ * The number of floats between two results. The SoA and array forms share one kernel, but
+ * each is optimized separately, and -Ofast may round a few intermediate results differently
+ */
+static uint32_t ulp_diff(const float a, const float b) {
+    int32_t ia, ib;
+
+    memcpy(&ia, &a, sizeof(float));
+    memcpy(&ib, &b, sizeof(float));
+    ia = (ia < 0) ? (int32_t)(0x80000000u - (uint32_t)ia) : ia;
+    ib = (ib < 0) ? (int32_t)(0x80000000u - (uint32_t)ib) : ib;
+    return (ia > ib) ? (uint32_t)ia - (uint32_t)ib : (uint32_t)ib - (uint32_t)ia;
+}
+
+/* The difference between two angles, ignoring whole turns */
+static float angle_diff(const float a, const float b) {
+    const float d = fabsf(a - b);
+    return fminf(d, fabsf(d - 6.2831853f));
+}
+
+START_TEST(CoordsPolar) {
+    const LacCoordAccuracy_t accuracies[2] = { LAC_COORD_FAST, LAC_COORD_PRECISE };
+    vec2 v_polar[POINTS], v_cart[POINTS], v_back[POINTS];
+    float len[POINTS], angle[POINTS], x[POINTS], y[POINTS], expected_len, expected_angle;
+    LacSoaVec2_t points = { x, y };
+    size_t a, i;
+    float tol;
+
+    seed = 17;
+    for (i = 0; i < POINTS; ++i) {
+        v_polar[i][0] = random_float(0.0f, 50.0f);
+        v_polar[i][1] = random_float(-100.0f, 100.0f);
+    }
+
+    /* Every quadrant boundary, and the origin */
+    for (i = 0; i < 9; ++i) {
+        v_polar[i][0] = 2.0f;
+        v_polar[i][1] = -6.2831853f + (1.5707963f * (float)i);
+    }
+    v_polar[9][0] = 0.0f;
+
+    /* Either side of the largest angle that is reduced, and angles far beyond it */
+    v_polar[10][1] = 8191.5f;
+    v_polar[11][1] = -8192.5f;
+    v_polar[12][1] = -12000.0f;
+    v_polar[13][1] = 1e6f;
+
+    for (a = 0; a < 2; ++a) {
+        tol = get_tolerance(accuracies[a]);
+
+        lac_polar_to_cartesian_array(v_cart, v_polar, POINTS, accuracies[a]);
+        for (i = 0; i < POINTS; ++i) {
+            lac_polar_to_cartesian(v_back[i], v_polar[i][0], v_polar[i][1]);
+            ck_assert_float_eq_tol(v_cart[i][0], v_back[i][0], tol * fmaxf(v_polar[i][0], 1.0f));
+            ck_assert_float_eq_tol(v_cart[i][1], v_back[i][1], tol * fmaxf(v_polar[i][0], 1.0f));
+        }
+
+        lac_cartesian_to_polar_array(v_back, v_cart, POINTS, accuracies[a]);
+        for (i = 0; i < POINTS; ++i) {
+            lac_cartesian_to_polar(&expected_len, &expected_angle, v_cart[i]);
+            ck_assert_float_eq_tol(v_back[i][0], expected_len, 1e-6f * fmaxf(expected_len, 1.0f));
+            ck_assert_float_eq_tol(v_back[i][1], expected_angle, tol);
+            ck_assert_float_le(v_back[i][1], 3.1415927f);
+            ck_assert_float_ge(v_back[i][1], -3.1415927f);
+        }
+        ck_assert_float_eq(v_back[9][1], 0.0f);
+
+        /* The SoA forms give the same results as the arrays of vectors, give or take rounding */
+        for (i = 0; i < POINTS; ++i) {
+            len[i] = v_polar[i][0];
+            angle[i] = v_polar[i][1];
+        }
+        lac_polar_to_cartesian_soa(&points, len, angle, POINTS, accuracies[a]);
+        for (i = 0; i < POINTS; ++i) {
+            ck_assert_uint_le(ulp_diff(x[i], v_cart[i][0]), MAX_ULPS);
+            ck_assert_uint_le(ulp_diff(y[i], v_cart[i][1]), MAX_ULPS);
+        }
+
+        /* Converted in place */
+        lac_cartesian_to_polar_soa(x, y, &points, POINTS, accuracies[a]);
+        for (i = 0; i < POINTS; ++i) {
+            ck_assert_uint_le(ulp_diff(x[i], v_back[i][0]), MAX_ULPS);
+            ck_assert_uint_le(ulp_diff(y[i], v_back[i][1]), MAX_ULPS);
+        }
+    }
+}
+END_TEST
+
+START_TEST(CoordsPolarEdges) {
+    const LacCoordAccuracy_t accuracies[2] = { LAC_COORD_FAST, LAC_COORD_PRECISE };
+    /* Signed zeros either side of the negative x axis, and every way of being infinite */
+    const vec2 v_cart[13] = {
+        { -1.0f, -0.0f },
+        { -1.0f, 0.0f },
+        { 1.0f, -0.0f },
+        { 1.0f, 0.0f },
+        { INFINITY, 1.0f },
+        { INFINITY, -1.0f },
+        { -INFINITY, 1.0f },
+        { -INFINITY, -1.0f },
+        { 1.0f, INFINITY },
+        { 1.0f, -INFINITY },
+        { INFINITY, INFINITY },
+        { -INFINITY, INFINITY },
+        { -INFINITY, -INFINITY }
+    };
+    vec2 v_polar[13];
+    float expected;
+    size_t a, i;
+
+    for (a = 0; a < 2; ++a) {
+        lac_cartesian_to_polar_array(v_polar, v_cart, 13, accuracies[a]);
+        for (i = 0; i < 13; ++i) {
+            expected = atan2f(v_cart[i][1], v_cart[i][0]);
+            ck_assert_float_eq_tol(v_polar[i][1], expected, get_tolerance(accuracies[a]));
+            ck_assert_int_eq(signbit(v_polar[i][1]) != 0, signbit(expected) != 0);
+        }
+    }
+}
+END_TEST
+
+START_TEST(CoordsSpherical) {
+    const LacCoordAccuracy_t accuracies[2] = { LAC_COORD_FAST, LAC_COORD_PRECISE };
+    vec3 v_sphere[POINTS], v_cart[POINTS], v_back[POINTS];
+    float x[POINTS], y[POINTS], z[POINTS], expected[3];
+    LacSoaVec3_t points = { x, y, z };
+    size_t a, i, c;
+    float tol;
+
+    seed = 23;
+    for (i = 0; i < POINTS; ++i) {
+        v_sphere[i][0] = random_float(0.5f, 20.0f);
+        v_sphere[i][1] = random_float(-3.1f, 3.1f);
+        v_sphere[i][2] = random_float(0.01f, 3.13f);
+    }
+
+    /* The poles */
+    v_sphere[0][2] = 0.0f;
+    v_sphere[1][2] = 3.1415927f;
+
+    for (a = 0; a < 2; ++a) {
+        tol = get_tolerance(accuracies[a]);
+
+        lac_spherical_to_cartesian_array(v_cart, v_sphere, POINTS, accuracies[a]);
+        for (i = 0; i < POINTS; ++i) {
+            expected[0] = v_sphere[i][0] * sinf(v_sphere[i][2]) * cosf(v_sphere[i][1]);
+            expected[1] = v_sphere[i][0] * sinf(v_sphere[i][2]) * sinf(v_sphere[i][1]);
+            expected[2] = v_sphere[i][0] * cosf(v_sphere[i][2]);
+            for (c = 0; c < 3; ++c) {
+                ck_assert_float_eq_tol(v_cart[i][c], expected[c], 2.0f * tol * v_sphere[i][0]);
+            }
+        }
+
+        /* The round trip gives back the original coordinates, except for the azimuth at the poles */
+        lac_cartesian_to_spherical_array(v_back, v_cart, POINTS, accuracies[a]);
+        for (i = 0; i < POINTS; ++i) {
+            ck_assert_float_eq_tol(v_back[i][0], v_sphere[i][0], 4.0f * tol * v_sphere[i][0]);
+            ck_assert_float_eq_tol(v_back[i][2], v_sphere[i][2], 4.0f * tol);
+            if (i > 1) {
+                ck_assert_float_le(angle_diff(v_back[i][1], v_sphere[i][1]), 4.0f * tol / sinf(v_sphere[i][2]));
+            }
+        }
+
+        for (i = 0; i < POINTS; ++i) {
+            x[i] = v_sphere[i][0];
+            y[i] = v_sphere[i][1];
+            z[i] = v_sphere[i][2];
+        }
+        lac_spherical_to_cartesian_soa(&points, x, y, z, POINTS, accuracies[a]);
+        lac_cartesian_to_spherical_soa(x, y, z, &points, POINTS, accuracies[a]);
+        for (i = 0; i < POINTS; ++i) {
+            ck_assert_uint_le(ulp_diff(x[i], v_back[i][0]), MAX_ULPS);
+            ck_assert_uint_le(ulp_diff(y[i], v_back[i][1]), MAX_ULPS);
+            ck_assert_uint_le(ulp_diff(z[i], v_back[i][2]), MAX_ULPS);
+        }
+    }
+}
+END_TEST
+
+START_TEST(CoordsCylindrical) {
+    const LacCoordAccuracy_t accuracies[2] = { LAC_COORD_FAST, LAC_COORD_PRECISE };
+    vec3 v_cyl[POINTS], v_cart[POINTS], v_back[POINTS];
+    float x[POINTS], y[POINTS], z[POINTS];
+    LacSoaVec3_t points = { x, y, z };
+    size_t a, i;
+    float tol;
+
+    seed = 29;
+    for (i = 0; i < POINTS; ++i) {
+        v_cyl[i][0] = random_float(0.5f, 20.0f);
+        v_cyl[i][1] = random_float(-3.1f, 3.1f);
+        v_cyl[i][2] = random_float(-10.0f, 10.0f);
+    }
+
+    for (a = 0; a < 2; ++a) {
+        tol = get_tolerance(accuracies[a]);
+
+        /* In place, both ways */
+        memcpy(v_cart, v_cyl, sizeof(v_cyl));
+        lac_cylindrical_to_cartesian_array(v_cart, v_cart, POINTS, accuracies[a]);
+        for (i = 0; i < POINTS; ++i) {
+            ck_assert_float_eq_tol(v_cart[i][0], v_cyl[i][0] * cosf(v_cyl[i][1]), tol * v_cyl[i][0]);
+            ck_assert_float_eq_tol(v_cart[i][1], v_cyl[i][0] * sinf(v_cyl[i][1]), tol * v_cyl[i][0]);
+            ck_assert_float_eq(v_cart[i][2], v_cyl[i][2]);
+        }
+
+        memcpy(v_back, v_cart, sizeof(v_cart));
+        lac_cartesian_to_cylindrical_array(v_back, v_back, POINTS, accuracies[a]);
+        for (i = 0; i < POINTS; ++i) {
+            ck_assert_float_eq_tol(v_back[i][0], v_cyl[i][0], 2.0f * tol * v_cyl[i][0]);
+            ck_assert_float_eq_tol(v_back[i][1], v_cyl[i][1], 4.0f * tol);
+            ck_assert_float_eq(v_back[i][2], v_cyl[i][2]);
+        }
+
+        for (i = 0; i < POINTS; ++i) {
+            x[i] = v_cyl[i][0];
+            y[i] = v_cyl[i][1];
+            z[i] = v_cyl[i][2];
+        }
+        lac_cylindrical_to_cartesian_soa(&points, x, y, z, POINTS, accuracies[a]);
+        lac_cartesian_to_cylindrical_soa(x, y, z, &points, POINTS, accuracies[a]);
+        for (i = 0; i < POINTS; ++i) {
+            ck_assert_uint_le(ulp_diff(x[i], v_back[i][0]), MAX_ULPS);
+            ck_assert_uint_le(ulp_diff(y[i], v_back[i][1]), MAX_ULPS);
+            ck_assert_uint_le(ulp_diff(z[i], v_back[i][2]), MAX_ULPS);
+        }
+    }
+
+    /* Nothing is touched for an empty array */
+    lac_cartesian_to_cylindrical_soa(NULL, NULL, NULL, &points, 0, LAC_COORD_FAST);
+}
+END_TEST
+
+Suite *buffer_suite(void) {
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Coords");
+
+    /* Core test cases */
+    tc_core = tcase_create("Core");
+    tcase_add_test(tc_core, CoordsPolar);
+    tcase_add_test(tc_core, CoordsPolarEdges);
+    tcase_add_test(tc_core, CoordsSpherical);
+    tcase_add_test(tc_core, CoordsCylindrical);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+int main(void) {
+    int num_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = buffer_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    num_failed = srunner_ntests_failed(sr);
+    printf("%s\n", num_failed ? "At least one test failed" : "All tests passed");
+    srunner_free(sr);
+    return (!num_failed ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,114 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <check.h>
+
+#include "lac_common.h"
+#include "vecmath.h"
+#include "matmath.h"
+#include "batch.h"
+#include "dispatch.h"
+
+START_TEST(DispatchLevel) {
+    const char *forced = getenv(LAC_ISA_ENV);
+    LacIsaLevel_t level;
+
+    level = lac_get_isa_level();
+    ck_assert(level == LAC_ISA_DEFAULT || level == LAC_ISA_SSE42 || level == LAC_ISA_AVX2);
+    ck_assert_int_eq(lac_get_isa_level(), level);
+
+    ck_assert_str_eq(lac_get_isa_name(LAC_ISA_DEFAULT), "default");
+    ck_assert_str_eq(lac_get_isa_name(LAC_ISA_SSE42), "sse4.2");
+    ck_assert_str_eq(lac_get_isa_name(LAC_ISA_AVX2), "avx2");
+
+    /* Forcing a level may lower it, but never raises it above what the CPU supports */
+    if (forced != NULL && strcmp(forced, "default") == 0) {
+        ck_assert_int_eq(level, LAC_ISA_DEFAULT);
+    } else if (forced != NULL && strcmp(forced, "sse4.2") == 0) {
+        ck_assert_int_le(level, LAC_ISA_SSE42);
+    }
+
+    /* The level is worked out once, so changing the environment afterwards has no effect */
+    setenv(LAC_ISA_ENV, (level == LAC_ISA_DEFAULT) ? "avx2" : "default", 1);
+    ck_assert_int_eq(lac_get_isa_level(), level);
+    if (forced != NULL) {
+        setenv(LAC_ISA_ENV, forced, 1);
+    } else {
+        unsetenv(LAC_ISA_ENV);
+    }
+}
+END_TEST
+
+START_TEST(DispatchKernels) {
+    const mat4 m_a = {
+        1.0f, 2.0f, 3.0f, 4.0f,
+        0.5f, -1.0f, 0.0f, 2.0f,
+        -3.0f, 0.25f, 1.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 1.0f
+    };
+    const mat4 m_identity = {
+        1.0f, 0.0f, 0.0f, 0.0f,
+        0.0f, 1.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 1.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 1.0f
+    };
+    vec4 v_in[3] = { { 1.0f, 2.0f, 3.0f, 1.0f }, { -1.0f, 0.0f, 0.5f, 1.0f }, { 0.0f, 0.0f, 0.0f, 0.0f } };
+    void (*multiply)(mat4, const mat4, const mat4) = &lac_multiply_mat4;
+    vec4 v_batch[3], v_single;
+    vec3 v_norm;
+    mat4 m_out;
+    size_t i;
+
+    /* Whichever variant was bound, the kernels behave the same, and can be called through their address */
+    lac_multiply_mat4(m_out, m_a, m_identity);
+    ck_assert_mem_eq(m_out, m_a, sizeof(mat4));
+    multiply(m_out, m_identity, m_a);
+    ck_assert_mem_eq(m_out, m_a, sizeof(mat4));
+
+    lac_multiply_vec4_mat4_array(v_batch, v_in, m_a, 3);
+    for (i = 0; i < 3; ++i) {
+        lac_multiply_vec4_mat4(v_single, v_in[i], m_a);
+        ck_assert_float_eq_tol(v_batch[i][0], v_single[0], 1e-5f);
+        ck_assert_float_eq_tol(v_batch[i][1], v_single[1], 1e-5f);
+        ck_assert_float_eq_tol(v_batch[i][2], v_single[2], 1e-5f);
+        ck_assert_float_eq_tol(v_batch[i][3], v_single[3], 1e-5f);
+    }
+
+    lac_normalize_vec3(v_norm, (vec3){ 3.0f, 0.0f, 4.0f });
+    ck_assert_float_eq_tol(v_norm[0], 0.6f, 1e-6f);
+    ck_assert_float_eq_tol(v_norm[1], 0.0f, 1e-6f);
+    ck_assert_float_eq_tol(v_norm[2], 0.8f, 1e-6f);
+}
+END_TEST
+
+Suite *buffer_suite(void) {
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Dispatch");
+
+    /* Core test cases */
+    tc_core = tcase_create("Core");
+    tcase_add_test(tc_core, DispatchLevel);
+    tcase_add_test(tc_core, DispatchKernels);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+int main(void) {
+    int num_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = buffer_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    num_failed = srunner_ntests_failed(sr);
+    printf("%s\n", num_failed ? "At least one test failed" : "All tests passed");
+    srunner_free(sr);
+    return (!num_failed ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,332 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <float.h>
+#include <math.h>
+#include <check.h>
+
+#include "lac_common.h"
+#include "grid.h"
+
+/* An odd count, so that the final block is padded */
+#define POINTS 2003
+/* Enough points for the build to be split across threads */
+#define MANY_POINTS 10001
+#define QUERIES 40
+
+static uint32_t seed;
+
+static float random_float(const float min, const float max) {
+    seed = (seed * 1664525u) + 1013904223u;
+    return min + ((max - min) * (float)(seed >> 8) / (float)(1u << 24));
+}
+
+static float distance_sq(const vec3 a, const vec3 b) {
+    const float dx = a[0] - b[0], dy = a[1] - b[1], dz = a[2] - b[2];
+    return (dx * dx) + (dy * dy) + (dz * dz);
+}
+
+/* Half of the points are spread out, and the rest are packed into a few dense clusters */
+static void random_points(vec3 *points, const size_t count) {
+    size_t i, c;
+
+    for (i = 0; i < count; ++i) {
+        for (c = 0; c < 3; ++c) {
+            points[i][c] = (i % 2 == 0) ? random_float(-10.0f, 10.0f) : (float)(i % 5) + random_float(-0.3f, 0.3f);
+        }
+    }
+}
+
+static int compare_floats(const void *a, const void *b) {
+    const float fa = *(const float *)a, fb = *(const float *)b;
+    return (fa > fb) - (fa < fb);
+}
+
+/* Checks a radius query against testing every point, allowing for rounding at the radius itself */
+static void check_radius(const LacGrid_t *grid, const vec3 *points, const size_t count, const vec3 center, const float radius) {
+    uint32_t *found = malloc(count * sizeof(uint32_t));
+    bool *seen = calloc(count, sizeof(bool));
+    const float radius_sq = radius * radius;
+    size_t n, i;
+    float d;
+
+    n = lac_query_grid_radius(grid, found, count, center, radius);
+    ck_assert_uint_le(n, count);
+    for (i = 0; i < n; ++i) {
+        ck_assert_uint_lt(found[i], count);
+        ck_assert(!seen[found[i]]);
+        seen[found[i]] = true;
+        ck_assert_float_le(distance_sq(points[found[i]], center), (radius_sq * (1.0f + 1e-5f)) + 1e-6f);
+    }
+    for (i = 0; i < count; ++i) {
+        d = distance_sq(points[i], center);
+        if (d <= (radius_sq * (1.0f - 1e-5f)) - 1e-6f) {
+            ck_assert(seen[i]);
+        }
+    }
+
+    /* The total is still counted once the output is full */
+    ck_assert_uint_eq(lac_query_grid_radius(grid, found, (n > 2) ? 2 : 0, center, radius), n);
+
+    free(found);
+    free(seen);
+}
+
+/* Checks a nearest neighbor query against sorting every point by distance */
+static void check_nearest(const LacGrid_t *grid, const vec3 *points, const size_t count, const vec3 center, const size_t k) {
+    uint32_t *found = malloc(k * sizeof(uint32_t));
+    float *found_sq = malloc(k * sizeof(float)), *all_sq = malloc(count * sizeof(float));
+    size_t n, i;
+
+    for (i = 0; i < count; ++i) {
+        all_sq[i] = distance_sq(points[i], center);
+    }
+    qsort(all_sq, count, sizeof(float), compare_floats);
+
+    n = lac_query_grid_nearest(grid, found, found_sq, k, center, FLT_MAX);
+    ck_assert_uint_eq(n, (k < count) ? k : count);
+    for (i = 0; i < n; ++i) {
+        ck_assert_float_eq_tol(found_sq[i], all_sq[i], 1e-4f * fmaxf(all_sq[i], 1.0f));
+        ck_assert_float_eq_tol(found_sq[i], distance_sq(points[found[i]], center), 1e-4f * fmaxf(all_sq[i], 1.0f));
+        if (i > 0) {
+            ck_assert_float_le(found_sq[i - 1], found_sq[i]);
+            ck_assert_uint_ne(found[i - 1], found[i]);
+        }
+    }
+
+    free(found);
+    free(found_sq);
+    free(all_sq);
+}
+
+START_TEST(GridRadius) {
+    const float radii[5] = { 0.0f, 0.4f, 1.0f, 2.5f, 40.0f };
+    static vec3 points[POINTS];
+    vec3 center;
+    LacGrid_t *grid;
+    size_t q, r, c;
+
+    seed = 31;
+    random_points(points, POINTS);
+    grid = lac_create_grid(NULL, points, POINTS, 1.0f);
+    ck_assert_ptr_nonnull(grid);
+    ck_assert_uint_eq(lac_get_grid_point_count(grid), POINTS);
+    ck_assert_uint_gt(lac_get_grid_cell_count(grid), 0);
+    ck_assert_uint_le(lac_get_grid_cell_count(grid), POINTS);
+
+    for (q = 0; q < QUERIES; ++q) {
+        for (c = 0; c < 3; ++c) {
+            center[c] = random_float(-12.0f, 12.0f);
+        }
+        for (r = 0; r < 5; ++r) {
+            check_radius(grid, points, POINTS, center, radii[r]);
+        }
+    }
+
+    /* A point is always within a zero radius of itself */
+    check_radius(grid, points, POINTS, points[7], 0.0f);
+    ck_assert_uint_ge(lac_query_grid_radius(grid, NULL, 0, points[7], 0.0f), 1);
+    ck_assert_uint_eq(lac_query_grid_radius(grid, NULL, 0, points[7], -1.0f), 0);
+
+    lac_destroy_grid(grid);
+}
+END_TEST
+
+START_TEST(GridNearest) {
+    const size_t ks[4] = { 1, 7, 40, POINTS + 5 };
+    static vec3 points[POINTS];
+    uint32_t found[8];
+    float found_sq[8];
+    vec3 center;
+    LacGrid_t *grid;
+    size_t q, k, c, n, i;
+
+    seed = 37;
+    random_points(points, POINTS);
+    grid = lac_create_grid(NULL, points, POINTS, 0.75f);
+    ck_assert_ptr_nonnull(grid);
+
+    for (q = 0; q < QUERIES; ++q) {
+        for (c = 0; c < 3; ++c) {
+            center[c] = random_float(-14.0f, 14.0f);
+        }
+        for (k = 0; k < 4; ++k) {
+            check_nearest(grid, points, POINTS, center, ks[k]);
+        }
+    }
+
+    /* Far outside the points, the search reaches them all the same */
+    center[0] = center[1] = center[2] = 500.0f;
+    check_nearest(grid, points, POINTS, center, 5);
+
+    /* Points beyond the maximum radius are left out */
+    n = lac_query_grid_nearest(grid, found, found_sq, 8, points[3], 0.3f);
+    ck_assert_uint_ge(n, 1);
+    ck_assert_uint_le(n, 8);
+    for (i = 0; i < n; ++i) {
+        ck_assert_float_le(found_sq[i], 0.09f);
+    }
+    if (n < 8) {
+        ck_assert_uint_eq(lac_query_grid_radius(grid, NULL, 0, points[3], 0.3f), n);
+    }
+    ck_assert_uint_eq(lac_query_grid_nearest(grid, found, found_sq, 0, points[3], 1.0f), 0);
+    ck_assert_uint_eq(lac_query_grid_nearest(grid, found, found_sq, 8, center, 1.0f), 0);
+
+    lac_destroy_grid(grid);
+}
+END_TEST
+
+START_TEST(GridUpdate) {
+    vec3 *points = malloc(MANY_POINTS * sizeof(vec3)), center;
+    uint32_t *serial = malloc(MANY_POINTS * sizeof(uint32_t)), *threaded = malloc(MANY_POINTS * sizeof(uint32_t));
+    LacScheduler_t *scheduler;
+    LacGrid_t *grid, *grid_mt;
+    size_t i, c, n;
+
+    seed = 41;
+    random_points(points, MANY_POINTS);
+    scheduler = lac_create_scheduler(4);
+    ck_assert_ptr_nonnull(scheduler);
+
+    /* The layout doesn't depend on how the build was split across threads */
+    grid = lac_create_grid(NULL, points, MANY_POINTS, 0.5f);
+    grid_mt = lac_create_grid(scheduler, points, MANY_POINTS, 0.5f);
+    ck_assert_ptr_nonnull(grid);
+    ck_assert_ptr_nonnull(grid_mt);
+    ck_assert_uint_eq(lac_get_grid_cell_count(grid), lac_get_grid_cell_count(grid_mt));
+    center[0] = center[1] = center[2] = 1.0f;
+    n = lac_query_grid_radius(grid, serial, MANY_POINTS, center, 1.5f);
+    ck_assert_uint_eq(lac_query_grid_radius(grid_mt, threaded, MANY_POINTS, center, 1.5f), n);
+    ck_assert_mem_eq(serial, threaded, n * sizeof(uint32_t));
+
+    /* Small moves, which mostly keep the points within their cells */
+    for (i = 0; i < MANY_POINTS; ++i) {
+        for (c = 0; c < 3; ++c) {
+            points[i][c] += random_float(-0.01f, 0.01f);
+        }
+    }
+    ck_assert(lac_update_grid(grid, NULL, points, MANY_POINTS));
+    ck_assert(lac_update_grid(grid_mt, scheduler, points, MANY_POINTS));
+    check_radius(grid, points, MANY_POINTS, center, 1.5f);
+    check_radius(grid_mt, points, MANY_POINTS, center, 1.5f);
+    check_nearest(grid_mt, points, MANY_POINTS, center, 16);
+
+    /* Merging in the points that changed cells gives the same layout as building from scratch */
+    lac_destroy_grid(grid_mt);
+    grid_mt = lac_create_grid(scheduler, points, MANY_POINTS, 0.5f);
+    ck_assert_ptr_nonnull(grid_mt);
+    ck_assert_uint_eq(lac_get_grid_cell_count(grid), lac_get_grid_cell_count(grid_mt));
+    n = lac_query_grid_radius(grid, serial, MANY_POINTS, center, 1.5f);
+    ck_assert_uint_eq(lac_query_grid_radius(grid_mt, threaded, MANY_POINTS, center, 1.5f), n);
+    ck_assert_mem_eq(serial, threaded, n * sizeof(uint32_t));
+
+    /* Moves which keep every point within its cell don't change the layout */
+    for (i = 0; i < MANY_POINTS; ++i) {
+        for (c = 0; c < 3; ++c) {
+            points[i][c] = (floorf(points[i][c] * 2.0f) + 0.5f) * 0.5f;
+        }
+    }
+    ck_assert(lac_update_grid(grid, scheduler, points, MANY_POINTS));
+    n = lac_get_grid_cell_count(grid);
+    for (i = 0; i < MANY_POINTS; ++i) {
+        points[i][0] += 0.1f;
+    }
+    ck_assert(lac_update_grid(grid, scheduler, points, MANY_POINTS));
+    ck_assert_uint_eq(lac_get_grid_cell_count(grid), n);
+    check_radius(grid, points, MANY_POINTS, center, 1.5f);
+
+    /* Large moves, and a change in the number of points */
+    for (i = 0; i < MANY_POINTS; ++i) {
+        points[i][1] = -points[i][1] * 1.5f;
+    }
+    ck_assert(lac_update_grid(grid, scheduler, points, MANY_POINTS));
+    check_radius(grid, points, MANY_POINTS, center, 2.0f);
+    check_nearest(grid, points, MANY_POINTS, center, 9);
+
+    ck_assert(lac_update_grid(grid, NULL, points, POINTS));
+    ck_assert_uint_eq(lac_get_grid_point_count(grid), POINTS);
+    check_radius(grid, points, POINTS, center, 2.0f);
+
+    ck_assert(lac_update_grid(grid, scheduler, points, MANY_POINTS));
+    check_radius(grid, points, MANY_POINTS, center, 2.0f);
+
+    lac_destroy_grid(grid);
+    lac_destroy_grid(grid_mt);
+    lac_destroy_scheduler(scheduler);
+    free(points);
+    free(serial);
+    free(threaded);
+}
+END_TEST
+
+START_TEST(GridSpecial) {
+    vec3 points[5] = {
+        { 0.0f, 0.0f, 0.0f },
+        { 1e4f, -1e4f, 1e4f },
+        { -3e4f, 2e4f, 5e3f },
+        { 0.1f, 0.1f, 0.1f },
+        { 1e4f, -1e4f, 1e4f }
+    };
+    uint32_t found[5];
+    float found_sq[5];
+    LacGrid_t *grid;
+
+    /* The cell size has to be positive */
+    ck_assert_ptr_null(lac_create_grid(NULL, points, 5, 0.0f));
+    ck_assert_ptr_null(lac_create_grid(NULL, points, 5, -1.0f));
+
+    /* Nothing is found in an empty grid */
+    grid = lac_create_grid(NULL, NULL, 0, 1.0f);
+    ck_assert_ptr_nonnull(grid);
+    ck_assert_uint_eq(lac_get_grid_cell_count(grid), 0);
+    ck_assert_uint_eq(lac_query_grid_radius(grid, found, 5, points[0], 10.0f), 0);
+    ck_assert_uint_eq(lac_query_grid_nearest(grid, found, found_sq, 5, points[0], FLT_MAX), 0);
+
+    /* Points far apart, in cells that don't fit a dense array */
+    ck_assert(lac_update_grid(grid, NULL, points, 5));
+    ck_assert_uint_eq(lac_get_grid_cell_count(grid), 3);
+    check_radius(grid, points, 5, points[0], 1.0f);
+    check_radius(grid, points, 5, points[1], 0.0f);
+    check_radius(grid, points, 5, points[2], 5e4f);
+    check_nearest(grid, points, 5, points[2], 5);
+    check_nearest(grid, points, 5, points[3], 3);
+
+    ck_assert(lac_update_grid(grid, NULL, points, 0));
+    ck_assert_uint_eq(lac_query_grid_radius(grid, found, 5, points[0], 10.0f), 0);
+
+    lac_destroy_grid(grid);
+    lac_destroy_grid(NULL);
+}
+END_TEST
+
+Suite *buffer_suite(void) {
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Grid");
+
+    /* Core test cases */
+    tc_core = tcase_create("Core");
+    tcase_add_test(tc_core, GridRadius);
+    tcase_add_test(tc_core, GridNearest);
+    tcase_add_test(tc_core, GridUpdate);
+    tcase_add_test(tc_core, GridSpecial);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+int main(void) {
+    int num_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = buffer_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    num_failed = srunner_ntests_failed(sr);
+    printf("%s\n", num_failed ? "At least one test failed" : "All tests passed");
+    srunner_free(sr);
+    return (!num_failed ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,178 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <sched.h>
+#include <pthread.h>
+#include <check.h>
+
+#include "lac_common.h"
+#include "jobqueue.h"
+
+#define PRODUCERS 4
+#define JOBS_PER_PRODUCER 64
+#define VECS_PER_JOB 13
+
+typedef struct {
+    LacJobQueue_t *queue;
+    vec4 *v_in;
+    vec4 *v_out;
+} Producer_t;
+
+/* Diagonal, so that the result does not depend on the matrix order */
+static const mat4 m_scale = {
+    2.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 3.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 4.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 1.0f
+};
+
+static void init_job(LacTransformJob_t *job, vec4 *v_out, vec4 *v_in, const size_t count) {
+    job->v_out = v_out;
+    job->v_in = v_in;
+    job->count = count;
+    memcpy(job->m_in, m_scale, sizeof(mat4));
+}
+
+static void *produce(void *arg) {
+    Producer_t *producer = arg;
+    LacTransformJob_t job;
+    size_t i;
+
+    for (i = 0; i < JOBS_PER_PRODUCER; ++i) {
+        init_job(&job, producer->v_out + (i * VECS_PER_JOB), producer->v_in + (i * VECS_PER_JOB), VECS_PER_JOB);
+        while (!lac_push_job_queue(producer->queue, &job)) {
+            sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+START_TEST(JobQueueSingleThread) {
+    LacJobQueue_t *queue;
+    LacTransformJob_t job, popped;
+    vec4 v_in[3] = { { 1.0f, 1.0f, 1.0f, 1.0f }, { 1.0f, 2.0f, 3.0f, 0.0f }, { -1.0f, 0.5f, 2.0f, 1.0f } };
+    vec4 v_out[3];
+    size_t i;
+
+    /* Capacities are rounded up to a power of 2 */
+    queue = lac_create_job_queue(3);
+    ck_assert_ptr_nonnull(queue);
+    ck_assert_uint_eq(lac_get_job_queue_capacity(queue), 4);
+
+    ck_assert(!lac_pop_job_queue(&popped, queue));
+
+    for (i = 0; i < 4; ++i) {
+        init_job(&job, v_out, v_in, i);
+        ck_assert(lac_push_job_queue(queue, &job));
+    }
+    ck_assert(!lac_push_job_queue(queue, &job));
+
+    /* Jobs come out in the order that they went in, and popping frees a slot */
+    ck_assert(lac_pop_job_queue(&popped, queue));
+    ck_assert_uint_eq(popped.count, 0);
+    ck_assert(lac_push_job_queue(queue, &job));
+
+    ck_assert_uint_eq(lac_drain_job_queue(queue, 2), 2);
+    ck_assert_uint_eq(lac_get_job_queue_completed(queue), 2);
+    ck_assert_uint_eq(lac_drain_job_queue(queue, 0), 2);
+    ck_assert_uint_eq(lac_drain_job_queue(queue, 0), 0);
+    ck_assert_uint_eq(lac_get_job_queue_completed(queue), 4);
+
+    for (i = 0; i < 3; ++i) {
+        ck_assert_float_eq(v_out[i][0], v_in[i][0] * 2.0f);
+        ck_assert_float_eq(v_out[i][1], v_in[i][1] * 3.0f);
+        ck_assert_float_eq(v_out[i][2], v_in[i][2] * 4.0f);
+        ck_assert_float_eq(v_out[i][3], v_in[i][3]);
+    }
+
+    lac_destroy_job_queue(queue);
+}
+END_TEST
+
+START_TEST(JobQueueMultiProducer) {
+    const size_t total = PRODUCERS * JOBS_PER_PRODUCER * VECS_PER_JOB;
+    Producer_t producers[PRODUCERS];
+    pthread_t threads[PRODUCERS];
+    LacJobQueue_t *queue;
+    vec4 *v_in, *v_out;
+    size_t i;
+
+    v_in = malloc(total * sizeof(vec4));
+    v_out = malloc(total * sizeof(vec4));
+    ck_assert_ptr_nonnull(v_in);
+    ck_assert_ptr_nonnull(v_out);
+
+    for (i = 0; i < total; ++i) {
+        v_in[i][0] = (float)i;
+        v_in[i][1] = (float)(i % 7) - 3.0f;
+        v_in[i][2] = 0.25f * (float)i;
+        v_in[i][3] = 1.0f;
+    }
+
+    /* Smaller than the number of jobs, so that producers see a full queue */
+    queue = lac_create_job_queue(16);
+    ck_assert_ptr_nonnull(queue);
+
+    for (i = 0; i < PRODUCERS; ++i) {
+        producers[i].queue = queue;
+        producers[i].v_in = v_in + (i * JOBS_PER_PRODUCER * VECS_PER_JOB);
+        producers[i].v_out = v_out + (i * JOBS_PER_PRODUCER * VECS_PER_JOB);
+        ck_assert_int_eq(pthread_create(&threads[i], NULL, produce, &producers[i]), 0);
+    }
+
+    while (lac_get_job_queue_completed(queue) < PRODUCERS * JOBS_PER_PRODUCER) {
+        if (lac_drain_job_queue(queue, 0) == 0) {
+            sched_yield();
+        }
+    }
+
+    for (i = 0; i < PRODUCERS; ++i) {
+        pthread_join(threads[i], NULL);
+    }
+    ck_assert(!lac_pop_job_queue(&(LacTransformJob_t){ 0 }, queue));
+
+    for (i = 0; i < total; ++i) {
+        ck_assert_float_eq(v_out[i][0], v_in[i][0] * 2.0f);
+        ck_assert_float_eq(v_out[i][1], v_in[i][1] * 3.0f);
+        ck_assert_float_eq(v_out[i][2], v_in[i][2] * 4.0f);
+        ck_assert_float_eq(v_out[i][3], 1.0f);
+    }
+
+    lac_destroy_job_queue(queue);
+    free(v_in);
+    free(v_out);
+}
+END_TEST
+
+Suite *buffer_suite(void) {
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Job Queues");
+
+    /* Core test cases */
+    tc_core = tcase_create("Core");
+    tcase_add_test(tc_core, JobQueueSingleThread);
+    tcase_add_test(tc_core, JobQueueMultiProducer);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+int main(void) {
+    int num_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = buffer_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    num_failed = srunner_ntests_failed(sr);
+    printf("%s\n", num_failed ? "At least one test failed" : "All tests passed");
+    srunner_free(sr);
+    return (!num_failed ? EXIT_SUCCESS : EXIT_FAILURE);
+}
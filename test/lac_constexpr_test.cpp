@@ -0,0 +1,174 @@
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <check.h>
+
+#include "lac_constexpr.hpp"
+
+/* Built by the compiler; these fail to compile if any builder isn't constexpr */
+static constexpr lac::Mat4 m_swap = lac::cx::multiply(
+    lac::cx::get_reflection_mat4(false, false, true),
+    lac::cx::get_scalar_mat4(0.01f, 0.01f, 0.01f)
+);
+static constexpr lac::Mat4 m_rot = lac::cx::get_rotation_mat4(0.3f, -1.2f, 2.5f);
+static constexpr lac::Mat4 m_proj = lac::cx::get_projection_mat4(0.75f, 1.0f, 0.1f, 100.0f);
+
+static_assert(m_swap[0] == 0.01f && m_swap[10] == -0.01f && m_swap[15] == 1.0f, "reflection * scale");
+static_assert(lac::cx::sin(0.0f) == 0.0f && lac::cx::cos(0.0f) == 1.0f, "sin/cos at 0");
+static_assert(lac::cx::sqrt(16.0f) == 4.0f, "sqrt of a perfect square");
+static_assert(lac::cx::transpose(lac::cx::get_translation_mat3(1.0f, 2.0f))[6] == 1.0f, "transpose");
+static_assert(
+    lac::cx::multiply(lac::cx::get_scalar_mat4(2.0f, 3.0f, 4.0f), lac::cx::get_scalar_mat4(0.5f, 0.25f, 0.125f))[5] == 0.75f,
+    "product of scales"
+);
+
+/**
+ * @brief Gets the distance between two floats in units in the last place.
+ */
+static long ulp_diff(const float a, const float b) {
+    int ia, ib;
+
+    memcpy(&ia, &a, sizeof(ia));
+    memcpy(&ib, &b, sizeof(ib));
+    ia = (ia < 0) ? (int)(0x80000000u - (unsigned)ia) : ia;
+    ib = (ib < 0) ? (int)(0x80000000u - (unsigned)ib) : ib;
+    return labs((long)ia - (long)ib);
+}
+
+/**
+ * @brief Checks that two arrays of floats agree to within __tol__, relative to the size of each expected value.
+ *
+ * Matrix products and inverses match the C kernels exactly only when neither side has been
+ * reassociated or contracted into FMAs, which depends on the flags both were built with.
+ */
+static void assert_near(const float *actual, const float *expected, const std::size_t n, const float tol) {
+    for (std::size_t i = 0; i < n; ++i) {
+        ck_assert_float_eq_tol(actual[i], expected[i], tol * fmaxf(fabsf(expected[i]), 1.0f));
+    }
+}
+
+START_TEST(TrigonometryMatchesLibm) {
+    float x;
+
+    for (x = -20.0f; x <= 20.0f; x += 0.0137f) {
+        ck_assert_int_le(ulp_diff(lac::cx::sin(x), sinf(x)), 1);
+        ck_assert_int_le(ulp_diff(lac::cx::cos(x), cosf(x)), 1);
+        if (fabsf(cosf(x)) > 1e-3f) {
+            ck_assert_int_le(ulp_diff(lac::cx::tan(x), tanf(x)), 1);
+        }
+    }
+    for (x = 1e-6f; x < 1e6f; x *= 1.37f) {
+        ck_assert_int_le(ulp_diff(lac::cx::sqrt(x), sqrtf(x)), 1);
+    }
+    ck_assert_float_eq(lac::cx::sqrt(0.0f), 0.0f);
+#ifndef __FAST_MATH__
+    /* -ffast-math assumes there are no NaNs, so the check itself would be folded away */
+    ck_assert_float_nan(lac::cx::sqrt(-1.0f));
+#endif /* __FAST_MATH__ */
+}
+END_TEST
+
+START_TEST(BuildersMatchC) {
+    mat4 m_expected;
+    mat3 m3_expected;
+    mat2 m2_expected;
+
+    lac_get_reflection_mat4(m_expected, true, false, true);
+    ck_assert_mem_eq(lac::cx::get_reflection_mat4(true, false, true).data, m_expected, sizeof(mat4));
+    lac_get_reflection_mat3(m3_expected, false, true, false);
+    ck_assert_mem_eq(lac::cx::get_reflection_mat3(false, true, false).data, m3_expected, sizeof(mat3));
+    lac_get_reflection_mat2(m2_expected, true, true);
+    ck_assert_mem_eq(lac::cx::get_reflection_mat2(true, true).data, m2_expected, sizeof(mat2));
+
+    lac_get_translation_mat4(m_expected, 1.0f, -2.0f, 3.5f);
+    ck_assert_mem_eq(lac::cx::get_translation_mat4(1.0f, -2.0f, 3.5f).data, m_expected, sizeof(mat4));
+    lac_get_scalar_mat4(m_expected, 2.0f, 0.5f, -1.0f);
+    ck_assert_mem_eq(lac::cx::get_scalar_mat4(2.0f, 0.5f, -1.0f).data, m_expected, sizeof(mat4));
+    ck_assert_mem_eq(lac::cx::get_ident_mat<4>().data, lac_ident_mat4, sizeof(mat4));
+
+    /* Rotations and projections differ from libm by at most a rounding step */
+    lac_get_rotation_mat4(m_expected, 0.3f, -1.2f, 2.5f);
+    for (std::size_t i = 0; i < 16; ++i) {
+        ck_assert_float_eq_tol(m_rot[i], m_expected[i], 1e-6f);
+    }
+    lac_get_projection_mat4(m_expected, 0.75f, 1.0f, 0.1f, 100.0f);
+    for (std::size_t i = 0; i < 16; ++i) {
+        ck_assert_float_eq_tol(m_proj[i], m_expected[i], 1e-5f);
+    }
+
+    const lac::Vec3 v_eye = { { 1.0f, 2.0f, 3.0f } };
+    const lac::Vec3 v_target = { { -4.0f, 0.5f, 2.0f } };
+    const lac::Vec3 v_up = { { 0.0f, 0.0f, 1.0f } };
+    const lac::Mat4 m_point_at = lac::cx::get_point_at_mat4(v_eye, v_target, v_up);
+    lac_get_point_at_mat4(m_expected, v_eye.data, v_target.data, v_up.data);
+    for (std::size_t i = 0; i < 16; ++i) {
+        ck_assert_float_eq_tol(m_point_at[i], m_expected[i], 1e-6f);
+    }
+
+    lac_invert_mat4(m_expected, m_point_at.data);
+    assert_near(lac::cx::invert(m_point_at).data, m_expected, 16, 1e-5f);
+}
+END_TEST
+
+START_TEST(ProductsMatchC) {
+    const lac::Mat4 m_a = lac::cx::get_rotation_mat4(0.1f, 0.7f, -0.4f);
+    const lac::Mat4 m_b = lac::cx::multiply(lac::cx::get_translation_mat4(3.0f, -1.0f, 0.25f), m_swap);
+    const lac::Mat3 m3 = { { 0.3f, -0.7f, 1.1f, 2.0f, 0.9f, -0.1f, 0.4f, 0.6f, -1.3f } };
+    const lac::Vec4 v_in = { { 1.5f, -0.25f, 3.0f, 1.0f } };
+    const lac::Vec3 v3_in = { { -2.0f, 0.125f, 7.0f } };
+    mat4 m_expected;
+    mat3 m3_expected;
+    vec4 v_expected;
+    vec3 v3_expected;
+
+    lac_multiply_mat4(m_expected, m_a.data, m_b.data);
+    assert_near(lac::cx::multiply(m_a, m_b).data, m_expected, 16, 1e-6f);
+    lac_multiply_mat3(m3_expected, m3.data, m3.data);
+    assert_near(lac::cx::multiply(m3, m3).data, m3_expected, 9, 1e-6f);
+
+    lac_multiply_vec4_mat4(v_expected, v_in.data, m_b.data);
+    assert_near(lac::cx::multiply(v_in, m_b).data, v_expected, 4, 1e-6f);
+    lac_multiply_vec3_mat3(v3_expected, v3_in.data, m3.data);
+    assert_near(lac::cx::multiply(v3_in, m3).data, v3_expected, 3, 1e-6f);
+
+    /* Each element of these is rounded once, so they match under any flags */
+    lac_add_mat4(m_expected, m_a.data, m_b.data);
+    ck_assert_mem_eq(lac::cx::add(m_a, m_b).data, m_expected, sizeof(mat4));
+    lac_subtract_mat4(m_expected, m_a.data, m_b.data);
+    ck_assert_mem_eq(lac::cx::subtract(m_a, m_b).data, m_expected, sizeof(mat4));
+    lac_transpose_mat4(m_expected, m_a.data);
+    ck_assert_mem_eq(lac::cx::transpose(m_a).data, m_expected, sizeof(mat4));
+}
+END_TEST
+
+Suite *buffer_suite(void) {
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("constexpr Builders");
+
+    /* Core test cases */
+    tc_core = tcase_create("Core");
+    tcase_add_test(tc_core, TrigonometryMatchesLibm);
+    tcase_add_test(tc_core, BuildersMatchC);
+    tcase_add_test(tc_core, ProductsMatchC);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+int main(void) {
+    int num_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = buffer_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    num_failed = srunner_ntests_failed(sr);
+    printf("%s\n", num_failed ? "At least one test failed" : "All tests passed");
+    srunner_free(sr);
+    return (!num_failed ? EXIT_SUCCESS : EXIT_FAILURE);
+}
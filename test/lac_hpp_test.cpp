@@ -0,0 +1,141 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <check.h>
+
+#include "lac.hpp"
+
+static const lac::Mat4 m_p = { {
+    1.5f, 0.0f, 0.0f, 0.0f,
+    0.0f, 2.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, -1.2f, -2.2f,
+    0.0f, 0.0f, -1.0f, 0.0f
+} };
+static const lac::Mat4 m_v = { {
+    1.0f, 0.0f, 0.0f, -3.0f,
+    0.0f, 0.8f, -0.6f, 1.0f,
+    0.0f, 0.6f, 0.8f, -5.0f,
+    0.0f, 0.0f, 0.0f, 1.0f
+} };
+static const lac::Mat4 m_m = { {
+    0.5f, -0.25f, 0.0f, 2.0f,
+    0.25f, 0.5f, 0.0f, 0.5f,
+    0.0f, 0.0f, 0.75f, -1.0f,
+    0.0f, 0.0f, 0.0f, 1.0f
+} };
+
+START_TEST(ExpressionMatVecChain) {
+    const lac::Vec4 v_in = { { 1.0f, -2.0f, 0.5f, 1.0f } };
+    lac::Vec4 v_actual, v_expected, v_tmp;
+
+    /* Reassociated into three matrix-vector products, using the same kernels */
+    lac_multiply_vec4_mat4(v_expected.data, v_in.data, m_m.data);
+    lac_multiply_vec4_mat4(v_tmp.data, v_expected.data, m_v.data);
+    lac_multiply_vec4_mat4(v_expected.data, v_tmp.data, m_p.data);
+
+    v_actual = m_p * m_v * m_m * v_in;
+    ck_assert_mem_eq(v_actual.data, v_expected.data, sizeof(vec4));
+
+    lac::Vec4 v_init = m_p * (m_v * (m_m * v_in));
+    ck_assert_mem_eq(v_init.data, v_expected.data, sizeof(vec4));
+
+    /* The destination may also be an operand */
+    v_actual = v_in;
+    v_actual = m_p * m_v * m_m * v_actual;
+    ck_assert_mem_eq(v_actual.data, v_expected.data, sizeof(vec4));
+}
+END_TEST
+
+START_TEST(ExpressionMatChain) {
+    lac::Mat4 m_actual, m_expected;
+
+    lac_multiply_mat4(m_expected.data, m_p.data, m_v.data);
+    lac_multiply_mat4(m_expected.data, m_expected.data, m_m.data);
+
+    m_actual = m_p * m_v * m_m;
+    ck_assert_mem_eq(m_actual.data, m_expected.data, sizeof(mat4));
+
+    lac::Mat4 m_init = m_p * m_v * m_m;
+    ck_assert_mem_eq(m_init.data, m_expected.data, sizeof(mat4));
+
+    m_actual = m_v;
+    m_actual = m_p * m_actual * m_m;
+    ck_assert_mem_eq(m_actual.data, m_expected.data, sizeof(mat4));
+
+    /* Applying a stored product matches applying the chain, up to rounding */
+    const lac::Vec4 v_in = { { 0.25f, 4.0f, -1.0f, 1.0f } };
+    lac::Vec4 v_stored = m_init * v_in;
+    lac::Vec4 v_chain = m_p * m_v * m_m * v_in;
+    for (std::size_t i = 0; i < 4; ++i) {
+        ck_assert_float_eq_tol(v_stored[i], v_chain[i], 1e-4f);
+    }
+}
+END_TEST
+
+START_TEST(ExpressionSmallSizes) {
+    const lac::Mat3 m_a = { { 0.0f, -1.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f } };
+    const lac::Vec3 v_in = { { 1.0f, 2.0f, 3.0f } };
+    lac::Vec3 v_out;
+
+    v_out = m_a * m_a * v_in;
+    ck_assert_float_eq(v_out[0], -1.0f);
+    ck_assert_float_eq(v_out[1], -2.0f);
+    ck_assert_float_eq(v_out[2], 3.0f);
+
+    const lac::Mat2 m_b = { { 2.0f, 0.0f, 0.0f, 3.0f } };
+    lac::Vec2 v2 = m_b * lac::Vec2{ { 1.0f, 1.0f } };
+    ck_assert_float_eq(v2[0], 2.0f);
+    ck_assert_float_eq(v2[1], 3.0f);
+}
+END_TEST
+
+START_TEST(EagerOperations) {
+    const lac::Vec3 v_x = { { 1.0f, 0.0f, 0.0f } };
+    const lac::Vec3 v_y = { { 0.0f, 1.0f, 0.0f } };
+    lac::Vec3 v_z = lac::cross(v_x, v_y);
+    lac::Vec3 v_sum = (v_x + v_y) * 2.0f - v_z;
+
+    ck_assert_float_eq(v_z[2], 1.0f);
+    ck_assert_float_eq(lac::dot(v_x, v_y), 0.0f);
+    ck_assert_float_eq(v_sum[0], 2.0f);
+    ck_assert_float_eq(v_sum[1], 2.0f);
+    ck_assert_float_eq(v_sum[2], -1.0f);
+    ck_assert_float_eq_tol(lac::normalize(v_sum)[2], -1.0f / 3.0f, 1e-6f);
+    ck_assert_float_eq(lac::lerp(v_x, v_y, 0.25f)[0], 0.75f);
+
+    lac::Mat4 m_t = lac::transpose(lac::transpose(m_v));
+    ck_assert_mem_eq(m_t.data, m_v.data, sizeof(mat4));
+}
+END_TEST
+
+Suite *buffer_suite(void) {
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("C++ Wrapper");
+
+    /* Core test cases */
+    tc_core = tcase_create("Core");
+    tcase_add_test(tc_core, ExpressionMatVecChain);
+    tcase_add_test(tc_core, ExpressionMatChain);
+    tcase_add_test(tc_core, ExpressionSmallSizes);
+    tcase_add_test(tc_core, EagerOperations);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+int main(void) {
+    int num_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = buffer_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    num_failed = srunner_ntests_failed(sr);
+    printf("%s\n", num_failed ? "At least one test failed" : "All tests passed");
+    srunner_free(sr);
+    return (!num_failed ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,142 @@
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <execution>
+#include <span>
+#include <vector>
+#include <check.h>
+
+#include "lac_span.hpp"
+
+static const lac::Mat4 m_mvp = { {
+    1.5f, 0.0f, 0.0f, 0.0f,
+    0.0f, 2.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, -1.2f, -2.2f,
+    0.0f, 0.0f, -1.0f, 0.0f
+} };
+static const lac::Mat3 m_rot = { {
+    0.0f, -1.0f, 0.0f,
+    1.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 1.0f
+} };
+
+START_TEST(SpansOfArrays) {
+    std::vector<std::array<float, 3>> v_in(37), v_out(37);
+    std::vector<lac::Vec3> v_expected(37);
+    std::size_t i;
+
+    for (i = 0; i < v_in.size(); ++i) {
+        v_in[i] = { (float)i, (float)(i * 2), 1.0f - (float)i };
+        lac_multiply_vec3_mat3(v_expected[i].data, v_in[i].data(), m_rot.data);
+    }
+
+    lac::multiply_array(std::span(v_out), std::span<const std::array<float, 3>>(v_in), m_rot);
+    ck_assert_mem_eq(v_out.data(), v_expected.data(), 37 * sizeof(vec3));
+
+    /* Containers of lac::Vec work too, and may be transformed in-place */
+    std::vector<lac::Vec3> v_inplace(37);
+    std::memcpy(v_inplace.data(), v_in.data(), 37 * sizeof(vec3));
+    lac::multiply_array(v_inplace, v_inplace, m_rot);
+    ck_assert_mem_eq(v_inplace.data(), v_expected.data(), 37 * sizeof(vec3));
+
+    /* So do C arrays */
+    vec3 v_c[37];
+    lac::multiply_array(std::span(v_c), v_in, m_rot);
+    ck_assert_mem_eq(v_c, v_expected.data(), 37 * sizeof(vec3));
+}
+END_TEST
+
+START_TEST(ExecutionPolicies) {
+    /* Enough vectors for several pieces, with a partial piece at the end */
+    const std::size_t count = (3 * LAC_SCHEDULER_BATCH_GRAIN) + 17;
+    std::vector<lac::Vec4> v_in(count), v_out(count), v_expected(count);
+    std::size_t i;
+
+    for (i = 0; i < count; ++i) {
+        v_in[i] = { { (float)(i % 101), -(float)(i % 7), (float)(i % 13) * 0.5f, 1.0f } };
+    }
+    lac::multiply_array(v_expected, v_in, m_mvp);
+
+    lac::multiply_array(std::execution::par_unseq, v_out, std::span<const lac::Vec4>(v_in), m_mvp);
+    ck_assert_mem_eq(v_out.data(), v_expected.data(), count * sizeof(vec4));
+
+    std::fill(v_out.begin(), v_out.end(), lac::Vec4{});
+    lac::multiply_array(std::execution::par, v_out, v_in, m_mvp);
+    ck_assert_mem_eq(v_out.data(), v_expected.data(), count * sizeof(vec4));
+
+    std::fill(v_out.begin(), v_out.end(), lac::Vec4{});
+    lac::multiply_array(std::execution::seq, v_out, v_in, m_mvp);
+    ck_assert_mem_eq(v_out.data(), v_expected.data(), count * sizeof(vec4));
+
+    LacScheduler_t *scheduler = lac_create_scheduler(2);
+    ck_assert_ptr_nonnull(scheduler);
+    v_out = v_in;
+    lac::multiply_array(scheduler, v_out, v_out, m_mvp);
+    ck_assert_mem_eq(v_out.data(), v_expected.data(), count * sizeof(vec4));
+    lac_destroy_scheduler(scheduler);
+}
+END_TEST
+
+START_TEST(ProjectSpans) {
+    const LacViewport_t viewport = { 0.0f, 0.0f, 640.0f, 480.0f, 0.0f, 1.0f };
+    const std::size_t count = LAC_SCHEDULER_BATCH_GRAIN + 3;
+    std::vector<std::array<float, 4>> v_in(count);
+    std::vector<std::array<float, 3>> v_out(count);
+    std::vector<lac::Vec3> v_expected(count);
+    std::vector<std::uint8_t> codes(count), codes_expected(count);
+    std::size_t i;
+
+    for (i = 0; i < count; ++i) {
+        v_in[i] = { (float)(i % 9) - 4.0f, (float)(i % 5) - 2.0f, -(float)(i % 11) - 1.0f, 1.0f };
+    }
+    lac_project_vec4_array(
+        reinterpret_cast<vec3*>(v_expected.data()),
+        codes_expected.data(),
+        reinterpret_cast<const vec4*>(v_in.data()),
+        m_mvp.data,
+        &viewport,
+        count,
+        true
+    );
+
+    lac::project_array(std::execution::par_unseq, v_out, codes, v_in, m_mvp, viewport, true);
+    ck_assert_mem_eq(v_out.data(), v_expected.data(), count * sizeof(vec3));
+    ck_assert_mem_eq(codes.data(), codes_expected.data(), count);
+
+    std::fill(codes.begin(), codes.end(), 0);
+    lac::project_array(v_out, codes, v_in, m_mvp, viewport, true);
+    ck_assert_mem_eq(codes.data(), codes_expected.data(), count);
+}
+END_TEST
+
+Suite *buffer_suite(void) {
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Span Adapters");
+
+    /* Core test cases */
+    tc_core = tcase_create("Core");
+    tcase_add_test(tc_core, SpansOfArrays);
+    tcase_add_test(tc_core, ExecutionPolicies);
+    tcase_add_test(tc_core, ProjectSpans);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+int main(void) {
+    int num_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = buffer_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    num_failed = srunner_ntests_failed(sr);
+    printf("%s\n", num_failed ? "At least one test failed" : "All tests passed");
+    srunner_free(sr);
+    return (!num_failed ? EXIT_SUCCESS : EXIT_FAILURE);
+}
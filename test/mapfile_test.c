@@ -0,0 +1,135 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <check.h>
+
+#include "lac_common.h"
+#include "vecmath.h"
+#include "batch.h"
+#include "mapfile.h"
+
+#define TEST_IN_PATH  "mapfile_test_in.bin"
+#define TEST_OUT_PATH "mapfile_test_out.bin"
+
+START_TEST(ArrayFileRoundTrip) {
+    vec3 v3_expected[5] = {
+        { 1, 2, 3 },
+        { 4, 5, 6 },
+        { 7, 8, 9 },
+        { 10, 11, 12 },
+        { 13, 14, 15 }
+    };
+    LacMappedArray_t mapped;
+
+    ck_assert_int_eq(lac_write_array_file(TEST_IN_PATH, v3_expected, LAC_ARRAY_VEC3, 5), 0);
+    ck_assert_int_eq(lac_map_array_file(&mapped, TEST_IN_PATH, false), 0);
+
+    ck_assert_uint_eq(mapped.count, 5);
+    ck_assert_int_eq(mapped.type, LAC_ARRAY_VEC3);
+    ck_assert_uint_eq((uintptr_t)mapped.data % LAC_ARRAY_FILE_ALIGN, 0);
+    ck_assert_ptr_null(lac_get_mapped_vec4_array(&mapped));
+    ck_assert_ptr_nonnull(lac_get_mapped_vec3_array(&mapped));
+    ck_assert_mem_eq(lac_get_mapped_vec3_array(&mapped), v3_expected, sizeof(v3_expected));
+
+    lac_unmap_array_file(&mapped);
+    ck_assert_ptr_null(mapped.base);
+    remove(TEST_IN_PATH);
+}
+END_TEST
+
+START_TEST(ArrayFileTransform) {
+    mat4 m4 = {
+        1,  0,  0,  5,
+        0,  2,  0,  6,
+        0,  0,  3,  7,
+        0,  0,  0,  1
+    };
+    vec4 v4_in[100];
+    vec4 v4_expected[100];
+    LacMappedArray_t mapped_in, mapped_out;
+    size_t i;
+
+    for (i = 0; i < 100; ++i) {
+        v4_in[i][0] = (float)i;
+        v4_in[i][1] = (float)(i + 1);
+        v4_in[i][2] = (float)(i + 2);
+        v4_in[i][3] = 1.0f;
+        lac_multiply_vec4_mat4(v4_expected[i], v4_in[i], m4);
+    }
+
+    ck_assert_int_eq(lac_write_array_file(TEST_IN_PATH, v4_in, LAC_ARRAY_VEC4, 100), 0);
+    ck_assert_int_eq(lac_map_array_file(&mapped_in, TEST_IN_PATH, false), 0);
+    ck_assert_int_eq(lac_create_array_file(&mapped_out, TEST_OUT_PATH, LAC_ARRAY_VEC4, 100), 0);
+
+    /* Transform from one mapping straight into the other */
+    lac_multiply_vec4_mat4_array(
+        lac_get_mapped_vec4_array(&mapped_out),
+        (const vec4*)lac_get_mapped_vec4_array(&mapped_in),
+        m4,
+        mapped_in.count
+    );
+
+    lac_unmap_array_file(&mapped_in);
+    lac_unmap_array_file(&mapped_out);
+
+    ck_assert_int_eq(lac_map_array_file(&mapped_out, TEST_OUT_PATH, false), 0);
+    ck_assert_uint_eq(mapped_out.count, 100);
+    ck_assert_mem_eq(lac_get_mapped_vec4_array(&mapped_out), v4_expected, sizeof(v4_expected));
+    lac_unmap_array_file(&mapped_out);
+
+    remove(TEST_IN_PATH);
+    remove(TEST_OUT_PATH);
+}
+END_TEST
+
+START_TEST(ArrayFileInvalid) {
+    FILE *file;
+    LacMappedArray_t mapped;
+    uint8_t garbage[128] = { 'N', 'O', 'T', 'L', 'A', 'C' };
+
+    file = fopen(TEST_IN_PATH, "wb");
+    ck_assert_ptr_nonnull(file);
+    fwrite(garbage, 1, sizeof(garbage), file);
+    fclose(file);
+
+    ck_assert_int_eq(lac_map_array_file(&mapped, TEST_IN_PATH, false), -1);
+    ck_assert_int_eq(errno, EINVAL);
+    ck_assert_ptr_null(mapped.base);
+
+    ck_assert_int_eq(lac_map_array_file(&mapped, "does_not_exist.bin", false), -1);
+    ck_assert_int_eq(errno, ENOENT);
+
+    remove(TEST_IN_PATH);
+}
+END_TEST
+
+Suite *buffer_suite(void) {
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Mapped Files");
+
+    /* Core test cases */
+    tc_core = tcase_create("Core");
+    tcase_add_test(tc_core, ArrayFileRoundTrip);
+    tcase_add_test(tc_core, ArrayFileTransform);
+    tcase_add_test(tc_core, ArrayFileInvalid);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+int main(void) {
+    int num_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = buffer_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    num_failed = srunner_ntests_failed(sr);
+    printf("%s\n", num_failed ? "At least one test failed" : "All tests passed");
+    srunner_free(sr);
+    return (!num_failed ? EXIT_SUCCESS : EXIT_FAILURE);
+}
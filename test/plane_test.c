@@ -0,0 +1,195 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <check.h>
+
+#include "lac_common.h"
+#include "plane.h"
+#include "vecmath.h"
+#include "matmath.h"
+#include "transforms.h"
+
+/* An odd count, so that the final block is padded */
+#define POINTS 37
+
+static void make_points(float x[POINTS], float y[POINTS], float z[POINTS]) {
+    size_t i;
+
+    for (i = 0; i < POINTS; ++i) {
+        x[i] = -3.0f + (0.17f * (float)i);
+        y[i] = (float)(i % 7) - 3.0f;
+        z[i] = 2.0f - (0.05f * (float)(i * i % 11));
+    }
+}
+
+START_TEST(PlaneInit) {
+    const vec3 v_a = { 0.0f, 1.0f, 0.0f }, v_b = { 0.0f, 1.0f, 1.0f }, v_c = { 1.0f, 1.0f, 0.0f };
+    const vec3 v_normal = { 0.0f, 4.0f, 0.0f }, v_zero = { 0.0f, 0.0f, 0.0f };
+    const vec3 v_above = { 3.0f, 3.5f, -2.0f };
+    LacPlane_t plane, other;
+    float distance;
+
+    /* The plane y = 1, facing +y, given either way */
+    ck_assert(lac_init_plane(&plane, v_a, v_normal));
+    ck_assert_float_eq_tol(plane.normal[1], 1.0f, 1e-6f);
+    ck_assert_float_eq_tol(plane.d, -1.0f, 1e-6f);
+
+    ck_assert(lac_init_plane_from_points(&other, v_a, v_b, v_c));
+    ck_assert_float_eq_tol(other.normal[0], 0.0f, 1e-6f);
+    ck_assert_float_eq_tol(other.normal[1], 1.0f, 1e-6f);
+    ck_assert_float_eq_tol(other.d, -1.0f, 1e-6f);
+
+    lac_calc_plane_distance(&distance, &plane, v_above);
+    ck_assert_float_eq_tol(distance, 2.5f, 1e-6f);
+
+    /* Reversing the winding faces the plane the other way */
+    ck_assert(lac_init_plane_from_points(&other, v_a, v_c, v_b));
+    ck_assert_float_eq_tol(other.normal[1], -1.0f, 1e-6f);
+
+    /* Degenerate inputs are reported, and leave a zeroed plane */
+    ck_assert(!lac_init_plane(&other, v_a, v_zero));
+    ck_assert(!lac_init_plane_from_points(&other, v_a, v_a, v_c));
+    ck_assert_float_eq(other.d, 0.0f);
+
+    other.normal[0] = 0.0f;
+    other.normal[1] = 0.0f;
+    other.normal[2] = 2.0f;
+    other.d = 6.0f;
+    ck_assert(lac_normalize_plane(&other, &other));
+    ck_assert_float_eq_tol(other.normal[2], 1.0f, 1e-6f);
+    ck_assert_float_eq_tol(other.d, 3.0f, 1e-6f);
+}
+END_TEST
+
+START_TEST(PlaneTransform) {
+    const vec3 v_points[3] = { { 1.0f, 0.0f, 0.0f }, { 0.0f, 2.0f, 0.5f }, { -1.0f, 0.5f, 3.0f } };
+    const vec3 v_front = { 5.0f, 5.0f, 5.0f };
+    mat4 m_in[2], m_rotation, m_scale, m_translation, m_tmp;
+    LacPlane_t plane, transformed;
+    vec4 v_point, v_out;
+    float distance, expected;
+    size_t t, i, c;
+
+    lac_get_rotation_mat4(m_rotation, 0.4f, -1.1f, 0.3f);
+    lac_get_scalar_mat4(m_scale, 2.0f, 0.5f, 1.5f);
+    lac_get_translation_mat4(m_translation, 3.0f, -1.0f, 2.0f);
+    lac_multiply_mat4(m_tmp, m_rotation, m_scale);
+    lac_multiply_mat4(m_in[0], m_translation, m_tmp);
+
+    /* A reflection flips the winding, but the front must still face the transformed front point */
+    lac_get_scalar_mat4(m_scale, -1.0f, 1.0f, 1.0f);
+    lac_multiply_mat4(m_in[1], m_in[0], m_scale);
+
+    ck_assert(lac_init_plane_from_points(&plane, v_points[0], v_points[1], v_points[2]));
+    for (t = 0; t < 2; ++t) {
+        lac_transform_plane(&transformed, &plane, m_in[t]);
+
+        for (i = 0; i < 3; ++i) {
+            for (c = 0; c < 3; ++c) {
+                v_point[c] = v_points[i][c];
+            }
+            v_point[3] = 1.0f;
+            lac_multiply_vec4_mat4(v_out, v_point, m_in[t]);
+            lac_calc_plane_distance(&distance, &transformed, v_out);
+            ck_assert_float_eq_tol(distance, 0.0f, 1e-4f);
+        }
+
+        lac_calc_plane_distance(&expected, &plane, v_front);
+        ck_assert_float_gt(expected, 0.0f);
+        for (c = 0; c < 3; ++c) {
+            v_point[c] = v_front[c];
+        }
+        lac_multiply_vec4_mat4(v_out, v_point, m_in[t]);
+        lac_calc_plane_distance(&distance, &transformed, v_out);
+        ck_assert_float_gt(distance, 0.0f);
+    }
+}
+END_TEST
+
+START_TEST(PlaneSoa) {
+    const vec3 v_point = { 0.0f, 0.0f, 0.5f }, v_normal = { 1.0f, -2.0f, 0.5f };
+    float x[POINTS], y[POINTS], z[POINTS], px[POINTS], py[POINTS], pz[POINTS], distances[POINTS];
+    uint8_t front[(POINTS + 7) / 8], back[(POINTS + 7) / 8], on[(POINTS + 7) / 8];
+    LacSoaVec3_t points = { x, y, z }, projected = { px, py, pz };
+    unsigned bits;
+    LacPlane_t plane;
+    vec3 v_in;
+    float expected;
+    uint8_t sides;
+    size_t i;
+
+    make_points(x, y, z);
+    ck_assert(lac_init_plane(&plane, v_point, v_normal));
+
+    /* Put one point exactly on the plane */
+    x[5] = 0.0f;
+    y[5] = 0.0f;
+    z[5] = 0.5f;
+
+    lac_calc_plane_distance_soa(distances, &points, &plane, POINTS);
+    sides = lac_classify_plane_soa(front, back, on, &points, &plane, 1e-4f, POINTS);
+    ck_assert_uint_eq(sides, LAC_PLANE_FRONT | LAC_PLANE_BACK | LAC_PLANE_ON);
+
+    for (i = 0; i < POINTS; ++i) {
+        v_in[0] = x[i];
+        v_in[1] = y[i];
+        v_in[2] = z[i];
+        lac_calc_plane_distance(&expected, &plane, v_in);
+        ck_assert_float_eq_tol(distances[i], expected, 1e-5f);
+
+        /* Exactly one of the three bits is set for each point */
+        bits = (((front[i / 8] >> (i % 8)) & 1u) << 0) | (((back[i / 8] >> (i % 8)) & 1u) << 1) |
+               (((on[i / 8] >> (i % 8)) & 1u) << 2);
+        ck_assert_uint_eq(bits, (expected > 1e-4f) ? 1u : ((expected < -1e-4f) ? 2u : 4u));
+    }
+    ck_assert_uint_eq(on[5 / 8] & (1u << 5), 1u << 5);
+    ck_assert_uint_eq((front[POINTS / 8] | back[POINTS / 8] | on[POINTS / 8]) >> (POINTS % 8), 0);
+
+    /* Points all on one side report only that side, and masks may be left out */
+    ck_assert_uint_eq(lac_classify_plane_soa(NULL, NULL, NULL, &points, &plane, 100.0f, POINTS), LAC_PLANE_ON);
+
+    /* Projected points lie on the plane, and moved only along the normal */
+    lac_project_plane_soa(&projected, &points, &plane, POINTS);
+    lac_calc_plane_distance_soa(distances, &projected, &plane, POINTS);
+    for (i = 0; i < POINTS; ++i) {
+        ck_assert_float_eq_tol(distances[i], 0.0f, 1e-5f);
+        ck_assert_float_eq_tol((px[i] - x[i]) * plane.normal[1], (py[i] - y[i]) * plane.normal[0], 1e-5f);
+    }
+
+    /* In place gives the same result */
+    lac_project_plane_soa(&points, &points, &plane, POINTS);
+    ck_assert_mem_eq(x, px, sizeof(x));
+    ck_assert_mem_eq(z, pz, sizeof(z));
+}
+END_TEST
+
+Suite *buffer_suite(void) {
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Plane");
+
+    /* Core test cases */
+    tc_core = tcase_create("Core");
+    tcase_add_test(tc_core, PlaneInit);
+    tcase_add_test(tc_core, PlaneTransform);
+    tcase_add_test(tc_core, PlaneSoa);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+int main(void) {
+    int num_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = buffer_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    num_failed = srunner_ntests_failed(sr);
+    printf("%s\n", num_failed ? "At least one test failed" : "All tests passed");
+    srunner_free(sr);
+    return (!num_failed ? EXIT_SUCCESS : EXIT_FAILURE);
+}
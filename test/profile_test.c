@@ -0,0 +1,151 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <check.h>
+
+#include "lac_common.h"
+#include "matmath.h"
+#include "profile.h"
+
+#define CALLS 1000
+
+static LacProfileEntry_t entries[LAC_PROFILE_MAX_FUNCS];
+
+/**
+ * @brief Finds the entry of __func__ within the snapshot.
+ */
+static const LacProfileEntry_t *find_entry(const void *func, const size_t count) {
+    size_t i;
+
+    for (i = 0; i < count && i < LAC_PROFILE_MAX_FUNCS; ++i) {
+        if (entries[i].func == func) {
+            return &entries[i];
+        }
+    }
+    return NULL;
+}
+
+static void *multiply_many(void *arg) {
+    mat4 m_out;
+    size_t i;
+
+    for (i = 0; i < CALLS; ++i) {
+        lac_multiply_mat4(m_out, m_out, (const float *)arg);
+    }
+    return NULL;
+}
+
+START_TEST(ProfileDisabled) {
+    char buffer[256] = { 0 };
+    FILE *stream;
+
+    if (lac_is_profile_enabled()) {
+        return;
+    }
+
+    ck_assert_uint_eq(lac_get_profile_snapshot(entries, LAC_PROFILE_MAX_FUNCS), 0);
+    lac_reset_profile();
+
+    stream = fmemopen(buffer, sizeof(buffer) - 1, "w");
+    ck_assert_ptr_nonnull(stream);
+    ck_assert_int_eq(lac_dump_profile_json(stream), 0);
+    fclose(stream);
+    ck_assert(strstr(buffer, "\"enabled\": false") != NULL);
+}
+END_TEST
+
+START_TEST(ProfileCountsCalls) {
+    const LacProfileEntry_t *entry;
+    pthread_t thread;
+    mat4 m_in = { 0 };
+    uint64_t total;
+    size_t count, b;
+
+    if (!lac_is_profile_enabled()) {
+        return;
+    }
+
+    lac_reset_profile();
+    multiply_many(m_in);
+    ck_assert_int_eq(pthread_create(&thread, NULL, multiply_many, m_in), 0);
+    pthread_join(thread, NULL);
+
+    /* Calls from both threads are added together */
+    count = lac_get_profile_snapshot(entries, LAC_PROFILE_MAX_FUNCS);
+    entry = find_entry((const void *)lac_multiply_mat4, count);
+    ck_assert_ptr_nonnull(entry);
+    ck_assert_uint_eq(entry->calls, 2 * CALLS);
+    ck_assert_uint_ge(entry->ticks, 2 * CALLS);
+
+    total = 0;
+    for (b = 0; b < LAC_PROFILE_BUCKETS; ++b) {
+        total += entry->histogram[b];
+    }
+    ck_assert_uint_eq(total, 2 * CALLS);
+
+    /* A snapshot that is too small still reports how many entries are needed */
+    ck_assert_uint_ge(lac_get_profile_snapshot(NULL, 0), count);
+
+    lac_reset_profile();
+    count = lac_get_profile_snapshot(entries, LAC_PROFILE_MAX_FUNCS);
+    entry = find_entry((const void *)lac_multiply_mat4, count);
+    ck_assert(entry == NULL || entry->calls == 0);
+}
+END_TEST
+
+START_TEST(ProfileDumpsJson) {
+    char buffer[65536] = { 0 };
+    mat4 m_in = { 0 };
+    FILE *stream;
+
+    if (!lac_is_profile_enabled()) {
+        return;
+    }
+
+    lac_reset_profile();
+    multiply_many(m_in);
+
+    stream = fmemopen(buffer, sizeof(buffer) - 1, "w");
+    ck_assert_ptr_nonnull(stream);
+    ck_assert_int_eq(lac_dump_profile_json(stream), 0);
+    fclose(stream);
+
+    ck_assert(strncmp(buffer, "{\"enabled\": true", 16) == 0);
+    ck_assert(strstr(buffer, "\"calls\": 1000,") != NULL);
+    ck_assert(strcmp(buffer + strlen(buffer) - 3, "]}\n") == 0);
+}
+END_TEST
+
+Suite *buffer_suite(void) {
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Profile");
+
+    /* Core test cases */
+    tc_core = tcase_create("Core");
+    tcase_add_test(tc_core, ProfileDisabled);
+    tcase_add_test(tc_core, ProfileCountsCalls);
+    tcase_add_test(tc_core, ProfileDumpsJson);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+int main(void) {
+    int num_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = buffer_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    num_failed = srunner_ntests_failed(sr);
+    printf("%s\n", num_failed ? "At least one test failed" : "All tests passed");
+    srunner_free(sr);
+    return (!num_failed ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,184 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <float.h>
+#include <check.h>
+
+#include "lac_common.h"
+#include "ray.h"
+
+/* A small mesh of 6 triangles at different depths along +z */
+static const vec3 vertices[] = {
+    { -1.0f, -1.0f, 5.0f }, { 1.0f, -1.0f, 5.0f }, { 0.0f, 1.0f, 5.0f },
+    { -2.0f, -2.0f, 3.0f }, { 2.0f, -2.0f, 3.0f }, { 0.0f, 2.0f, 3.0f },
+    { 0.0f, 0.0f, 2.0f }, { 0.5f, 0.0f, 2.0f }, { 0.0f, 0.5f, 2.0f },
+    { -3.0f, 0.0f, 4.0f }, { 3.0f, 0.0f, 4.5f }, { 0.0f, 3.0f, 4.0f },
+    { 5.0f, 5.0f, 1.0f }, { 6.0f, 5.0f, 1.0f }, { 5.0f, 6.0f, 1.0f },
+    { -1.0f, 0.0f, 6.0f }, { 1.0f, 0.0f, 6.0f }, { 0.0f, 0.0f, 7.0f }
+};
+
+#define TRIANGLES 6
+
+/* Rays fanning out from the origin, some of which miss everything */
+static void make_rays(LacRay_t rays[LAC_RAY_PACKET]) {
+    size_t i;
+    vec3 v_origin = { 0.0f, 0.0f, 0.0f };
+    vec3 v_direction;
+
+    for (i = 0; i < LAC_RAY_PACKET; ++i) {
+        v_direction[0] = -0.5f + (0.15f * (float)i);
+        v_direction[1] = 0.4f - (0.1f * (float)i);
+        v_direction[2] = 1.0f;
+        lac_init_ray(&rays[i], v_origin, v_direction, 0.0f, FLT_MAX);
+    }
+    rays[LAC_RAY_PACKET - 1].direction[2] = -1.0f;
+}
+
+START_TEST(SingleRay) {
+    vec3 v_origin = { 0.25f, 0.0f, 0.0f };
+    vec3 v_direction = { 0.0f, 0.0f, 1.0f };
+    vec3 v_parallel = { 1.0f, 0.0f, 0.0f };
+    LacRayHit_t hit;
+    LacRay_t ray;
+
+    lac_init_ray(&ray, v_origin, v_direction, 0.0f, FLT_MAX);
+    lac_init_ray_hit(&hit, &ray);
+    ck_assert_uint_eq(hit.prim, LAC_RAY_NO_HIT);
+
+    /* (0.25, 0) lies at u = 0.375, v = 0.5 on the first triangle */
+    ck_assert(lac_intersect_ray_triangle(&hit, &ray, vertices[0], vertices[1], vertices[2], 0));
+    ck_assert_float_eq_tol(hit.t, 5.0f, 1e-6f);
+    ck_assert_float_eq_tol(hit.u, 0.375f, 1e-6f);
+    ck_assert_float_eq_tol(hit.v, 0.5f, 1e-6f);
+    ck_assert_uint_eq(hit.prim, 0);
+
+    /* A further triangle does not replace the hit, but a nearer one does */
+    ck_assert(!lac_intersect_ray_triangle(&hit, &ray, vertices[15], vertices[16], vertices[17], 5));
+    ck_assert(lac_intersect_ray_triangle(&hit, &ray, vertices[3], vertices[4], vertices[5], 1));
+    ck_assert_float_eq_tol(hit.t, 3.0f, 1e-6f);
+    ck_assert_uint_eq(hit.prim, 1);
+
+    /* Triangles behind the ray, beyond tmax or parallel to the ray are never hit */
+    lac_init_ray(&ray, v_origin, v_direction, 0.0f, 2.5f);
+    lac_init_ray_hit(&hit, &ray);
+    ck_assert(!lac_intersect_ray_triangle(&hit, &ray, vertices[0], vertices[1], vertices[2], 0));
+    ck_assert(lac_intersect_ray_triangle(&hit, &ray, vertices[6], vertices[7], vertices[8], 2));
+
+    v_origin[2] = 10.0f;
+    lac_init_ray(&ray, v_origin, v_direction, 0.0f, FLT_MAX);
+    lac_init_ray_hit(&hit, &ray);
+    ck_assert(!lac_intersect_ray_triangle(&hit, &ray, vertices[0], vertices[1], vertices[2], 0));
+
+    lac_init_ray(&ray, vertices[0], v_parallel, 0.0f, FLT_MAX);
+    lac_init_ray_hit(&hit, &ray);
+    ck_assert(!lac_intersect_ray_triangle(&hit, &ray, vertices[0], vertices[1], vertices[2], 0));
+}
+END_TEST
+
+START_TEST(RayPacket) {
+    LacRay_t rays[LAC_RAY_PACKET];
+    LacRayHit_t expected[LAC_RAY_PACKET];
+    LacRayPacket_t packet;
+    LacRayHitPacket_t hits;
+    unsigned any = 0;
+    uint32_t p;
+    size_t i;
+
+    make_rays(rays);
+    for (i = 0; i < LAC_RAY_PACKET; ++i) {
+        lac_init_ray_hit(&expected[i], &rays[i]);
+        for (p = 0; p < TRIANGLES; ++p) {
+            lac_intersect_ray_triangle(&expected[i], &rays[i], vertices[3 * p], vertices[(3 * p) + 1], vertices[(3 * p) + 2], p);
+        }
+    }
+
+    /* Leave out the last ray so that the padded lane is exercised */
+    lac_init_ray_packet(&packet, &hits, rays, LAC_RAY_PACKET - 1);
+    for (p = 0; p < TRIANGLES; ++p) {
+        any |= lac_intersect_ray_packet_triangle(&hits, &packet, vertices[3 * p], vertices[(3 * p) + 1], vertices[(3 * p) + 2], p);
+    }
+    ck_assert_uint_eq(any & (1u << (LAC_RAY_PACKET - 1)), 0);
+    ck_assert_uint_eq(hits.prim[LAC_RAY_PACKET - 1], LAC_RAY_NO_HIT);
+
+    for (i = 0; i < LAC_RAY_PACKET - 1; ++i) {
+        ck_assert_uint_eq(hits.prim[i], expected[i].prim);
+        if (expected[i].prim != LAC_RAY_NO_HIT) {
+            ck_assert_float_eq_tol(hits.t[i], expected[i].t, 1e-5f);
+            ck_assert_float_eq_tol(hits.u[i], expected[i].u, 1e-5f);
+            ck_assert_float_eq_tol(hits.v[i], expected[i].v, 1e-5f);
+        }
+    }
+}
+END_TEST
+
+START_TEST(TrianglePacket) {
+    const uint32_t prims[TRIANGLES] = { 0, 1, 2, 3, 4, 5 };
+    const uint32_t indices[3 * TRIANGLES] = { 2, 1, 0, 5, 4, 3, 8, 7, 6, 11, 10, 9, 14, 13, 12, 17, 16, 15 };
+    LacRay_t rays[LAC_RAY_PACKET];
+    LacTrianglePacket_t triangles, indexed;
+    LacRayHit_t expected, actual;
+    uint32_t p;
+    size_t i;
+
+    make_rays(rays);
+    lac_init_triangle_packet(&triangles, vertices, NULL, prims, TRIANGLES);
+    lac_init_triangle_packet(&indexed, vertices, indices, prims, TRIANGLES);
+
+    for (i = 0; i < LAC_RAY_PACKET; ++i) {
+        lac_init_ray_hit(&expected, &rays[i]);
+        for (p = 0; p < TRIANGLES; ++p) {
+            lac_intersect_ray_triangle(&expected, &rays[i], vertices[3 * p], vertices[(3 * p) + 1], vertices[(3 * p) + 2], p);
+        }
+
+        lac_init_ray_hit(&actual, &rays[i]);
+        ck_assert(lac_intersect_ray_triangle_packet(&actual, &rays[i], &triangles) == (expected.prim != LAC_RAY_NO_HIT));
+        ck_assert_uint_eq(actual.prim, expected.prim);
+        if (expected.prim != LAC_RAY_NO_HIT) {
+            ck_assert_float_eq_tol(actual.t, expected.t, 1e-5f);
+            ck_assert_float_eq_tol(actual.u, expected.u, 1e-5f);
+            ck_assert_float_eq_tol(actual.v, expected.v, 1e-5f);
+
+            /* A hit that is already nearer is kept */
+            ck_assert(!lac_intersect_ray_triangle_packet(&actual, &rays[i], &triangles));
+
+            /* Reversing the winding order swaps the roles of v and w = 1 - u - v, but not t */
+            lac_init_ray_hit(&actual, &rays[i]);
+            ck_assert(lac_intersect_ray_triangle_packet(&actual, &rays[i], &indexed));
+            ck_assert_uint_eq(actual.prim, expected.prim);
+            ck_assert_float_eq_tol(actual.t, expected.t, 1e-5f);
+            ck_assert_float_eq_tol(actual.u, expected.u, 1e-5f);
+            ck_assert_float_eq_tol(actual.v, 1.0f - expected.u - expected.v, 1e-5f);
+        }
+    }
+}
+END_TEST
+
+Suite *buffer_suite(void) {
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Ray");
+
+    /* Core test cases */
+    tc_core = tcase_create("Core");
+    tcase_add_test(tc_core, SingleRay);
+    tcase_add_test(tc_core, RayPacket);
+    tcase_add_test(tc_core, TrianglePacket);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+int main(void) {
+    int num_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = buffer_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    num_failed = srunner_ntests_failed(sr);
+    printf("%s\n", num_failed ? "At least one test failed" : "All tests passed");
+    srunner_free(sr);
+    return (!num_failed ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,228 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <check.h>
+
+#include "lac_common.h"
+#include "batch.h"
+#include "scheduler.h"
+
+#define TREE_NODES 1023
+
+typedef struct Tree Tree_t;
+
+typedef struct {
+    Tree_t *tree;
+    size_t index;
+} Node_t;
+
+struct Tree {
+    LacScheduler_t *scheduler;
+    LacTaskGroup_t group;
+    atomic_size_t visited;
+    Node_t nodes[TREE_NODES];
+};
+
+static void count_task(void *arg) {
+    atomic_fetch_add((atomic_size_t*)arg, 1);
+}
+
+/* Each node submits its children into the same group, so tasks are also queued by worker threads */
+static void tree_task(void *arg) {
+    Node_t *node = arg;
+    Tree_t *tree = node->tree;
+    size_t child;
+
+    atomic_fetch_add(&tree->visited, 1);
+    for (child = (2 * node->index) + 1; child <= (2 * node->index) + 2 && child < TREE_NODES; ++child) {
+        lac_submit_task(tree->scheduler, &tree->group, tree_task, &tree->nodes[child]);
+    }
+}
+
+static void visit_range(void *arg, size_t begin, size_t end) {
+    atomic_int *visits = arg;
+    size_t i;
+
+    for (i = begin; i < end; ++i) {
+        atomic_fetch_add(&visits[i], 1);
+    }
+}
+
+/* Keeps the size of the smallest piece that a range was split into */
+static void measure_range(void *arg, size_t begin, size_t end) {
+    atomic_size_t *smallest = arg;
+    size_t size = atomic_load(smallest);
+
+    while (end - begin < size && !atomic_compare_exchange_weak(smallest, &size, end - begin)) {
+    }
+}
+
+START_TEST(SchedulerTasks) {
+    LacScheduler_t *scheduler;
+    LacTaskGroup_t group;
+    atomic_size_t count;
+    size_t i;
+
+    scheduler = lac_create_scheduler(4);
+    ck_assert_ptr_nonnull(scheduler);
+    ck_assert_uint_eq(lac_get_scheduler_thread_count(scheduler), 4);
+
+    /* Far more tasks than the initial size of a deque */
+    atomic_init(&count, 0);
+    lac_init_task_group(&group);
+    for (i = 0; i < 1000; ++i) {
+        ck_assert(lac_submit_task(scheduler, &group, count_task, &count));
+    }
+    lac_wait_task_group(scheduler, &group);
+    ck_assert_uint_eq(atomic_load(&count), 1000);
+
+    /* Groups can be reused once they have been waited on */
+    ck_assert(lac_submit_task(scheduler, &group, count_task, &count));
+    lac_wait_task_group(scheduler, &group);
+    ck_assert_uint_eq(atomic_load(&count), 1001);
+
+    lac_destroy_scheduler(scheduler);
+}
+END_TEST
+
+START_TEST(SchedulerNestedTasks) {
+    Tree_t *tree;
+    size_t i;
+
+    tree = malloc(sizeof(Tree_t));
+    ck_assert_ptr_nonnull(tree);
+
+    tree->scheduler = lac_create_scheduler(3);
+    ck_assert_ptr_nonnull(tree->scheduler);
+    atomic_init(&tree->visited, 0);
+    for (i = 0; i < TREE_NODES; ++i) {
+        tree->nodes[i].tree = tree;
+        tree->nodes[i].index = i;
+    }
+
+    lac_init_task_group(&tree->group);
+    ck_assert(lac_submit_task(tree->scheduler, &tree->group, tree_task, &tree->nodes[0]));
+    lac_wait_task_group(tree->scheduler, &tree->group);
+    ck_assert_uint_eq(atomic_load(&tree->visited), TREE_NODES);
+
+    lac_destroy_scheduler(tree->scheduler);
+    free(tree);
+}
+END_TEST
+
+START_TEST(SchedulerRangeTasks) {
+    const size_t count = 10007;
+    LacScheduler_t *scheduler;
+    LacTaskGroup_t group;
+    atomic_size_t smallest;
+    atomic_int *visits;
+    size_t i;
+
+    visits = malloc(count * sizeof(atomic_int));
+    ck_assert_ptr_nonnull(visits);
+    for (i = 0; i < count; ++i) {
+        atomic_init(&visits[i], 0);
+    }
+
+    scheduler = lac_create_scheduler(4);
+    ck_assert_ptr_nonnull(scheduler);
+
+    /* Every index is visited exactly once, however the range is split */
+    lac_parallel_for(scheduler, visit_range, visits, count, 7);
+    lac_parallel_for(scheduler, visit_range, visits, count, 0);
+
+    lac_init_task_group(&group);
+    ck_assert(lac_submit_range_task(scheduler, &group, visit_range, visits, 100, count, 1));
+    ck_assert(lac_submit_range_task(scheduler, &group, visit_range, visits, 5, 5, 1));
+    lac_wait_task_group(scheduler, &group);
+
+    for (i = 0; i < count; ++i) {
+        ck_assert_int_eq(atomic_load(&visits[i]), (i < 100) ? 2 : 3);
+    }
+
+    /* Without a grain, a small range is not split into pieces much below LAC_SCHEDULER_MIN_GRAIN */
+    atomic_init(&smallest, SIZE_MAX);
+    lac_parallel_for(scheduler, measure_range, &smallest, 1000, 0);
+    ck_assert_uint_gt(atomic_load(&smallest), LAC_SCHEDULER_MIN_GRAIN / 2);
+
+    lac_destroy_scheduler(scheduler);
+    free(visits);
+}
+END_TEST
+
+START_TEST(SchedulerBatch) {
+    const size_t count = 100003;
+    const size_t threads[] = { 1, 4 };
+    LacScheduler_t *scheduler;
+    vec4 *v_in, *v_expected, *v_out;
+    mat4 m_in;
+    size_t i, t;
+
+    for (i = 0; i < 16; ++i) {
+        m_in[i] = (float)((i * 7) % 11) - 5.0f;
+    }
+
+    v_in = malloc(count * sizeof(vec4));
+    v_expected = malloc(count * sizeof(vec4));
+    v_out = malloc(count * sizeof(vec4));
+    ck_assert_ptr_nonnull(v_in);
+    ck_assert_ptr_nonnull(v_expected);
+    ck_assert_ptr_nonnull(v_out);
+
+    for (i = 0; i < count; ++i) {
+        v_in[i][0] = (float)(i % 13);
+        v_in[i][1] = (float)(i % 5) - 2.0f;
+        v_in[i][2] = 0.5f * (float)(i % 9);
+        v_in[i][3] = 1.0f;
+    }
+    lac_multiply_vec4_mat4_array(v_expected, v_in, m_in, count);
+
+    for (t = 0; t < sizeof(threads) / sizeof(threads[0]); ++t) {
+        scheduler = lac_create_scheduler(threads[t]);
+        ck_assert_ptr_nonnull(scheduler);
+
+        memset(v_out, 0, count * sizeof(vec4));
+        lac_parallel_multiply_vec4_mat4_array(scheduler, v_out, v_in, m_in, count);
+        ck_assert_mem_eq(v_out, v_expected, count * sizeof(vec4));
+
+        lac_destroy_scheduler(scheduler);
+    }
+
+    free(v_in);
+    free(v_expected);
+    free(v_out);
+}
+END_TEST
+
+Suite *buffer_suite(void) {
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Scheduler");
+
+    /* Core test cases */
+    tc_core = tcase_create("Core");
+    tcase_add_test(tc_core, SchedulerTasks);
+    tcase_add_test(tc_core, SchedulerNestedTasks);
+    tcase_add_test(tc_core, SchedulerRangeTasks);
+    tcase_add_test(tc_core, SchedulerBatch);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+int main(void) {
+    int num_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = buffer_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    num_failed = srunner_ntests_failed(sr);
+    printf("%s\n", num_failed ? "At least one test failed" : "All tests passed");
+    srunner_free(sr);
+    return (!num_failed ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,385 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+#include <check.h>
+
+#include "lac_common.h"
+#include "sparse.h"
+#include "scheduler.h"
+
+/* Odd sizes, so that rows end part way through a SIMD block */
+#define ROWS 203
+#define COLS 157
+#define TRIPLETS 6001
+/* Enough rows and entries for a product to be split across threads */
+#define MANY_ROWS 30001
+
+static uint32_t seed;
+
+static float random_float(const float min, const float max) {
+    seed = (seed * 1664525u) + 1013904223u;
+    return min + ((max - min) * (float)(seed >> 8) / (float)(1u << 24));
+}
+
+static uint32_t random_index(const size_t count) {
+    seed = (seed * 1664525u) + 1013904223u;
+    return (seed >> 8) % (uint32_t)count;
+}
+
+/* Rows which are multiples of 3 get more entries than the rest, and every 7th triplet repeats the position before it */
+static void random_triplets(LacTriplet_t *triplets, const size_t count, const size_t rows, const size_t cols) {
+    size_t i;
+
+    for (i = 0; i < count; ++i) {
+        if (i % 7 == 0 && i > 0) {
+            triplets[i].row = triplets[i - 1].row;
+            triplets[i].col = triplets[i - 1].col;
+        } else {
+            triplets[i].row = random_index(rows);
+            if (triplets[i].row % 3 != 0) {
+                triplets[i].row = random_index(rows);
+            }
+            triplets[i].col = random_index(cols);
+        }
+        triplets[i].value = random_float(-2.0f, 2.0f);
+    }
+}
+
+/* Adds the triplets into a dense row-major matrix, in the order given */
+static float *dense_matrix(const LacTriplet_t *triplets, const size_t count, const size_t rows, const size_t cols) {
+    float *dense = calloc(rows * cols, sizeof(float));
+    size_t i;
+
+    for (i = 0; i < count; ++i) {
+        dense[(triplets[i].row * cols) + triplets[i].col] += triplets[i].value;
+    }
+    return dense;
+}
+
+/* Checks that a CSR matrix holds exactly the entries of a dense one which were given */
+static void check_csr(const LacCsr_t *csr, const float *dense, const bool *present, const size_t rows, const size_t cols) {
+    size_t r, c, e, nnz = 0;
+
+    ck_assert_uint_eq(csr->rows, rows);
+    ck_assert_uint_eq(csr->cols, cols);
+    ck_assert_uint_eq(csr->row_start[0], 0);
+    for (r = 0; r < rows; ++r) {
+        for (c = 0; c < cols; ++c) {
+            nnz += present[(r * cols) + c];
+        }
+        for (e = csr->row_start[r]; e < csr->row_start[r + 1]; ++e) {
+            if (e > csr->row_start[r]) {
+                ck_assert_uint_gt(csr->col_index[e], csr->col_index[e - 1]);
+            }
+            ck_assert_uint_lt(csr->col_index[e], cols);
+            ck_assert(present[(r * cols) + csr->col_index[e]]);
+            ck_assert_float_eq(csr->values[e], dense[(r * cols) + csr->col_index[e]]);
+        }
+    }
+    ck_assert_uint_eq(csr->nnz, nnz);
+    ck_assert_uint_eq(csr->row_start[rows], nnz);
+}
+
+static bool *present_entries(const LacTriplet_t *triplets, const size_t count, const size_t rows, const size_t cols) {
+    bool *present = calloc(rows * cols, sizeof(bool));
+    size_t i;
+
+    for (i = 0; i < count; ++i) {
+        present[(triplets[i].row * cols) + triplets[i].col] = true;
+    }
+    return present;
+}
+
+/* Checks y = dense * x against a product in double precision */
+static void check_product(const float *y, const float *dense, const float *x, const size_t rows, const size_t cols) {
+    double sum, mag;
+    size_t r, c;
+
+    for (r = 0; r < rows; ++r) {
+        sum = 0.0;
+        mag = 0.0;
+        for (c = 0; c < cols; ++c) {
+            sum += (double)dense[(r * cols) + c] * x[c];
+            mag += fabs((double)dense[(r * cols) + c] * x[c]);
+        }
+        ck_assert_float_eq_tol(y[r], (float)sum, (float)(mag * 1e-5) + 1e-6f);
+    }
+}
+
+START_TEST(SparseCsr) {
+    LacTriplet_t *triplets = malloc(TRIPLETS * sizeof(LacTriplet_t));
+    float x[COLS], y[ROWS], *dense;
+    bool *present;
+    LacCsr_t csr;
+    size_t i;
+
+    seed = 11;
+    random_triplets(triplets, TRIPLETS, ROWS, COLS);
+    dense = dense_matrix(triplets, TRIPLETS, ROWS, COLS);
+    present = present_entries(triplets, TRIPLETS, ROWS, COLS);
+
+    ck_assert_int_eq(lac_init_csr(&csr, ROWS, COLS, triplets, TRIPLETS), 0);
+    check_csr(&csr, dense, present, ROWS, COLS);
+
+    for (i = 0; i < COLS; ++i) {
+        x[i] = random_float(-1.0f, 1.0f);
+    }
+    lac_multiply_csr_vec(y, &csr, x);
+    check_product(y, dense, x, ROWS, COLS);
+
+    lac_free_csr(&csr);
+    ck_assert_ptr_null(csr.values);
+    ck_assert_uint_eq(csr.nnz, 0);
+
+    free(triplets);
+    free(dense);
+    free(present);
+}
+END_TEST
+
+START_TEST(SparseTranspose) {
+    LacTriplet_t *triplets = malloc(TRIPLETS * sizeof(LacTriplet_t));
+    float x[ROWS], y[COLS], *dense;
+    bool *present;
+    LacCsr_t csr, transposed, twice;
+    size_t i;
+
+    seed = 12;
+    random_triplets(triplets, TRIPLETS, ROWS, COLS);
+    ck_assert_int_eq(lac_init_csr(&csr, ROWS, COLS, triplets, TRIPLETS), 0);
+
+    /* The transpose is the matrix assembled from the triplets with their rows and columns swapped */
+    for (i = 0; i < TRIPLETS; ++i) {
+        triplets[i].row ^= triplets[i].col;
+        triplets[i].col ^= triplets[i].row;
+        triplets[i].row ^= triplets[i].col;
+    }
+    dense = dense_matrix(triplets, TRIPLETS, COLS, ROWS);
+    present = present_entries(triplets, TRIPLETS, COLS, ROWS);
+
+    ck_assert_int_eq(lac_transpose_csr(&transposed, &csr), 0);
+    check_csr(&transposed, dense, present, COLS, ROWS);
+
+    for (i = 0; i < ROWS; ++i) {
+        x[i] = random_float(-1.0f, 1.0f);
+    }
+    lac_multiply_csr_vec(y, &transposed, x);
+    check_product(y, dense, x, COLS, ROWS);
+
+    ck_assert_int_eq(lac_transpose_csr(&twice, &transposed), 0);
+    ck_assert_uint_eq(twice.rows, ROWS);
+    ck_assert_uint_eq(twice.nnz, csr.nnz);
+    ck_assert_mem_eq(twice.row_start, csr.row_start, (ROWS + 1) * sizeof(uint32_t));
+    ck_assert_mem_eq(twice.col_index, csr.col_index, csr.nnz * sizeof(uint32_t));
+    ck_assert_mem_eq(twice.values, csr.values, csr.nnz * sizeof(float));
+
+    lac_free_csr(&csr);
+    lac_free_csr(&transposed);
+    lac_free_csr(&twice);
+    free(triplets);
+    free(dense);
+    free(present);
+}
+END_TEST
+
+START_TEST(SparseBsr3) {
+    LacTriplet_t *triplets = malloc(TRIPLETS * sizeof(LacTriplet_t));
+    const size_t block_rows = (ROWS / 3) + 1, block_cols = (COLS / 3) + 1;
+    vec3 *x = calloc(block_cols, sizeof(vec3)), *y = malloc(block_rows * sizeof(vec3));
+    float *dense;
+    LacBsr3_t bsr, transposed;
+    LacCsr_t csr;
+    size_t i, r, c, e;
+
+    seed = 13;
+    random_triplets(triplets, TRIPLETS, ROWS, COLS);
+    dense = dense_matrix(triplets, TRIPLETS, block_rows * 3, block_cols * 3);
+
+    ck_assert_int_eq(lac_init_bsr3(&bsr, block_rows, block_cols, triplets, TRIPLETS), 0);
+    ck_assert_uint_eq(bsr.block_rows, block_rows);
+    ck_assert_uint_eq(bsr.block_cols, block_cols);
+    for (r = 0; r < block_rows; ++r) {
+        for (e = bsr.row_start[r]; e < bsr.row_start[r + 1]; ++e) {
+            if (e > bsr.row_start[r]) {
+                ck_assert_uint_gt(bsr.col_index[e], bsr.col_index[e - 1]);
+            }
+            for (i = 0; i < 3; ++i) {
+                for (c = 0; c < 3; ++c) {
+                    ck_assert_float_eq(
+                        bsr.blocks[e][LAC_IS_ROW_MAJOR ? (i * 3) + c : (c * 3) + i],
+                        dense[(((r * 3) + i) * block_cols * 3) + (bsr.col_index[e] * 3) + c]
+                    );
+                }
+            }
+        }
+    }
+
+    /* Multiplying by the BSR matrix gives the same result as by the same entries in a CSR matrix */
+    for (i = 0; i < COLS; ++i) {
+        x[i / 3][i % 3] = random_float(-1.0f, 1.0f);
+    }
+    lac_multiply_bsr3_vec(y, &bsr, x);
+    check_product(&y[0][0], dense, &x[0][0], block_rows * 3, block_cols * 3);
+
+    ck_assert_int_eq(lac_init_csr(&csr, ROWS, COLS, triplets, TRIPLETS), 0);
+    ck_assert_uint_le(bsr.block_count, csr.nnz);
+    lac_free_csr(&csr);
+
+    /* Transposing moves each block and transposes it */
+    ck_assert_int_eq(lac_transpose_bsr3(&transposed, &bsr), 0);
+    ck_assert_uint_eq(transposed.block_rows, block_cols);
+    ck_assert_uint_eq(transposed.block_count, bsr.block_count);
+    for (r = 0; r < transposed.block_rows; ++r) {
+        for (e = transposed.row_start[r]; e < transposed.row_start[r + 1]; ++e) {
+            for (i = 0; i < 3; ++i) {
+                for (c = 0; c < 3; ++c) {
+                    ck_assert_float_eq(
+                        transposed.blocks[e][LAC_IS_ROW_MAJOR ? (i * 3) + c : (c * 3) + i],
+                        dense[(((transposed.col_index[e] * 3) + c) * block_cols * 3) + (r * 3) + i]
+                    );
+                }
+            }
+        }
+    }
+
+    lac_free_bsr3(&bsr);
+    ck_assert_ptr_null(bsr.blocks);
+    lac_free_bsr3(&transposed);
+    free(triplets);
+    free(dense);
+    free(x);
+    free(y);
+}
+END_TEST
+
+START_TEST(SparseParallel) {
+    const size_t count = MANY_ROWS * 9;
+    LacTriplet_t *triplets = malloc(count * sizeof(LacTriplet_t));
+    float *x = malloc(MANY_ROWS * sizeof(float));
+    float *y = malloc(MANY_ROWS * sizeof(float)), *y_serial = malloc(MANY_ROWS * sizeof(float));
+    vec3 *y3 = malloc((MANY_ROWS / 3) * sizeof(vec3)), *y3_serial = malloc((MANY_ROWS / 3) * sizeof(vec3));
+    LacScheduler_t *scheduler;
+    LacCsr_t csr;
+    LacBsr3_t bsr;
+    size_t i;
+
+    /* Rows of very different lengths, so that the parts hold different numbers of rows */
+    seed = 14;
+    for (i = 0; i < count; ++i) {
+        triplets[i].row = (i % 2 == 0) ? (uint32_t)(i / 9) : random_index(MANY_ROWS / 64);
+        triplets[i].col = random_index(MANY_ROWS);
+        triplets[i].value = random_float(-1.0f, 1.0f);
+    }
+    for (i = 0; i < MANY_ROWS; ++i) {
+        x[i] = random_float(-1.0f, 1.0f);
+    }
+
+    scheduler = lac_create_scheduler(4);
+    ck_assert_ptr_nonnull(scheduler);
+
+    ck_assert_int_eq(lac_init_csr(&csr, MANY_ROWS, MANY_ROWS, triplets, count), 0);
+    lac_multiply_csr_vec(y_serial, &csr, x);
+    lac_parallel_multiply_csr_vec(scheduler, y, &csr, x);
+    ck_assert_mem_eq(y, y_serial, MANY_ROWS * sizeof(float));
+    lac_parallel_multiply_csr_vec(NULL, y, &csr, x);
+    ck_assert_mem_eq(y, y_serial, MANY_ROWS * sizeof(float));
+
+    /* The first half of the triplets, within a matrix of 3x3 blocks */
+    for (i = 0; i < count; ++i) {
+        triplets[i].col %= (MANY_ROWS / 3) * 3;
+    }
+    ck_assert_int_eq(lac_init_bsr3(&bsr, MANY_ROWS / 3, MANY_ROWS / 3, triplets, count / 2), 0);
+    lac_multiply_bsr3_vec(y3_serial, &bsr, (const vec3 *)x);
+    lac_parallel_multiply_bsr3_vec(scheduler, y3, &bsr, (const vec3 *)x);
+    ck_assert_mem_eq(y3, y3_serial, (MANY_ROWS / 3) * sizeof(vec3));
+
+    lac_free_csr(&csr);
+    lac_free_bsr3(&bsr);
+    lac_destroy_scheduler(scheduler);
+    free(triplets);
+    free(x);
+    free(y);
+    free(y_serial);
+    free(y3);
+    free(y3_serial);
+}
+END_TEST
+
+START_TEST(SparseSpecial) {
+    LacTriplet_t triplets[] = {
+        { 0, 1, 2.0f },
+        { 2, 0, 0.0f },
+        { 0, 1, -2.0f },
+        { 3, 3, 1.0f }
+    };
+    float x[4] = { 1.0f, 2.0f, 3.0f, 4.0f }, y[4] = { 9.0f, 9.0f, 9.0f, 9.0f };
+    LacCsr_t csr;
+    LacBsr3_t bsr;
+
+    /* Entries which are given are stored, even if they are or add up to 0 */
+    ck_assert_int_eq(lac_init_csr(&csr, 4, 4, triplets, 4), 0);
+    ck_assert_uint_eq(csr.nnz, 3);
+    ck_assert_float_eq(csr.values[0], 0.0f);
+    lac_multiply_csr_vec(y, &csr, x);
+    ck_assert_float_eq(y[0], 0.0f);
+    ck_assert_float_eq(y[1], 0.0f);
+    ck_assert_float_eq(y[2], 0.0f);
+    ck_assert_float_eq(y[3], 4.0f);
+    lac_free_csr(&csr);
+
+    /* Entries outside the matrix */
+    errno = 0;
+    ck_assert_int_eq(lac_init_csr(&csr, 3, 4, triplets, 4), -1);
+    ck_assert_int_eq(errno, EINVAL);
+    ck_assert_ptr_null(csr.row_start);
+    errno = 0;
+    ck_assert_int_eq(lac_init_bsr3(&bsr, 1, 2, triplets, 4), -1);
+    ck_assert_int_eq(errno, EINVAL);
+
+    /* A matrix with no entries multiplies to 0 */
+    ck_assert_int_eq(lac_init_csr(&csr, 4, 4, NULL, 0), 0);
+    ck_assert_uint_eq(csr.nnz, 0);
+    lac_multiply_csr_vec(y, &csr, x);
+    ck_assert_float_eq(y[0] + y[1] + y[2] + y[3], 0.0f);
+    lac_free_csr(&csr);
+
+    /* And so does one with no rows */
+    ck_assert_int_eq(lac_init_bsr3(&bsr, 0, 0, NULL, 0), 0);
+    lac_parallel_multiply_bsr3_vec(NULL, NULL, &bsr, NULL);
+    lac_free_bsr3(&bsr);
+}
+END_TEST
+
+Suite *buffer_suite(void) {
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Sparse");
+
+    /* Core test cases */
+    tc_core = tcase_create("Core");
+    tcase_add_test(tc_core, SparseCsr);
+    tcase_add_test(tc_core, SparseTranspose);
+    tcase_add_test(tc_core, SparseBsr3);
+    tcase_add_test(tc_core, SparseParallel);
+    tcase_add_test(tc_core, SparseSpecial);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+int main(void) {
+    int num_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = buffer_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    num_failed = srunner_ntests_failed(sr);
+    printf("%s\n", num_failed ? "At least one test failed" : "All tests passed");
+    srunner_free(sr);
+    return (!num_failed ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,255 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+#include <check.h>
+
+#include "lac_common.h"
+#include "sphere.h"
+#include "vecmath.h"
+#include "matmath.h"
+#include "transforms.h"
+
+#define POINTS 1001
+#define SPHERES 37
+
+static uint32_t seed;
+
+static float random_float(const float min, const float max) {
+    seed = (seed * 1664525u) + 1013904223u;
+    return min + ((max - min) * (float)(seed >> 8) / (float)(1u << 24));
+}
+
+static float distance(const vec3 v_a, const vec3 v_b) {
+    const float dx = v_a[0] - v_b[0], dy = v_a[1] - v_b[1], dz = v_a[2] - v_b[2];
+    return sqrtf((dx * dx) + (dy * dy) + (dz * dz));
+}
+
+static void make_sphere(LacSphere_t *sphere) {
+    size_t c;
+
+    for (c = 0; c < 3; ++c) {
+        sphere->center[c] = random_float(-10.0f, 10.0f);
+    }
+    sphere->radius = random_float(0.1f, 4.0f);
+}
+
+START_TEST(SphereFromPoints) {
+    vec3 points[POINTS];
+    LacSphere_t sphere;
+    float theta, phi;
+    size_t i;
+
+    lac_init_sphere_from_points(&sphere, points, 0);
+    ck_assert_float_lt(sphere.radius, 0.0f);
+
+    /* Points on the surface of a sphere of radius 3 around (1, 2, 3), in a shuffled order */
+    seed = 42;
+    for (i = 0; i < POINTS; ++i) {
+        theta = random_float(0.0f, 6.2831853f);
+        phi = acosf(random_float(-1.0f, 1.0f));
+        points[i][0] = 1.0f + (3.0f * sinf(phi) * cosf(theta));
+        points[i][1] = 2.0f + (3.0f * sinf(phi) * sinf(theta));
+        points[i][2] = 3.0f + (3.0f * cosf(phi));
+    }
+
+    /* Every count up to a few blocks, so that both the blocks and the tail are exercised */
+    for (i = 1; i <= POINTS; i += (i < 40) ? 1 : 160) {
+        lac_init_sphere_from_points(&sphere, points, i);
+        ck_assert_float_le(sphere.radius, 3.0f * 1.25f);
+    }
+    for (i = 0; i < POINTS; ++i) {
+        ck_assert_float_le(distance(points[i], sphere.center), sphere.radius * 1.00001f);
+    }
+    ck_assert_float_ge(sphere.radius, 3.0f * 0.99999f);
+
+    /* A single point gives a sphere of radius 0 */
+    lac_init_sphere_from_points(&sphere, &points[7], 1);
+    ck_assert_float_eq(sphere.radius, 0.0f);
+    ck_assert_float_eq(sphere.center[0], points[7][0]);
+}
+END_TEST
+
+START_TEST(SphereMerge) {
+    LacSphere_t a[SPHERES], b[SPHERES], out[SPHERES], expected, empty;
+    size_t i, c;
+
+    seed = 5;
+    for (i = 0; i < SPHERES; ++i) {
+        make_sphere(&a[i]);
+        make_sphere(&b[i]);
+    }
+
+    /* Contained spheres are returned as they are */
+    b[3] = a[3];
+    b[3].radius *= 0.5f;
+    lac_init_sphere(&empty);
+    b[4] = empty;
+
+    lac_merge_sphere_array(out, a, b, SPHERES);
+    for (i = 0; i < SPHERES; ++i) {
+        lac_merge_sphere(&expected, &a[i], &b[i]);
+        ck_assert_float_eq_tol(out[i].radius, expected.radius, 1e-5f);
+        for (c = 0; c < 3; ++c) {
+            ck_assert_float_eq_tol(out[i].center[c], expected.center[c], 1e-5f);
+        }
+
+        /* Both spheres must lie entirely inside the merged one */
+        ck_assert_float_le(distance(a[i].center, out[i].center) + a[i].radius, out[i].radius * 1.00001f);
+        if (b[i].radius >= 0.0f) {
+            ck_assert_float_le(distance(b[i].center, out[i].center) + b[i].radius, out[i].radius * 1.00001f);
+        }
+    }
+    ck_assert_mem_eq(&out[3], &a[3], sizeof(LacSphere_t));
+    ck_assert_mem_eq(&out[4], &a[4], sizeof(LacSphere_t));
+
+    /* Merging two empty spheres stays empty */
+    lac_merge_sphere(&expected, &empty, &empty);
+    ck_assert_float_lt(expected.radius, 0.0f);
+}
+END_TEST
+
+START_TEST(SphereTransform) {
+    LacSphere_t in[SPHERES], out[SPHERES], expected;
+    mat4 m_in[SPHERES], m_rotation, m_scale, m_translation, m_tmp;
+    vec4 v_point, v_out;
+    size_t i, k, c;
+
+    seed = 11;
+    for (i = 0; i < SPHERES; ++i) {
+        make_sphere(&in[i]);
+        lac_get_rotation_mat4(m_rotation, 0.3f * (float)i, 0.1f, -0.2f * (float)i);
+        lac_get_scalar_mat4(m_scale, 1.0f, 1.0f + (float)(i % 3), 0.5f);
+        lac_get_translation_mat4(m_translation, (float)i, 2.0f, -3.0f);
+        lac_multiply_mat4(m_tmp, m_rotation, m_scale);
+        lac_multiply_mat4(m_in[i], m_translation, m_tmp);
+    }
+
+    lac_transform_sphere_array(out, in, (const mat4 *)m_in, SPHERES);
+    for (i = 0; i < SPHERES; ++i) {
+        lac_transform_sphere(&expected, &in[i], m_in[i]);
+        ck_assert_float_eq_tol(out[i].radius, expected.radius, 1e-4f);
+        ck_assert_float_eq_tol(out[i].radius, in[i].radius * (1.0f + (float)(i % 3)), 1e-4f);
+
+        /* Points on the surface of the original sphere stay inside the transformed one */
+        for (k = 0; k < 6; ++k) {
+            for (c = 0; c < 3; ++c) {
+                v_point[c] = in[i].center[c] + ((c == k / 2) ? ((k % 2) ? in[i].radius : -in[i].radius) : 0.0f);
+            }
+            v_point[3] = 1.0f;
+            lac_multiply_vec4_mat4(v_out, v_point, m_in[i]);
+            ck_assert_float_le(distance(v_out, out[i].center), out[i].radius * 1.0001f);
+        }
+    }
+}
+END_TEST
+
+START_TEST(SphereTransformSheared) {
+    LacSphere_t in, out;
+    mat4 m_in[3], m_rotation, m_scale;
+    vec4 v_point, v_out;
+    float length;
+    size_t i, k, c;
+
+    /* Scaling after a rotation does not keep the columns orthogonal, so the longest column (1.58) is not the most stretch (2) */
+    lac_get_rotation_mat4(m_rotation, 0.0f, 0.0f, lac_PI / 4.0f);
+    lac_get_scalar_mat4(m_scale, 2.0f, 1.0f, 1.0f);
+    lac_multiply_mat4(m_in[0], m_scale, m_rotation);
+    /* Pure shears, in both directions between two axes */
+    lac_get_scalar_mat4(m_in[1], 1.0f, 1.0f, 1.0f);
+    m_in[1][1] = 1.5f;
+    lac_get_scalar_mat4(m_in[2], 1.0f, 0.5f, 2.0f);
+    m_in[2][2] = -0.75f;
+    m_in[2][9] = 0.4f;
+    m_in[2][3] = 3.0f;
+
+    seed = 17;
+    make_sphere(&in);
+    lac_transform_sphere(&out, &in, m_in[0]);
+    ck_assert_float_ge(out.radius, 2.0f * in.radius * 0.9999f);
+
+    for (i = 0; i < 3; ++i) {
+        lac_transform_sphere(&out, &in, m_in[i]);
+
+        /* Points in many directions on the surface of the original sphere stay inside the transformed one */
+        for (k = 0; k < POINTS; ++k) {
+            do {
+                length = 0.0f;
+                for (c = 0; c < 3; ++c) {
+                    v_point[c] = random_float(-1.0f, 1.0f);
+                    length += v_point[c] * v_point[c];
+                }
+            } while (length < 1e-4f || length > 1.0f);
+            length = sqrtf(length);
+            for (c = 0; c < 3; ++c) {
+                v_point[c] = in.center[c] + (in.radius * v_point[c] / length);
+            }
+            v_point[3] = 1.0f;
+            lac_multiply_vec4_mat4(v_out, v_point, m_in[i]);
+            ck_assert_float_le(distance(v_out, out.center), out.radius * 1.0001f);
+        }
+    }
+}
+END_TEST
+
+START_TEST(SphereOverlap) {
+    LacSphere_t spheres[SPHERES], query, empty;
+    bool results[SPHERES];
+    size_t i, count = 0;
+
+    seed = 3;
+    for (i = 0; i < SPHERES; ++i) {
+        make_sphere(&spheres[i]);
+    }
+    lac_init_sphere(&spheres[8]);
+    query.center[0] = 1.0f;
+    query.center[1] = -2.0f;
+    query.center[2] = 0.5f;
+    query.radius = 6.0f;
+
+    lac_test_sphere_overlap_array(results, spheres, &query, SPHERES);
+    for (i = 0; i < SPHERES; ++i) {
+        ck_assert(results[i] == lac_test_sphere_overlap(&spheres[i], &query));
+        count += results[i];
+    }
+    ck_assert_uint_eq(lac_test_sphere_overlap_array(results, spheres, &query, SPHERES), count);
+    ck_assert(!results[8]);
+
+    lac_init_sphere(&empty);
+    ck_assert_uint_eq(lac_test_sphere_overlap_array(results, spheres, &empty, SPHERES), 0);
+    ck_assert(!lac_test_sphere_overlap(&empty, &empty));
+}
+END_TEST
+
+Suite *buffer_suite(void) {
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Sphere");
+
+    /* Core test cases */
+    tc_core = tcase_create("Core");
+    tcase_add_test(tc_core, SphereFromPoints);
+    tcase_add_test(tc_core, SphereMerge);
+    tcase_add_test(tc_core, SphereTransform);
+    tcase_add_test(tc_core, SphereTransformSheared);
+    tcase_add_test(tc_core, SphereOverlap);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+int main(void) {
+    int num_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = buffer_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    num_failed = srunner_ntests_failed(sr);
+    printf("%s\n", num_failed ? "At least one test failed" : "All tests passed");
+    srunner_free(sr);
+    return (!num_failed ? EXIT_SUCCESS : EXIT_FAILURE);
+}
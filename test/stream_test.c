@@ -0,0 +1,177 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <check.h>
+
+#include "lac_common.h"
+#include "vecmath.h"
+#include "arena.h"
+#include "stream.h"
+
+#define TEST_IN_PATH  "stream_test_in.bin"
+#define TEST_OUT_PATH "stream_test_out.bin"
+#define TEST_COUNT 1000
+
+START_TEST(StreamTransform) {
+    mat4 m4 = {
+        2,  0,  0,  1,
+        0,  3,  0,  2,
+        0,  0,  4,  3,
+        0,  0,  0,  1
+    };
+    static vec4 v4_in[TEST_COUNT];
+    static vec4 v4_expected[TEST_COUNT];
+    static vec4 v4_actual[TEST_COUNT];
+    size_t chunk_sizes[3] = { 0, 4096, TEST_COUNT * sizeof(vec4) };
+    int fd_in, fd_out;
+    FILE *file;
+    size_t i;
+
+    for (i = 0; i < TEST_COUNT; ++i) {
+        v4_in[i][0] = (float)i;
+        v4_in[i][1] = (float)(i % 7);
+        v4_in[i][2] = -(float)i;
+        v4_in[i][3] = 1.0f;
+        lac_multiply_vec4_mat4(v4_expected[i], v4_in[i], m4);
+    }
+
+    file = fopen(TEST_IN_PATH, "wb");
+    ck_assert_ptr_nonnull(file);
+    fwrite(v4_in, sizeof(vec4), TEST_COUNT, file);
+    fclose(file);
+
+    /* The default chunk, several chunks, and a chunk which is exactly filled by the input */
+    for (i = 0; i < 3; ++i) {
+        fd_in = open(TEST_IN_PATH, O_RDONLY);
+        fd_out = open(TEST_OUT_PATH, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        ck_assert_int_ge(fd_in, 0);
+        ck_assert_int_ge(fd_out, 0);
+
+        ck_assert_int_eq(lac_stream_multiply_vec4_mat4(fd_out, fd_in, m4, chunk_sizes[i], NULL), 0);
+        close(fd_in);
+        close(fd_out);
+
+        memset(v4_actual, 0, sizeof(v4_actual));
+        file = fopen(TEST_OUT_PATH, "rb");
+        ck_assert_ptr_nonnull(file);
+        ck_assert_uint_eq(fread(v4_actual, sizeof(vec4), TEST_COUNT + 1, file), TEST_COUNT);
+        fclose(file);
+
+        ck_assert_mem_eq(v4_actual, v4_expected, sizeof(v4_expected));
+    }
+
+    remove(TEST_IN_PATH);
+    remove(TEST_OUT_PATH);
+}
+END_TEST
+
+START_TEST(StreamScratch) {
+    mat4 m4 = {
+        1,  0,  0,  0,
+        0,  1,  0,  0,
+        0,  0,  1,  0,
+        0,  0,  0,  1
+    };
+    vec4 v4_in[16] = { { 0 } };
+    vec4 v4_actual[16];
+    LacArena_t arena, *thread_arena;
+    LacArenaMark_t mark;
+    int fd_in, fd_out;
+    FILE *file;
+
+    file = fopen(TEST_IN_PATH, "wb");
+    ck_assert_ptr_nonnull(file);
+    fwrite(v4_in, sizeof(vec4), 16, file);
+    fclose(file);
+
+    ck_assert_int_eq(lac_init_arena(&arena, 3 * 4096 + 4096), 0);
+    lac_alloc_arena(&arena, 10, 0);
+
+    fd_in = open(TEST_IN_PATH, O_RDONLY);
+    fd_out = open(TEST_OUT_PATH, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    ck_assert_int_eq(lac_stream_multiply_vec4_mat4(fd_out, fd_in, m4, 4096, &arena), 0);
+    close(fd_in);
+    close(fd_out);
+
+    /* The buffers are released back to the arena, and nothing else is */
+    ck_assert_uint_eq(lac_get_arena_mark(&arena), 10);
+    ck_assert_uint_ge(arena.peak, 3 * 4096);
+    lac_free_arena(&arena);
+
+    /* The thread arena holds the buffers at their default size */
+    thread_arena = lac_get_thread_arena();
+    ck_assert_ptr_nonnull(thread_arena);
+    mark = lac_get_arena_mark(thread_arena);
+    fd_in = open(TEST_IN_PATH, O_RDONLY);
+    fd_out = open(TEST_OUT_PATH, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    ck_assert_int_eq(lac_stream_multiply_vec4_mat4(fd_out, fd_in, m4, 0, thread_arena), 0);
+    close(fd_in);
+    close(fd_out);
+    ck_assert_uint_eq(lac_get_arena_mark(thread_arena), mark);
+
+    file = fopen(TEST_OUT_PATH, "rb");
+    ck_assert_ptr_nonnull(file);
+    ck_assert_uint_eq(fread(v4_actual, sizeof(vec4), 16, file), 16);
+    fclose(file);
+    ck_assert_mem_eq(v4_actual, v4_in, sizeof(v4_in));
+
+    remove(TEST_IN_PATH);
+    remove(TEST_OUT_PATH);
+}
+END_TEST
+
+START_TEST(StreamTruncated) {
+    mat4 m4 = { 0 };
+    float f_in[6] = { 1, 2, 3, 4, 5, 6 };
+    int fd_in, fd_out;
+    FILE *file;
+
+    file = fopen(TEST_IN_PATH, "wb");
+    ck_assert_ptr_nonnull(file);
+    fwrite(f_in, sizeof(float), 6, file);
+    fclose(file);
+
+    fd_in = open(TEST_IN_PATH, O_RDONLY);
+    fd_out = open(TEST_OUT_PATH, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+    ck_assert_int_eq(lac_stream_multiply_vec4_mat4(fd_out, fd_in, m4, 0, NULL), -1);
+    ck_assert_int_eq(errno, EINVAL);
+
+    close(fd_in);
+    close(fd_out);
+    remove(TEST_IN_PATH);
+    remove(TEST_OUT_PATH);
+}
+END_TEST
+
+Suite *buffer_suite(void) {
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Streams");
+
+    /* Core test cases */
+    tc_core = tcase_create("Core");
+    tcase_add_test(tc_core, StreamTransform);
+    tcase_add_test(tc_core, StreamScratch);
+    tcase_add_test(tc_core, StreamTruncated);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+int main(void) {
+    int num_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = buffer_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    num_failed = srunner_ntests_failed(sr);
+    printf("%s\n", num_failed ? "At least one test failed" : "All tests passed");
+    srunner_free(sr);
+    return (!num_failed ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,321 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+#include <check.h>
+
+#include "lac_common.h"
+#include "transforms.h"
+#include "vecmath.h"
+#include "matmath.h"
+
+/* An odd count, so that the final block is padded */
+#define MATRICES 29
+
+static uint32_t seed;
+
+static float random_float(const float min, const float max) {
+    seed = (seed * 1664525u) + 1013904223u;
+    return min + ((max - min) * (float)(seed >> 8) / (float)(1u << 24));
+}
+
+static size_t get_index(const size_t n, const size_t r, const size_t c) {
+#if LAC_IS_ROW_MAJOR
+    return (r * n) + c;
+#else
+    return (c * n) + r;
+#endif
+}
+
+static float get_element(const mat4 m_in, const size_t r, const size_t c) {
+    return m_in[get_index(4, r, c)];
+}
+
+/* Builds translation * rotation * shear * scale */
+static void compose(mat4 m_out, const vec3 t, const vec3 euler, const vec3 shear, const vec3 s) {
+    mat4 m_translation, m_rotation, m_shear, m_scale, m_tmp;
+
+    lac_get_translation_mat4(m_translation, t[0], t[1], t[2]);
+    lac_get_rotation_mat4(m_rotation, euler[0], euler[1], euler[2]);
+    lac_get_scalar_mat4(m_scale, s[0], s[1], s[2]);
+
+    memcpy(m_shear, lac_ident_mat4, sizeof(mat4));
+#if LAC_IS_ROW_MAJOR
+    m_shear[1] = shear[0];
+    m_shear[2] = shear[1];
+    m_shear[6] = shear[2];
+#else
+    m_shear[4] = shear[0];
+    m_shear[8] = shear[1];
+    m_shear[9] = shear[2];
+#endif
+
+    lac_multiply_mat4(m_tmp, m_shear, m_scale);
+    lac_multiply_mat4(m_out, m_rotation, m_tmp);
+    memcpy(m_tmp, m_out, sizeof(mat4));
+    lac_multiply_mat4(m_out, m_translation, m_tmp);
+}
+
+/* Rotates a vector by a unit quaternion (x, y, z, w) */
+static void rotate(vec3 v_out, const vec4 q, const vec3 v_in) {
+    vec3 u = { q[0], q[1], q[2] }, uv, uuv;
+
+    lac_calc_cross_prod(uv, u, v_in);
+    lac_calc_cross_prod(uuv, u, uv);
+    v_out[0] = v_in[0] + (2.0f * ((q[3] * uv[0]) + uuv[0]));
+    v_out[1] = v_in[1] + (2.0f * ((q[3] * uv[1]) + uuv[1]));
+    v_out[2] = v_in[2] + (2.0f * ((q[3] * uv[2]) + uuv[2]));
+}
+
+START_TEST(DecomposeRoundTrip) {
+    mat4 m_in[MATRICES], m_out;
+    LacTransformParts_t parts[MATRICES], single;
+    vec3 t, euler, shear, s, v_axis, v_rotated;
+    float length_sq;
+    size_t i, r, c;
+
+    seed = 7;
+    for (i = 0; i < MATRICES; ++i) {
+        for (c = 0; c < 3; ++c) {
+            t[c] = random_float(-50.0f, 50.0f);
+            shear[c] = random_float(-0.5f, 0.5f);
+            s[c] = random_float(0.1f, 10.0f);
+        }
+        euler[0] = random_float(-3.1f, 3.1f);
+        euler[1] = random_float(-1.5f, 1.5f);
+        euler[2] = random_float(-3.1f, 3.1f);
+
+        /* Every third matrix is a reflection */
+        if (i % 3 == 0) {
+            s[i % 2] = -s[i % 2];
+        }
+        compose(m_in[i], t, euler, shear, s);
+    }
+
+    ck_assert_uint_eq(lac_decompose_mat4_array(parts, (const mat4 *)m_in, MATRICES), 0);
+    for (i = 0; i < MATRICES; ++i) {
+        ck_assert(parts[i].reflected == (i % 3 == 0));
+        ck_assert_float_ge(parts[i].rotation[3], 0.0f);
+        lac_calc_dot_prod_vec4(&length_sq, parts[i].rotation, parts[i].rotation);
+        ck_assert_float_eq_tol(length_sq, 1.0f, 1e-5f);
+
+        /* Composing the parts gives back the matrix */
+        compose(m_out, parts[i].translation, parts[i].euler, parts[i].shear, parts[i].scale);
+        for (r = 0; r < 4; ++r) {
+            for (c = 0; c < 4; ++c) {
+                ck_assert_float_eq_tol(get_element(m_out, r, c), get_element(m_in[i], r, c), 1e-4f * fmaxf(fabsf(get_element(m_in[i], r, c)), 10.0f));
+            }
+        }
+
+        /* The quaternion is the same rotation as the angles */
+        lac_get_rotation_mat4(m_out, parts[i].euler[0], parts[i].euler[1], parts[i].euler[2]);
+        for (c = 0; c < 3; ++c) {
+            v_axis[0] = (c == 0) ? 1.0f : 0.0f;
+            v_axis[1] = (c == 1) ? 1.0f : 0.0f;
+            v_axis[2] = (c == 2) ? 1.0f : 0.0f;
+            rotate(v_rotated, parts[i].rotation, v_axis);
+            for (r = 0; r < 3; ++r) {
+                ck_assert_float_eq_tol(v_rotated[r], get_element(m_out, r, c), 1e-5f);
+            }
+        }
+
+        /* A single matrix gives the same parts */
+        ck_assert(lac_decompose_mat4(&single, m_in[i]));
+        for (c = 0; c < 3; ++c) {
+            ck_assert_float_eq_tol(single.rotation[c], parts[i].rotation[c], 1e-6f);
+            ck_assert_float_eq_tol(single.euler[c], parts[i].euler[c], 1e-6f);
+            ck_assert_float_eq_tol(single.scale[c], parts[i].scale[c], 1e-6f * fabsf(parts[i].scale[c]));
+            ck_assert_float_eq_tol(single.shear[c], parts[i].shear[c], 1e-6f);
+        }
+    }
+}
+END_TEST
+
+START_TEST(DecomposeSpecial) {
+    const vec3 t = { 1.0f, 2.0f, 3.0f }, no_shear = { 0.0f, 0.0f, 0.0f }, s = { 2.0f, 3.0f, 4.0f };
+    const vec3 gimbal = { 0.3f, 1.5707963f, 0.4f }, flat = { 1.0f, 1.0f, 0.0f };
+    LacTransformParts_t parts;
+    mat4 m_in, m_out;
+    size_t r, c;
+
+    /* The identity */
+    ck_assert(lac_decompose_mat4(&parts, lac_ident_mat4));
+    for (c = 0; c < 3; ++c) {
+        ck_assert_float_eq(parts.translation[c], 0.0f);
+        ck_assert_float_eq_tol(parts.scale[c], 1.0f, 1e-6f);
+        ck_assert_float_eq_tol(parts.euler[c], 0.0f, 1e-6f);
+        ck_assert_float_eq_tol(parts.shear[c], 0.0f, 1e-6f);
+    }
+    ck_assert_float_eq_tol(parts.rotation[3], 1.0f, 1e-6f);
+    ck_assert(!parts.reflected);
+
+    /* In gimbal lock, the angles still give back the same rotation */
+    compose(m_in, t, gimbal, no_shear, s);
+    ck_assert(lac_decompose_mat4(&parts, m_in));
+    ck_assert_float_eq_tol(parts.euler[1], 1.5707963f, 1e-3f);
+    ck_assert_float_eq(parts.euler[2], 0.0f);
+    compose(m_out, parts.translation, parts.euler, parts.shear, parts.scale);
+    for (r = 0; r < 3; ++r) {
+        for (c = 0; c < 4; ++c) {
+            ck_assert_float_eq_tol(get_element(m_out, r, c), get_element(m_in, r, c), 1e-4f);
+        }
+    }
+
+    /* A matrix which flattens space has no rotation, but keeps its translation */
+    compose(m_in, t, gimbal, no_shear, flat);
+    ck_assert(!lac_decompose_mat4(&parts, m_in));
+    ck_assert_float_eq(parts.translation[2], 3.0f);
+    ck_assert_float_eq_tol(parts.rotation[3], 1.0f, 1e-6f);
+    ck_assert_float_eq(parts.shear[0], 0.0f);
+    ck_assert(!parts.reflected);
+
+    memset(m_in, 0, sizeof(mat4));
+    ck_assert(!lac_decompose_mat4(&parts, m_in));
+    ck_assert_float_eq_tol(parts.rotation[3], 1.0f, 1e-6f);
+
+    /* Nothing is touched for an empty array */
+    ck_assert_uint_eq(lac_decompose_mat4_array(NULL, NULL, 0), 0);
+}
+END_TEST
+
+/* The largest difference between M^T * M and the identity, over the upper-left 3x3 part of an n x n matrix */
+static float orthonormal_error(const float *m_in, const size_t n) {
+    float dot, error = 0.0f;
+    size_t a, b, r;
+
+    for (a = 0; a < 3; ++a) {
+        for (b = 0; b < 3; ++b) {
+            dot = 0.0f;
+            for (r = 0; r < 3; ++r) {
+                dot += m_in[get_index(n, r, a)] * m_in[get_index(n, r, b)];
+            }
+            error = fmaxf(error, fabsf(dot - ((a == b) ? 1.0f : 0.0f)));
+        }
+    }
+    return error;
+}
+
+/* The squared distance between the upper-left 3x3 parts of two matrices */
+static float distance_sq(const mat4 m_a, const mat4 m_b) {
+    float d, sum = 0.0f;
+    size_t r, c;
+
+    for (r = 0; r < 3; ++r) {
+        for (c = 0; c < 3; ++c) {
+            d = get_element(m_a, r, c) - get_element(m_b, r, c);
+            sum += d * d;
+        }
+    }
+    return sum;
+}
+
+START_TEST(Orthonormalize) {
+    const LacOrthonormalizeMode_t modes[2] = { LAC_ORTHONORMALIZE_GRAM_SCHMIDT, LAC_ORTHONORMALIZE_SYMMETRIC };
+    mat4 m_in[MATRICES], m_out[2][MATRICES];
+    mat3 m3_in[MATRICES], m3_out[MATRICES];
+    float drift, cross;
+    size_t m, i, r, c;
+
+    seed = 11;
+    for (i = 0; i < MATRICES; ++i) {
+        lac_get_rotation_mat4(m_in[i], random_float(-3.1f, 3.1f), random_float(-1.5f, 1.5f), random_float(-3.1f, 3.1f));
+        m_in[i][get_index(4, 0, 3)] = (float)i;
+
+        /* Drift each rotation, and the last few badly */
+        drift = (i >= MATRICES - 3) ? 0.3f : 0.01f;
+        for (r = 0; r < 3; ++r) {
+            for (c = 0; c < 3; ++c) {
+                m_in[i][get_index(4, r, c)] += drift * random_float(-1.0f, 1.0f);
+                m3_in[i][get_index(3, r, c)] = m_in[i][get_index(4, r, c)];
+            }
+        }
+    }
+
+    for (m = 0; m < 2; ++m) {
+        ck_assert_uint_eq(lac_orthonormalize_mat4_array(m_out[m], (const mat4 *)m_in, MATRICES, modes[m]), 0);
+        for (i = 0; i < MATRICES; ++i) {
+            ck_assert_float_le(orthonormal_error(m_out[m][i], 4), 1e-5f);
+            ck_assert_float_le(distance_sq(m_out[m][i], m_in[i]), (i >= MATRICES - 3) ? 2.0f : 0.01f);
+
+            /* The translation and bottom row are left as they were */
+            ck_assert_float_eq(get_element(m_out[m][i], 0, 3), (float)i);
+            ck_assert_float_eq(get_element(m_out[m][i], 3, 0), 0.0f);
+            ck_assert_float_eq(get_element(m_out[m][i], 3, 3), 1.0f);
+        }
+
+        /* The 3x3 version gives the same results, here in place */
+        memcpy(m3_out, m3_in, sizeof(m3_in));
+        ck_assert_uint_eq(lac_orthonormalize_mat3_array(m3_out, (const mat3 *)m3_out, MATRICES, modes[m]), 0);
+        for (i = 0; i < MATRICES; ++i) {
+            for (r = 0; r < 3; ++r) {
+                for (c = 0; c < 3; ++c) {
+                    ck_assert_float_eq_tol(m3_out[i][get_index(3, r, c)], get_element(m_out[m][i], r, c), 1e-6f);
+                }
+            }
+        }
+    }
+
+    for (i = 0; i < MATRICES; ++i) {
+        /* Gram-Schmidt keeps the direction of the x axis */
+        cross = (get_element(m_in[i], 0, 0) * get_element(m_out[0][i], 1, 0)) - (get_element(m_in[i], 1, 0) * get_element(m_out[0][i], 0, 0));
+        ck_assert_float_eq_tol(cross, 0.0f, 1e-5f);
+
+        /* The symmetric correction finds the nearest orthonormal matrix */
+        ck_assert_float_le(distance_sq(m_out[1][i], m_in[i]), distance_sq(m_out[0][i], m_in[i]) + 1e-6f);
+    }
+}
+END_TEST
+
+START_TEST(OrthonormalizeSpecial) {
+    const LacOrthonormalizeMode_t modes[2] = { LAC_ORTHONORMALIZE_GRAM_SCHMIDT, LAC_ORTHONORMALIZE_SYMMETRIC };
+    mat4 m_in[3], m_out[3];
+    size_t m;
+
+    /* Rotations are left alone, reflections stay reflections, and singular matrices become the identity */
+    lac_get_rotation_mat4(m_in[0], 0.3f, -0.2f, 1.1f);
+    lac_get_reflection_mat4(m_in[1], true, false, false);
+    memset(m_in[2], 0, sizeof(mat4));
+
+    for (m = 0; m < 2; ++m) {
+        ck_assert_uint_eq(lac_orthonormalize_mat4_array(m_out, (const mat4 *)m_in, 3, modes[m]), 1);
+        ck_assert_float_le(distance_sq(m_out[0], m_in[0]), 1e-12f);
+        ck_assert_float_le(distance_sq(m_out[1], m_in[1]), 1e-12f);
+        ck_assert_float_le(distance_sq(m_out[2], lac_ident_mat4), 1e-12f);
+    }
+
+    /* Nothing is touched for an empty array */
+    ck_assert_uint_eq(lac_orthonormalize_mat3_array(NULL, NULL, 0, LAC_ORTHONORMALIZE_SYMMETRIC), 0);
+}
+END_TEST
+
+Suite *buffer_suite(void) {
+    Suite *s;
+    TCase *tc_core;
+
+    s = suite_create("Transform");
+
+    /* Core test cases */
+    tc_core = tcase_create("Core");
+    tcase_add_test(tc_core, DecomposeRoundTrip);
+    tcase_add_test(tc_core, DecomposeSpecial);
+    tcase_add_test(tc_core, Orthonormalize);
+    tcase_add_test(tc_core, OrthonormalizeSpecial);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+int main(void) {
+    int num_failed;
+    Suite *s;
+    SRunner *sr;
+
+    s = buffer_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    num_failed = srunner_ntests_failed(sr);
+    printf("%s\n", num_failed ? "At least one test failed" : "All tests passed");
+    srunner_free(sr);
+    return (!num_failed ? EXIT_SUCCESS : EXIT_FAILURE);
+}
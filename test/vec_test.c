@@ -137,6 +137,38 @@ START_TEST(VectorDivision) {
 }
 END_TEST
 
+START_TEST(VectorLerp) {
+    /*** 2 Element Vector ***/
+
+    vec2 v2_a = { 2, -4 }, v2_b = { 6, 4 };
+    vec2 v2_expected = { 3, -2 };
+    vec2 v2_actual = { 0 };
+
+    lac_lerp_vec2(v2_actual, v2_a, v2_b, 0.25f);
+    ck_assert_mem_eq(v2_actual, v2_expected, sizeof(vec2));
+
+    /*** 3 Element Vector ***/
+
+    vec3 v3_a = { 1, 2, 3 }, v3_b = { 3, 2, -1 };
+    vec3 v3_expected = { 5, 2, -5 };
+    vec3 v3_actual = { 0 };
+
+    /* Factors outside [0, 1] extrapolate */
+    lac_lerp_vec3(v3_actual, v3_a, v3_b, 2.0f);
+    ck_assert_mem_eq(v3_actual, v3_expected, sizeof(vec3));
+
+    /*** 4 Element Vector ***/
+
+    vec4 v4_a = { 10, 20, 30, 40 }, v4_b = { 20, 0, 30, 50 };
+    vec4 v4_actual = { 0 };
+
+    lac_lerp_vec4(v4_actual, v4_a, v4_b, 0.0f);
+    ck_assert_mem_eq(v4_actual, v4_a, sizeof(vec4));
+    lac_lerp_vec4(v4_actual, v4_a, v4_b, 1.0f);
+    ck_assert_mem_eq(v4_actual, v4_b, sizeof(vec4));
+}
+END_TEST
+
 START_TEST(DotProduct) {
     /*** 2 Element Vector ***/
 
@@ -274,6 +306,7 @@ Suite *buffer_suite(void) {
     tcase_add_test(tc_core, VectorSubtraction);
     tcase_add_test(tc_core, VectorMultiplication);
     tcase_add_test(tc_core, VectorDivision);
+    tcase_add_test(tc_core, VectorLerp);
     tcase_add_test(tc_core, DotProduct);
     tcase_add_test(tc_core, CrossProduct);
     tcase_add_test(tc_core, Magnitude);